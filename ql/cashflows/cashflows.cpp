@@ -29,6 +29,7 @@
 #include <quotes/simplequote.hpp>
 #include <termstructures/yield/flatforward.hpp>
 #include <termstructures/yield/zerospreadedtermstructure.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib {
@@ -419,6 +420,21 @@ namespace QuantLib {
             Real bps_ = 0.0, nonSensNPV_ = 0.0;
         };
 
+        // discount factors at the given times; the times of most legs
+        // are sorted, and are then discounted in a single batch
+        void discountFactors(const YieldTermStructure& discountCurve,
+                             const std::vector<Time>& times,
+                             std::vector<DiscountFactor>& discounts) {
+            discounts.resize(times.size());
+            if (std::is_sorted(times.begin(), times.end())) {
+                discountCurve.discounts(times.data(), discounts.data(),
+                                        times.size());
+            } else {
+                for (Size i=0; i<times.size(); ++i)
+                    discounts[i] = discountCurve.discount(times[i]);
+            }
+        }
+
         const Spread basisPoint_ = 1.0e-4;
     } // anonymous namespace ends here
 
@@ -437,12 +453,23 @@ namespace QuantLib {
         if (npvDate == Date())
             npvDate = settlementDate;
 
-        Real totalNPV = 0.0;
+        std::vector<Real> amounts;
+        std::vector<Time> times;
+        amounts.reserve(leg.size());
+        times.reserve(leg.size());
         for (const auto& i : leg) {
             if (!i->hasOccurred(settlementDate, includeSettlementDateFlows) &&
-                !i->tradingExCoupon(settlementDate))
-                totalNPV += i->amount() * discountCurve.discount(i->date());
+                !i->tradingExCoupon(settlementDate)) {
+                amounts.push_back(i->amount());
+                times.push_back(discountCurve.timeFromReference(i->date()));
+            }
         }
+        std::vector<DiscountFactor> discounts;
+        discountFactors(discountCurve, times, discounts);
+
+        Real totalNPV = 0.0;
+        for (Size i=0; i<amounts.size(); ++i)
+            totalNPV += amounts[i] * discounts[i];
 
         return totalNPV/discountCurve.discount(npvDate);
     }
@@ -488,18 +515,30 @@ namespace QuantLib {
         if (npvDate == Date())
             npvDate = settlementDate;
 
+        std::vector<Real> amounts, accruals;
+        std::vector<Time> times;
+        amounts.reserve(leg.size());
+        accruals.reserve(leg.size());
+        times.reserve(leg.size());
         for (const auto& i : leg) {
             CashFlow& cf = *i;
             if (!cf.hasOccurred(settlementDate,
                                 includeSettlementDateFlows) &&
                 !cf.tradingExCoupon(settlementDate)) {
                 ext::shared_ptr<Coupon> cp = ext::dynamic_pointer_cast<Coupon>(i);
-                Real df = discountCurve.discount(cf.date());
-                npv += cf.amount() * df;
-                if (cp != nullptr)
-                    bps += cp->nominal() * cp->accrualPeriod() * df;
+                amounts.push_back(cf.amount());
+                accruals.push_back(cp != nullptr ?
+                                   cp->nominal() * cp->accrualPeriod() : 0.0);
+                times.push_back(discountCurve.timeFromReference(cf.date()));
             }
         }
+        std::vector<DiscountFactor> discounts;
+        discountFactors(discountCurve, times, discounts);
+
+        for (Size i=0; i<amounts.size(); ++i) {
+            npv += amounts[i] * discounts[i];
+            bps += accruals[i] * discounts[i];
+        }
         DiscountFactor d = discountCurve.discount(npvDate);
         npv /= d;
         bps = basisPoint_ * bps / d;
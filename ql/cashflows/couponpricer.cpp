@@ -143,13 +143,13 @@ namespace QuantLib {
                 a = effStrike;
                 b = coupon_->indexFixing();
             }
-            return std::max(a - b, 0.0);
+            return std::max(a - b, Real(0.0));
         } else {
             // not yet determined, use Black model
             QL_REQUIRE(!capletVolatility().empty(),
                        "missing optionlet volatility");
             Real stdDev =
-                std::sqrt(capletVolatility()->blackVariance(fixingDate_,
+                sqrt(capletVolatility()->blackVariance(fixingDate_,
                                                             effStrike));
             Real shift = capletVolatility()->displacement();
             bool shiftedLn =
@@ -86,7 +86,7 @@ namespace QuantLib {
         QL_REQUIRE(index_, "no index provided");
         QL_REQUIRE(baseCPI_ != Null<Rate>() || baseDate != Date(),
                    "baseCPI and baseDate can not be both null, provide a valid baseCPI or baseDate");
-        QL_REQUIRE(baseCPI_ == Null<Rate>() || std::fabs(baseCPI_) > 1e-16,
+        QL_REQUIRE(baseCPI_ == Null<Rate>() || fabs(baseCPI_) > 1e-16,
                    "|baseCPI_| < 1e-16, future divide-by-zero problem");
     }
 
@@ -152,7 +152,7 @@ namespace QuantLib {
         QL_REQUIRE(
             baseFixing_ != Null<Rate>() || baseDate != Date(),
             "baseCPI and baseDate can not be both null, provide a valid baseCPI or baseDate");
-        QL_REQUIRE(baseFixing_ == Null<Rate>() || std::fabs(baseFixing_) > 1e-16,
+        QL_REQUIRE(baseFixing_ == Null<Rate>() || fabs(baseFixing_) > 1e-16,
                    "|baseCPI_| < 1e-16, future divide-by-zero problem");
     }
 
@@ -28,6 +28,7 @@
 #include <indexes/iborindex.hpp>
 #include <instruments/vanillaswap.hpp>
 #include <instruments/overnightindexedswap.hpp>
+#include <math/integrals/gaussianquadratures.hpp>
 #include <math/integrals/kronrodintegral.hpp>
 #include <math/solvers1d/brent.hpp>
 #include <pricingengines/blackformula.hpp>
@@ -66,15 +67,18 @@ namespace QuantLib {
         if (integrator_ == nullptr)
             integrator_ =
                 ext::make_shared<GaussKronrodNonAdaptive>(1E-10, 5000, 1E-10);
+
+        if (auto gl = ext::dynamic_pointer_cast<GaussLegendreIntegrator>(integrator_))
+            gaussLegendre_ = gl->getIntegration();
     }
 
     Real LinearTsrPricer::GsrG(const Date &d) const {
 
         Real yf = volDayCounter_.yearFraction(fixingDate_, d);
-        if (std::fabs(meanReversion_->value()) < 1.0E-4)
+        if (fabs(meanReversion_->value()) < 1.0E-4)
             return yf;
         else
-            return (1.0 - std::exp(-meanReversion_->value() * yf)) /
+            return (1.0 - exp(-meanReversion_->value() * yf)) /
                    meanReversion_->value();
     }
 
@@ -82,7 +86,7 @@ namespace QuantLib {
                                         const Real strike) const {
 
         Real omega = (type == Option::Call ? 1.0 : -1.0);
-        Real s1 = std::max(omega * (swapRateValue_ - strike), 0.0) *
+        Real s1 = std::max(omega * (swapRateValue_ - strike), Real(0.0)) *
                   (a_ * swapRateValue_ + b_);
         Real s2 = (a_ * strike + b_) *
                   smileSection_->optionPrice(strike, strike < swapRateValue_
@@ -97,6 +101,30 @@ namespace QuantLib {
                                                               : Option::Call);
     }
 
+    Real LinearTsrPricer::integral(const Option::Type type,
+                                   const Real lower,
+                                   const Real upper) const {
+        if (gaussLegendre_ == nullptr)
+            return (*integrator_)(integrand_f(this), lower, upper);
+
+        // the nodes are fixed, so that the option prices can be
+        // computed on all of them at once; the interval lies on one
+        // side of the swap rate, so the option type doesn't change
+        const Array& x = gaussLegendre_->x();
+        const Array& w = gaussLegendre_->weights();
+        const Real c1 = 0.5 * (upper - lower);
+        const Real c2 = 0.5 * (upper + lower);
+        std::vector<Real> strikes(x.size()), prices(x.size());
+        for (Size i = 0; i < x.size(); ++i)
+            strikes[i] = c1 * x[i] + c2;
+        smileSection_->optionPrices(strikes.data(), prices.data(),
+                                    strikes.size(), type);
+        Real sum = 0.0;
+        for (Integer i = Integer(x.size()) - 1; i >= 0; --i)
+            sum += w[i] * 2.0 * a_ * prices[i];
+        return c1 * sum;
+    }
+
     void LinearTsrPricer::initialize(const FloatingRateCoupon &coupon) {
 
         coupon_ = dynamic_cast<const CmsCoupon *>(&coupon);
@@ -152,7 +180,7 @@ namespace QuantLib {
                 swap_ = swapIndex_->underlyingSwap(fixingDate_);
             }
             swapRateValue_ = swap_->fairRate();
-            annuity_ = 1.0E4 * std::fabs(swap_->fixedLegBPS());
+            annuity_ = 1.0E4 * fabs(swap_->fixedLegBPS());
             Leg swapFixedLeg = swap_->fixedLeg();
 
             ext::shared_ptr<SmileSection> sectionTmp =
@@ -322,18 +350,18 @@ namespace QuantLib {
             Real lowerTmp, upperTmp;
             if (smileSection_->volatilityType() == ShiftedLognormal) {
                 upperTmp = (atm + shift) *
-                               std::exp(settings_.stdDevs_ * atmVol -
+                               exp(settings_.stdDevs_ * atmVol -
                                         0.5 * atmVol * atmVol *
                                             smileSection_->exerciseTime()) -
                            shift;
                 lowerTmp = (atm + shift) *
-                               std::exp(-settings_.stdDevs_ * atmVol -
+                               exp(-settings_.stdDevs_ * atmVol -
                                         0.5 * atmVol * atmVol *
                                             smileSection_->exerciseTime()) -
                            shift;
             } else {
                 Real tmp = settings_.stdDevs_ * atmVol *
-                           std::sqrt(smileSection_->exerciseTime());
+                           sqrt(smileSection_->exerciseTime());
                 upperTmp = atm + tmp;
                 lowerTmp = atm - tmp;
             }
@@ -353,13 +381,11 @@ namespace QuantLib {
         if (upper > lower) {
             tmpBound = std::min(upper, swapRateValue_);
             if (tmpBound > lower) {
-                result += (*integrator_)(integrand_f(this),
-                                         lower, tmpBound);
+                result += integral(Option::Put, lower, tmpBound);
             }
             tmpBound = std::max(lower, swapRateValue_);
             if (upper > tmpBound) {
-                result += (*integrator_)(integrand_f(this),
-                                         tmpBound, upper);
+                result += integral(Option::Call, tmpBound, upper);
             }
             result *= (optionType == Option::Call ? 1.0 : -1.0);
         }
@@ -382,7 +408,7 @@ namespace QuantLib {
         if (fixingDate_ <= today_) {
             // the fixing is determined
             const Rate Rs = std::max(
-                coupon_->swapIndex()->fixing(fixingDate_) - effectiveCap, 0.);
+                coupon_->swapIndex()->fixing(fixingDate_) - effectiveCap, Rate(0.0));
             Rate price = (gearing_ * Rs) * (coupon_->accrualPeriod() *
                                             discountCurvePaymentDiscount_ * couponDiscountRatio_);
             return price;
@@ -402,7 +428,7 @@ namespace QuantLib {
         if (fixingDate_ <= today_) {
             // the fixing is determined
             const Rate Rs = std::max(
-                effectiveFloor - coupon_->swapIndex()->fixing(fixingDate_), 0.);
+                effectiveFloor - coupon_->swapIndex()->fixing(fixingDate_), Rate(0.0));
             Rate price = (gearing_ * Rs) * (coupon_->accrualPeriod() *
                                             discountCurvePaymentDiscount_ * couponDiscountRatio_);
             return price;
@@ -34,6 +34,7 @@
 namespace QuantLib {
 
     class CmsCoupon;
+    class GaussLegendreIntegration;
     class YieldTermStructure;
 
     //! CMS-coupon pricer
@@ -59,6 +60,9 @@ namespace QuantLib {
         Note that for normal volatility input the lower rate bound
         is adjusted to min(-upperBound, lowerBound), except the bounds
         are set explicitly.
+        If the integrator is a GaussLegendreIntegrator, the smile
+        section is evaluated on all the nodes of an integration
+        interval at once through SmileSection::optionPrices().
     */
 
     class LinearTsrPricer : public CmsCouponPricer, public MeanRevertingPricer {
@@ -187,6 +191,7 @@ namespace QuantLib {
         Real GsrG(const Date &d) const;
         Real singularTerms(Option::Type type, Real strike) const;
         Real integrand(Real strike) const;
+        Real integral(Option::Type type, Real lower, Real upper) const;
         Real a_, b_;
 
         class integrand_f;
@@ -244,6 +249,7 @@ namespace QuantLib {
         Settings settings_;
         DayCounter volDayCounter_;
         ext::shared_ptr<Integrator> integrator_;
+        ext::shared_ptr<GaussLegendreIntegration> gaussLegendre_;
 
         Real adjustedLowerBound_, adjustedUpperBound_;
     };
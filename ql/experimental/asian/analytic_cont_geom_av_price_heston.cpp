@@ -36,7 +36,7 @@ namespace QuantLib {
                   Real K,
                   const AnalyticContinuousGeometricAveragePriceAsianHestonEngine* const parent,
                   Real xiRightLimit)
-        : T_(T), K_(K), logK_(std::log(K)), cutoff_(cutoff), parent_(parent),
+        : T_(T), K_(K), logK_(log(K)), cutoff_(cutoff), parent_(parent),
           xiRightLimit_(xiRightLimit), i_(std::complex<Real>(0.0, 1.0)) {}
 
         Real operator()(Real xi) const {
@@ -45,7 +45,7 @@ namespace QuantLib {
             std::complex<Real> inner1 = parent_->Phi(1.0 + xiDash*i_, 0, T_, t_, cutoff_);
             std::complex<Real> inner2 = - K_*parent_->Phi(xiDash*i_, 0, T_, t_, cutoff_);
 
-            return 0.5*xiRightLimit_*std::real((inner1 + inner2) * std::exp(-xiDash*logK_*i_) / (xiDash*i_));
+            return 0.5*xiRightLimit_*std::real((inner1 + inner2) * exp(-xiDash*logK_*i_) / (xiDash*i_));
         }
     };
 
@@ -61,13 +61,13 @@ namespace QuantLib {
                      Handle<YieldTermStructure> dividendYield)
         : t_(t), T_(T), riskFreeRate_(std::move(riskFreeRate)),
           dividendYield_(std::move(dividendYield)) {
-            denominator_ = std::log(riskFreeRate_->discount(t_)) - std::log(dividendYield_->discount(t_));
+            denominator_ = log(riskFreeRate_->discount(t_)) - log(dividendYield_->discount(t_));
         }
 
         Real operator()(Real u) const {
             Real uDash = (0.5+1e-8+0.5*u) * (T_ - t_) + t_; // Map u to full range
-            return 0.5*(T_ - t_)*(-std::log(riskFreeRate_->discount(uDash))
-                               + std::log(dividendYield_->discount(uDash)) + denominator_);
+            return 0.5*(T_ - t_)*(-log(riskFreeRate_->discount(uDash))
+                               + log(dividendYield_->discount(uDash)) + denominator_);
         }
     };
 
@@ -202,7 +202,7 @@ namespace QuantLib {
         F = temp.first;
         F_tilde = temp.second;
 
-        return std::exp(-a1_*F_tilde/F - a2_*std::log(F) + a3_*s + a4_*w + a5_);
+        return exp(-a1_*F_tilde/F - a2_*log(F) + a3_*s + a4_*w + a5_);
     }
 
     void AnalyticContinuousGeometricAveragePriceAsianHestonEngine::calculate() const {
@@ -232,7 +232,7 @@ namespace QuantLib {
         Time t = startTime;
         Time T = expiryTime;
         Time tau = T - t;
-        Real logS0 = std::log(s0_->value());
+        Real logS0 = log(s0_->value());
 
         // To deal with non-constant rates and dividends, we reformulate Eq.s (14) to (17) with
         // r_ --> (r(t) - q(t)), which gives the new expressions for a3 and a4 used below
@@ -41,7 +41,7 @@ namespace QuantLib {
                   Real K,
                   const AnalyticDiscreteGeometricAveragePriceAsianHestonEngine* const parent,
                   Real xiRightLimit)
-        : t_(t), T_(T), K_(K), logK_(std::log(K)), kStar_(kStar), t_n_(std::move(t_n)),
+        : t_(t), T_(T), K_(K), logK_(log(K)), kStar_(kStar), t_n_(std::move(t_n)),
           tauK_(std::move(tauK)), parent_(parent), xiRightLimit_(xiRightLimit),
           i_(std::complex<Real>(0.0, 1.0)) {}
 
@@ -51,7 +51,7 @@ namespace QuantLib {
             std::complex<Real> inner1 = parent_->Phi(1.0 + xiDash*i_, 0, t_, T_, kStar_, t_n_, tauK_);
             std::complex<Real> inner2 = -K_*parent_->Phi(xiDash*i_, 0, t_, T_, kStar_, t_n_, tauK_);
 
-            return 0.5*xiRightLimit_*std::real((inner1 + inner2) * std::exp(-xiDash*logK_*i_) / (xiDash*i_));
+            return 0.5*xiRightLimit_*std::real((inner1 + inner2) * exp(-xiDash*logK_*i_) / (xiDash*i_));
         }
     };
 
@@ -68,7 +68,7 @@ namespace QuantLib {
         theta_ = process_->theta();
         sigma_ = process_->sigma();
         s0_ = process_->s0();
-        logS0_ = std::log(s0_->value());
+        logS0_ = log(s0_->value());
 
         riskFreeRate_ = process_->riskFreeRate();
         dividendYield_ = process_->dividendYield();
@@ -78,8 +78,8 @@ namespace QuantLib {
             const std::complex<Real>& z1,
             const std::complex<Real>& z2,
             Time tau) const {
-        std::complex<Real> temp = std::sqrt(kappa_*kappa_-2.0*z1*sigma_*sigma_);
-        if (std::abs(kappa_*kappa_-2.0*sigma_*sigma_) < 1e-8) {
+        std::complex<Real> temp = sqrt(kappa_*kappa_-2.0*z1*sigma_*sigma_);
+        if (abs(kappa_*kappa_-2.0*sigma_*sigma_) < 1e-8) {
             return 1.0 + 0.5*(kappa_-z2*sigma_*sigma_);
         } else {
             return cosh(0.5*tau*temp) + (kappa_-z2*sigma_*sigma_)*sinh(0.5*tau*temp)/temp;
@@ -90,7 +90,7 @@ namespace QuantLib {
             const std::complex<Real>& z1,
             const std::complex<Real>& z2,
             Time tau) const {
-        std::complex<Real> temp = std::sqrt(kappa_*kappa_ - 2.0*z1*sigma_*sigma_);
+        std::complex<Real> temp = sqrt(kappa_*kappa_ - 2.0*z1*sigma_*sigma_);
         return 0.5*temp*sinh(0.5*tau*temp) + 0.5*(kappa_ - z2*sigma_*sigma_)*cosh(0.5*tau*temp);
     }
 
@@ -192,11 +192,11 @@ namespace QuantLib {
             std::complex<Real> z_k = z(s, w, i, n);
             std::complex<Real> omega_tilde_k = omega_tilde(s, w, i, kStar, n, tauK);
 
-            summation += std::log(F(z_k, omega_tilde_k, dTau));
+            summation += log(F(z_k, omega_tilde_k, dTau));
         }
         std::complex<Real> term4 = 2*kappa_*theta_*summation/pow(sigma_,2);
 
-        return std::exp(aTerm + omegaTerm + term3 - term4);
+        return exp(aTerm + omegaTerm + term3 - term4);
 }
 
     void AnalyticDiscreteGeometricAveragePriceAsianHestonEngine::calculate() const {
@@ -214,7 +214,7 @@ namespace QuantLib {
             QL_REQUIRE(arguments_.runningAccumulator>0.0,
                        "positive running product required: "
                        << arguments_.runningAccumulator << " not allowed");
-            runningLog = std::log(arguments_.runningAccumulator);
+            runningLog = log(arguments_.runningAccumulator);
             pastFixings = arguments_.pastFixings;
         } else {  // it is being used as control variate
             runningLog = 0.0;
@@ -260,19 +260,19 @@ namespace QuantLib {
         tr_t_ = 0;
         Tr_T_ = 0;
         tkr_tk_ = std::vector<Real>();
-        tr_t_ = -std::log(riskFreeRate_->discount(startTime) / dividendYield_->discount(startTime));
-        Tr_T_ = -std::log(riskFreeRate_->discount(expiryTime) / dividendYield_->discount(expiryTime));
+        tr_t_ = -log(riskFreeRate_->discount(startTime) / dividendYield_->discount(startTime));
+        Tr_T_ = -log(riskFreeRate_->discount(expiryTime) / dividendYield_->discount(expiryTime));
         for (Real fixingTime : fixingTimes) {
             if (fixingTime < 0) {
                 tkr_tk_.push_back(1.0);
             } else {
-                tkr_tk_.push_back(-std::log(riskFreeRate_->discount(fixingTime) /
+                tkr_tk_.push_back(-log(riskFreeRate_->discount(fixingTime) /
                                             dividendYield_->discount(fixingTime)));
             }
         }
 
         // To account for seasoning, we need to calculate an 'adjusted' strike (Eq 6)
-        Real prefactor = std::exp(runningLog / fixingTimes.size());
+        Real prefactor = exp(runningLog / fixingTimes.size());
         Real adjustedStrike = strike / prefactor;
 
         // Calculate the two terms in eq (23) - Phi(1,0) is real (asian forward) but need to type convert
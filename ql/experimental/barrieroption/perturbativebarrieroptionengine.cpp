@@ -36,9 +36,9 @@ namespace {
     inline QuantLib::Real SIGN(const QuantLib::Real& a, const QuantLib::Real& b) 
     {
         if (b > 0.0) 
-            return std::fabs(a);
+            return fabs(a);
         else
-            return -std::fabs(a);
+            return -fabs(a);
     }
 
 }
@@ -147,8 +147,8 @@ namespace QuantLib {
         e3=PHID(d3);
         e4=PHID(d4);
 
-        v0=kprice*e1-kprice*std::pow(s0,(1.0-gm))*e2;
-        v0=v0+exp(gm*0.5*sigmat)*(-hbarr*s0*e3+hbarr*std::pow(s0,-gm)*e4);
+        v0=kprice*e1-kprice*pow(s0,(1.0-gm))*e2;
+        v0=v0+exp(gm*0.5*sigmat)*(-hbarr*s0*e3+hbarr*pow(s0,-gm)*e4);
         v0=v0*exp(disc);
 
         if(iord==0) return v0;
@@ -171,7 +171,7 @@ namespace QuantLib {
         x=log(s0);
         et=exp(0.5*(1.0-gm)*x);
 
-        dsqpi=std::pow(pi,0.5);
+        dsqpi=pow(pi,0.5);
 
         v1=0.0;
         for( i=1;i<=npoint;i++) {
@@ -388,9 +388,9 @@ namespace QuantLib {
         Real aa, caux;
         Real ppi= 3.14159265358979324;
 
-        aa=-(b*p-b*tt+a)/std::pow(2.0*(tt-p),0.5);
+        aa=-(b*p-b*tt+a)/pow(2.0*(tt-p),0.5);
 
-        caux=2.0*std::pow(ppi,0.5)*PHID(aa);
+        caux=2.0*pow(ppi,0.5)*PHID(aa);
         aa=b*b-(1.0-gm)*(1.0-gm);
         aa=aa/4.0;
         phid=exp(-0.5*a*b)*exp(aa*(tt-p))*caux;
@@ -408,10 +408,10 @@ namespace QuantLib {
         Real result;
         Real aa,caux;
 
-        aa=-(p*(a-b)+b*tt)/std::pow(2.0*p*tt*(tt-p),0.5);
+        aa=-(p*(a-b)+b*tt)/pow(2.0*p*tt*(tt-p),0.5);
         caux=PHID(aa);
 
-        aa=exp(std::pow((a-b),2)/(4.0*tt))*exp(std::pow((1.0-gm),2)*tt/4.0)*std::pow(tt,0.5);
+        aa=exp(pow((a-b),2)/(4.0*tt))*exp(pow((1.0-gm),2)*tt/4.0)*pow(tt,0.5);
         result=caux/aa;
 
         return(result);
@@ -428,14 +428,14 @@ namespace QuantLib {
         Real ppi= 3.14159265358979324;
         Real aa;
 
-        xx=(-a+b*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        yy=(-a+b*tt+c)/std::pow(2.0*tt,0.5);
-        rho=std::pow((tt-p)/tt,0.5);
+        xx=(-a+b*(tt-p))/pow(2.0*(tt-p),0.5);
+        yy=(-a+b*tt+c)/pow(2.0*tt,0.5);
+        rho=pow((tt-p)/tt,0.5);
         aa=b*b-(1.0-gm)*(1.0-gm);
         aa=aa/4.0;
         caux=ND2(-xx,-yy,rho);
 
-        bvnd=2.0*std::pow(ppi,0.5)*exp(-a*b*0.5)*exp(aa*(tt-p))*caux;
+        bvnd=2.0*pow(ppi,0.5)*exp(-a*b*0.5)*exp(aa*(tt-p))*caux;
         return(bvnd);
     }
 
@@ -459,27 +459,27 @@ namespace QuantLib {
         Real aa,caux,caux1,caux2;
         Real xx,yy,rho;
 
-        aa=(a*p+b*(tt-p))/std::pow(2.0*p*tt*(tt-p),0.5);
+        aa=(a*p+b*(tt-p))/pow(2.0*p*tt*(tt-p),0.5);
         caux=PHID(aa);
 
-        aa=exp((a-b)*(a-b)/(4.0*tt))*exp(std::pow((1.0-gm),2)*tt/4.0)*std::pow(tt,0.5);
+        aa=exp((a-b)*(a-b)/(4.0*tt))*exp(pow((1.0-gm),2)*tt/4.0)*pow(tt,0.5);
         caux=-caux/aa;
 
-        xx=(a*p+b*(tt-p))/std::pow(2.0*tt*p*(tt-p),0.5);
-        yy=(a*s+b*(tt-s))/std::pow(2.0*tt*s*(tt-s),0.5);
-        rho=std::pow((s*(tt-p))/(p*(tt-s)),0.5);
+        xx=(a*p+b*(tt-p))/pow(2.0*tt*p*(tt-p),0.5);
+        yy=(a*s+b*(tt-s))/pow(2.0*tt*s*(tt-s),0.5);
+        rho=pow((s*(tt-p))/(p*(tt-s)),0.5);
         caux1=ND2(-xx,-yy,rho);
         caux1=caux1/aa;
 
 
-        aa=exp((a+b)*(a+b)/(4.0*tt))*exp(std::pow((1.0-gm),2)*tt/4.0)*std::pow(tt,0.5);
+        aa=exp((a+b)*(a+b)/(4.0*tt))*exp(pow((1.0-gm),2)*tt/4.0)*pow(tt,0.5);
 
-        xx=(a*p-b*(tt-p))/std::pow(2.0*tt*p*(tt-p),0.5);
-        yy=(a*s-b*(tt-s))/std::pow(2.0*tt*s*(tt-s),0.5);
-        rho=std::pow((s*(tt-p))/(p*(tt-s)),0.5);
+        xx=(a*p-b*(tt-p))/pow(2.0*tt*p*(tt-p),0.5);
+        yy=(a*s-b*(tt-s))/pow(2.0*tt*s*(tt-s),0.5);
+        rho=pow((s*(tt-p))/(p*(tt-s)),0.5);
         caux2=ND2(-xx,-yy,rho);
         caux2=caux2/aa;
-        result=(caux+caux1+caux2)/(2.0*std::pow(ppi,0.5));
+        result=(caux+caux1+caux2)/(2.0*pow(ppi,0.5));
         return(result);
     }
 
@@ -494,18 +494,18 @@ namespace QuantLib {
         Real aa,caux,caux1,caux2;
         Real xx,yy,rho;
 
-        xx=(a-b*(tt-p))/std::pow(2.0*(tt-p),0.5);
+        xx=(a-b*(tt-p))/pow(2.0*(tt-p),0.5);
         caux=-PHID(xx)*exp(-0.5*a*b);
 
-        xx=(a+b*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        yy=(a+b*(tt-s))/std::pow(2.0*(tt-s),0.5);
-        rho=std::pow((tt-p)/(tt-s),0.5);
+        xx=(a+b*(tt-p))/pow(2.0*(tt-p),0.5);
+        yy=(a+b*(tt-s))/pow(2.0*(tt-s),0.5);
+        rho=pow((tt-p)/(tt-s),0.5);
         caux1=ND2(-xx,-yy,rho);
         caux1=exp(0.5*a*b)*caux1;
 
-        xx=(a-b*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        yy=(a-b*(tt-s))/std::pow(2.0*(tt-s),0.5);
-        rho=std::pow((tt-p)/(tt-s),0.5);
+        xx=(a-b*(tt-p))/pow(2.0*(tt-p),0.5);
+        yy=(a-b*(tt-s))/pow(2.0*(tt-s),0.5);
+        rho=pow((tt-p)/(tt-s),0.5);
         caux2=ND2(-xx,-yy,rho);
         caux2=exp(-0.5*a*b)*caux2;
 
@@ -528,21 +528,21 @@ namespace QuantLib {
         Real sigmarho[4],limit[4],epsi;
 
         epsi=1.e-12;
-        limit[1]=(a+b*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        limit[2]=(a+b*(tt-s))/std::pow(2.0*(tt-s),0.5);
-        limit[3]=(a+b*tt+c)/std::pow(2.0*tt,0.5);
-        sigmarho[1]=std::pow((tt-p)/(tt-s),0.5);
-        sigmarho[2]=std::pow((tt-p)/tt,0.5);
-        sigmarho[3]=std::pow((tt-s)/tt,0.5);
+        limit[1]=(a+b*(tt-p))/pow(2.0*(tt-p),0.5);
+        limit[2]=(a+b*(tt-s))/pow(2.0*(tt-s),0.5);
+        limit[3]=(a+b*tt+c)/pow(2.0*tt,0.5);
+        sigmarho[1]=pow((tt-p)/(tt-s),0.5);
+        sigmarho[2]=pow((tt-p)/tt,0.5);
+        sigmarho[3]=pow((tt-s)/tt,0.5);
 
         caux=exp(0.5*a*b)*tvtl(0,limit,sigmarho,epsi);
 
-        limit[1]=(a-b*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        limit[2]=(-a+b*(tt-s))/std::pow(2.0*(tt-s),0.5);
-        limit[3]=(-a+b*tt+c)/std::pow(2.0*tt,0.5);
-        sigmarho[1]=-std::pow((tt-p)/(tt-s),0.5);
-        sigmarho[2]=-std::pow((tt-p)/tt,0.5);
-        sigmarho[3]=std::pow((tt-s)/tt,0.5);
+        limit[1]=(a-b*(tt-p))/pow(2.0*(tt-p),0.5);
+        limit[2]=(-a+b*(tt-s))/pow(2.0*(tt-s),0.5);
+        limit[3]=(-a+b*tt+c)/pow(2.0*tt,0.5);
+        sigmarho[1]=-pow((tt-p)/(tt-s),0.5);
+        sigmarho[2]=-pow((tt-p)/tt,0.5);
+        sigmarho[3]=pow((tt-s)/tt,0.5);
 
         caux1=-exp(-0.5*a*b)*tvtl(0,limit,sigmarho,epsi);
 
@@ -566,40 +566,40 @@ namespace QuantLib {
         Real result;
         double ppi= 3.14159265358979324;
 
-        xx=(a-b*(tt-p))/std::pow(2.0*(tt-p),0.5);
+        xx=(a-b*(tt-p))/pow(2.0*(tt-p),0.5);
         caux=PHID(xx)*exp(-0.5*a*b);
 
-        xx=(a+b*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        yy=(a+b*(tt-s))/std::pow(2.0*(tt-s),0.5);
-        rho=std::pow((tt-p)/(tt-s),0.5);
+        xx=(a+b*(tt-p))/pow(2.0*(tt-p),0.5);
+        yy=(a+b*(tt-s))/pow(2.0*(tt-s),0.5);
+        rho=pow((tt-p)/(tt-s),0.5);
         caux1=ND2(-xx,-yy,rho);
         caux1=exp(0.5*a*b)*caux1;
 
-        xx=(a-b*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        yy=(a-b*(tt-s))/std::pow(2.0*(tt-s),0.5);
-        rho=std::pow((tt-p)/(tt-s),0.5);
+        xx=(a-b*(tt-p))/pow(2.0*(tt-p),0.5);
+        yy=(a-b*(tt-s))/pow(2.0*(tt-s),0.5);
+        rho=pow((tt-p)/(tt-s),0.5);
         caux2=ND2(-xx,-yy,rho);
         caux2=-exp(-0.5*a*b)*caux2;
 
         caux=0.5*b*(caux+caux1+caux2);
 
-        xx=(a+b*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        yy=b*std::pow((p-s),0.5)/std::pow(2.0,0.5);
-        caux1=exp(-0.5*xx*xx)*exp(0.5*a*b)*PHID(yy)/(2.0*std::pow(ppi*(tt-p),0.5));
+        xx=(a+b*(tt-p))/pow(2.0*(tt-p),0.5);
+        yy=b*pow((p-s),0.5)/pow(2.0,0.5);
+        caux1=exp(-0.5*xx*xx)*exp(0.5*a*b)*PHID(yy)/(2.0*pow(ppi*(tt-p),0.5));
 
 
-        xx=(a+b*(tt-s))/std::pow(2.0*(tt-s),0.5);
-        yy=a*std::pow((p-s),0.5)/std::pow(2.0*(tt-p)*(tt-s),0.5);
-        caux2=exp(-0.5*xx*xx)*exp(0.5*a*b)*PHID(yy)/(2.0*std::pow(ppi*(tt-s),0.5));
+        xx=(a+b*(tt-s))/pow(2.0*(tt-s),0.5);
+        yy=a*pow((p-s),0.5)/pow(2.0*(tt-p)*(tt-s),0.5);
+        caux2=exp(-0.5*xx*xx)*exp(0.5*a*b)*PHID(yy)/(2.0*pow(ppi*(tt-s),0.5));
 
-        xx=(a-b*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        yy=b*std::pow((p-s),0.5)/std::pow(2.0,0.5);
-        caux3=-exp(-0.5*xx*xx)*exp(-0.5*a*b)*PHID(yy)/(2.0*std::pow(ppi*(tt-p),0.5));
+        xx=(a-b*(tt-p))/pow(2.0*(tt-p),0.5);
+        yy=b*pow((p-s),0.5)/pow(2.0,0.5);
+        caux3=-exp(-0.5*xx*xx)*exp(-0.5*a*b)*PHID(yy)/(2.0*pow(ppi*(tt-p),0.5));
 
 
-        xx=(a-b*(tt-s))/std::pow(2.0*(tt-s),0.5);
-        yy=a*std::pow((p-s),0.5)/std::pow(2.0*(tt-p)*(tt-s),0.5);
-        caux4=exp(-0.5*xx*xx)*exp(-0.5*a*b)*PHID(yy)/(2.0*std::pow(ppi*(tt-s),0.5));
+        xx=(a-b*(tt-s))/pow(2.0*(tt-s),0.5);
+        yy=a*pow((p-s),0.5)/pow(2.0*(tt-p)*(tt-s),0.5);
+        caux4=exp(-0.5*xx*xx)*exp(-0.5*a*b)*PHID(yy)/(2.0*pow(ppi*(tt-s),0.5));
 
 
 
@@ -624,45 +624,45 @@ namespace QuantLib {
         Real epsi;
 
         epsi=1.e-12;
-        limit[1]=(ax+bx*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        limit[2]=(ax+bx*(tt-s))/std::pow(2.0*(tt-s),0.5);
-        limit[3]=(ax+bx*tt+c)/std::pow(2.0*tt,0.5);
-        sigmarho[1]=std::pow((tt-p)/(tt-s),0.5);
-        sigmarho[2]=std::pow((tt-p)/tt,0.5);
-        sigmarho[3]=std::pow((tt-s)/tt,0.5);
+        limit[1]=(ax+bx*(tt-p))/pow(2.0*(tt-p),0.5);
+        limit[2]=(ax+bx*(tt-s))/pow(2.0*(tt-s),0.5);
+        limit[3]=(ax+bx*tt+c)/pow(2.0*tt,0.5);
+        sigmarho[1]=pow((tt-p)/(tt-s),0.5);
+        sigmarho[2]=pow((tt-p)/tt,0.5);
+        sigmarho[3]=pow((tt-s)/tt,0.5);
 
         caux=0.5*bx*tvtl(0,limit,sigmarho,epsi);
 
 
         idx=1;
-        caux=caux+derivn3(limit,sigmarho,idx)/std::pow(2.0*(tt-p),0.5);
+        caux=caux+derivn3(limit,sigmarho,idx)/pow(2.0*(tt-p),0.5);
 
         idx=2;
-        caux=caux+derivn3(limit,sigmarho,idx)/std::pow(2.0*(tt-s),0.5);
+        caux=caux+derivn3(limit,sigmarho,idx)/pow(2.0*(tt-s),0.5);
 
         idx=3;
-        caux=caux+derivn3(limit,sigmarho,idx)/std::pow(2.0*tt,0.5);
+        caux=caux+derivn3(limit,sigmarho,idx)/pow(2.0*tt,0.5);
 
         caux=exp(0.5*ax*bx)*caux;
 
-        limit[1]=(ax-bx*(tt-p))/std::pow(2.0*(tt-p),0.5);
-        limit[2]=(-ax+bx*(tt-s))/std::pow(2.0*(tt-s),0.5);
-        limit[3]=(-ax+bx*tt+c)/std::pow(2.0*tt,0.5);
-        sigmarho[1]=-std::pow((tt-p)/(tt-s),0.5);
-        sigmarho[2]=-std::pow((tt-p)/tt,0.5);
-        sigmarho[3]=std::pow((tt-s)/tt,0.5);
+        limit[1]=(ax-bx*(tt-p))/pow(2.0*(tt-p),0.5);
+        limit[2]=(-ax+bx*(tt-s))/pow(2.0*(tt-s),0.5);
+        limit[3]=(-ax+bx*tt+c)/pow(2.0*tt,0.5);
+        sigmarho[1]=-pow((tt-p)/(tt-s),0.5);
+        sigmarho[2]=-pow((tt-p)/tt,0.5);
+        sigmarho[3]=pow((tt-s)/tt,0.5);
 
         caux1=0.5*bx*tvtl(0,limit,sigmarho,epsi);
 
         idx=1;
-        caux1=caux1-derivn3(limit,sigmarho,idx)/std::pow(2.0*(tt-p),0.5);
+        caux1=caux1-derivn3(limit,sigmarho,idx)/pow(2.0*(tt-p),0.5);
 
         idx=2;
-        caux1=caux1+derivn3(limit,sigmarho,idx)/std::pow(2.0*(tt-s),0.5);
+        caux1=caux1+derivn3(limit,sigmarho,idx)/pow(2.0*(tt-s),0.5);
 
 
         idx=3;
-        caux1=caux1+derivn3(limit,sigmarho,idx)/std::pow(2.0*tt,0.5);
+        caux1=caux1+derivn3(limit,sigmarho,idx)/pow(2.0*tt,0.5);
 
         caux1=exp(-0.5*ax*bx)*caux1;
 
@@ -686,54 +686,54 @@ namespace QuantLib {
         static Real xx,yy,rho;
         static double ppi= 3.14159265358979324;
 
-        aa=(a*p+b*(tt-p))/std::pow(2.0*p*tt*(tt-p),0.5);
+        aa=(a*p+b*(tt-p))/pow(2.0*p*tt*(tt-p),0.5);
         caux=PHID(aa);
 
         aa=exp(-(a-b)*(a-b)/(4.0*tt))/tt;
 
         caux=0.5*aa*caux*(a-b);
 
-        xx=(a*p+b*(tt-p))/std::pow(2.0*tt*p*(tt-p),0.5);
-        yy=(a*s+b*(tt-s))/std::pow(2.0*tt*s*(tt-s),0.5);
-        rho=std::pow((s*(tt-p))/(p*(tt-s)),0.5);
+        xx=(a*p+b*(tt-p))/pow(2.0*tt*p*(tt-p),0.5);
+        yy=(a*s+b*(tt-s))/pow(2.0*tt*s*(tt-s),0.5);
+        rho=pow((s*(tt-p))/(p*(tt-s)),0.5);
         caux1=ND2(-xx,-yy,rho);
         caux1=-0.5*aa*caux1*(a-b);
 
 
         aa=exp(-(a+b)*(a+b)/(4.0*tt))/tt;
 
-        xx=(a*p-b*(tt-p))/std::pow(2.0*tt*p*(tt-p),0.5);
-        yy=(a*s-b*(tt-s))/std::pow(2.0*tt*s*(tt-s),0.5);
-        rho=std::pow((s*(tt-p))/(p*(tt-s)),0.5);
+        xx=(a*p-b*(tt-p))/pow(2.0*tt*p*(tt-p),0.5);
+        yy=(a*s-b*(tt-s))/pow(2.0*tt*s*(tt-s),0.5);
+        rho=pow((s*(tt-p))/(p*(tt-s)),0.5);
         caux2=ND2(-xx,-yy,rho);
         caux2=-0.5*aa*caux2*(a+b);
 
-        aa=-b*std::pow((p-s)/std::pow(2.0*p*s,0.5),0.5);
-        aux=std::pow(p/(ppi*tt*(tt-p)),0.5)*PHID(aa);
+        aa=-b*pow((p-s)/pow(2.0*p*s,0.5),0.5);
+        aux=pow(p/(ppi*tt*(tt-p)),0.5)*PHID(aa);
 
         xx=(a+b)*(a+b)/(4.0*tt);
-        yy=std::pow((a*p-b*(tt-p)),2)/(4.0*p*tt*(tt-p));
+        yy=pow((a*p-b*(tt-p)),2)/(4.0*p*tt*(tt-p));
         caux3=aux*exp(-xx)*exp(-yy)/2.0;
 
 
         xx=(a-b)*(a-b)/(4.0*tt);
-        yy=std::pow((a*p+b*(tt-p)),2)/(4.0*p*tt*(tt-p));
+        yy=pow((a*p+b*(tt-p)),2)/(4.0*p*tt*(tt-p));
         caux4=aux*exp(-xx)*exp(-yy)/2.0;
 
-        aa=a*std::pow((p-s)/std::pow(2.0*(tt-p)*(tt-s),0.5),0.5);
-        aux=std::pow(s/(ppi*tt*(tt-s)),0.5)*PHID(aa);
+        aa=a*pow((p-s)/pow(2.0*(tt-p)*(tt-s),0.5),0.5);
+        aux=pow(s/(ppi*tt*(tt-s)),0.5)*PHID(aa);
 
         xx=(a+b)*(a+b)/(4.0*tt);
-        yy=std::pow((a*s-b*(tt-s)),2)/(4.0*s*tt*(tt-s));
+        yy=pow((a*s-b*(tt-s)),2)/(4.0*s*tt*(tt-s));
         caux5=aux*exp(-xx)*exp(-yy)/2.0;
 
         xx=(a-b)*(a-b)/(4.0*tt);
-        yy=std::pow((a*s+b*(tt-s)),2)/(4.0*s*tt*(tt-s));
+        yy=pow((a*s+b*(tt-s)),2)/(4.0*s*tt*(tt-s));
         caux6=aux*exp(-xx)*exp(-yy)/2.0;
 
-        aux=exp((1.0-gm)*(1.0-gm)*tt/4.0)*std::pow(tt,0.5);
+        aux=exp((1.0-gm)*(1.0-gm)*tt/4.0)*pow(tt,0.5);
 
-        result=(caux+caux1+caux2+caux3+caux4+caux5+caux6)/(aux*2.0*std::pow(ppi,0.5));
+        result=(caux+caux1+caux2+caux3+caux4+caux5+caux6)/(aux*2.0*pow(ppi,0.5));
         return(result);
     }
 
@@ -749,14 +749,14 @@ namespace QuantLib {
         static Real xx,yy,rho,sc;
         static double  ppi= 3.14159265358979324;
         static Real deriv;
-        sc=std::pow(2.0*ppi,0.5);
+        sc=pow(2.0*ppi,0.5);
 
         if(idx==1)
             {
-                aa=exp(-0.5*std::pow(limit[1],2));
-                xx=(limit[3]-sigmarho[2]*limit[1])/std::pow((1.0-std::pow(sigmarho[2],2)),0.5);
-                yy=(limit[2]-sigmarho[1]*limit[1])/std::pow((1.0-std::pow(sigmarho[1],2)),0.5);
-                rho=(sigmarho[3]-sigmarho[1]*sigmarho[2])/std::pow((1.0-sigmarho[1]*sigmarho[1])*(1.0-sigmarho[2]*sigmarho[2]),0.5);
+                aa=exp(-0.5*pow(limit[1],2));
+                xx=(limit[3]-sigmarho[2]*limit[1])/pow((1.0-pow(sigmarho[2],2)),0.5);
+                yy=(limit[2]-sigmarho[1]*limit[1])/pow((1.0-pow(sigmarho[1],2)),0.5);
+                rho=(sigmarho[3]-sigmarho[1]*sigmarho[2])/pow((1.0-sigmarho[1]*sigmarho[1])*(1.0-sigmarho[2]*sigmarho[2]),0.5);
                 deriv=aa*ND2(-xx,-yy,rho)/sc;
             }
         else
@@ -764,10 +764,10 @@ namespace QuantLib {
                 if(idx==2)
                     {
                         aa=exp(-0.5*limit[2]*limit[2]);
-                        xx=(limit[1]-sigmarho[1]*limit[2])/std::pow((1.0-std::pow(sigmarho[1],2)),0.5);
-                        yy=(limit[3]-sigmarho[3]*limit[2])/std::pow((1.0-std::pow(sigmarho[3],2)),0.5);
+                        xx=(limit[1]-sigmarho[1]*limit[2])/pow((1.0-pow(sigmarho[1],2)),0.5);
+                        yy=(limit[3]-sigmarho[3]*limit[2])/pow((1.0-pow(sigmarho[3],2)),0.5);
                         rho=(sigmarho[2]-sigmarho[1]*sigmarho[3])/ \
-                            std::pow((1.0-sigmarho[1]*sigmarho[1])*(1.0-sigmarho[3]*sigmarho[3]),0.5);
+                            pow((1.0-sigmarho[1]*sigmarho[1])*(1.0-sigmarho[3]*sigmarho[3]),0.5);
                         deriv=aa*ND2(-xx,-yy,rho)/sc;
                     }
                 else
@@ -775,10 +775,10 @@ namespace QuantLib {
                         //!!! idx=3
                         aa=exp(-0.5*limit[3]*limit[3]);
 
-                        xx=(limit[1]-sigmarho[2]*limit[3])/std::pow((1.0-std::pow(sigmarho[2],2)),0.5);
-                        yy=(limit[2]-sigmarho[3]*limit[3])/std::pow((1.0-std::pow(sigmarho[3],2)),0.5);
+                        xx=(limit[1]-sigmarho[2]*limit[3])/pow((1.0-pow(sigmarho[2],2)),0.5);
+                        yy=(limit[2]-sigmarho[3]*limit[3])/pow((1.0-pow(sigmarho[3],2)),0.5);
                         rho=(sigmarho[1]-sigmarho[2]*sigmarho[3])/ \
-                            std::pow((1.0-sigmarho[2]*sigmarho[2])*(1.0-sigmarho[3]*sigmarho[3]),0.5);
+                            pow((1.0-sigmarho[2]*sigmarho[2])*(1.0-sigmarho[3]*sigmarho[3]),0.5);
                         deriv=aa*ND2(-xx,-yy,rho)/sc;
                     }
 
@@ -942,7 +942,7 @@ namespace QuantLib {
         */
         static Real PT, EE;
         PT = 1.57079632679489661923132169163975;
-        EE = std::pow(( PT - fabs(X) ),2);
+        EE = pow(( PT - fabs(X) ),2);
 
         if ( EE < 5e-5 )
             {
@@ -993,7 +993,7 @@ namespace QuantLib {
                         FIN = FIN + FI[I];
                         ERR = ERR + EI[I]*EI[I];
                     }
-                ERR = std::pow( ERR,0.5 );
+                ERR = pow( ERR,0.5 );
             }
         result=FIN;
         //   ADONET = FIN
@@ -1099,7 +1099,7 @@ namespace QuantLib {
 
         if ( NU < 1 ) result= PHID( T );
         else if ( NU == 1 ) result = ( 1 + 2.0*atan(T)/PI )/2.0;
-        else if ( NU == 2 ) result = ( 1 + T/std::pow(( 2.0 + T*T),0.5))/2.0;
+        else if ( NU == 2 ) result = ( 1 + T/pow(( 2.0 + T*T),0.5))/2.0;
         else
             {
                 TT = T*T;
@@ -1112,12 +1112,12 @@ namespace QuantLib {
                 if ((NU-2*int(NU/2) ) == 1 )
                     {
                         RN = NU;
-                        TS = T/std::pow(RN,0.5);
+                        TS = T/pow(RN,0.5);
                         result = ( 1.0 + 2.0*( atan(TS) + TS*CSSTHE*POLYN )/PI )/2.0;
                     }
                 else
                     {
-                        SNTHE = T/std::pow(( NU + TT ),0.5);
+                        SNTHE = T/pow(( NU + TT ),0.5);
                         result = ( 1 + SNTHE*POLYN )/2.0;
                     }
                 result = max( ZRO, min( result, ONE ) );
@@ -1176,7 +1176,7 @@ namespace QuantLib {
             {
                 TPI = 2.0*PI;
                 SNU = (double)NU;
-                SNU = std::pow(SNU,0.5);
+                SNU = pow(SNU,0.5);
                 ORS = 1.0 - R*R;
                 HRK = DH - R*DK;
                 KRH = DK - R*DH;
@@ -1195,13 +1195,13 @@ namespace QuantLib {
                 KS =(int)SIGN( ONE, DK - R*DH );
                 if((NU-2*(int)(NU/2))==0 )
                     {
-                        BVT = atan2( std::pow(ORS,0.5), -R )/TPI;
-                        GMPH = DH/std::pow( 16*( NU + DH*DH ),0.5 );
-                        GMPK = DK/std::pow( 16*( NU + DK*DK),0.5);
-                        BTNCKH = 2*atan2( std::pow( XNKH,0.5 ), std::pow(( 1-XNKH),0.5) )/PI;
-                        BTPDKH = 2*std::pow( XNKH*( 1 - XNKH ),0.5 )/PI;
-                        BTNCHK = 2*atan2( std::pow( XNHK,0.5 ), std::pow((1 - XNHK),0.5) )/PI;
-                        BTPDHK = 2*std::pow( XNHK*( 1 - XNHK ),0.5 )/PI;
+                        BVT = atan2( pow(ORS,0.5), -R )/TPI;
+                        GMPH = DH/pow( 16*( NU + DH*DH ),0.5 );
+                        GMPK = DK/pow( 16*( NU + DK*DK),0.5);
+                        BTNCKH = 2*atan2( pow( XNKH,0.5 ), pow(( 1-XNKH),0.5) )/PI;
+                        BTPDKH = 2*pow( XNKH*( 1 - XNKH ),0.5 )/PI;
+                        BTNCHK = 2*atan2( pow( XNHK,0.5 ), pow((1 - XNHK),0.5) )/PI;
+                        BTPDHK = 2*pow( XNHK*( 1 - XNHK ),0.5 )/PI;
                         for( J = 1; J<= NU/2;J++)
                             {
                                 BVT = BVT + GMPH*( 1 + KS*BTNCKH );
@@ -1216,7 +1216,7 @@ namespace QuantLib {
                     }
                 else
                     {
-                        QHRK = std::pow((DH*DH + DK*DK - 2*R*DH*DK + NU*ORS),0.5 ) ;
+                        QHRK = pow((DH*DH + DK*DK - 2*R*DH*DK + NU*ORS),0.5 ) ;
                         HKRN = DH*DK + R*NU ;
                         HKN = DH*DK - NU;
                         HPK = DH + DK;
@@ -1224,9 +1224,9 @@ namespace QuantLib {
                         if ( BVT < -EPS ) BVT = BVT + 1;
                         GMPH = DH/( TPI*SNU*( 1 + DH*DH/NU ) );
                         GMPK = DK/( TPI*SNU*( 1 + DK*DK/NU ) );
-                        BTNCKH = std::pow( XNKH,0.5 );
+                        BTNCKH = pow( XNKH,0.5 );
                         BTPDKH = BTNCKH;
-                        BTNCHK = std::pow( XNHK,0.5 );
+                        BTNCHK = pow( XNHK,0.5 );
                         BTPDHK = BTNCHK;
                         for( J = 1;J<= ( NU - 1 )/2; J++)
                             {
@@ -1257,17 +1257,17 @@ namespace QuantLib {
           static Real DT, FT, BT,result;
 
           result = 0.0;
-          DT = RR*( RR - std::pow(( RA - RB ),2) - 2*RA*RB*( 1 - R ) );
+          DT = RR*( RR - pow(( RA - RB ),2) - 2*RA*RB*( 1 - R ) );
           if( DT > 0 ) {
-              BT = ( BC*RR + BA*( R*RB - RA ) + BB*( R*RA -RB ) )/std::pow(DT,0.5);
-              FT = std::pow(( BA - R*BB ),0.5)/RR + BB*BB;
+              BT = ( BC*RR + BA*( R*RB - RA ) + BB*( R*RA -RB ) )/pow(DT,0.5);
+              FT = pow(( BA - R*BB ),0.5)/RR + BB*BB;
               if( NUC<1 ) {
                   if ( (BT > -10) && (FT <100) ) {
                       result = exp( -FT/2 );
                       if ( BT <10 ) result= result*PHID(BT);
                   } else {
-                      FT = std::pow((1 + FT/NUC),0.5);
-                      result = STUDNT( NUC, BT/FT )/std::pow(FT,NUC);
+                      FT = pow((1 + FT/NUC),0.5);
+                      result = STUDNT( NUC, BT/FT )/pow(FT,NUC);
                   }
               }
           }
@@ -1404,22 +1404,22 @@ namespace QuantLib {
 
                 if( fabs(R) <1 ) {
                     AS = ( 1 - R )*( 1 + R );
-                    AA = std::pow(AS,0.5);
+                    AA = pow(AS,0.5);
 
-                    BS = std::pow(( H - K ),2);
+                    BS = pow(( H - K ),2);
                     C = ( 4 - HK )/8 ;
                     D = ( 12 - HK )/16;
                     ASR = -( BS/AS + HK )/2;
                     if( ASR > -100 ) BVN = AA*exp(ASR)*( 1 - C*( BS - AS )*( 1 - D*BS/5 )/3 + C*D*AS*AS/5 );
                     if( -HK<100 ){
-                        BB = std::pow(BS,0.5);
-                        BVN = BVN - exp( -HK/2 )*std::pow(TWOPI,0.5)*PHID(-BB/AA)*BB*( 1 - C*BS*( 1 - D*BS/5 )/3 );
+                        BB = pow(BS,0.5);
+                        BVN = BVN - exp( -HK/2 )*pow(TWOPI,0.5)*PHID(-BB/AA)*BB*( 1 - C*BS*( 1 - D*BS/5 )/3 );
                     }
                     AA = AA/2   ;
                     for (I = 1; I<= LG;I++){
                         for( IS = -1; IS<=1; IS=IS+2){
-                            XS =std::pow( ( AA*(  IS*XL[I][NG] + 1 ) ),2)  ;
-                            RS = std::pow( (1 - XS),2 );
+                            XS =pow( ( AA*(  IS*XL[I][NG] + 1 ) ),2)  ;
+                            RS = pow( (1 - XS),2 );
                             ASR = -( BS/XS + HK )/2;
                             if ( ASR > -100 ) {
 
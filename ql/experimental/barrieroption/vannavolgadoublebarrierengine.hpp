@@ -221,9 +221,9 @@ namespace QuantLib {
 
                      // Analytical Black Scholes formula
                      NormalDistribution norm;
-                     Real d1atm = (std::log(x0Quote->value() * foreignTS_->discount(T_) /
+                     Real d1atm = (log(x0Quote->value() * foreignTS_->discount(T_) /
                                             domesticTS_->discount(T_) / atmStrike) +
-                                   0.5 * std::pow(atmVolQuote->value(), 2.0) * T_) /
+                                   0.5 * pow(atmVolQuote->value(), 2.0) * T_) /
                                   (atmVolQuote->value() * sqrt(T_));
                      Real vegaAtm_Analytical =
                          x0Quote->value() * norm(d1atm) * sqrt(T_) * foreignTS_->discount(T_);
@@ -233,9 +233,9 @@ namespace QuantLib {
                                                 (d1atm - atmVolQuote->value() * sqrt(T_)) /
                                                 atmVolQuote->value();
 
-                     Real d125call = (std::log(x0Quote->value() * foreignTS_->discount(T_) /
+                     Real d125call = (log(x0Quote->value() * foreignTS_->discount(T_) /
                                                domesticTS_->discount(T_) / call25Strike) +
-                                      0.5 * std::pow(atmVolQuote->value(), 2.0) * T_) /
+                                      0.5 * pow(atmVolQuote->value(), 2.0) * T_) /
                                      (atmVolQuote->value() * sqrt(T_));
                      Real vega25Call_Analytical =
                          x0Quote->value() * norm(d125call) * sqrt(T_) * foreignTS_->discount(T_);
@@ -246,9 +246,9 @@ namespace QuantLib {
                                                    (d125call - atmVolQuote->value() * sqrt(T_)) /
                                                    atmVolQuote->value();
 
-                     Real d125Put = (std::log(x0Quote->value() * foreignTS_->discount(T_) /
+                     Real d125Put = (log(x0Quote->value() * foreignTS_->discount(T_) /
                                               domesticTS_->discount(T_) / put25Strike) +
-                                     0.5 * std::pow(atmVolQuote->value(), 2.0) * T_) /
+                                     0.5 * pow(atmVolQuote->value(), 2.0) * T_) /
                                     (atmVolQuote->value() * sqrt(T_));
                      Real vega25Put_Analytical =
                          x0Quote->value() * norm(d125Put) * sqrt(T_) * foreignTS_->discount(T_);
@@ -352,20 +352,20 @@ namespace QuantLib {
                                                foreignTS_->zeroRate(T_, Continuous).rate()) /
                                                   atmVol_->value() -
                                               atmVol_->value() / 2.0) *
-                                             std::sqrt(T_);
+                                             sqrt(T_);
                      Real h =
-                         1.0 / atmVol_->value() * std::log(H / x0Quote->value()) / std::sqrt(T_);
+                         1.0 / atmVol_->value() * log(H / x0Quote->value()) / sqrt(T_);
                      Real l =
-                         1.0 / atmVol_->value() * std::log(L / x0Quote->value()) / std::sqrt(T_);
+                         1.0 / atmVol_->value() * log(L / x0Quote->value()) / sqrt(T_);
                      CumulativeNormalDistribution cnd;
 
                      Real doubleNoTouch = 0.0;
                      for (int j = -series_; j < series_; j++) {
                          Real e_minus = 2 * j * (h - l) - theta_tilt_minus;
                          doubleNoTouch +=
-                             std::exp(-2.0 * j * theta_tilt_minus * (h - l)) *
+                             exp(-2.0 * j * theta_tilt_minus * (h - l)) *
                                  (cnd(h + e_minus) - cnd(l + e_minus)) -
-                             std::exp(-2.0 * j * theta_tilt_minus * (h - l) +
+                             exp(-2.0 * j * theta_tilt_minus * (h - l) +
                                       2.0 * theta_tilt_minus * h) *
                                  (cnd(h - 2.0 * h + e_minus) - cnd(l - 2.0 * h + e_minus));
                      }
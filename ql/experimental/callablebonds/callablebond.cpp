@@ -395,7 +395,7 @@ namespace QuantLib {
             return 0;
         else
             {
-                return (Ppp + Pmm - 2*P) / ( std::pow(bump,2) * P);
+                return (Ppp + Pmm - 2*P) / ( pow(bump,2) * P);
             }
 
     }
@@ -82,7 +82,7 @@ namespace QuantLib {
                             termStructure->zeroRate(date, termStructure->dayCounter(), Continuous,
                                                     NoFrequency) +
                             spread;
-                        auto df = std::exp(-zeroRateInclSpread * time);
+                        auto df = exp(-zeroRateInclSpread * time);
                         return df;
                     };
 
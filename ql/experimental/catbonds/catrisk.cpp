@@ -103,7 +103,7 @@ namespace QuantLib {
         while(eventFraction<=yearFraction_)
         {
             auto days =
-                static_cast<Integer>(std::lround(eventFraction * dayCount_ / yearFraction_));
+                static_cast<Integer>(lround(eventFraction * dayCount_ / yearFraction_));
             Date eventDate = start_ + days*Days;
             if(eventDate<=end_)
             {
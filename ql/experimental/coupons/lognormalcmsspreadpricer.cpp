@@ -86,26 +86,26 @@ namespace QuantLib {
 
         Real v = M_SQRT2 * x;
         Real h =
-            k_ - b_ * s2_ * std::exp((m2_ - 0.5 * v2_ * v2_) * fixingTime_ +
-                                     v2_ * std::sqrt(fixingTime_) * v);
+            k_ - b_ * s2_ * exp((m2_ - 0.5 * v2_ * v2_) * fixingTime_ +
+                                     v2_ * sqrt(fixingTime_) * v);
         Real phi1, phi2;
         phi1 = (*cnd_)(
-            phi_ * (std::log(a_ * s1_ / h) +
+            phi_ * (log(a_ * s1_ / h) +
                     (m1_ + (0.5 - rho_ * rho_) * v1_ * v1_) * fixingTime_ +
-                    rho_ * v1_ * std::sqrt(fixingTime_) * v) /
-            (v1_ * std::sqrt(fixingTime_ * (1.0 - rho_ * rho_))));
+                    rho_ * v1_ * sqrt(fixingTime_) * v) /
+            (v1_ * sqrt(fixingTime_ * (1.0 - rho_ * rho_))));
         phi2 = (*cnd_)(
-            phi_ * (std::log(a_ * s1_ / h) +
+            phi_ * (log(a_ * s1_ / h) +
                     (m1_ - 0.5 * v1_ * v1_) * fixingTime_ +
-                    rho_ * v1_ * std::sqrt(fixingTime_) * v) /
-            (v1_ * std::sqrt(fixingTime_ * (1.0 - rho_ * rho_))));
+                    rho_ * v1_ * sqrt(fixingTime_) * v) /
+            (v1_ * sqrt(fixingTime_ * (1.0 - rho_ * rho_))));
         Real f = a_ * phi_ * s1_ *
-                     std::exp(m1_ * fixingTime_ -
+                     exp(m1_ * fixingTime_ -
                               0.5 * rho_ * rho_ * v1_ * v1_ * fixingTime_ +
-                              rho_ * v1_ * std::sqrt(fixingTime_) * v) *
+                              rho_ * v1_ * sqrt(fixingTime_) * v) *
                      phi1 -
                  phi_ * h * phi2;
-        return std::exp(-x * x) * f;
+        return exp(-x * x) * f;
     }
 
     Real LognormalCmsSpreadPricer::integrand_normal(const Real x) const {
@@ -117,15 +117,15 @@ namespace QuantLib {
         Real beta =
             phi_ *
             (gearing1_ * adjustedRate1_ + gearing2_ * adjustedRate2_ - k_ +
-             std::sqrt(fixingTime_) *
+             sqrt(fixingTime_) *
                  (rho_ * gearing1_ * vol1_ + gearing2_ * vol2_) * s);
         Real f =
             close_enough(alpha_, 0.0)
                 ? Real(std::max(beta, 0.0))
                 : psi_ * alpha_ / (M_SQRTPI * M_SQRT2) *
-                          std::exp(-beta * beta / (2.0 * alpha_ * alpha_)) +
+                          exp(-beta * beta / (2.0 * alpha_ * alpha_)) +
                       beta * (1.0 - (*cnd_)(-psi_ * beta / alpha_));
-        return std::exp(-x * x) * f;
+        return exp(-x * x) * f;
     }
 
     void
@@ -231,9 +231,9 @@ namespace QuantLib {
             }
 
             if(volType_ == ShiftedLognormal) {
-                mu1_ = 1.0 / fixingTime_ * std::log((adjustedRate1_ + shift1_) /
+                mu1_ = 1.0 / fixingTime_ * log((adjustedRate1_ + shift1_) /
                                                     (swapRate1_ + shift1_));
-                mu2_ = 1.0 / fixingTime_ * std::log((adjustedRate2_ + shift2_) /
+                mu2_ = 1.0 / fixingTime_ * log((adjustedRate2_ + shift2_) /
                                                     (swapRate2_ + shift2_));
             }
             // for the normal volatility case we do not need the drifts
@@ -286,7 +286,7 @@ namespace QuantLib {
             Real forward = gearing1_ * adjustedRate1_ +
                 gearing2_ * adjustedRate2_;
             Real stddev =
-                std::sqrt(fixingTime_ *
+                sqrt(fixingTime_ *
                           (gearing1_ * gearing1_ * vol1_ * vol1_ +
                            gearing2_ * gearing2_ * vol2_ * vol2_ +
                            2.0 * gearing1_ * gearing2_ * rho_ * vol1_ * vol2_));
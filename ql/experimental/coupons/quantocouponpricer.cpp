@@ -50,7 +50,7 @@ namespace QuantLib {
             // Hull 6th Edition, page 642, generalised to
             // shifted lognormal and normal volatilities
             if(capletVolatility()->volatilityType() == ShiftedLognormal) {
-                Real dQuantoAdj = std::exp(sigma*fxsigma*rho*t1);
+                Real dQuantoAdj = exp(sigma*fxsigma*rho*t1);
                 Real shift = capletVolatility()->displacement();
                 fixing = (fixing+shift)*dQuantoAdj-shift;
             }
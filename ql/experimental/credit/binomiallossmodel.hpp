@@ -183,7 +183,7 @@ namespace QuantLib {
                 / (avgLgd * bsktSize);
         // model parameters:
         Real m = avgProb * bsktSize;
-        Real floorAveProb = std::min(Real(bsktSize-1), std::floor(Real(m)));
+        Real floorAveProb = std::min(Real(bsktSize-1), floor(Real(m)));
         Real ceilAveProb = floorAveProb + 1.;
         // nu_A
         Real varianceBinom = avgProb * (1. - avgProb)/bsktSize;
@@ -204,8 +204,8 @@ namespace QuantLib {
 
         variance = avgLgd <= QL_EPSILON ? Real(0.) : 
             variance / (bsktSize * bsktSize * avgLgd * avgLgd );
-        Real sumAves = -std::pow(ceilAveProb-m, 2) 
-            - (std::pow(floorAveProb-m, 2) - std::pow(ceilAveProb,2.)) 
+        Real sumAves = -pow(ceilAveProb-m, 2) 
+            - (pow(floorAveProb-m, 2) - pow(ceilAveProb,2.)) 
                 * (ceilAveProb-m);
         Real alpha = (variance * bsktSize + sumAves) 
             / (varianceBinom * bsktSize + sumAves);
@@ -224,7 +224,7 @@ namespace QuantLib {
             pointed out in the book. This is numerical.
             */
             Probability probsRatio = avgProb/(1.-avgProb);
-            lossProbDensity[0] = std::pow(1.-avgProb, 
+            lossProbDensity[0] = pow(1.-avgProb, 
                 static_cast<Real>(bsktSize));
             for(Size i=1; i<bsktSize+1; i++) // recursive to avoid factorial
                 lossProbDensity[i] = lossProbDensity[i-1] * probsRatio 
@@ -271,7 +271,7 @@ namespace QuantLib {
         }else{
             E1i1j = pi;
         }
-        return (E1i1j - pipj )/std::sqrt(pipj*(1.-pi)*(1.-pj));
+        return (E1i1j - pipj )/sqrt(pipj*(1.-pi)*(1.-pj));
     }
 
 
@@ -292,7 +292,7 @@ namespace QuantLib {
             Size poolSize = basket_->size();//move to 'livesize'
             const ext::shared_ptr<Pool>& pool = basket_->pool();
 
-            auto limit = static_cast<BigNatural>(std::pow(2., (int)(poolSize)));
+            auto limit = static_cast<BigNatural>(pow(2., (int)(poolSize)));
 
             // Precalc conditional probabilities
             std::vector<Probability> pDefCond;
@@ -303,7 +303,7 @@ namespace QuantLib {
                     defaultProbability(date), i, mktFactors));
 
             Probability probNEventsOrMore = 0.;
-            for (auto mask = static_cast<BigNatural>(std::pow(2., (int)(n)) - 1); mask < limit;
+            for (auto mask = static_cast<BigNatural>(pow(2., (int)(n)) - 1); mask < limit;
                  mask++) {
                 // cheap permutations
                 boost::dynamic_bitset<> bsetMask(poolSize, mask);
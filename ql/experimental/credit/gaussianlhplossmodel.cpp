@@ -37,7 +37,7 @@ namespace QuantLib {
             quotes.size(),
             //g++ complains default value not seen as typename
             GaussianCopulaPolicy::initTraits()),
-          sqrt1minuscorrel_(std::sqrt(1.-correlQuote->value())),
+          sqrt1minuscorrel_(sqrt(1.-correlQuote->value())),
           correl_(correlQuote),
           rrQuotes_(quotes), 
           beta_(sqrt(correlQuote->value())),
@@ -55,7 +55,7 @@ namespace QuantLib {
             recoveries.size(),
             //g++ complains default value not seen as typename
             GaussianCopulaPolicy::initTraits()),
-          sqrt1minuscorrel_(std::sqrt(1.-correlation)),
+          sqrt1minuscorrel_(sqrt(1.-correlation)),
           correl_(Handle<Quote>(ext::make_shared<SimpleQuote>(correlation))),
           beta_(sqrt(correlation)),
           biphi_(-sqrt(correlation))
@@ -71,7 +71,7 @@ namespace QuantLib {
             recoveries.size(),
             //g++ complains default value not seen as typename
             GaussianCopulaPolicy::initTraits()),
-          sqrt1minuscorrel_(std::sqrt(1.-correlQuote->value())),
+          sqrt1minuscorrel_(sqrt(1.-correlQuote->value())),
           correl_(correlQuote),
           beta_(sqrt(correlQuote->value())),
           biphi_(-sqrt(correlQuote->value()))
@@ -294,7 +294,7 @@ namespace QuantLib {
         Time t) const 
     {
         // the way x0 is defined:
-        Real initValHR = std::pow(model_->dynamics()->process()->x0(), 2);
+        Real initValHR = pow(model_->dynamics()->process()->x0(), 2);
 
         if (t == 0.0)
             return model_->discountBond(0., t, initValHR);
@@ -308,7 +308,7 @@ namespace QuantLib {
                 this->interpolation_.primitive(this->times_.back(), true)
                      + this->data_.back()*(t - this->times_.back());
         }
-        return std::exp(-integral) * model_->discountBond(0., t, initValHR);
+        return exp(-integral) * model_->discountBond(0., t, initValHR);
     }
 
     template <class T>
@@ -347,7 +347,7 @@ namespace QuantLib {
                      + this->data_.back()*(tTarget - this->times_.back());
         }
 
-        return std::exp(-(integralTP-integralTFwd)) * 
+        return exp(-(integralTP-integralTFwd)) * 
             model_->discountBond(tFwd, tTarget, yVal );
     }
 
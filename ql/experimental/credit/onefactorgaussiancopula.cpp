@@ -45,7 +45,7 @@ namespace QuantLib {
             // outer integral -> 1 for c -> 0
             // inner integral -> CumulativeNormal()(y) for c-> 0
             for (Real m = minimum; m < maximum; m += delta)
-                for (Real z = minimum; z < (y - std::sqrt(c) * m) / std::sqrt (1. - c);
+                for (Real z = minimum; z < (y - sqrt(c) * m) / sqrt (1. - c);
                      z += delta)
                     cumulated += dm (m) * dz (z);
         }
@@ -53,7 +53,7 @@ namespace QuantLib {
             // outer integral -> 1 for c -> 1
             // inner integral -> CumulativeNormal()(y) for c-> 1
             for (Real z = minimum; z < maximum; z += delta)
-                for (Real m = minimum; m < (y - std::sqrt(1.0 - c) * z) / std::sqrt(c);
+                for (Real m = minimum; m < (y - sqrt(1.0 - c) * z) / sqrt(c);
                      m += delta)
                     cumulated += dm (m) * dz (z);
         }
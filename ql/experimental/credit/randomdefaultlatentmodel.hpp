@@ -328,7 +328,7 @@ namespace QuantLib {
         expectedDefj = expectedDefj / nSims_;
 
         return (expectedDefiDefj - expectedDefi*expectedDefj) /
-            std::sqrt((expectedDefi*expectedDefj*(1.-expectedDefi)
+            sqrt((expectedDefi*expectedDefj*(1.-expectedDefi)
                 *(1.-expectedDefj)));
         // \todo Provide confidence interval
     }
@@ -478,7 +478,7 @@ namespace QuantLib {
         }
 
         std::sort(losses.begin(), losses.end());
-        Real posit = std::ceil(percent * nSims_);
+        Real posit = ceil(percent * nSims_);
         posit = posit >= 0. ? posit : 0.;
         Size position = static_cast<Size>(posit);
         Real perctlInf = losses[position];//q_{\alpha}
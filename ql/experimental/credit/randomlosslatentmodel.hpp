@@ -38,7 +38,7 @@ namespace QuantLib {
             simEvent(unsigned int n, unsigned int d, Real r) 
             : nameIdx(n), dayFromRef(d), 
                 // truncates the value:
-              compactRR(std::lround(r/rrGranular)) {}
+              compactRR(lround(r/rrGranular)) {}
             unsigned int nameIdx : 12; // can index up to 4095 names
             unsigned int dayFromRef : 12; // can index up to 4095 days = 11 yrs
         private:
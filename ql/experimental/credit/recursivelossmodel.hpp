@@ -208,7 +208,7 @@ namespace QuantLib {
         lossUnit_ = *(std::min_element(lgds.begin(), lgds.end()))
             / nBuckets_;
         for(Size i=0; i<remainingBsktSize_; ++i)
-            wk_.push_back(std::floor(lgdsTmp[i]/lossUnit_ + .5));
+            wk_.push_back(floor(lgdsTmp[i]/lossUnit_ + .5));
     }
 
     // make it return a distribution object?
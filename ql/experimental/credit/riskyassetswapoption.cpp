@@ -45,7 +45,7 @@ namespace QuantLib {
 
         Date today = Settings::instance().evaluationDate();
         Time expiryTime = Actual365Fixed().yearFraction(today, expiry_);
-        Real stdDev = spreadVolatility_ * std::sqrt(expiryTime);
+        Real stdDev = spreadVolatility_ * sqrt(expiryTime);
         Real d = (asw_->spread() - marketSpread_) / stdDev;
         Real A0 = asw_->nominal() * asw_->floatAnnuity();
 
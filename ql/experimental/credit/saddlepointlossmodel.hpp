@@ -575,8 +575,8 @@ namespace QuantLib {
             Probability pBuffer = 
                 copula_->conditionalDefaultProbabilityInvP(
                     invUncondProbs[iName], iName, mktFactor);
-            sum += std::log(1. - pBuffer + 
-                pBuffer * std::exp(remainingNotionals_[iName] * 
+            sum += log(1. - pBuffer + 
+                pBuffer * exp(remainingNotionals_[iName] * 
                 (1.-copula_->conditionalRecoveryInvP(invUncondProbs[iName],
                     iName, mktFactor)) * lossFraction / remainingNotional_));
         }
@@ -600,7 +600,7 @@ namespace QuantLib {
             Real lossInDef = remainingNotionals_[iName] * 
                 (1.-copula_->conditionalRecoveryInvP(invUncondProbs[iName], 
                     iName, mktFactor)) / remainingNotional_;
-            Real midFactor = pBuffer * std::exp(lossInDef * saddle);
+            Real midFactor = pBuffer * exp(lossInDef * saddle);
             sum += lossInDef * midFactor / (1.-pBuffer + midFactor);
         }
        return sum;
@@ -623,10 +623,10 @@ namespace QuantLib {
             Real lossInDef = remainingNotionals_[iName] * 
                 (1.-copula_->conditionalRecoveryInvP(invUncondProbs[iName], 
                     iName, mktFactor)) / remainingNotional_;
-            Real midFactor = pBuffer * std::exp(lossInDef * saddle);
+            Real midFactor = pBuffer * exp(lossInDef * saddle);
             Real denominator = 1.-pBuffer + midFactor;
             sum += lossInDef * lossInDef * midFactor / denominator - 
-                std::pow(lossInDef * midFactor / denominator , 2.);
+                pow(lossInDef * midFactor / denominator , 2.);
         }
        return sum;
     }
@@ -648,7 +648,7 @@ namespace QuantLib {
                 (1.-copula_->conditionalRecoveryInvP(invUncondProbs[iName], 
                     iName, mktFactor)) / remainingNotional_;
 
-            const Real midFactor = pBuffer * std::exp(lossInDef * saddle);
+            const Real midFactor = pBuffer * exp(lossInDef * saddle);
             const Real denominator = 1.-pBuffer + midFactor;
 
             const Real& suma0 = denominator;
@@ -656,7 +656,7 @@ namespace QuantLib {
             const Real suma2  = lossInDef * suma1;
             const Real suma3  = lossInDef * suma2;
 
-            sum += (suma3 + (2.*std::pow(suma1, 3.)/suma0 - 
+            sum += (suma3 + (2.*pow(suma1, 3.)/suma0 - 
                 3.*suma1*suma2)/suma0)/suma0;
         }
        return sum;
@@ -679,7 +679,7 @@ namespace QuantLib {
                 (1.-copula_->conditionalRecoveryInvP(invUncondProbs[iName], 
                     iName, mktFactor)) / remainingNotional_;
 
-            Real midFactor = pBuffer * std::exp(lossInDef * saddle);
+            Real midFactor = pBuffer * exp(lossInDef * saddle);
             Real denominator = 1.-pBuffer + midFactor;
 
             const Real& suma0 = denominator;
@@ -690,7 +690,7 @@ namespace QuantLib {
 
             sum += (suma4 + (-4.*suma1*suma3 - 3.*suma2*suma2 + 
                 (12.*suma1*suma1*suma2 - 
-                    6.*std::pow(suma1,4.)/suma0)/suma0)/suma0)/suma0;
+                    6.*pow(suma1,4.)/suma0)/suma0)/suma0)/suma0;
         }
        return sum;
     }
@@ -715,7 +715,7 @@ namespace QuantLib {
                 (1.-copula_->conditionalRecoveryInvP(invUncondProbs[iName], 
                     iName, mktFactor)) / remainingNotional_;
 
-            Real midFactor = pBuffer * std::exp(lossInDef * saddle);
+            Real midFactor = pBuffer * exp(lossInDef * saddle);
             Real denominator = 1.-pBuffer + midFactor;
 
             const Real& suma0 = denominator;
@@ -725,14 +725,14 @@ namespace QuantLib {
             const Real suma4  = lossInDef * suma3;
 
             // To do: optimize these:
-            deriv0 += std::log(suma0);
+            deriv0 += log(suma0);
             //deriv1 += suma1 / suma0;
-            deriv2 += suma2 / suma0 - std::pow(suma1 / suma0 , 2.);
-            deriv3 += (suma3 + (2.*std::pow(suma1, 3.)/suma0 - 
+            deriv2 += suma2 / suma0 - pow(suma1 / suma0 , 2.);
+            deriv3 += (suma3 + (2.*pow(suma1, 3.)/suma0 - 
                 3.*suma1*suma2)/suma0)/suma0;
             deriv4 += (suma4 + (-4.*suma1*suma3 - 3.*suma2*suma2 + 
                 (12.*suma1*suma1*suma2 - 
-                    6.*std::pow(suma1,4.)/suma0)/suma0)/suma0)/suma0;
+                    6.*pow(suma1,4.)/suma0)/suma0)/suma0)/suma0;
         }
         return {deriv0, deriv2, deriv3, deriv4};
     }
@@ -755,7 +755,7 @@ namespace QuantLib {
                 (1.-copula_->conditionalRecoveryInvP(invUncondProbs[iName], 
                     iName, mktFactor)) / remainingNotional_;
 
-            Real midFactor = pBuffer * std::exp(lossInDef * saddle);
+            Real midFactor = pBuffer * exp(lossInDef * saddle);
             Real denominator = 1.-pBuffer + midFactor;
 
             const Real& suma0 = denominator;
@@ -763,9 +763,9 @@ namespace QuantLib {
             const Real suma2  = lossInDef * suma1;
 
             // To do: optimize these:
-            deriv0 += std::log(suma0);
+            deriv0 += log(suma0);
             //deriv1 += suma1 / suma0;
-            deriv2 += suma2 / suma0 - std::pow(suma1 / suma0 , 2.);
+            deriv2 += suma2 / suma0 - pow(suma1 / suma0 , 2.);
         }
         return {deriv0, deriv2};
     }
@@ -808,7 +808,7 @@ namespace QuantLib {
         //   it by using only the smallest logistic term and thus this is 
         //   smaller than the true value:
         Real saddleMin = 1./(lgds[iNamMax]/remainingNotional_) * 
-            std::log(deltaMin*(1.-pMaxName)/
+            log(deltaMin*(1.-pMaxName)/
                 (pMaxName*lgds[iNamMax]/remainingNotional_-pMaxName*deltaMin));
         // and the associated minimum loss is approximately: (this is thence 
         //   the minimum loss we can resolve/invert)
@@ -821,7 +821,7 @@ namespace QuantLib {
         if(lossLevel < minLoss) return saddleMin;
 
         Real saddleMax = 1./(lgds[iNamMax]/remainingNotional_) * 
-            std::log((lgds[iNamMax]/remainingNotional_
+            log((lgds[iNamMax]/remainingNotional_
                 -deltaMin)*(1.-pMaxName)/(pMaxName*deltaMin));
         Real maxLoss = 
             CumGen1stDerivativeCond(invUncondPs, saddleMax, mktFactor);
@@ -963,11 +963,11 @@ namespace QuantLib {
         if(saddlePt > 0.) { // <-> (loss > condEL)
             Real exponent = baseVal - relativeLoss * saddlePt + 
                 .5 * saddleTo2 * secondVal;
-            if( std::abs(exponent) > 700.) return 0.;
+            if( abs(exponent) > 700.) return 0.;
             return 
-                std::exp(exponent)
-                * CumulativeNormalDistribution()(-std::abs(saddlePt)*
-                    std::sqrt(/*saddleTo2 **/secondVal))
+                exp(exponent)
+                * CumulativeNormalDistribution()(-abs(saddlePt)*
+                    sqrt(/*saddleTo2 **/secondVal))
 
                 // high order corrections:
                 * (1. - saddleTo3*K3Saddle/6. + saddleTo4*K4Saddle/24. + 
@@ -987,12 +987,12 @@ namespace QuantLib {
         }else {// <->(loss < condEL)
             Real exponent = baseVal - relativeLoss * saddlePt + 
                 .5 * saddleTo2 * secondVal;
-            if( std::abs(exponent) > 700.) return 0.;
+            if( abs(exponent) > 700.) return 0.;
             return 
                 1.-
-                std::exp(exponent)
-                * CumulativeNormalDistribution()(-std::abs(saddlePt)
-                    * std::sqrt(/*saddleTo2 **/secondVal))// static call?
+                exp(exponent)
+                * CumulativeNormalDistribution()(-abs(saddlePt)
+                    * sqrt(/*saddleTo2 **/secondVal))// static call?
 
                 // high order corrections:
                 * (1. - saddleTo3*K3Saddle/6. + saddleTo4*K4Saddle/24. + 
@@ -1046,28 +1046,28 @@ namespace QuantLib {
         if(saddlePt > 0.) { // <-> (loss > condEL)
             Real exponent = baseVal - relativeLoss * saddlePt + 
                 .5 * saddleTo2 * secondVal;
-            if( std::abs(exponent) > 700.) return 0.;
+            if( abs(exponent) > 700.) return 0.;
             return 
                 // dangerous exponential; fix me
-                std::exp(exponent)
+                exp(exponent)
                 /*  std::exp(baseVal - relativeLoss * saddlePt 
                     + .5 * saddleTo2 * secondVal)*/
-                * CumulativeNormalDistribution()(-std::abs(saddlePt)*
-                    std::sqrt(/*saddleTo2 **/secondVal));
+                * CumulativeNormalDistribution()(-abs(saddlePt)*
+                    sqrt(/*saddleTo2 **/secondVal));
         }else if(saddlePt==0.){// <-> (loss == condEL)
             return .5;
         }else {// <->(loss < condEL)
             Real exponent = baseVal - relativeLoss * saddlePt + 
                 .5 * saddleTo2 * secondVal;
-            if( std::abs(exponent) > 700.) return 0.;
+            if( abs(exponent) > 700.) return 0.;
 
             return 
                 1.-
                /* std::exp(baseVal - relativeLoss * saddlePt 
                + .5 * saddleTo2 * secondVal)*/
-                std::exp(exponent)
-                * CumulativeNormalDistribution()(-std::abs(saddlePt)*
-                    std::sqrt(/*saddleTo2 **/secondVal));
+                exp(exponent)
+                * CumulativeNormalDistribution()(-abs(saddlePt)*
+                    sqrt(/*saddleTo2 **/secondVal));
         }
     }
 
@@ -1105,11 +1105,11 @@ namespace QuantLib {
             (
             1.
             + K4Saddle
-                /(8.*std::pow(K2Saddle, 2.))
-            - 5.*std::pow(K3Saddle,2.)
-                /(24.*std::pow(K2Saddle, 3.))
-            ) * std::exp(K0Saddle - saddlePt * relativeLoss)
-             / (std::sqrt(2. * M_PI * K2Saddle));
+                /(8.*pow(K2Saddle, 2.))
+            - 5.*pow(K3Saddle,2.)
+                /(24.*pow(K2Saddle, 3.))
+            ) * exp(K0Saddle - saddlePt * relativeLoss)
+             / (sqrt(2. * M_PI * K2Saddle));
     }
 
     /*    NOTICE THIS IS ON THE TOTAL PORTFOLIO ---- UNTRANCHED..
@@ -1144,7 +1144,7 @@ namespace QuantLib {
                 (1.-copula_->conditionalRecoveryInvP(invUncondProbs[iName], 
                     iName, mktFactor));
             Real midFactor = pBuffer * 
-                std::exp(lossInDef * saddlePt/ remainingNotional_);
+                exp(lossInDef * saddlePt/ remainingNotional_);
             Real denominator = 1.-pBuffer + midFactor;
 
             condContrib[iName] = lossInDef * midFactor / denominator; 
@@ -1218,7 +1218,7 @@ namespace QuantLib {
 
         std::vector<Real> esfPartition(nNames, 0.);
         for(Size iName=0; iName < nNames; iName++) {
-            Real uEdisp = (lossPerc-muTot)/std::sqrt(volaTot);
+            Real uEdisp = (lossPerc-muTot)/sqrt(volaTot);
             esfPartition[iName] = mu[iName]
                 * CumulativeNormalDistribution()(uEdisp) // static call?
                 + vola[iName] * NormalDistribution()(uEdisp);
@@ -49,10 +49,10 @@ namespace QuantLib {
             Real f = 0;
             if (shape_ != nullptr) {
                 f = std::lower_bound(shape_->begin(), shape_->end(),
-                   std::pair<Time, Real>(t-std::sqrt(QL_EPSILON), 0.0))->second;
+                   std::pair<Time, Real>(t-sqrt(QL_EPSILON), 0.0))->second;
             }
 
-            return (*payoff_)(std::exp(f + u));
+            return (*payoff_)(exp(f + u));
         }
         Real avgInnerValue(const FdmLinearOpIterator& iter, Time t) override {
             return innerValue(iter, t);
@@ -85,7 +85,7 @@ namespace QuantLib {
             const Integer yIndex = iter.coordinates()[1];
 
             for (Size i=0; i < yInt.size(); ++i) {
-                const Real weight = std::exp(-yInt[i])*weights[i];
+                const Real weight = exp(-yInt[i])*weights[i];
 
                 const Real ys = y + yInt[i]/eta;
                 const Integer l = (ys > yLoc.back()) ? yLoc.size()-2
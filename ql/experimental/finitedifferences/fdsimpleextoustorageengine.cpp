@@ -50,7 +50,7 @@ namespace QuantLib {
             : mesher_(std::move(mesher)) {}
 
             Real innerValue(const FdmLinearOpIterator& iter, Time) override {
-                const Real s = std::exp(mesher_->location(iter, 0));
+                const Real s = exp(mesher_->location(iter, 0));
                 const Real v = mesher_->location(iter, 1);
                 return s*v;
             }
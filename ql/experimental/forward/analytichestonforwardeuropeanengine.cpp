@@ -49,7 +49,7 @@ namespace QuantLib {
         // QL Gaussian Quadrature - map phi from [-1 to 1] to {0, phiRightLimit] 
         Real operator()(Real phi) const {
             Real phiDash = (0.5+1e-8+0.5*phi) * phiRightLimit_; // Map phi to full range
-            return 0.5*phiRightLimit_*std::real((std::exp(-phiDash*logK_*i_) / (phiDash*i_)) * engine_->chF(phiDash+adj_, tenor_));
+            return 0.5*phiRightLimit_*std::real((exp(-phiDash*logK_*i_) / (phiDash*i_)) * engine_->chF(phiDash+adj_, tenor_));
         }
     };
 
@@ -146,7 +146,7 @@ namespace QuantLib {
 
         // Use some heuristics to decide upon phiRightLimit and nuRightLimit
         Real phiRightLimit = 100.0;
-        Real nuRightLimit = std::max(2.0, 10.0 * (1+std::max(0.0, rho_)) * sigma_ * std::sqrt(resetTime * std::max(v0_, theta_)));
+        Real nuRightLimit = std::max(2.0, 10.0 * (1+std::max(0.0, rho_)) * sigma_ * sqrt(resetTime * std::max(v0_, theta_)));
 
         // do the 2D integral calculation. For very short times, we just fall back on the standard
         // calculation, both for accuracy and because tStar==0 causes some numerical issues...
@@ -201,7 +201,7 @@ namespace QuantLib {
 
         // Re-expressing moneyness in terms of the forward here (strike fixes to spot, but in
         // our pricing calculation we need to compare it to the future at expiry)
-        Real logMoneyness = std::log(moneyness*ratio);
+        Real logMoneyness = log(moneyness*ratio);
 
         P12HatIntegrand p1HatIntegrand(tenor, resetTime, unitQuote, logMoneyness, true, this, phiRightLimit, nuRightLimit);
         P12HatIntegrand p2HatIntegrand(tenor, resetTime, unitQuote, logMoneyness, false, this, phiRightLimit, nuRightLimit);
@@ -219,13 +219,13 @@ namespace QuantLib {
                                                          Real varReset) const {
         Real B, Lambda, term1, term2, term3;
 
-        B = 4 * kappaHat_ / (sigma_ * sigma_ * (1 - std::exp(-kappaHat_ * resetTime)));
-        Lambda = B * std::exp(-kappaHat_ * resetTime) * v0_;
+        B = 4 * kappaHat_ / (sigma_ * sigma_ * (1 - exp(-kappaHat_ * resetTime)));
+        Lambda = B * exp(-kappaHat_ * resetTime) * v0_;
 
         // Now construct equation (18) from the paper term-by-term
-        term1 = std::exp(-0.5*(B * varReset + Lambda)) * B / 2;
-        term2 = std::pow(B * varReset / Lambda, 0.5*(R_/2 - 1));
-        term3 = modifiedBesselFunction_i(Real(R_/2 - 1),Real(std::sqrt(Lambda * B * varReset)));
+        term1 = exp(-0.5*(B * varReset + Lambda)) * B / 2;
+        term2 = pow(B * varReset / Lambda, 0.5*(R_/2 - 1));
+        term3 = modifiedBesselFunction_i(Real(R_/2 - 1),Real(sqrt(Lambda * B * varReset)));
 
         return term1 * term2 * term3;
     }
@@ -257,7 +257,7 @@ namespace QuantLib {
                                                                              Real phiRightLimit) const {
 
         ext::shared_ptr<AnalyticHestonEngine> engine = forwardChF(St, v0_);
-        Real logK = std::log(K*ratio/St->value());
+        Real logK = log(K*ratio/St->value());
 
         // Integrate the CF and the complex integrand over positive phi
         GaussLegendreIntegration integrator = GaussLegendreIntegration(128);
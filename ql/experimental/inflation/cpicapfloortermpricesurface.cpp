@@ -118,7 +118,7 @@ namespace QuantLib {
             detail::CPI::isInterpolated(interpolationType_), dayCounter(),
             referenceDate() - observationLag_, maturity - observationLag_);
 
-        return T > 0.0 ? std::pow(F1 / F0, 1 / T) - 1.0 : baseRate();
+        return T > 0.0 ? pow(F1 / F0, 1 / T) - 1.0 : baseRate();
     }
 
     Date CPICapFloorTermPriceSurface::cpiOptionDateFromTenor(const Period& p) const
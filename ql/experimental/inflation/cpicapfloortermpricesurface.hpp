@@ -245,11 +245,11 @@ namespace QuantLib {
             Period mat = cfMaturities_[j];
             Real df = yts->discount(cpiOptionDateFromTenor(mat));
             Real atm_quote = atmRate(cpiOptionDateFromTenor(mat));
-            Real atm = std::pow(1.0 + atm_quote, mat.length());
+            Real atm = pow(1.0 + atm_quote, mat.length());
             Real S = atm * df;
             for (Size i = 0; i < cfStrikes_.size(); ++i) {
                 Real K_quote = cfStrikes_[i];
-                Real K = std::pow(1.0 + K_quote, mat.length());
+                Real K = pow(1.0 + K_quote, mat.length());
                 auto close = [k = cfStrikes_[i]](Real x){ return close_enough(x, k); };
                 Size indF = std::find_if(fStrikes_.begin(), fStrikes_.end(), close) - fStrikes_.begin();
                 Size indC = std::find_if(cStrikes_.begin(), cStrikes_.end(), close) - cStrikes_.begin();
@@ -112,7 +112,7 @@ namespace QuantLib {
         lag_ = surf_->observationLag();
         capfloor_ =
             MakeYoYInflationCapFloor(type, anIndex,
-                                     (Size)std::floor(0.5+surf->timeFromReference(surf->minMaturity())),
+                                     (Size)floor(0.5+surf->timeFromReference(surf->minMaturity())),
                                      surf->calendar(), lag, CPI::AsIndex)
             .withNominal(10000.0)
             .withStrike(K);
@@ -126,7 +126,7 @@ namespace QuantLib {
         tvec_[1] = surf_->dayCounter().yearFraction(surf_->referenceDate(),
                                                     dvec_[1]);
 
-        Size n = (Size)std::floor(0.5 + surf->timeFromReference(surf_->minMaturity()));
+        Size n = (Size)floor(0.5 + surf->timeFromReference(surf_->minMaturity()));
         QL_REQUIRE( n > 0,
                     "first maturity in price surface not > 0: "
                     << n);
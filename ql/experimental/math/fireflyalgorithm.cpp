@@ -192,7 +192,7 @@ namespace QuantLib {
                         }
                     }
                     Real val = P.value(z);
-                    if(!std::isnan(val))
+                    if(!isnan(val))
 					{
 						//Accept new point
                         x = z;
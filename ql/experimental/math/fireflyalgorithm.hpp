@@ -148,7 +148,7 @@ namespace QuantLib {
               : beta0_(beta0), betaMin_(betaMin), gamma_(gamma) {}
       protected:
         Real intensityImpl(Real valueX, Real valueY, Real d) override {
-            return (beta0_ - betaMin_) * std::exp(-gamma_ * d) + betaMin_;
+            return (beta0_ - betaMin_) * exp(-gamma_ * d) + betaMin_;
         }
           Real beta0_, betaMin_, gamma_;
     };
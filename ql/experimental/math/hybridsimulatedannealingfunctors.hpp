@@ -71,7 +71,7 @@ namespace QuantLib
             QL_REQUIRE(newPoint.size() == currentPoint.size(), "Incompatible input");
             QL_REQUIRE(newPoint.size() == temp.size(), "Incompatible input");
             for (Size i = 0; i < currentPoint.size(); i++)
-                newPoint[i] = currentPoint[i] + std::sqrt(temp[i]) * distribution_(generator_);
+                newPoint[i] = currentPoint[i] + sqrt(temp[i]) * distribution_(generator_);
         };
     private:
         std::mt19937 generator_;
@@ -96,7 +96,7 @@ namespace QuantLib
             QL_REQUIRE(newPoint.size() == currentPoint.size(), "Incompatible input");
             QL_REQUIRE(newPoint.size() == temp.size(), "Incompatible input");
             for (Size i = 0; i < currentPoint.size(); i++){
-                newPoint[i] = currentPoint[i] + std::sqrt(temp[i]) * distribution_(generator_);
+                newPoint[i] = currentPoint[i] + sqrt(temp[i]) * distribution_(generator_);
                 while(newPoint[i] < lower_[i] || newPoint[i] > upper_[i]){
 					if(newPoint[i] < lower_[i]){
 						newPoint[i] = upper_[i] + newPoint[i] - lower_[i];
@@ -130,7 +130,7 @@ namespace QuantLib
             QL_REQUIRE(newPoint.size() == currentPoint.size(), "Incompatible input");
             QL_REQUIRE(newPoint.size() == temp.size(), "Incompatible input");
             for (Size i = 0; i < currentPoint.size(); i++){
-                newPoint[i] = currentPoint[i] + std::sqrt(temp[i]) * distribution_(generator_);
+                newPoint[i] = currentPoint[i] + sqrt(temp[i]) * distribution_(generator_);
                 while(newPoint[i] < lower_[i] || newPoint[i] > upper_[i]){
 					if(newPoint[i] < lower_[i]){
 						newPoint[i] = lower_[i] + lower_[i] - newPoint[i];
@@ -192,8 +192,8 @@ namespace QuantLib
                 while (newPoint[i] < lower_[i] || newPoint[i] > upper_[i]) {
                     Real draw = distribution_(generator_);
                     Real sign = static_cast<int>(0.5 < draw) - static_cast<int>(draw < 0.5);
-                    Real y = sign*temp[i] * (std::pow(1.0 + 1.0 / temp[i],
-                                                      std::abs(2 * draw - 1.0)) - 1.0);
+                    Real y = sign*temp[i] * (pow(1.0 + 1.0 / temp[i],
+                                                      abs(2 * draw - 1.0)) - 1.0);
                     newPoint[i] = currentPoint[i] + y*(upper_[i] - lower_[i]);
                 }
             }
@@ -262,7 +262,7 @@ namespace QuantLib
             QL_REQUIRE(currTemp.size() == initialTemp_.size(), "Incompatible input");
             QL_REQUIRE(currTemp.size() == newTemp.size(), "Incompatible input");
             for (Size i = 0; i < initialTemp_.size(); i++)
-                newTemp[i] = initialTemp_[i] / std::log(steps[i]);
+                newTemp[i] = initialTemp_[i] / log(steps[i]);
         }
     private:
         Array initialTemp_;
@@ -293,7 +293,7 @@ namespace QuantLib
             QL_REQUIRE(currTemp.size() == initialTemp_.size(), "Incompatible input");
             QL_REQUIRE(currTemp.size() == newTemp.size(), "Incompatible input");
             for (Size i = 0; i < initialTemp_.size(); i++)
-                newTemp[i] = initialTemp_[i] / std::pow(steps[i], inverseN_);
+                newTemp[i] = initialTemp_[i] / pow(steps[i], inverseN_);
         }
     private:
         Real inverseN_;
@@ -308,7 +308,7 @@ namespace QuantLib
             QL_REQUIRE(currTemp.size() == initialTemp_.size(), "Incompatible input");
             QL_REQUIRE(currTemp.size() == newTemp.size(), "Incompatible input");
             for (Size i = 0; i < initialTemp_.size(); i++)
-                newTemp[i] = initialTemp_[i] * std::pow(power_, steps[i]);
+                newTemp[i] = initialTemp_[i] * pow(power_, steps[i]);
         }
     private:
         Array initialTemp_;
@@ -322,15 +322,15 @@ namespace QuantLib
         TemperatureVeryFastAnnealing(Real initialTemp, Real finalTemp, Real maxSteps, Size dimension)
             :inverseN_(1.0 / dimension), initialTemp_(dimension, initialTemp),
             finalTemp_(dimension, finalTemp), exponent_(dimension, 0.0) {
-            Real coeff = std::pow(maxSteps, -inverseN_);
+            Real coeff = pow(maxSteps, -inverseN_);
             for (Size i = 0; i < initialTemp_.size(); i++)
-                exponent_[i] = -std::log(finalTemp_[i] / initialTemp_[i])*coeff;
+                exponent_[i] = -log(finalTemp_[i] / initialTemp_[i])*coeff;
         }
         void operator()(Array &newTemp, const Array &currTemp, const Array &steps) {
             QL_REQUIRE(currTemp.size() == initialTemp_.size(), "Incompatible input");
             QL_REQUIRE(currTemp.size() == newTemp.size(), "Incompatible input");
             for (Size i = 0; i < initialTemp_.size(); i++)
-                newTemp[i] = initialTemp_[i] * exp(-exponent_[i] * std::pow(steps[i], inverseN_));
+                newTemp[i] = initialTemp_[i] * exp(-exponent_[i] * pow(steps[i], inverseN_));
         }
     private:
         Real inverseN_;
@@ -386,7 +386,7 @@ namespace QuantLib
             Array ofssetPoint(currentPoint);
             for (Size i = 0; i < N_; i++) {
                 ofssetPoint[i] += stepSize_;
-                finiteDiffs[i] = bounded_[i] * std::abs((problem_->value(ofssetPoint) - currentValue) / stepSize_);
+                finiteDiffs[i] = bounded_[i] * abs((problem_->value(ofssetPoint) - currentValue) / stepSize_);
                 ofssetPoint[i] -= stepSize_;
                 if (finiteDiffs[i] < minSize_)
                     finiteDiffs[i] = minSize_;
@@ -397,10 +397,10 @@ namespace QuantLib
                 Real tRatio = initialTemp_[i] / currTemp[i];
                 Real sRatio = finiteDiffMax / finiteDiffs[i];
                 if (sRatio*tRatio < functionTol_)
-                    steps[i] = std::pow(std::fabs(std::log(functionTol_)),
+                    steps[i] = pow(fabs(log(functionTol_)),
                                         Integer(N_));
                 else
-                    steps[i] = std::pow(std::fabs(std::log(sRatio*tRatio)),
+                    steps[i] = pow(fabs(log(sRatio*tRatio)),
                                         Integer(N_));
             }
         }
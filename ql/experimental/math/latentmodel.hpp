@@ -649,7 +649,7 @@ namespace QuantLib {
       nVariables_(factorWeights.size()), copula_(factorWeights, ini)
     {
         for(Size i=0; i<factorWeights.size(); i++) {
-            idiosyncFctrs_.push_back(std::sqrt(1.-
+            idiosyncFctrs_.push_back(sqrt(1.-
                     std::inner_product(factorWeights[i].begin(), 
                 factorWeights[i].end(), 
                 factorWeights[i].begin(), Real(0.))));
@@ -669,7 +669,7 @@ namespace QuantLib {
         for (Real factorWeight : factorWeights)
             factorWeights_.emplace_back(1, factorWeight);
         for (Real factorWeight : factorWeights)
-            idiosyncFctrs_.push_back(std::sqrt(1. - factorWeight * factorWeight));
+            idiosyncFctrs_.push_back(sqrt(1. - factorWeight * factorWeight));
         //convert row to column vector....
         copula_ = copulaType(factorWeights_, ini);
     }
@@ -681,7 +681,7 @@ namespace QuantLib {
         const typename Impl::initTraits& ini)
     : factorWeights_(nVariables, std::vector<Real>(1, correlSqr)),
       idiosyncFctrs_(nVariables, 
-        std::sqrt(1.-correlSqr*correlSqr)),
+        sqrt(1.-correlSqr*correlSqr)),
       nFactors_(1), 
       nVariables_(nVariables),
       copula_(factorWeights_, ini)
@@ -693,10 +693,10 @@ namespace QuantLib {
         Size nVariables,
         const typename Impl::initTraits& ini)
     : factorWeights_(nVariables, std::vector<Real>(1, 
-        std::sqrt(singleFactorCorrel->value()))),
+        sqrt(singleFactorCorrel->value()))),
       cachedMktFactor_(singleFactorCorrel),
       idiosyncFctrs_(nVariables, 
-        std::sqrt(1.-singleFactorCorrel->value())),
+        sqrt(1.-singleFactorCorrel->value())),
       nFactors_(1), 
       nVariables_(nVariables),
       copula_(factorWeights_, ini)
@@ -714,9 +714,9 @@ namespace QuantLib {
         square root of the correlation.
         */
         factorWeights_ = std::vector<std::vector<Real> >(nVariables_, 
-            std::vector<Real>(1, std::sqrt(cachedMktFactor_->value())));
+            std::vector<Real>(1, sqrt(cachedMktFactor_->value())));
         idiosyncFctrs_ = std::vector<Real>(nVariables_, 
-            std::sqrt(1.-cachedMktFactor_->value()));
+            sqrt(1.-cachedMktFactor_->value()));
         copula_ = copulaType(factorWeights_, copula_.getInitTraits());
         notifyObservers();
     }
@@ -83,7 +83,7 @@ namespace QuantLib {
             u = 2.* uniformGenerator_.next().value - 1.;
             rSqr = v*v + u*u;
         }while(rSqr >= 1.);
-        return {u * std::sqrt(degFreedom_ * (std::pow(rSqr, -2. / degFreedom_) - 1.) / rSqr), 1.};
+        return {u * sqrt(degFreedom_ * (pow(rSqr, -2. / degFreedom_) - 1.) / rSqr), 1.};
     }
 
 }
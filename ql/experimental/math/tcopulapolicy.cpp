@@ -36,7 +36,7 @@ namespace QuantLib {
             // For low values of the T order this number is very close to zero 
             // and it enters the expressions dividing them, which introduces 
             // numerical errors.
-            varianceFactors_.push_back(std::sqrt((tOrder - 2.) / tOrder));
+            varianceFactors_.push_back(sqrt((tOrder - 2.) / tOrder));
         }
 
         for (const auto& factorWeight : factorWeights) {
@@ -49,7 +49,7 @@ namespace QuantLib {
                                                   factorWeight.begin(), Real(0.));
             QL_REQUIRE(factorsNorm < 1., 
                 "Non normal random factor combination.");
-            Real idiosyncFctr = std::sqrt(1.-factorsNorm);
+            Real idiosyncFctr = sqrt(1.-factorsNorm);
 
             // linear comb factors ajusted for the variance renormalization:
             std::vector<Real> normFactorWeights;
@@ -63,8 +63,8 @@ namespace QuantLib {
         const Real sigma = sqrtProcess_->sigma();
 
         const Real df  = 4*theta*kappa/(sigma*sigma);
-        const Real ncp = 4*kappa*std::exp(-kappa*t)
-            / (sigma*sigma*(1-std::exp(-kappa*t)))*sqrtProcess_->x0();
+        const Real ncp = 4*kappa*exp(-kappa*t)
+            / (sigma*sigma*(1-exp(-kappa*t)))*sqrtProcess_->x0();
 
         return std::make_pair(df, ncp);
     }
@@ -29,7 +29,7 @@ namespace QuantLib {
         Real rho,
         ext::shared_ptr<ExtOUWithJumpsProcess> klugeProcess,
         ext::shared_ptr<ExtendedOrnsteinUhlenbeckProcess> ouProcess)
-    : rho_(rho), sqrtMRho_(std::sqrt(1 - rho * rho)), klugeProcess_(std::move(klugeProcess)),
+    : rho_(rho), sqrtMRho_(sqrt(1 - rho * rho)), klugeProcess_(std::move(klugeProcess)),
       ouProcess_(std::move(ouProcess)) {
         QL_REQUIRE(klugeProcess_, "null Kluge process");
         QL_REQUIRE(ouProcess_, "null Ornstein-Uhlenbeck process");
@@ -59,7 +59,7 @@ NoArbSabrModel::NoArbSabrModel(const Real expiryTime, const Real forward,
     QL_REQUIRE(forward > 0.0, "forward (" << forward << ") must be positive");
     QL_REQUIRE(beta >= detail::NoArbSabrModel::beta_min && beta <= detail::NoArbSabrModel::beta_max,
                "beta (" << beta << ") out of bounds");
-    Real sigmaI = alpha * std::pow(forward, beta - 1.0);
+    Real sigmaI = alpha * pow(forward, beta - 1.0);
     QL_REQUIRE(sigmaI >= detail::NoArbSabrModel::sigmaI_min &&
                    sigmaI <= detail::NoArbSabrModel::sigmaI_max,
                "sigmaI = alpha*forward^(beta-1.0) ("
@@ -98,7 +98,7 @@ NoArbSabrModel::NoArbSabrModel(const Real expiryTime, const Real forward,
 
     try {
         Brent b;
-        Real start = std::sqrt(externalForward_ - detail::NoArbSabrModel::strike_min);
+        Real start = sqrt(externalForward_ - detail::NoArbSabrModel::strike_min);
         Real tmp =
             b.solve([&](Real x){ return forwardError(x); },
                     detail::NoArbSabrModel::forward_accuracy, start,
@@ -109,7 +109,7 @@ NoArbSabrModel::NoArbSabrModel(const Real expiryTime, const Real forward,
         forward_ = externalForward_;
     }
 
-    Real d = forwardError(std::sqrt(forward_ - detail::NoArbSabrModel::strike_min));
+    Real d = forwardError(sqrt(forward_ - detail::NoArbSabrModel::strike_min));
     numericalForward_ = d + externalForward_;
 }
 
@@ -146,35 +146,35 @@ Real NoArbSabrModel::p(const Real f) const {
         forward_ < detail::NoArbSabrModel::density_lower_bound)
         return 0.0;
 
-    Real fOmB = std::pow(f, 1.0 - beta_);
-    Real FOmB = std::pow(forward_, 1.0 - beta_);
+    Real fOmB = pow(f, 1.0 - beta_);
+    Real FOmB = pow(forward_, 1.0 - beta_);
 
     Real zf = fOmB / (alpha_ * (1.0 - beta_));
     Real zF = FOmB / (alpha_ * (1.0 - beta_));
     Real z = zF - zf;
 
     // Real JzF = std::sqrt(1.0 - 2.0 * rho_ * nu_ * zF + nu_ * nu_ * zF * zF);
-    Real Jmzf = std::sqrt(1.0 + 2.0 * rho_ * nu_ * zf + nu_ * nu_ * zf * zf);
-    Real Jz = std::sqrt(1.0 - 2.0 * rho_ * nu_ * z + nu_ * nu_ * z * z);
+    Real Jmzf = sqrt(1.0 + 2.0 * rho_ * nu_ * zf + nu_ * nu_ * zf * zf);
+    Real Jz = sqrt(1.0 - 2.0 * rho_ * nu_ * z + nu_ * nu_ * z * z);
 
-    Real xz = std::log((Jz - rho_ + nu_ * z) / (1.0 - rho_)) / nu_;
+    Real xz = log((Jz - rho_ + nu_ * z) / (1.0 - rho_)) / nu_;
     Real Bp_B = beta_ / FOmB;
     // Real Bpp_B = beta_ * (2.0 * beta_ - 1.0) / (FOmB * FOmB);
     Real kappa1 = 0.125 * nu_ * nu_ * (2.0 - 3.0 * rho_ * rho_) -
                   0.25 * rho_ * nu_ * alpha_ * Bp_B;
     // Real kappa2 = alpha_ * alpha_ * (0.25 * Bpp_B - 0.375 * Bp_B * Bp_B);
     Real gamma = 1.0 / (2.0 * (1.0 - beta_));
-    Real sqrtOmR = std::sqrt(1.0 - rho_ * rho_);
+    Real sqrtOmR = sqrt(1.0 - rho_ * rho_);
     Real h = 0.5 * beta_ * rho_ / ((1.0 - beta_) * Jmzf * Jmzf) *
-             (nu_ * zf * std::log(zf * Jz / zF) +
+             (nu_ * zf * log(zf * Jz / zF) +
               (1 + rho_ * nu_ * zf) / sqrtOmR *
-                  (std::atan((nu_ * z - rho_) / sqrtOmR) +
-                   std::atan(rho_ / sqrtOmR)));
+                  (atan((nu_ * z - rho_) / sqrtOmR) +
+                   atan(rho_ / sqrtOmR)));
 
     Real res =
-        std::pow(Jz, -1.5) / (alpha_ * std::pow(f, beta_) * expiryTime_) *
-        std::pow(zf, 1.0 - gamma) * std::pow(zF, gamma) *
-        std::exp(-(xz * xz) / (2.0 * expiryTime_) +
+        pow(Jz, -1.5) / (alpha_ * pow(f, beta_) * expiryTime_) *
+        pow(zf, 1.0 - gamma) * pow(zF, gamma) *
+        exp(-(xz * xz) / (2.0 * expiryTime_) +
                  (h + kappa1 * expiryTime_)) *
         modifiedBesselFunction_i_exponentiallyWeighted(gamma,
                                                        Real(zF * zf / expiryTime_));
@@ -189,7 +189,7 @@ D0Interpolator::D0Interpolator(const Real forward, const Real expiryTime,
     : forward_(forward), expiryTime_(expiryTime), alpha_(alpha), beta_(beta),
       nu_(nu), rho_(rho), gamma_(1.0 / (2.0 * (1.0 - beta_))) {
 
-    sigmaI_ = alpha_ * std::pow(forward_, beta_ - 1.0);
+    sigmaI_ = alpha_ * pow(forward_, beta_ - 1.0);
 
     tauG_ = {
         0.25, 0.5, 0.75, 1.0, 1.25, 1.5, 1.75, 2.0, 2.25, 2.5, 2.75, 3.0,
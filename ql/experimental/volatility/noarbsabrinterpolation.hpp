@@ -45,29 +45,29 @@ struct NoArbSabrSpecs {
         // check if alpha / beta is admissable, otherwise adjust
         // if possible (i.e. not fixed, otherwise an exception will
         // be thrown from the model constructor anyway)
-        Real sigmaI = params[0] * std::pow(forward, params[1] - 1.0);
+        Real sigmaI = params[0] * pow(forward, params[1] - 1.0);
         if (sigmaI < detail::NoArbSabrModel::sigmaI_min) {
             if (!paramIsFixed[0])
                 params[0] = detail::NoArbSabrModel::sigmaI_min * (1.0 + eps()) /
-                            std::pow(forward, params[1] - 1.0);
+                            pow(forward, params[1] - 1.0);
             else {
                 if (!paramIsFixed[1])
                     params[1] = 1.0 +
-                                std::log(detail::NoArbSabrModel::sigmaI_min *
+                                log(detail::NoArbSabrModel::sigmaI_min *
                                          (1.0 + eps()) / params[0]) /
-                                    std::log(forward);
+                                    log(forward);
             }
         }
         if (sigmaI > detail::NoArbSabrModel::sigmaI_max) {
             if (!paramIsFixed[0])
                 params[0] = detail::NoArbSabrModel::sigmaI_max * (1.0 - eps()) /
-                            std::pow(forward, params[1] - 1.0);
+                            pow(forward, params[1] - 1.0);
             else {
                 if (!paramIsFixed[1])
                     params[1] = 1.0 +
-                                std::log(detail::NoArbSabrModel::sigmaI_max *
+                                log(detail::NoArbSabrModel::sigmaI_max *
                                          (1.0 - eps()) / params[0]) /
-                                    std::log(forward);
+                                    log(forward);
             }
         }
     }
@@ -87,7 +87,7 @@ struct NoArbSabrSpecs {
                               r[j++];
             sigmaI *= (1.0 - eps());
             sigmaI += eps() / 2.0;
-            values[0] = sigmaI / std::pow(forward, values[1] - 1.0);
+            values[0] = sigmaI / pow(forward, values[1] - 1.0);
         }
         if (!paramIsFixed[2])
             values[2] = detail::NoArbSabrModel::nu_min +
@@ -103,23 +103,23 @@ struct NoArbSabrSpecs {
     Array inverse(const Array &y, const std::vector<bool> &paramIsFixed,
                   const std::vector<Real> &params, const Real forward) {
         Array x(4);
-        x[1] = std::tan((y[1] - detail::NoArbSabrModel::beta_min) /
+        x[1] = tan((y[1] - detail::NoArbSabrModel::beta_min) /
                             (detail::NoArbSabrModel::beta_max -
                              detail::NoArbSabrModel::beta_min) *
                             M_PI +
                         M_PI / 2.0);
-        x[0] = std::tan((y[0] * std::pow(forward, y[1] - 1.0) -
+        x[0] = tan((y[0] * pow(forward, y[1] - 1.0) -
                          detail::NoArbSabrModel::sigmaI_min) /
                             (detail::NoArbSabrModel::sigmaI_max -
                              detail::NoArbSabrModel::sigmaI_min) *
                             M_PI -
                         M_PI / 2.0);
-        x[2] = std::tan((y[2] - detail::NoArbSabrModel::nu_min) /
+        x[2] = tan((y[2] - detail::NoArbSabrModel::nu_min) /
                             (detail::NoArbSabrModel::nu_max -
                              detail::NoArbSabrModel::nu_min) *
                             M_PI +
                         M_PI / 2.0);
-        x[3] = std::tan((y[3] - detail::NoArbSabrModel::rho_min) /
+        x[3] = tan((y[3] - detail::NoArbSabrModel::rho_min) /
                             (detail::NoArbSabrModel::rho_max -
                              detail::NoArbSabrModel::rho_min) *
                             M_PI +
@@ -135,31 +135,31 @@ struct NoArbSabrSpecs {
             y[1] = detail::NoArbSabrModel::beta_min +
                    (detail::NoArbSabrModel::beta_max -
                     detail::NoArbSabrModel::beta_min) *
-                       (std::atan(x[1]) + M_PI / 2.0) / M_PI;
+                       (atan(x[1]) + M_PI / 2.0) / M_PI;
         // we compute alpha from sigmaI using beta
         // if alpha is fixed we have to check if beta is admissable
         // and adjust if need be
         if (paramIsFixed[0]) {
             y[0] = params[0];
-            Real sigmaI = y[0] * std::pow(forward, y[1] - 1.0);
+            Real sigmaI = y[0] * pow(forward, y[1] - 1.0);
             if (sigmaI < detail::NoArbSabrModel::sigmaI_min) {
                 y[1] = (1.0 +
-                        std::log(detail::NoArbSabrModel::sigmaI_min *
+                        log(detail::NoArbSabrModel::sigmaI_min *
                                  (1.0 + eps()) / y[0]) /
-                            std::log(forward));
+                            log(forward));
             }
             if (sigmaI > detail::NoArbSabrModel::sigmaI_max) {
                 y[1] = (1.0 +
-                        std::log(detail::NoArbSabrModel::sigmaI_max *
+                        log(detail::NoArbSabrModel::sigmaI_max *
                                  (1.0 - eps()) / y[0]) /
-                            std::log(forward));
+                            log(forward));
             }
         } else {
             Real sigmaI = detail::NoArbSabrModel::sigmaI_min +
                           (detail::NoArbSabrModel::sigmaI_max -
                            detail::NoArbSabrModel::sigmaI_min) *
-                              (std::atan(x[0]) + M_PI / 2.0) / M_PI;
-            y[0] = sigmaI / std::pow(forward, y[1] - 1.0);
+                              (atan(x[0]) + M_PI / 2.0) / M_PI;
+            y[0] = sigmaI / pow(forward, y[1] - 1.0);
         }
         if (paramIsFixed[2])
             y[2] = params[2];
@@ -167,14 +167,14 @@ struct NoArbSabrSpecs {
             y[2] = detail::NoArbSabrModel::nu_min +
                    (detail::NoArbSabrModel::nu_max -
                     detail::NoArbSabrModel::nu_min) *
-                       (std::atan(x[2]) + M_PI / 2.0) / M_PI;
+                       (atan(x[2]) + M_PI / 2.0) / M_PI;
         if (paramIsFixed[3])
             y[3] = params[3];
         else
             y[3] = detail::NoArbSabrModel::rho_min +
                    (detail::NoArbSabrModel::rho_max -
                     detail::NoArbSabrModel::rho_min) *
-                       (std::atan(x[3]) + M_PI / 2.0) / M_PI;
+                       (atan(x[3]) + M_PI / 2.0) / M_PI;
         return y;
     }
     Real weight(const Real strike, const Real forward, const Real stdDev,
@@ -49,7 +49,7 @@ namespace QuantLib {
 
       protected:
         Volatility blackVolImpl(Time t, Real strike) const override {
-            const Real fwd = s0_*std::exp(r_*t);
+            const Real fwd = s0_*exp(r_*t);
             return sabrVolatility(strike, fwd, t, alpha_, beta_, gamma_, rho_);
         }
 
@@ -47,10 +47,35 @@ void SviSmileSection::init() {
 
 Volatility SviSmileSection::volatilityImpl(Rate strike) const {
 
-    Real k = std::log(std::max(strike, 1E-6) / forward_);
+    Real k = log(std::max(strike, 1E-6) / forward_);
     Real totalVariance = detail::sviTotalVariance(params_[0], params_[1], params_[2],
                                                   params_[3], params_[4],k);
-    return std::sqrt(std::max(0.0, totalVariance / exerciseTime()));
+    return sqrt(std::max(0.0, totalVariance / exerciseTime()));
 
 }
+
+void SviSmileSection::volatilities(const Rate* strikes, Volatility* volatilities, Size n) const {
+
+    const Real a = params_[0], b = params_[1], sigma = params_[2], rho = params_[3],
+               m = params_[4];
+    const Time t = exerciseTime();
+    for (Size i = 0; i < n; ++i) {
+        Real k = log(std::max(strikes[i], 1E-6) / forward_);
+        Real totalVariance = detail::sviTotalVariance(a, b, sigma, rho, m, k);
+        volatilities[i] = sqrt(std::max(0.0, totalVariance / t));
+    }
+}
+
+void SviSmileSection::optionPrices(const Rate* strikes,
+                                   Real* prices,
+                                   Size n,
+                                   Option::Type type,
+                                   Real discount) const {
+    std::vector<Volatility> vols(n);
+    volatilities(strikes, vols.data(), n);
+    const Time t = exerciseTime();
+    for (Size i = 0; i < n; ++i)
+        prices[i] = optionPriceFromStdDev(strikes[i], sqrt(vols[i] * vols[i] * t), type,
+                                          discount);
+}
 } // namespace QuantLib
@@ -57,6 +57,12 @@ class SviSmileSection : public SmileSection {
     Real minStrike() const override { return 0.0; }
     Real maxStrike() const override { return QL_MAX_REAL; }
     Real atmLevel() const override { return forward_; }
+    void volatilities(const Rate* strikes, Volatility* volatilities, Size n) const override;
+    void optionPrices(const Rate* strikes,
+                      Real* prices,
+                      Size n,
+                      Option::Type type = Option::Call,
+                      Real discount = 1.0) const override;
 
   protected:
     Volatility volatilityImpl(Rate strike) const override;
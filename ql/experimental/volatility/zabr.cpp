@@ -43,7 +43,7 @@ ZabrModel::ZabrModel(const Real expiryTime, const Real forward,
                      const Real alpha, const Real beta, const Real nu,
                      const Real rho, const Real gamma)
     : expiryTime_(expiryTime), forward_(forward), alpha_(alpha), beta_(beta),
-      nu_(nu * std::pow(alpha_, 1.0 - gamma)), rho_(rho), gamma_(gamma) {
+      nu_(nu * pow(alpha_, 1.0 - gamma)), rho_(rho), gamma_(gamma) {
 
     validateSabrParameters(alpha, beta, nu, rho);
     QL_REQUIRE(gamma >= 0.0 /*&& gamma<=1.0*/,
@@ -57,9 +57,9 @@ ZabrModel::ZabrModel(const Real expiryTime, const Real forward,
 Real ZabrModel::lognormalVolatilityHelper(const Real strike,
                                           const Real x) const {
     if (close(strike, forward_))
-        return std::pow(forward_, beta_ - 1.0) * alpha_;
+        return pow(forward_, beta_ - 1.0) * alpha_;
     else
-        return std::log(forward_ / strike) / x;
+        return log(forward_ / strike) / x;
 }
 
 Real ZabrModel::lognormalVolatility(const Real strike) const {
@@ -76,7 +76,7 @@ std::vector<Real> ZabrModel::lognormalVolatility(const std::vector<Real> &strike
 
 Real ZabrModel::normalVolatilityHelper(const Real strike, const Real x) const {
     if (close(strike, forward_))
-        return std::pow(forward_, beta_) * alpha_;
+        return pow(forward_, beta_) * alpha_;
     else
         return (forward_ - strike) / x;
 }
@@ -94,8 +94,8 @@ std::vector<Real> ZabrModel::normalVolatility(const std::vector<Real> &strikes)
 }
 
 Real ZabrModel::localVolatilityHelper(const Real f, const Real x) const {
-    return alpha_ * std::pow(std::fabs(f), beta_) /
-           F(y(f), std::pow(alpha_, gamma_ - 1.0) *
+    return alpha_ * pow(fabs(f), beta_) /
+           F(y(f), pow(alpha_, gamma_ - 1.0) *
                        x); // TODO optimize this, y is comoputed together
                            // with x already
 }
@@ -127,7 +127,7 @@ std::vector<Real> ZabrModel::fdPrice(const std::vector<Real> &strikes) const {
     const Size size = 500;                    // grid points
     const Real density = 0.1; // density for concentrating mesher
     const Size steps =
-        (Size)std::ceil(expiryTime_ * 24); // number of steps in dimension t
+        (Size)ceil(expiryTime_ * 24); // number of steps in dimension t
     const Size dampingSteps = 5;           // thereof damping steps
 
 #if defined(__GNUC__) && (__GNUC__ >= 12)
@@ -202,16 +202,16 @@ Real ZabrModel::fullFdPrice(const Real strike) const {
     Real eps = 0.01;
     Real scaleFactor = 1.5;
     Real normInvEps = InverseCumulativeNormal()(1.0 - eps);
-    Real alphaI = alpha_ * std::pow(forward_, beta_ - 1.0);
+    Real alphaI = alpha_ * pow(forward_, beta_ - 1.0);
     // nu is already standardized within this class ...
-    Real v0 = alpha_ * std::exp(-scaleFactor * normInvEps *
-                                std::sqrt(expiryTime_) * nu_);
+    Real v0 = alpha_ * exp(-scaleFactor * normInvEps *
+                                sqrt(expiryTime_) * nu_);
     Real v1 = alpha_ *
-              std::exp(scaleFactor * normInvEps * std::sqrt(expiryTime_) * nu_);
-    Real f0 = forward_ * std::exp(-scaleFactor * normInvEps *
-                                  std::sqrt(expiryTime_) * alphaI);
-    Real f1 = forward_ * std::exp(scaleFactor * normInvEps *
-                                  std::sqrt(expiryTime_) * alphaI);
+              exp(scaleFactor * normInvEps * sqrt(expiryTime_) * nu_);
+    Real f0 = forward_ * exp(-scaleFactor * normInvEps *
+                                  sqrt(expiryTime_) * alphaI);
+    Real f1 = forward_ * exp(scaleFactor * normInvEps *
+                                  sqrt(expiryTime_) * alphaI);
     v1 = std::min(v1, 2.0);
     f0 = std::min(strike / 2.0, f0);
     f1 = std::max(strike * 1.5, std::min(f1, std::max(2.0, strike * 1.5)));
@@ -239,7 +239,7 @@ Real ZabrModel::fullFdPrice(const Real strike) const {
     const Real x0 = std::min(forward_, strike);
     const Real x1 = std::max(forward_, strike);
     const Size sizefa = std::max<Size>(
-        4, (Size)std::ceil(((x0 + x1) / 2.0 - f0) / (f1 - f0) * (Real)sizef));
+        4, (Size)ceil(((x0 + x1) / 2.0 - f0) / (f1 - f0) * (Real)sizef));
     const Size sizefb = sizef - sizefa + 1; // common point, so we can spend
     // one more here
     const ext::shared_ptr<Fdm1dMesher> mfa(
@@ -330,10 +330,10 @@ std::vector<Real> ZabrModel::x(const std::vector<Real> &strikes) const {
 
     if (close(gamma_, 1.0)) {
         for (Size m = 0; m < y.size(); m++) {
-            Real J = std::sqrt(1.0 + nu_ * nu_ * y[m] * y[m] -
+            Real J = sqrt(1.0 + nu_ * nu_ * y[m] * y[m] -
                                2.0 * rho_ * nu_ * y[m]);
             result[y.size() - 1 - m] =
-                std::log((J + nu_ * y[m] - rho_) / (1.0 - rho_)) / nu_;
+                log((J + nu_ * y[m] - rho_) / (1.0 - rho_)) / nu_;
         }
     } else {
         Size ynz = std::upper_bound(y.begin(), y.end(), 0.0) - y.begin();
@@ -362,14 +362,14 @@ std::vector<Real> ZabrModel::x(const std::vector<Real> &strikes) const {
 Real ZabrModel::y(const Real strike) const {
 
     if (close(beta_, 1.0)) {
-        return std::log(forward_ / strike) * std::pow(alpha_, gamma_ - 2.0);
+        return log(forward_ / strike) * pow(alpha_, gamma_ - 2.0);
     } else {
         return (strike < 0.0
-                    ? Real(std::pow(forward_, 1.0 - beta_) +
-                          std::pow(-strike, 1.0 - beta_))
-                    : Real(std::pow(forward_, 1.0 - beta_) -
-                          std::pow(strike, 1.0 - beta_))) *
-               std::pow(alpha_, gamma_ - 2.0) / (1.0 - beta_);
+                    ? Real(pow(forward_, 1.0 - beta_) +
+                          pow(-strike, 1.0 - beta_))
+                    : Real(pow(forward_, 1.0 - beta_) -
+                          pow(strike, 1.0 - beta_))) *
+               pow(alpha_, gamma_ - 2.0) / (1.0 - beta_);
     }
 }
 
@@ -379,7 +379,7 @@ Real ZabrModel::F(const Real y, const Real u) const {
     Real B = 2.0 * rho_ * (1.0 - gamma_) * nu_ +
              2.0 * (1.0 - gamma_) * (gamma_ - 2.0) * nu_ * nu_ * y;
     Real C = (1.0 - gamma_) * (1.0 - gamma_) * nu_ * nu_;
-    return (-B * u + std::sqrt(B * B * u * u - 4.0 * A * (C * u * u - 1.0))) /
+    return (-B * u + sqrt(B * B * u * u - 4.0 * A * (C * u * u - 1.0))) /
            (2.0 * A);
 }
 }
@@ -249,7 +249,7 @@ void ZabrSmileSection<Evaluation>::init3(ZabrLocalVolatility) {
     Real c0p = ((*callPriceFct_)(strikes_.back() - eps) - c0) / eps;
 
     a_ = c0p / c0;
-    b_ = std::log(c0) + a_ * strikes_.back();
+    b_ = log(c0) + a_ * strikes_.back();
 }
 
 template <typename Evaluation>
@@ -271,7 +271,7 @@ Real ZabrSmileSection<Evaluation>::optionPrice(Real strike, Option::Type type,
                                                ZabrShortMaturityNormal) const {
     return bachelierBlackFormula(
         type, strike, forward_,
-        model_->normalVolatility(strike) * std::sqrt(exerciseTime()), discount);
+        model_->normalVolatility(strike) * sqrt(exerciseTime()), discount);
 }
 
 template <typename Evaluation>
@@ -315,7 +315,7 @@ ZabrSmileSection<Evaluation>::volatilityImpl(Rate strike,
         impliedVol =
             blackFormulaImpliedStdDev(type, strike, model_->forward(),
                                       optionPrice(strike, type, 1.0), 1.0) /
-            std::sqrt(exerciseTime());
+            sqrt(exerciseTime());
     } catch (...) {
     }
     return impliedVol;
@@ -69,9 +69,9 @@ namespace QuantLib {
 
     inline Array BoundedLogGrid(Real xMin, Real xMax, Size steps) {
         Array result(steps+1);
-        Real gridLogSpacing = (std::log(xMax) - std::log(xMin)) / 
+        Real gridLogSpacing = (log(xMax) - log(xMin)) / 
             (steps);
-        Real edx = std::exp(gridLogSpacing);
+        Real edx = exp(gridLogSpacing);
         result[0] = xMin;
         for (Size j=1; j < steps+1; j++) {
             result[j] = result[j-1]*edx;
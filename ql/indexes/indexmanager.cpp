@@ -22,18 +22,20 @@
 namespace QuantLib {
 
     bool IndexManager::hasHistory(const std::string& name) const {
-        return data_.find(name) != data_.end();
+        return data_->find(name) != data_->end();
     }
 
     const TimeSeries<Real>& IndexManager::getHistory(const std::string& name) const {
-        return data_[name];
+        static const TimeSeries<Real> empty;
+        auto i = data_->find(name);
+        return i != data_->end() ? i->second : empty;
     }
 
     void IndexManager::setHistory(const std::string& name, TimeSeries<Real> history) {
         QL_DEPRECATED_DISABLE_WARNING
         notifier(name)->notifyObservers();
         QL_DEPRECATED_ENABLE_WARNING
-        data_[name] = std::move(history);
+        mutableData()[name] = std::move(history);
     }
 
     void IndexManager::addFixing(const std::string& name,
@@ -54,8 +56,8 @@ namespace QuantLib {
 
     std::vector<std::string> IndexManager::histories() const {
         std::vector<std::string> temp;
-        temp.reserve(data_.size());
-        for (const auto& i : data_)
+        temp.reserve(data_->size());
+        for (const auto& i : *data_)
             temp.push_back(i.first);
         return temp;
     }
@@ -64,20 +66,32 @@ namespace QuantLib {
         QL_DEPRECATED_DISABLE_WARNING
         notifier(name)->notifyObservers();
         QL_DEPRECATED_ENABLE_WARNING
-        data_.erase(name);
+        mutableData().erase(name);
     }
 
     void IndexManager::clearHistories() {
         QL_DEPRECATED_DISABLE_WARNING
-        for (auto const& d : data_)
+        for (auto const& d : *data_)
             notifier(d.first)->notifyObservers();
         QL_DEPRECATED_ENABLE_WARNING
-        data_.clear();
+        data_ = ext::make_shared<history_map>();
+    }
+
+    IndexManager::history_map& IndexManager::mutableData() {
+        if (data_.use_count() > 1)
+            data_ = ext::make_shared<history_map>(*data_);
+        return *data_;
+    }
+
+    void IndexManager::setHistories(ext::shared_ptr<history_map> histories) {
+        data_ = std::move(histories);
+        for (auto const& n : notifiers_)
+            n.second->notifyObservers();
     }
 
     bool IndexManager::hasHistoricalFixing(const std::string& name, const Date& fixingDate) const {
-        auto const& indexIter = data_.find(name);
-        return (indexIter != data_.end()) &&
+        auto const& indexIter = data_->find(name);
+        return (indexIter != data_->end()) &&
                ((*indexIter).second[fixingDate] != Null<Real>());
     }
 
@@ -38,6 +38,7 @@ namespace QuantLib {
     class IndexManager : public Singleton<IndexManager> {
         friend class Singleton<IndexManager>;
         friend class Index;
+        friend class PricingContext;
 
       private:
         IndexManager() = default;
@@ -95,9 +96,18 @@ namespace QuantLib {
           }
         };
 
-        mutable std::map<std::string, TimeSeries<Real>, CaseInsensitiveCompare> data_;
+        typedef std::map<std::string, TimeSeries<Real>, CaseInsensitiveCompare> history_map;
+
+        // shared with the pricing contexts capturing it, and copied
+        // before being modified if that is the case
+        ext::shared_ptr<history_map> data_ = ext::make_shared<history_map>();
         mutable std::map<std::string, ext::shared_ptr<Observable>> notifiers_;
 
+        //! the stored fixings, unshared before being modified
+        history_map& mutableData();
+        //! replaces all stored fixings
+        void setHistories(ext::shared_ptr<history_map> histories);
+
         //! add a fixing
         void addFixing(const std::string& name,
                        const Date& fixingDate,
@@ -111,7 +121,7 @@ namespace QuantLib {
                         ValueIterator vBegin,
                         bool forceOverwrite = false,
                         const std::function<bool(const Date& d)>& isValidFixingDate = {}) {
-            auto& h = data_[name];
+            auto& h = mutableData()[name];
             bool noInvalidFixing = true, noDuplicatedFixing = true;
             Date invalidDate, duplicatedDate;
             Real nullValue = Null<Real>();
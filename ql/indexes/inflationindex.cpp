@@ -229,7 +229,7 @@ namespace QuantLib {
         Rate Z1 = zeroInflation_->zeroRate(firstDateInPeriod, Period(0,Days), false);
         Time t1 = inflationYearFraction(frequency_, false, zeroInflation_->dayCounter(),
                                         baseDate, firstDateInPeriod);
-        return baseFixing * std::pow(1.0 + Z1, t1);
+        return baseFixing * pow(1.0 + Z1, t1);
     }
 
 
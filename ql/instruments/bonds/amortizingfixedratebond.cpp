@@ -100,8 +100,8 @@ namespace QuantLib {
                 ((Real)superDays.first)/((Real)subDays.second);
             Real maxPeriodRatio =
                 ((Real)superDays.second)/((Real)subDays.first);
-            auto lowRatio = static_cast<Integer>(std::floor(minPeriodRatio));
-            auto highRatio = static_cast<Integer>(std::ceil(maxPeriodRatio));
+            auto lowRatio = static_cast<Integer>(floor(minPeriodRatio));
+            auto highRatio = static_cast<Integer>(ceil(maxPeriodRatio));
 
             try {
                 for(Integer i=lowRatio; i <= highRatio; ++i) {
@@ -132,7 +132,7 @@ namespace QuantLib {
         notionals.front() = initialNotional;
         Real coupon = couponRate / static_cast<Real>(sinkingFrequency);
         Real compoundedInterest = 1.0;
-        Real totalValue = std::pow(1.0+coupon, nPeriods);
+        Real totalValue = pow(1.0+coupon, nPeriods);
         for (Size i = 0; i < (Size)nPeriods-1; ++i) {
             compoundedInterest *= (1.0 + coupon);
             Real currentNotional = 0.0;
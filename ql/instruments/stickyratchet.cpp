@@ -24,9 +24,9 @@ namespace QuantLib {
 
     // Double Sticky/Ratchet payoffs
     Real DoubleStickyRatchetPayoff::operator()(Real forward) const {
-        QL_REQUIRE((std::fabs(type1_)==1.0 || type1_==0.0),
+        QL_REQUIRE((fabs(type1_)==1.0 || type1_==0.0),
             "unknown/illegal type1 value (only 0.0 and +/-1,0 are allowed))");
-        QL_REQUIRE((std::fabs(type2_)==1.0 || type2_==0.0),
+        QL_REQUIRE((fabs(type2_)==1.0 || type2_==0.0),
             "unknown/illegal type2 value(only 0.0 and +/-1,0 are allowed)");
         Real swaplet = gearing3_ * forward + spread3_;
         Real effStrike1 = gearing1_ * initialValue1_ + spread1_;
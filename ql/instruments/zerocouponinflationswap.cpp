@@ -94,7 +94,7 @@ namespace QuantLib {
                                   detail::CPI::isInterpolated(observationInterpolation_),
                                   dayCounter_, baseDate_, obsDate_);
         // N.B. the -1.0 is because swaps only exchange growth, not notionals as well
-        Real fixedAmount = nominal * (std::pow(1.0 + fixedRate, T) - 1.0);
+        Real fixedAmount = nominal * (pow(1.0 + fixedRate, T) - 1.0);
 
         auto fixedCashFlow = ext::make_shared<SimpleCashFlow>(fixedAmount, fixedPayDate);
 
@@ -135,7 +135,7 @@ namespace QuantLib {
                                   detail::CPI::isInterpolated(observationInterpolation_),
                                   dayCounter_, baseDate_, obsDate_);
 
-        return std::pow(growth,1.0/T) - 1.0;
+        return pow(growth,1.0/T) - 1.0;
 
         // we cannot use this simple definition because
         // it does not work for already-issued instruments
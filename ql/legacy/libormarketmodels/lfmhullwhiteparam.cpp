@@ -50,7 +50,7 @@ namespace QuantLib {
             // "Reconstructing a valid correlation matrix from invalid data"
             // (<http://www.quarchome.org/correlationmatrix.pdf>)
             for (Size i=0; i < size_-1; ++i) {
-                Real p = std::sqrt(std::inner_product(
+                Real p = sqrt(std::inner_product(
                                      tmpSqrtCorr[i],tmpSqrtCorr[i]+factors_,
                                      tmpSqrtCorr[i], Real(0.0)));
                 std::transform(
@@ -75,7 +75,7 @@ namespace QuantLib {
                 * capletVol->dayCounter().yearFraction(fixingDates[0],
                                                        fixingDates[i]);
 
-            lambda.push_back(std::sqrt(  (var - cumVar)
+            lambda.push_back(sqrt(  (var - cumVar)
                                        / (fixingTimes[1] - fixingTimes[0])) );
 
             for (Size q=0; q<factors_; ++q) {
@@ -94,7 +94,7 @@ namespace QuantLib {
         Array tmp(size_);
 
         for (Size k=0; k<size_; ++k) {
-            tmp[k] = x0[k] * std::exp(dx[k]);
+            tmp[k] = x0[k] * exp(dx[k]);
         }
 
         return tmp;
@@ -116,7 +116,7 @@ namespace QuantLib {
         */
 
         const Size m   = nextIndexReset(t0);
-        const Real sdt = std::sqrt(dt);
+        const Real sdt = sqrt(dt);
 
         Array f(x0);
         Matrix diff       = lfmParam_->diffusion(t0, x0);
@@ -133,9 +133,9 @@ namespace QuantLib {
             const Real r = std::inner_product(
                 diff.row_begin(k), diff.row_end(k), dw.begin(), Real(0.0))*sdt;
 
-            const Real x = y*std::exp(d + r);
+            const Real x = y*exp(d + r);
             m2[k] = x/(1+x);
-            f[k] = x0[k] * std::exp(0.5*(d+
+            f[k] = x0[k] * exp(0.5*(d+
                  (std::inner_product(m2.begin()+m, m2.begin()+k+1,
                                      covariance.column_begin(k)+m,Real(0.0))
                   -0.5*covariance[k][k])*dt)+ r);
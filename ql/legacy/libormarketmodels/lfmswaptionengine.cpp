@@ -44,7 +44,7 @@ namespace QuantLib {
                                   new DiscountingSwapEngine(discountCurve_, false)));
 
         Spread correction = swap->spread() *
-            std::fabs(swap->floatingLegBPS()/swap->fixedLegBPS());
+            fabs(swap->floatingLegBPS()/swap->fixedLegBPS());
         Rate fixedRate = swap->fixedRate() - correction;
         Rate fairRate = swap->fairRate() - correction;
 
@@ -66,7 +66,7 @@ namespace QuantLib {
         Volatility vol = volatility->volatility(exercise, swapLength,
                                                 fairRate, true);
         results_.value = (swap->fixedLegBPS()/basisPoint) *
-            blackFormula(w, fixedRate, fairRate, vol*std::sqrt(exercise));
+            blackFormula(w, fixedRate, fairRate, vol*sqrt(exercise));
     }
 
 }
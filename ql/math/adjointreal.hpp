@@ -0,0 +1,385 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file adjointreal.hpp
+    \brief tape-based number type for adjoint algorithmic differentiation
+*/
+
+#ifndef quantlib_adjoint_real_hpp
+#define quantlib_adjoint_real_hpp
+
+/* This file doesn't include any other QuantLib header, so that it
+   can be used as QL_INCLUDE_FIRST when building the library with
+   -DQL_REAL=QuantLib::AdjointReal (see the QL_USE_ADJOINT_REAL
+   option in CMake or --enable-adjoint-real in configure).
+*/
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+namespace QuantLib {
+
+  // the functions below must be found by argument-dependent lookup,
+  // but they shouldn't hide the standard ones inside QuantLib
+  namespace aad {
+
+    class AdjointReal;
+
+    //! tape recording the operations performed on AdjointReal instances
+    /*! Each thread has its own tape.  Every operation involving at
+        least one active variable (i.e., a registered input or a
+        result depending on one) appends a node holding the partial
+        derivatives of its result with respect to its operands.  A
+        single reverse sweep then yields the derivatives of a given
+        output with respect to all the inputs.
+
+        The tape grows until it's cleared; variables recorded before
+        the last call to clear() must not be used afterwards.
+    */
+    class AdjointTape {
+      public:
+        //! the tape of the current thread
+        static AdjointTape& instance() {
+            thread_local AdjointTape tape;
+            return tape;
+        }
+        //! marks the variable as an input of the calculation
+        void registerInput(AdjointReal& x);
+        //! calculates the derivatives of the given output
+        void computeAdjoints(const AdjointReal& y);
+        //! derivative of the last output with respect to the given variable
+        double adjoint(const AdjointReal& x) const;
+        //! removes all the recorded operations
+        void clear() {
+            nodes_.resize(1);
+            adjoints_.clear();
+        }
+        //! number of recorded operations
+        std::size_t size() const { return nodes_.size() - 1; }
+
+        //! \name Internal interface
+        //@{
+        std::size_t record(std::size_t i1, double d1,
+                           std::size_t i2 = 0, double d2 = 0.0) {
+            nodes_.push_back(Node{{i1, i2}, {d1, d2}});
+            return nodes_.size() - 1;
+        }
+        //@}
+      private:
+        // node 0 stands for constants, which don't need recording
+        AdjointTape() : nodes_(1, Node{{0, 0}, {0.0, 0.0}}) {}
+        struct Node {
+            std::size_t parent[2];
+            double partial[2];
+        };
+        std::vector<Node> nodes_;
+        std::vector<double> adjoints_;
+    };
+
+
+    //! number type for adjoint algorithmic differentiation
+    /*! It stores a value and the position of the corresponding node
+        on the tape of the current thread; constants are not recorded.
+
+        \code
+        AdjointTape& tape = AdjointTape::instance();
+        AdjointReal x = 2.0;
+        tape.registerInput(x);
+        AdjointReal y = x * exp(x);
+        tape.computeAdjoints(y);
+        double dydx = tape.adjoint(x);
+        \endcode
+    */
+    class AdjointReal {
+      public:
+        AdjointReal() = default;
+        template <class T,
+                  class = std::enable_if_t<std::is_arithmetic_v<T> > >
+        constexpr AdjointReal(T value) // NOLINT(google-explicit-constructor)
+        : value_(static_cast<double>(value)) {}
+        //! \name Inspectors
+        //@{
+        constexpr double value() const { return value_; }
+        std::size_t index() const { return index_; }
+        bool isActive() const { return index_ != 0; }
+        template <class T,
+                  class = std::enable_if_t<std::is_arithmetic_v<T> > >
+        explicit constexpr operator T() const { return static_cast<T>(value_); }
+        //@}
+        //! \name Internal interface
+        //@{
+        //! unary operation with the given partial derivative
+        static AdjointReal unary(double value, const AdjointReal& x, double dx) {
+            AdjointReal r(value);
+            if (x.index_ != 0)
+                r.index_ = AdjointTape::instance().record(x.index_, dx);
+            return r;
+        }
+        //! binary operation with the given partial derivatives
+        static AdjointReal binary(double value,
+                                  const AdjointReal& x, double dx,
+                                  const AdjointReal& y, double dy) {
+            AdjointReal r(value);
+            if (x.index_ != 0 || y.index_ != 0)
+                r.index_ = AdjointTape::instance().record(x.index_, dx,
+                                                          y.index_, dy);
+            return r;
+        }
+        //@}
+        //! \name Arithmetic
+        //@{
+        AdjointReal operator+() const { return *this; }
+        AdjointReal operator-() const { return unary(-value_, *this, -1.0); }
+        AdjointReal& operator+=(const AdjointReal& y) { return *this = *this + y; }
+        AdjointReal& operator-=(const AdjointReal& y) { return *this = *this - y; }
+        AdjointReal& operator*=(const AdjointReal& y) { return *this = *this * y; }
+        AdjointReal& operator/=(const AdjointReal& y) { return *this = *this / y; }
+        AdjointReal& operator++() { return *this += 1.0; }
+        AdjointReal& operator--() { return *this -= 1.0; }
+
+        friend AdjointReal operator+(const AdjointReal& x, const AdjointReal& y) {
+            return binary(x.value_ + y.value_, x, 1.0, y, 1.0);
+        }
+        friend AdjointReal operator-(const AdjointReal& x, const AdjointReal& y) {
+            return binary(x.value_ - y.value_, x, 1.0, y, -1.0);
+        }
+        friend AdjointReal operator*(const AdjointReal& x, const AdjointReal& y) {
+            return binary(x.value_ * y.value_, x, y.value_, y, x.value_);
+        }
+        friend AdjointReal operator/(const AdjointReal& x, const AdjointReal& y) {
+            const double r = x.value_ / y.value_;
+            return binary(r, x, 1.0 / y.value_, y, -r / y.value_);
+        }
+        //@}
+        //! \name Comparisons
+        //@{
+        friend bool operator==(const AdjointReal& x, const AdjointReal& y) {
+            return x.value_ == y.value_;
+        }
+        friend bool operator!=(const AdjointReal& x, const AdjointReal& y) {
+            return x.value_ != y.value_;
+        }
+        friend bool operator<(const AdjointReal& x, const AdjointReal& y) {
+            return x.value_ < y.value_;
+        }
+        friend bool operator<=(const AdjointReal& x, const AdjointReal& y) {
+            return x.value_ <= y.value_;
+        }
+        friend bool operator>(const AdjointReal& x, const AdjointReal& y) {
+            return x.value_ > y.value_;
+        }
+        friend bool operator>=(const AdjointReal& x, const AdjointReal& y) {
+            return x.value_ >= y.value_;
+        }
+        //@}
+        friend std::ostream& operator<<(std::ostream& out, const AdjointReal& x) {
+            return out << x.value_;
+        }
+      private:
+        friend class AdjointTape;
+        double value_ = 0.0;
+        std::size_t index_ = 0;
+    };
+
+
+    // inline definitions
+
+    inline void AdjointTape::registerInput(AdjointReal& x) {
+        x.index_ = record(0, 0.0);
+    }
+
+    inline void AdjointTape::computeAdjoints(const AdjointReal& y) {
+        adjoints_.assign(nodes_.size(), 0.0);
+        if (y.index_ == 0)
+            return;
+        adjoints_[y.index_] = 1.0;
+        for (std::size_t i = y.index_; i > 0; --i) {
+            const double a = adjoints_[i];
+            if (a != 0.0) {
+                const Node& node = nodes_[i];
+                adjoints_[node.parent[0]] += node.partial[0] * a;
+                adjoints_[node.parent[1]] += node.partial[1] * a;
+            }
+        }
+    }
+
+    inline double AdjointTape::adjoint(const AdjointReal& x) const {
+        return x.index_ != 0 && x.index_ < adjoints_.size() ? adjoints_[x.index_] : 0.0;
+    }
+
+
+    // mathematical functions; the library calls them unqualified, so
+    // that they are found by argument-dependent lookup.
+
+    inline AdjointReal exp(const AdjointReal& x) {
+        const double e = std::exp(x.value());
+        return AdjointReal::unary(e, x, e);
+    }
+    inline AdjointReal log(const AdjointReal& x) {
+        return AdjointReal::unary(std::log(x.value()), x, 1.0 / x.value());
+    }
+    inline AdjointReal log10(const AdjointReal& x) {
+        return AdjointReal::unary(std::log10(x.value()), x,
+                                  1.0 / (x.value() * std::log(10.0)));
+    }
+    inline AdjointReal expm1(const AdjointReal& x) {
+        return AdjointReal::unary(std::expm1(x.value()), x, std::exp(x.value()));
+    }
+    inline AdjointReal log1p(const AdjointReal& x) {
+        return AdjointReal::unary(std::log1p(x.value()), x, 1.0 / (1.0 + x.value()));
+    }
+    inline AdjointReal sqrt(const AdjointReal& x) {
+        const double s = std::sqrt(x.value());
+        return AdjointReal::unary(s, x, 0.5 / s);
+    }
+    inline AdjointReal cbrt(const AdjointReal& x) {
+        const double c = std::cbrt(x.value());
+        return AdjointReal::unary(c, x, 1.0 / (3.0 * c * c));
+    }
+    inline AdjointReal pow(const AdjointReal& x, const AdjointReal& y) {
+        const double p = std::pow(x.value(), y.value());
+        // the logarithm is only needed (and defined) for active exponents
+        const double dx = y.value() == 0.0 ? 0.0 : y.value() * std::pow(x.value(), y.value() - 1.0);
+        const double dy = y.isActive() ? p * std::log(x.value()) : 0.0;
+        return AdjointReal::binary(p, x, dx, y, dy);
+    }
+    inline AdjointReal fabs(const AdjointReal& x) {
+        return AdjointReal::unary(std::fabs(x.value()), x,
+                                  x.value() > 0.0 ? 1.0 : (x.value() < 0.0 ? -1.0 : 0.0));
+    }
+    inline AdjointReal abs(const AdjointReal& x) {
+        return fabs(x);
+    }
+    inline AdjointReal sin(const AdjointReal& x) {
+        return AdjointReal::unary(std::sin(x.value()), x, std::cos(x.value()));
+    }
+    inline AdjointReal cos(const AdjointReal& x) {
+        return AdjointReal::unary(std::cos(x.value()), x, -std::sin(x.value()));
+    }
+    inline AdjointReal tan(const AdjointReal& x) {
+        const double t = std::tan(x.value());
+        return AdjointReal::unary(t, x, 1.0 + t * t);
+    }
+    inline AdjointReal asin(const AdjointReal& x) {
+        return AdjointReal::unary(std::asin(x.value()), x,
+                                  1.0 / std::sqrt(1.0 - x.value() * x.value()));
+    }
+    inline AdjointReal acos(const AdjointReal& x) {
+        return AdjointReal::unary(std::acos(x.value()), x,
+                                  -1.0 / std::sqrt(1.0 - x.value() * x.value()));
+    }
+    inline AdjointReal atan(const AdjointReal& x) {
+        return AdjointReal::unary(std::atan(x.value()), x,
+                                  1.0 / (1.0 + x.value() * x.value()));
+    }
+    inline AdjointReal atan2(const AdjointReal& y, const AdjointReal& x) {
+        const double r2 = x.value() * x.value() + y.value() * y.value();
+        return AdjointReal::binary(std::atan2(y.value(), x.value()),
+                                   y, x.value() / r2, x, -y.value() / r2);
+    }
+    inline AdjointReal sinh(const AdjointReal& x) {
+        return AdjointReal::unary(std::sinh(x.value()), x, std::cosh(x.value()));
+    }
+    inline AdjointReal cosh(const AdjointReal& x) {
+        return AdjointReal::unary(std::cosh(x.value()), x, std::sinh(x.value()));
+    }
+    inline AdjointReal tanh(const AdjointReal& x) {
+        const double t = std::tanh(x.value());
+        return AdjointReal::unary(t, x, 1.0 - t * t);
+    }
+    inline AdjointReal erf(const AdjointReal& x) {
+        // 2/sqrt(pi)
+        const double c = 1.1283791670955125739;
+        return AdjointReal::unary(std::erf(x.value()), x,
+                                  c * std::exp(-x.value() * x.value()));
+    }
+    inline AdjointReal erfc(const AdjointReal& x) {
+        const double c = 1.1283791670955125739;
+        return AdjointReal::unary(std::erfc(x.value()), x,
+                                  -c * std::exp(-x.value() * x.value()));
+    }
+    inline AdjointReal hypot(const AdjointReal& x, const AdjointReal& y) {
+        const double h = std::hypot(x.value(), y.value());
+        return AdjointReal::binary(h, x, x.value() / h, y, y.value() / h);
+    }
+    inline AdjointReal fmod(const AdjointReal& x, const AdjointReal& y) {
+        const double q = std::trunc(x.value() / y.value());
+        return AdjointReal::binary(std::fmod(x.value(), y.value()), x, 1.0, y, -q);
+    }
+    inline AdjointReal ldexp(const AdjointReal& x, int e) {
+        const double f = std::ldexp(1.0, e);
+        return AdjointReal::unary(std::ldexp(x.value(), e), x, f);
+    }
+    inline AdjointReal frexp(const AdjointReal& x, int* e) {
+        const double m = std::frexp(x.value(), e);
+        return AdjointReal::unary(m, x, std::ldexp(1.0, -*e));
+    }
+    inline AdjointReal modf(const AdjointReal& x, AdjointReal* i) {
+        double integral;
+        const double f = std::modf(x.value(), &integral);
+        *i = integral;
+        return AdjointReal::unary(f, x, 1.0);
+    }
+    inline AdjointReal fmax(const AdjointReal& x, const AdjointReal& y) {
+        return x.value() >= y.value() ? x : y;
+    }
+    inline AdjointReal fmin(const AdjointReal& x, const AdjointReal& y) {
+        return x.value() <= y.value() ? x : y;
+    }
+    // piecewise-constant functions have null derivatives
+    inline AdjointReal floor(const AdjointReal& x) { return std::floor(x.value()); }
+    inline AdjointReal ceil(const AdjointReal& x) { return std::ceil(x.value()); }
+    inline AdjointReal round(const AdjointReal& x) { return std::round(x.value()); }
+    inline AdjointReal trunc(const AdjointReal& x) { return std::trunc(x.value()); }
+    inline long lround(const AdjointReal& x) { return std::lround(x.value()); }
+    inline bool isnan(const AdjointReal& x) { return std::isnan(x.value()); }
+    inline bool isinf(const AdjointReal& x) { return std::isinf(x.value()); }
+    inline bool isfinite(const AdjointReal& x) { return std::isfinite(x.value()); }
+    inline bool signbit(const AdjointReal& x) { return std::signbit(x.value()); }
+
+  }
+
+    using aad::AdjointReal;
+    using aad::AdjointTape;
+
+}
+
+namespace std {
+
+    template <>
+    class numeric_limits<QuantLib::AdjointReal> : public numeric_limits<double> {
+        typedef numeric_limits<double> base;
+        typedef QuantLib::AdjointReal T;
+      public:
+        static constexpr T min() noexcept { return (base::min)(); }
+        static constexpr T max() noexcept { return (base::max)(); }
+        static constexpr T lowest() noexcept { return base::lowest(); }
+        static constexpr T epsilon() noexcept { return base::epsilon(); }
+        static constexpr T round_error() noexcept { return base::round_error(); }
+        static constexpr T infinity() noexcept { return base::infinity(); }
+        static constexpr T quiet_NaN() noexcept { return base::quiet_NaN(); }
+        static constexpr T signaling_NaN() noexcept { return base::signaling_NaN(); }
+        static constexpr T denorm_min() noexcept { return base::denorm_min(); }
+    };
+
+}
+
+#endif
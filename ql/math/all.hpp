@@ -2,6 +2,7 @@
 /* Add the files to be included into Makefile.am instead. */
 
 #include <math/abcdmathfunction.hpp>
+#include <math/adjointreal.hpp>
 #include <math/array.hpp>
 #include <math/autocovariance.hpp>
 #include <math/bernsteinpolynomial.hpp>
@@ -546,7 +546,7 @@ namespace QuantLib {
     }
 
     inline Real Norm2(const Array& v) {
-        return std::sqrt(DotProduct(v, v));
+        return sqrt(DotProduct(v, v));
     }
 
     // overloaded operators
@@ -821,70 +821,70 @@ namespace QuantLib {
     inline Array Abs(const Array& v) {
         Array result(v.size());
         std::transform(v.begin(), v.end(), result.begin(),
-                       [](Real x) -> Real { return std::fabs(x); });
+                       [](Real x) -> Real { return fabs(x); });
         return result;
     }
 
     inline Array Abs(Array&& v) {
         Array result = std::move(v);
         std::transform(result.begin(), result.end(), result.begin(),
-                       [](Real x) -> Real { return std::fabs(x); });
+                       [](Real x) -> Real { return fabs(x); });
         return result;
     }
 
     inline Array Sqrt(const Array& v) {
         Array result(v.size());
         std::transform(v.begin(),v.end(),result.begin(),
-                       [](Real x) -> Real { return std::sqrt(x); });
+                       [](Real x) -> Real { return sqrt(x); });
         return result;
     }
 
     inline Array Sqrt(Array&& v) {
         Array result = std::move(v);
         std::transform(result.begin(), result.end(), result.begin(),
-                       [](Real x) -> Real { return std::sqrt(x); });
+                       [](Real x) -> Real { return sqrt(x); });
         return result;
     }
 
     inline Array Log(const Array& v) {
         Array result(v.size());
         std::transform(v.begin(),v.end(),result.begin(),
-                       [](Real x) -> Real { return std::log(x); });
+                       [](Real x) -> Real { return log(x); });
         return result;
     }
 
     inline Array Log(Array&& v) {
         Array result = std::move(v);
         std::transform(result.begin(), result.end(), result.begin(),
-                       [](Real x) -> Real { return std::log(x); });
+                       [](Real x) -> Real { return log(x); });
         return result;
     }
 
     inline Array Exp(const Array& v) {
         Array result(v.size());
         std::transform(v.begin(), v.end(), result.begin(),
-                       [](Real x) -> Real { return std::exp(x); });
+                       [](Real x) -> Real { return exp(x); });
         return result;
     }
 
     inline Array Exp(Array&& v) {
         Array result = std::move(v);
         std::transform(result.begin(), result.end(), result.begin(),
-                       [](Real x) -> Real { return std::exp(x); });
+                       [](Real x) -> Real { return exp(x); });
         return result;
     }
 
     inline Array Pow(const Array& v, Real alpha) {
         Array result(v.size());
         std::transform(v.begin(), v.end(), result.begin(),
-                       [=](Real x) -> Real { return std::pow(x, alpha); });
+                       [=](Real x) -> Real { return pow(x, alpha); });
         return result;
     }
 
     inline Array Pow(Array&& v, Real alpha) {
         Array result = std::move(v);
         std::transform(result.begin(), result.end(), result.begin(),
-                       [=](Real x) -> Real { return std::pow(x, alpha); });
+                       [=](Real x) -> Real { return pow(x, alpha); });
         return result;
     }
 
@@ -65,14 +65,14 @@ namespace QuantLib {
         if (x == y)
             return true;
 
-        Real diff = std::fabs(x-y);
-        constexpr double tolerance = 42 * QL_EPSILON;
+        Real diff = fabs(x-y);
+        constexpr double tolerance = 42 * static_cast<double>(QL_EPSILON);
 
         if (x == 0.0 || y == 0.0)
             return diff < (tolerance * tolerance);
 
-        return diff <= tolerance*std::fabs(x) &&
-               diff <= tolerance*std::fabs(y);
+        return diff <= tolerance*fabs(x) &&
+               diff <= tolerance*fabs(y);
     }
 
     inline bool close(Real x, Real y, Size n) {
@@ -80,13 +80,13 @@ namespace QuantLib {
         if (x == y)
             return true;
 
-        Real diff = std::fabs(x-y), tolerance = n * QL_EPSILON;
+        Real diff = fabs(x-y), tolerance = n * QL_EPSILON;
 
         if (x == 0.0 || y == 0.0)
             return diff < (tolerance * tolerance);
 
-        return diff <= tolerance*std::fabs(x) &&
-               diff <= tolerance*std::fabs(y);
+        return diff <= tolerance*fabs(x) &&
+               diff <= tolerance*fabs(y);
     }
 
     inline bool close_enough(Real x, Real y) {
@@ -96,14 +96,14 @@ namespace QuantLib {
         if (x == y)
             return true;
 
-        Real diff = std::fabs(x-y);
-        constexpr double tolerance = 42 * QL_EPSILON;
+        Real diff = fabs(x-y);
+        constexpr double tolerance = 42 * static_cast<double>(QL_EPSILON);
 
         if (x == 0.0 || y == 0.0) // x or y = 0.0
             return diff < (tolerance * tolerance);
 
-        return diff <= tolerance*std::fabs(x) ||
-               diff <= tolerance*std::fabs(y);
+        return diff <= tolerance*fabs(x) ||
+               diff <= tolerance*fabs(y);
     }
 
     inline bool close_enough(Real x, Real y, Size n) {
@@ -111,13 +111,13 @@ namespace QuantLib {
         if (x == y)
             return true;
 
-        Real diff = std::fabs(x-y), tolerance = n * QL_EPSILON;
+        Real diff = fabs(x-y), tolerance = n * QL_EPSILON;
 
         if (x == 0.0 || y == 0.0)
             return diff < (tolerance * tolerance);
 
-        return diff <= tolerance*std::fabs(x) ||
-               diff <= tolerance*std::fabs(y);
+        return diff <= tolerance*fabs(x) ||
+               diff <= tolerance*fabs(y);
     }
 
 
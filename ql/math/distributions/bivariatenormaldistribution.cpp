@@ -68,8 +68,8 @@ namespace QuantLib {
         if (MinCumNormDistAB<1e-15)
             return MinCumNormDistAB;
 
-        Real a1 = a / std::sqrt(2.0 * (1.0 - rho2_));
-        Real b1 = b / std::sqrt(2.0 * (1.0 - rho2_));
+        Real a1 = a / sqrt(2.0 * (1.0 - rho2_));
+        Real b1 = b / sqrt(2.0 * (1.0 - rho2_));
 
         Real result=-1.0;
 
@@ -78,11 +78,11 @@ namespace QuantLib {
             for (Size i=0; i<5; i++) {
                 for (Size j=0;j<5; j++) {
                     sum += x_[i]*x_[j]*
-                        std::exp(a1*(2.0*y_[i]-a1)+b1*(2.0*y_[j]-b1)
+                        exp(a1*(2.0*y_[i]-a1)+b1*(2.0*y_[j]-b1)
                                  +2.0*rho_*(y_[i]-a1)*(y_[j]-b1));
                 }
             }
-            result = std::sqrt(1.0 - rho2_)/M_PI*sum;
+            result = sqrt(1.0 - rho2_)/M_PI*sum;
         } else if (a<=0 && b>=0 && rho_>=0) {
             BivariateCumulativeNormalDistributionDr78 bivCumNormalDist(-rho_);
             result= CumNormDistA - bivCumNormalDist(a, -b);
@@ -93,11 +93,11 @@ namespace QuantLib {
             result= CumNormDistA + CumNormDistB -1.0 + (*this)(-a, -b);
         } else if (a*b*rho_>0.0) {
             Real rho1 = (rho_*a-b)*(a>0.0 ? 1.0: -1.0)/
-                std::sqrt(a*a-2.0*rho_*a*b+b*b);
+                sqrt(a*a-2.0*rho_*a*b+b*b);
             BivariateCumulativeNormalDistributionDr78 bivCumNormalDist(rho1);
 
             Real rho2 = (rho_*b-a)*(b>0.0 ? 1.0: -1.0)/
-                std::sqrt(a*a-2.0*rho_*a*b+b*b);
+                sqrt(a*a-2.0*rho_*a*b+b*b);
             BivariateCumulativeNormalDistributionDr78 CBND2(rho2);
 
             Real delta = (1.0-(a>0.0 ? 1.0: -1.0)*(b>0.0 ? 1.0: -1.0))/4.0;
@@ -121,8 +121,8 @@ namespace QuantLib {
             : hk_(h * k), asr_(asr), hs_((h * h + k * k) / 2) {}
 
             Real operator()(Real x) const {
-                Real sn = std::sin(asr_ * (-x + 1) * 0.5);
-                return std::exp((sn * hk_ - hs_) / (1.0 - sn * sn));
+                Real sn = sin(asr_ * (-x + 1) * 0.5);
+                return exp((sn * hk_ - hs_) / (1.0 - sn * sn));
             }
           private:
             Real hk_, asr_, hs_;
@@ -134,12 +134,12 @@ namespace QuantLib {
             : a_(a), c_(c), d_(d), bs_(bs), hk_(hk) {}
             Real operator()(Real x) const {
                 Real xs = a_ * (-x + 1);
-                xs = std::fabs(xs*xs);
-                Real rs = std::sqrt(1 - xs);
+                xs = fabs(xs*xs);
+                Real rs = sqrt(1 - xs);
                 Real asr = -(bs_ / xs + hk_) / 2;
                 if (asr > -100.0) {
-                    return (a_ * std::exp(asr) *
-                            (std::exp(-hk_ * (1 - rs) / (2 * (1 + rs))) / rs -
+                    return (a_ * exp(asr) *
+                            (exp(-hk_ * (1 - rs) / (2 * (1 + rs))) / rs -
                              (1 + c_ * xs * (1 + d_ * xs))));
                 } else {
                     return 0.0;
@@ -181,9 +181,9 @@ namespace QuantLib {
            Change some magic numbers to M_PI */
 
         TabulatedGaussLegendre gaussLegendreQuad(20);
-        if (std::fabs(correlation_) < 0.3) {
+        if (fabs(correlation_) < 0.3) {
             gaussLegendreQuad.order(6);
-        } else if (std::fabs(correlation_) < 0.75) {
+        } else if (fabs(correlation_) < 0.75) {
             gaussLegendreQuad.order(12);
         }
 
@@ -192,11 +192,11 @@ namespace QuantLib {
         Real hk = h * k;
         Real BVN = 0.0;
 
-        if (std::fabs(correlation_) < 0.925)
+        if (fabs(correlation_) < 0.925)
         {
-            if (std::fabs(correlation_) > 0)
+            if (fabs(correlation_) > 0)
             {
-                Real asr = std::asin(correlation_);
+                Real asr = asin(correlation_);
                 eqn3 f(h,k,asr);
                 BVN = gaussLegendreQuad(f);
                 BVN *= asr * (0.25 / M_PI);
@@ -210,24 +210,24 @@ namespace QuantLib {
                 k *= -1;
                 hk *= -1;
             }
-            if (std::fabs(correlation_) < 1)
+            if (fabs(correlation_) < 1)
             {
                 Real Ass = (1 - correlation_) * (1 + correlation_);
-                Real a = std::sqrt(Ass);
+                Real a = sqrt(Ass);
                 Real bs = (h-k)*(h-k);
                 Real c = (4 - hk) / 8;
                 Real d = (12 - hk) / 16;
                 Real asr = -(bs / Ass + hk) / 2;
                 if (asr > -100)
                 {
-                    BVN = a * std::exp(asr) *
+                    BVN = a * exp(asr) *
                         (1 - c * (bs - Ass) * (1 - d * bs / 5) / 3 +
                          c * d * Ass * Ass / 5);
                 }
                 if (-hk < 100)
                 {
-                    Real B = std::sqrt(bs);
-                    BVN -= std::exp(-hk / 2) * 2.506628274631 *
+                    Real B = sqrt(bs);
+                    BVN -= exp(-hk / 2) * 2.506628274631 *
                         cumnorm_(-B / a) * B *
                         (1 - c * bs * (1 - d * bs / 5) / 3);
                 }
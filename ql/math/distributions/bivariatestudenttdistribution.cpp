@@ -34,14 +34,14 @@ namespace QuantLib {
            [-pi,pi], this returns a value in [0, 2*pi]
         */
         Real arctan(Real x, Real y) {
-            Real res = std::atan2(x, y);
+            Real res = atan2(x, y);
             return res >= 0.0 ? res : res + 2 * M_PI;
         }
 
         // function x(m,h,k) defined on top of page 155
         Real f_x(Real m, Real h, Real k, Real rho) {
             Real unCor = 1 - rho*rho;
-            Real sub = std::pow(h - rho * k, 2);
+            Real sub = pow(h - rho * k, 2);
             Real denom = sub + unCor * (m + k*k);
             if (denom < epsilon)
                 return 0.0; // limit case for rho = +/-1.0
@@ -52,7 +52,7 @@ namespace QuantLib {
         Real P_n(Real h, Real k, Natural n, Real rho) {
             Real unCor = 1.0 - rho*rho;
 
-            Real div = 4 * std::sqrt(n * M_PI);
+            Real div = 4 * sqrt(n * M_PI);
             Real xHK = f_x(n, h, k, rho);
             Real xKH = f_x(n, k, h, rho);
             Real divH = 1 + h*h / n;
@@ -62,19 +62,19 @@ namespace QuantLib {
 
             if (n % 2 == 0) { // n is even, equation (10)
                 // first line of (10)
-                Real res = arctan(std::sqrt(unCor), -rho) / M_TWOPI;
+                Real res = arctan(sqrt(unCor), -rho) / M_TWOPI;
 
                 // second line of (10)
                 Real dgM = 2 * (1 - xHK);  // multiplier for dgj
                 Real gjM = sgnHK * 2 / M_PI; // multiplier for g_j
                 // initializations for j = 1:
-                Real f_j = std::sqrt(M_PI / divK);
-                Real g_j = 1 + gjM * arctan(std::sqrt(xHK), std::sqrt(1 - xHK));
+                Real f_j = sqrt(M_PI / divK);
+                Real g_j = 1 + gjM * arctan(sqrt(xHK), sqrt(1 - xHK));
                 Real sum = f_j * g_j;
                 if (n >= 4) {
                     // different formulas for j = 2:
                     f_j *= 0.5 / divK; // (2 - 1.5) / (Real) (2 - 1) / divK;
-                    Real dgj = gjM * std::sqrt(xHK * (1 - xHK));
+                    Real dgj = gjM * sqrt(xHK * (1 - xHK));
                     g_j += dgj;
                     sum += f_j * g_j;
                     // and then the loop for the rest of the j's:
@@ -91,13 +91,13 @@ namespace QuantLib {
                 dgM = 2 * (1 - xKH);
                 gjM = sgnKH * 2 / M_PI;
                 // initializations for j = 1:
-                f_j = std::sqrt(M_PI / divH);
-                g_j = 1 + gjM * arctan(std::sqrt(xKH), std::sqrt(1 - xKH));
+                f_j = sqrt(M_PI / divH);
+                g_j = 1 + gjM * arctan(sqrt(xKH), sqrt(1 - xKH));
                 sum = f_j * g_j;
                 if (n >= 4) {
                     // different formulas for j = 2:
                     f_j *= 0.5 / divH; // (2 - 1.5) / (Real) (2 - 1) / divK;
-                    Real dgj = gjM * std::sqrt(xKH * (1 - xKH));
+                    Real dgj = gjM * sqrt(xKH * (1 - xKH));
                     g_j += dgj;
                     sum += f_j * g_j;
                     // and then the loop for the rest of the j's:
@@ -115,16 +115,16 @@ namespace QuantLib {
                 // first line of (11)
                 Real hk = h * k;
                 Real hkcn = hk + rho * n;
-                Real sqrtExpr = std::sqrt(h*h - 2 * rho * hk + k*k + n * unCor);
-                Real res = arctan(std::sqrt(Real(n)) * (-(h + k) * hkcn - (hk - n) * sqrtExpr),
+                Real sqrtExpr = sqrt(h*h - 2 * rho * hk + k*k + n * unCor);
+                Real res = arctan(sqrt(Real(n)) * (-(h + k) * hkcn - (hk - n) * sqrtExpr),
                                   (hk - n) * hkcn - n * (h + k) * sqrtExpr ) / M_TWOPI;
 
                 if (n > 1) {
                     // second line of (11)
                     Real mult = (1 - xHK) / 2;
                     // initializations for j = 1:
-                    Real f_j = 2 / std::sqrt(M_PI) / divK;
-                    Real dgj = sgnHK * std::sqrt(xHK);
+                    Real f_j = 2 / sqrt(M_PI) / divK;
+                    Real dgj = sgnHK * sqrt(xHK);
                     Real g_j = 1 + dgj;
                     Real sum = f_j * g_j;
                     // and then the loop for the rest of the j's:
@@ -139,8 +139,8 @@ namespace QuantLib {
                     // third line of (11)
                     mult = (1 - xKH) / 2;
                     // initializations for j = 1:
-                    f_j = 2 / std::sqrt(M_PI) / divH;
-                    dgj = sgnKH * std::sqrt(xKH);
+                    f_j = 2 / sqrt(M_PI) / divH;
+                    dgj = sgnKH * sqrt(xKH);
                     g_j = 1 + dgj;
                     sum = f_j * g_j;
                     // and then the loop for the rest of the j's:
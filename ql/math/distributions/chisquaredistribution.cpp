@@ -38,7 +38,7 @@ namespace QuantLib {
         const Size itrmax = 10000;
         Real lam = 0.5*ncp_;
 
-        Real u = std::exp(-lam);
+        Real u = exp(-lam);
         Real v = u;
         Real x2 = 0.5*x;
         Real f2 = 0.5*df_;
@@ -46,12 +46,12 @@ namespace QuantLib {
 
         Real t = 0.0;
         if (f2*QL_EPSILON > 0.125 &&
-            std::fabs(x2-f2) < std::sqrt(QL_EPSILON)*f2) {
-            t = std::exp((1 - t) *
-                         (2 - t/(f2+1)))/std::sqrt(2.0*M_PI*(f2 + 1.0));
+            fabs(x2-f2) < sqrt(QL_EPSILON)*f2) {
+            t = exp((1 - t) *
+                         (2 - t/(f2+1)))/sqrt(2.0*M_PI*(f2 + 1.0));
         }
         else {
-            t = std::exp(f2*std::log(x2) - x2 -
+            t = exp(f2*log(x2) - x2 -
                          GammaFunction().logValue(f2 + 1));
         }
 
@@ -96,8 +96,8 @@ namespace QuantLib {
         const Real p = (df_+2*ncp_)/squared(df_+ncp_);
         const Real m = (h-1)*(1-3*h);
 
-        const Real u= (std::pow(x/(df_+ncp_), h) - (1 + h*p*(h-1-0.5*(2-h)*m*p)))/
-            (h*std::sqrt(2*p)*(1+0.5*m*p));
+        const Real u= (pow(x/(df_+ncp_), h) - (1 + h*p*(h-1-0.5*(2-h)*m*p)))/
+            (h*sqrt(2*p)*(1+0.5*m*p));
 
         return CumulativeNormalDistribution()(u);
     }
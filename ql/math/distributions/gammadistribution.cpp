@@ -34,8 +34,8 @@ namespace QuantLib {
                 ap += 1.0;
                 del *= x/ap;
                 sum += del;
-                if (std::fabs(del) < std::fabs(sum)*3.0e-7)
-                    return sum*std::exp(-x + a_*std::log(x) - gln);
+                if (fabs(del) < fabs(sum)*3.0e-7)
+                    return sum*exp(-x + a_*log(x) - gln);
             }
         } else {
             Real b = x + 1.0 - a_;
@@ -46,14 +46,14 @@ namespace QuantLib {
                 Real an = -1.0*n*(n-a_);
                 b += 2.0;
                 d = an*d + b;
-                if (std::fabs(d) < QL_EPSILON) d = QL_EPSILON;
+                if (fabs(d) < QL_EPSILON) d = QL_EPSILON;
                 c = b + an/c;
-                if (std::fabs(c) < QL_EPSILON) c = QL_EPSILON;
+                if (fabs(c) < QL_EPSILON) c = QL_EPSILON;
                 d = 1.0/d;
                 Real del = d*c;
                 h *= del;
-                if (std::fabs(del - 1.0)<QL_EPSILON)
-                    return 1.0-h*std::exp(-x + a_*std::log(x) - gln);
+                if (fabs(del - 1.0)<QL_EPSILON)
+                    return 1.0-h*exp(-x + a_*log(x) - gln);
             }
         }
         QL_FAIL("too few iterations");
@@ -69,7 +69,7 @@ namespace QuantLib {
     Real GammaFunction::logValue(Real x) const {
         QL_REQUIRE(x>0.0, "positive argument required");
         Real temp = x + 5.5;
-        temp -= (x + 0.5)*std::log(temp);
+        temp -= (x + 0.5)*log(temp);
         Real ser=1.000000000190015;
         ser += c1_/(x + 1.0);
         ser += c2_/(x + 2.0);
@@ -78,12 +78,12 @@ namespace QuantLib {
         ser += c5_/(x + 5.0);
         ser += c6_/(x + 6.0);
 
-        return -temp+std::log(2.5066282746310005*ser/x);
+        return -temp+log(2.5066282746310005*ser/x);
     }
 
     Real GammaFunction::value(Real x) const {
         if (x >= 1.0) {
-            return std::exp(logValue(x));
+            return exp(logValue(x));
         }
         else {
             if (x > -20.0) {
@@ -92,7 +92,7 @@ namespace QuantLib {
             }
             else {
                 // \Gamma(-x) = -\frac{\pi}{\Gamma(x)\sin(\pi x) x}
-                return -M_PI/(value(-x)*x*std::sin(M_PI*x));
+                return -M_PI/(value(-x)*x*sin(M_PI*x));
             }
         }
     }
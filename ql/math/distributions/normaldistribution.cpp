@@ -47,13 +47,25 @@ namespace QuantLib {
                 sum -= a;
                 g *= y;
                 ++i;
-                a = std::fabs(a);
-            } while (lasta>a && a>=std::fabs(sum*QL_EPSILON));
+                a = fabs(a);
+            } while (lasta>a && a>=fabs(sum*QL_EPSILON));
             result = -gaussian_(z)/z*sum;
         }
         return result;
     }
 
+    void CumulativeNormalDistribution::transform(const Real* begin,
+                                                 const Real* end,
+                                                 Real* output) const {
+        // the complementary error function is accurate in both
+        // tails, which makes the asymptotic expansion unnecessary
+        const Real average = average_, scale = -M_SQRT1_2/sigma_;
+        const auto n = static_cast<Size>(end - begin);
+        #pragma omp simd
+        for (Size i=0; i<n; ++i)
+            output[i] = 0.5 * erfc((begin[i] - average) * scale);
+    }
+
     #if !defined(QL_PATCH_SOLARIS)
     const CumulativeNormalDistribution InverseCumulativeNormal::f_;
     #endif
@@ -93,7 +105,7 @@ namespace QuantLib {
             // try to recover if due to numerical error
             if (close_enough(x, 1.0)) {
                 return QL_MAX_REAL; // largest value available
-            } else if (std::fabs(x) < QL_EPSILON) {
+            } else if (fabs(x) < QL_EPSILON) {
                 return QL_MIN_REAL; // largest negative value available
             } else {
                 QL_FAIL("InverseCumulativeNormal(" << x
@@ -104,12 +116,12 @@ namespace QuantLib {
         Real z;
         if (x < x_low_) {
             // Rational approximation for the lower region 0<x<u_low
-            z = std::sqrt(-2.0*std::log(x));
+            z = sqrt(-2.0*log(x));
             z = (((((c1_*z+c2_)*z+c3_)*z+c4_)*z+c5_)*z+c6_) /
                 ((((d1_*z+d2_)*z+d3_)*z+d4_)*z+1.0);
         } else {
             // Rational approximation for the upper region u_high<x<1
-            z = std::sqrt(-2.0*std::log(1.0-x));
+            z = sqrt(-2.0*log(1.0-x));
             z = -(((((c1_*z+c2_)*z+c3_)*z+c4_)*z+c5_)*z+c6_) /
                 ((((d1_*z+d2_)*z+d3_)*z+d4_)*z+1.0);
         }
@@ -145,7 +157,7 @@ namespace QuantLib {
         Real result;
         Real temp=x-0.5;
 
-        if (std::fabs(temp) < 0.42) {
+        if (fabs(temp) < 0.42) {
             // Beasley and Springer, 1977
             result=temp*temp;
             result=temp*
@@ -157,7 +169,7 @@ namespace QuantLib {
                 result = x;
             else
                 result=1.0-x;
-            result = std::log(-std::log(result));
+            result = log(-log(result));
             result = c0_+result*(c1_+result*(c2_+result*(c3_+result*
                                    (c4_+result*(c5_+result*(c6_+result*
                                                        (c7_+result*c8_)))))));
@@ -72,6 +72,14 @@ namespace QuantLib {
         // function
         Real operator()(Real x) const;
         Real derivative(Real x) const;
+        /*! evaluates the function on the range [begin, end) and
+            writes the results into the range starting at output.
+            The loop has no data-dependent branches, so that the
+            compiler can vectorize it.
+        */
+        void transform(const Real* begin,
+                       const Real* end,
+                       Real* output) const;
       private:
         Real average_, sigma_;
         NormalDistribution gaussian_;
@@ -277,7 +285,7 @@ namespace QuantLib {
         Real exponent = -(deltax*deltax)/denominator_;
         // debian alpha had some strange problem in the very-low range
         return exponent <= -690.0 ? 0.0 :  // exp(x) < 1.0e-300 anyway
-            Real(normalizationFactor_*std::exp(exponent));
+            Real(normalizationFactor_*exp(exponent));
     }
 
     inline Real NormalDistribution::derivative(Real x) const {
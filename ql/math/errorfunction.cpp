@@ -197,14 +197,14 @@ namespace QuantLib {
 
         Real R,S,P,Q,s,y,z,r, ax;
 
-        if (!std::isfinite(x)) {
-            if (std::isnan(x))
+        if (!isfinite(x)) {
+            if (isnan(x))
                 return x;
             else
                 return ( x > 0 ? 1 : -1);
         }
 
-        ax = std::fabs(x);
+        ax = fabs(x);
 
         if(ax < 0.84375) {      /* |x|<0.84375 */
             if(ax < 3.7252902984e-09) { /* |x|<2**-28 */
@@ -238,7 +238,7 @@ namespace QuantLib {
             R=rb0+s*(rb1+s*(rb2+s*(rb3+s*(rb4+s*(rb5+s*rb6)))));
             S=one+s*(sb1+s*(sb2+s*(sb3+s*(sb4+s*(sb5+s*(sb6+s*sb7))))));
         }
-        r = std::exp( -ax*ax-0.5625 +R/S);
+        r = exp( -ax*ax-0.5625 +R/S);
         if(x>=0) return one-r/ax; else return  r/ax-one;
 
     }
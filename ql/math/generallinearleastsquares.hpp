@@ -141,7 +141,7 @@ namespace QuantLib {
 
         const Real chiSq
             = std::inner_product(residuals_.begin(), residuals_.end(), residuals_.begin(), Real(0.0));
-        const Real multiplier = std::sqrt(chiSq/(n-2));
+        const Real multiplier = sqrt(chiSq/(n-2));
         std::transform(err_.begin(), err_.end(), standardErrors_.begin(),
                        [=](Real x) -> Real { return x * multiplier; });
     }
@@ -93,7 +93,7 @@ namespace QuantLib {
             }
             else {
                 using namespace exponential_integrals_helper;
-                return M_PI_2 - f(x)*std::cos(x) - g(x)*std::sin(x);
+                return M_PI_2 - f(x)*cos(x) - g(x)*sin(x);
             }
         }
 
@@ -103,7 +103,7 @@ namespace QuantLib {
             if (x <= 4.0) {
                 const Real x2 = x*x;
 
-                return M_EULER_MASCHERONI + std::log(x) +
+                return M_EULER_MASCHERONI + log(x) +
                     x2* ( -0.25 + x2*(7.51851524438898291e-3 +x2*(-1.27528342240267686e-4
                                 + x2*(1.05297363846239184e-6 +x2*(-4.68889508144848019e-9
                                 + x2*(1.06480802891189243e-11 - x2*9.93728488857585407e-15)))))
@@ -116,7 +116,7 @@ namespace QuantLib {
             }
             else {
                 using namespace exponential_integrals_helper;
-                return f(x)*std::sin(x) - g(x)*std::cos(x);
+                return f(x)*sin(x) - g(x)*cos(x);
             }
         }
 
@@ -132,29 +132,29 @@ namespace QuantLib {
             constexpr double DIST = 4.5;
             constexpr double MAX_ERROR = 5.0 * QL_EPSILON;
 
-            const Real z_inf = std::log(0.01*QL_MAX_REAL) + std::log(100.0);
+            const Real z_inf = log(0.01*QL_MAX_REAL) + log(100.0);
             QL_REQUIRE(z.real() < z_inf, "argument error " << z);
 
-            const Real z_asym = 2.0 - 1.035*std::log(MAX_ERROR);
+            const Real z_asym = 2.0 - 1.035*log(MAX_ERROR);
 
             using boost::math::sign;
-            const Real abs_z = std::abs(z);
+            const Real abs_z = abs(z);
 
             const auto match = [=](
                 const std::complex<Real>& z1, const std::complex<Real>& z2)
                 -> bool {
                     const std::complex<Real> d = z1 - z2;
-                    return std::abs(d.real()) <= MAX_ERROR*std::abs(z1.real())
-                        && std::abs(d.imag()) <= MAX_ERROR*std::abs(z1.imag());
+                    return abs(d.real()) <= MAX_ERROR*abs(z1.real())
+                        && abs(d.imag()) <= MAX_ERROR*abs(z1.imag());
             };
 
             if (z.real() > z_inf)
-                return std::complex<Real>(std::exp(z)/z) + acc;
+                return std::complex<Real>(exp(z)/z) + acc;
 
             if (abs_z > 1.1*z_asym) {
                 std::complex<Real> ei = acc + std::complex<Real>(Real(0.0), sign(z.imag())*M_PI);
-                std::complex<Real> s(std::exp(z)/z);
-                for (Size i=1; i <= std::floor(abs_z)+1; ++i) {
+                std::complex<Real> s(exp(z)/z);
+                for (Size i=1; i <= floor(abs_z)+1; ++i) {
                     if (match(ei+s, ei))
                         return ei+s;
                     ei += s;
@@ -163,13 +163,13 @@ namespace QuantLib {
                 QL_FAIL("series conversion issue for Ei(" << z << ")");
             }
 
-            if (abs_z > DIST && (z.real() < 0 || std::abs(z.imag()) > DIST)) {
+            if (abs_z > DIST && (z.real() < 0 || abs(z.imag()) > DIST)) {
                 std::complex<Real> ei(0.0);
                 for (Size k = 47; k >=1; --k) {
                     ei = - Real(k*k)/(2.0*k + 1.0 - z + ei);
                 }
                 return (acc + std::complex<Real>(0.0, sign(z.imag())*M_PI))
-                        - std::exp(z)/ (1.0 - z + ei);
+                        - exp(z)/ (1.0 - z + ei);
             }
 
             std::complex<Real> s(0.0), sn=z;
@@ -188,7 +188,7 @@ namespace QuantLib {
             QL_REQUIRE(n < 1000, "series conversion issue for Ei(" << z << ")");
 
             const std::complex<Real> r
-                = (M_EULER_MASCHERONI + acc) + std::log(z) + std::exp(0.5*z)*s;
+                = (M_EULER_MASCHERONI + acc) + log(z) + exp(0.5*z)*s;
 
             if (z.imag() != Real(0.0))
                 return r;
@@ -215,7 +215,7 @@ namespace QuantLib {
         // Reference:
         // https://functions.wolfram.com/GammaBetaErf/ExpIntegralEi/introductions/ExpIntegrals/ShowAll.html
         std::complex<Real> Si(const std::complex<Real>& z) {
-            if (std::abs(z) <= 0.2) {
+            if (abs(z) <= 0.2) {
                 std::complex<Real> s(0), nn(z);
                 Size k;
                 for (k=2; k < 100 && s != s+nn; ++k) {
@@ -41,7 +41,7 @@ namespace QuantLib {
     class ExpSinhIntegral : public Integrator {
       public:
         explicit ExpSinhIntegral(
-            Real relTolerance = std::sqrt(std::numeric_limits<Real>::epsilon()),
+            Real relTolerance = sqrt(std::numeric_limits<Real>::epsilon()),
             Size maxRefinements = 9)
       : Integrator(QL_MAX_REAL, Null<Size>()),
         relTolerance_(relTolerance),
@@ -48,11 +48,11 @@ namespace QuantLib {
         const Real theta2 = theta*theta;
         const Real theta3 = theta2*theta;
 
-        const Real alpha = 1/theta + std::sin(2*theta)/(2*theta2)
-            - 2*squared(std::sin(theta))/theta3;
-        const Real beta = 2*( (1+squared(std::cos(theta)))/theta2
-            - std::sin(2*theta)/theta3);
-        const Real gamma = 4*(std::sin(theta)/theta3 - std::cos(theta)/theta2);
+        const Real alpha = 1/theta + sin(2*theta)/(2*theta2)
+            - 2*squared(sin(theta))/theta3;
+        const Real beta = 2*( (1+squared(cos(theta)))/theta2
+            - sin(2*theta)/theta3);
+        const Real gamma = 4*(sin(theta)/theta3 - cos(theta)/theta2);
 
         Array v(x.size());
         std::transform(x.begin(), x.end(), v.begin(), f);
@@ -60,12 +60,12 @@ namespace QuantLib {
         std::function<Real(Real)> f1, f2;
         switch(type_) {
           case Cosine:
-            f1 = [](Real x) -> Real { return std::sin(x); };
-            f2 = [](Real x) -> Real { return std::cos(x); };
+            f1 = [](Real x) -> Real { return sin(x); };
+            f2 = [](Real x) -> Real { return cos(x); };
             break;
           case Sine:
-            f1 = [](Real x) -> Real { return std::cos(x); };
-            f2 = [](Real x) -> Real { return std::sin(x); };
+            f1 = [](Real x) -> Real { return cos(x); };
+            f2 = [](Real x) -> Real { return sin(x); };
             break;
           default:
             QL_FAIL("unknown integration type");
@@ -42,7 +42,7 @@ namespace QuantLib {
     }
 
     Real GaussianOrthogonalPolynomial::weightedValue(Size n, Real x) const {
-        return std::sqrt(w(x))*value(n, x);
+        return sqrt(w(x))*value(n, x);
     }
 
 
@@ -52,7 +52,7 @@ namespace QuantLib {
     }
 
     Real GaussLaguerrePolynomial::mu_0() const {
-        return std::exp(GammaFunction().logValue(s_+1));
+        return exp(GammaFunction().logValue(s_+1));
     }
 
     Real GaussLaguerrePolynomial::alpha(Size i) const {
@@ -64,7 +64,7 @@ namespace QuantLib {
     }
 
     Real GaussLaguerrePolynomial::w(Real x) const {
-        return std::pow(x, s_)*std::exp(-x);
+        return pow(x, s_)*exp(-x);
     }
 
 
@@ -74,7 +74,7 @@ namespace QuantLib {
     }
 
     Real GaussHermitePolynomial::mu_0() const {
-        return std::exp(GammaFunction().logValue(mu_+0.5));
+        return exp(GammaFunction().logValue(mu_+0.5));
     }
 
     Real GaussHermitePolynomial::alpha(Size) const {
@@ -86,7 +86,7 @@ namespace QuantLib {
     }
 
     Real GaussHermitePolynomial::w(Real x) const {
-        return std::pow(std::fabs(x), 2*mu_)*std::exp(-x*x);
+        return pow(fabs(x), 2*mu_)*exp(-x*x);
     }
 
     GaussJacobiPolynomial::GaussJacobiPolynomial(Real alpha, Real beta)
@@ -97,8 +97,8 @@ namespace QuantLib {
     }
 
     Real GaussJacobiPolynomial::mu_0() const {
-        return std::pow(2.0, alpha_+beta_+1)
-            * std::exp( GammaFunction().logValue(alpha_+1)
+        return pow(2.0, alpha_+beta_+1)
+            * exp( GammaFunction().logValue(alpha_+1)
                         +GammaFunction().logValue(beta_ +1)
                         -GammaFunction().logValue(alpha_+beta_+2));
     }
@@ -143,7 +143,7 @@ namespace QuantLib {
     }
 
     Real GaussJacobiPolynomial::w(Real x) const {
-        return std::pow(1-x, alpha_)*std::pow(1+x, beta_);
+        return pow(1-x, alpha_)*pow(1+x, beta_);
     }
 
 
@@ -176,7 +176,7 @@ namespace QuantLib {
     }
 
     Real GaussHyperbolicPolynomial::w(Real x) const {
-        return 1/std::cosh(x);
+        return 1/cosh(x);
     }
 
 }
@@ -45,7 +45,7 @@ namespace QuantLib {
 			if (m_.size() <= n)
 				m_.resize(n+1, std::numeric_limits<mp_real>::quiet_NaN());
 
-			if (std::isnan(m_[n])) {
+			if (isnan(m_[n])) {
 				if (n == 0)
 					m_[0] = m0();
 				else if (n == 1)
@@ -61,7 +61,7 @@ namespace QuantLib {
 			if (f_.size() <= n)
 				f_.resize(n+1, std::numeric_limits<mp_real>::quiet_NaN());
 
-			if (std::isnan(f_[n])) {
+			if (isnan(f_[n])) {
 				if (n == 0)
 					f_[0] = 1.0;
 				else
@@ -96,7 +96,7 @@ namespace QuantLib {
           m0_(1.0+1.0/(1.0+u*u)) { }
 
         mp_real moment(Size n) const override { return (this->moment_(n) + this->fact(n)) / m0_; }
-        Real w(Real x) const override { return std::exp(-x) * (1 + std::cos(this->u_ * x)) / m0_; }
+        Real w(Real x) const override { return exp(-x) * (1 + cos(this->u_ * x)) / m0_; }
 
       protected:
         mp_real m0() const override { return 1 / (1 + this->u_ * this->u_); }
@@ -128,7 +128,7 @@ namespace QuantLib {
           m0_(1.0+u/(1.0+u*u)) { }
 
         mp_real moment(Size n) const override { return (this->moment_(n) + this->fact(n)) / m0_; }
-        Real w(Real x) const override { return std::exp(-x) * (1 + std::sin(this->u_ * x)) / m0_; }
+        Real w(Real x) const override { return exp(-x) * (1 + sin(this->u_ * x)) / m0_; }
 
       protected:
         mp_real m0() const override { return this->u_ / (1 + this->u_ * this->u_); }
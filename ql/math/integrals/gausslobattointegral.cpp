@@ -27,8 +27,8 @@
 
 namespace QuantLib {
 
-    const Real GaussLobattoIntegral::alpha_ = std::sqrt(2.0/3.0); 
-    const Real GaussLobattoIntegral::beta_  = 1.0/std::sqrt(5.0);
+    const Real GaussLobattoIntegral::alpha_ = sqrt(2.0/3.0); 
+    const Real GaussLobattoIntegral::beta_  = 1.0/sqrt(5.0);
     const Real GaussLobattoIntegral::x1_    = 0.94288241569547971906; 
     const Real GaussLobattoIntegral::x2_    = 0.64185334234578130578;
     const Real GaussLobattoIntegral::x3_    = 0.23638319966214988028;
@@ -98,8 +98,8 @@ namespace QuantLib {
             const Real integral1 = (h/1470)*(77*(y1+y13)+432*(y3+y11)+
                                              625*(y5+y9)+672*y7);
         
-            if (std::fabs(integral2-acc) != 0.0) 
-                r = std::fabs(integral1-acc)/std::fabs(integral2-acc);
+            if (fabs(integral2-acc) != 0.0) 
+                r = fabs(integral1-acc)/fabs(integral2-acc);
             if (r == 0.0 || r > 1.0)
                 r = 1.0;
         }
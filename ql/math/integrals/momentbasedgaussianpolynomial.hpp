@@ -86,7 +86,7 @@ namespace QuantLib {
                 z_[0].size(), std::numeric_limits<mp_real>::quiet_NaN()));
         }
 
-        if (std::isnan(z_[k][i])) {
+        if (isnan(z_[k][i])) {
             if (k == 0)
                 z_[k][i] = moment(i);
             else {
@@ -105,7 +105,7 @@ namespace QuantLib {
         if (b_.size() <= u)
             b_.resize(u+1, std::numeric_limits<mp_real>::quiet_NaN());
 
-        if (std::isnan(b_[u])) {
+        if (isnan(b_[u])) {
             if (u == 0)
                 b_[u] = moment(1);
             else {
@@ -126,7 +126,7 @@ namespace QuantLib {
         if (c_.size() <= u)
             c_.resize(u+1, std::numeric_limits<mp_real>::quiet_NaN());
 
-        if (std::isnan(c_[u])) {
+        if (isnan(c_[u])) {
             const Integer iu(u);
             const mp_real tmp = z(iu, iu) / z(iu-1, iu-1);
             c_[u] = tmp;
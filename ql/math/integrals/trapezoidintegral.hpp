@@ -69,7 +69,7 @@ namespace QuantLib {
                 increaseNumberOfEvaluations(N*(IntegrationPolicy::nbEvalutions()-1));
                 N *= IntegrationPolicy::nbEvalutions();
                 // good enough? Also, don't run away immediately
-                if (std::fabs(I-newI) <= absoluteAccuracy() && i > 5)
+                if (fabs(I-newI) <= absoluteAccuracy() && i > 5)
                     // ok, exit
                     return newI;
                 // oh well. Another step.
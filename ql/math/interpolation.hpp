@@ -68,6 +68,20 @@ namespace QuantLib {
             virtual Real primitive(Real) const = 0;
             virtual Real derivative(Real) const = 0;
             virtual Real secondDerivative(Real) const = 0;
+            //! values at sorted points; implementations can merge them in one pass
+            virtual void values(const Real* x, Real* y, Size n) const {
+                for (Size i=0; i<n; ++i)
+                    y[i] = value(x[i]);
+            }
+            //! derivatives of the value at x with respect to the y values
+            /*! The default implementation returns false, i.e., they
+                are not available.
+            */
+            virtual bool yDerivatives(Real, std::vector<Real>&) const {
+                return false;
+            }
+            virtual void enableLocateIndex(bool) {}
+            virtual void updateLocateIndex() {}
         };
         ext::shared_ptr<Impl> impl_;
       public:
@@ -97,6 +111,16 @@ namespace QuantLib {
                 Real x1 = xMin(), x2 = xMax();
                 return (x >= x1 && x <= x2) || close(x,x1) || close(x,x2);
             }
+            void enableLocateIndex(bool b) override {
+                if (b)
+                    buildLocateIndex();
+                else
+                    locateIndex_.clear();
+            }
+            void updateLocateIndex() override {
+                if (!locateIndex_.empty())
+                    buildLocateIndex();
+            }
 
           protected:
             Size locate(Real x) const {
@@ -108,11 +132,45 @@ namespace QuantLib {
                     return 0;
                 else if (x > *(xEnd_-1))
                     return xEnd_-xBegin_-2;
-                else
-                    return std::upper_bound(xBegin_,xEnd_-1,x)-xBegin_-1;
+                else if (!locateIndex_.empty()) {
+                    // the bucket containing x gives the range of
+                    // intervals to search; the check guards against
+                    // an index built on different x values.
+                    Real position = (x - locateOrigin_) * locateScale_;
+                    Size b = position > 0.0 ?
+                        std::min(static_cast<Size>(position), locateIndex_.size()-2) : 0;
+                    Size lo = locateIndex_[b], hi = locateIndex_[b+1];
+                    if (*(xBegin_+lo) <= x &&
+                        (hi == Size(xEnd_-xBegin_-2) || x < *(xBegin_+hi+1)))
+                        return std::upper_bound(xBegin_+lo+1,xBegin_+hi+1,x)-xBegin_-1;
+                }
+                return std::upper_bound(xBegin_,xEnd_-1,x)-xBegin_-1;
             }
             I1 xBegin_, xEnd_;
             I2 yBegin_;
+
+          private:
+            void buildLocateIndex() {
+                // one bucket per interval on average: on uniform and
+                // near-uniform grids each bucket spans one or two
+                // intervals and the search above takes constant time.
+                Size n = xEnd_-xBegin_;
+                if (n < 3)
+                    return;
+                locateOrigin_ = *xBegin_;
+                locateScale_ = (n-1) / (*(xEnd_-1) - locateOrigin_);
+                locateIndex_.resize(n);
+                locateIndex_[0] = 0;
+                for (Size b=1, i=0; b<n-1; ++b) {
+                    Real edge = locateOrigin_ + b / locateScale_;
+                    while (i < n-2 && *(xBegin_+i+1) <= edge)
+                        ++i;
+                    locateIndex_[b] = i;
+                }
+                locateIndex_[n-1] = n-2;
+            }
+            std::vector<Size> locateIndex_;
+            Real locateOrigin_ = 0.0, locateScale_ = 0.0;
         };
 
         Interpolation() = default;
@@ -122,10 +180,29 @@ namespace QuantLib {
             checkRange(x,allowExtrapolation);
             return impl_->value(x);
         }
+        //! values at the n sorted points xs, written to ys
+        void operator()(const Real* xs, Real* ys, Size n,
+                        bool allowExtrapolation = false) const {
+            if (n == 0)
+                return;
+            QL_REQUIRE(std::is_sorted(xs, xs+n), "unsorted x values");
+            checkRange(xs[0],allowExtrapolation);
+            checkRange(xs[n-1],allowExtrapolation);
+            impl_->values(xs, ys, n);
+        }
         Real primitive(Real x, bool allowExtrapolation = false) const {
             checkRange(x,allowExtrapolation);
             return impl_->primitive(x);
         }
+        //! derivatives of the value at x with respect to the y values
+        /*! Returns false if the interpolation doesn't provide them;
+            otherwise, \p derivatives holds one value for each point.
+        */
+        bool yDerivatives(Real x, std::vector<Real>& derivatives,
+                          bool allowExtrapolation = false) const {
+            checkRange(x,allowExtrapolation);
+            return impl_->yDerivatives(x, derivatives);
+        }
         Real derivative(Real x, bool allowExtrapolation = false) const {
             checkRange(x,allowExtrapolation);
             return impl_->derivative(x);
@@ -145,6 +222,16 @@ namespace QuantLib {
         }
         void update() {
             impl_->update();
+            impl_->updateLocateIndex();
+        }
+        //! speeds up the search of the interval containing a given point
+        /*! A bucket index over the x values is built and kept up to
+            date by update(); on uniform or near-uniform grids it
+            replaces the binary search with a constant-time lookup.
+            Results are the same with or without the index.
+        */
+        void enableLocateIndex(bool b = true) {
+            impl_->enableLocateIndex(b);
         }
       protected:
         void checkRange(Real x, bool extrapolate) const {
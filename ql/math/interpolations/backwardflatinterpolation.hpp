@@ -104,6 +104,16 @@ namespace QuantLib {
             }
             Real derivative(Real) const override { return 0.0; }
             Real secondDerivative(Real) const override { return 0.0; }
+            bool yDerivatives(Real x, std::vector<Real>& d) const override {
+                d.assign(this->xEnd_-this->xBegin_, 0.0);
+                if (x <= this->xBegin_[0] || d.size() == 1) {
+                    d[0] = 1.0;
+                } else {
+                    Size i = this->locate(x);
+                    d[x == this->xBegin_[i] ? i : i+1] = 1.0;
+                }
+                return true;
+            }
 
           private:
             std::vector<Real> primitive_;
@@ -61,11 +61,11 @@ namespace QuantLib {
         switch(pointsType) {
           case FirstKind:
             for (Size i=0; i < n; ++i)
-                t[i] = -std::cos((i+0.5)*M_PI/n);
+                t[i] = -cos((i+0.5)*M_PI/n);
             break;
           case SecondKind:
             for (Size i=0; i < n; ++i)
-                t[i] = -std::cos(i*M_PI/(n-1));
+                t[i] = -cos(i*M_PI/(n-1));
             break;
           default:
               QL_FAIL("unknonw Chebyshev interpolation points type");
@@ -593,8 +593,8 @@ namespace QuantLib {
                                 tmp_[n_-1] = ((2.0*dx_[n_-2]+dx_[n_-3])*S_[n_-2] - dx_[n_-2]*S_[n_-3]) / (dx_[n_-2]+dx_[n_-3]);
                                 break;
                             case CubicInterpolation::Akima:
-                                tmp_[0] = (std::abs(S_[1]-S_[0])*2*S_[0]*S_[1]+std::abs(2*S_[0]*S_[1]-4*S_[0]*S_[0]*S_[1])*S_[0])/(std::abs(S_[1]-S_[0])+std::abs(2*S_[0]*S_[1]-4*S_[0]*S_[0]*S_[1]));
-                                tmp_[1] = (std::abs(S_[2]-S_[1])*S_[0]+std::abs(S_[0]-2*S_[0]*S_[1])*S_[1])/(std::abs(S_[2]-S_[1])+std::abs(S_[0]-2*S_[0]*S_[1]));
+                                tmp_[0] = (abs(S_[1]-S_[0])*2*S_[0]*S_[1]+abs(2*S_[0]*S_[1]-4*S_[0]*S_[0]*S_[1])*S_[0])/(abs(S_[1]-S_[0])+abs(2*S_[0]*S_[1]-4*S_[0]*S_[0]*S_[1]));
+                                tmp_[1] = (abs(S_[2]-S_[1])*S_[0]+abs(S_[0]-2*S_[0]*S_[1])*S_[1])/(abs(S_[2]-S_[1])+abs(S_[0]-2*S_[0]*S_[1]));
                                 for (Size i=2; i<n_-2; ++i) {
                                     if ((S_[i-2]==S_[i-1]) && (S_[i]!=S_[i+1]))
                                         tmp_[i] = S_[i-1];
@@ -605,10 +605,10 @@ namespace QuantLib {
                                     else if ((S_[i-2]==S_[i-1]) && (S_[i-1]!=S_[i]) && (S_[i]==S_[i+1]))
                                         tmp_[i] = (S_[i-1]+S_[i])/2.0;
                                     else
-                                        tmp_[i] = (std::abs(S_[i+1]-S_[i])*S_[i-1]+std::abs(S_[i-1]-S_[i-2])*S_[i])/(std::abs(S_[i+1]-S_[i])+std::abs(S_[i-1]-S_[i-2]));
+                                        tmp_[i] = (abs(S_[i+1]-S_[i])*S_[i-1]+abs(S_[i-1]-S_[i-2])*S_[i])/(abs(S_[i+1]-S_[i])+abs(S_[i-1]-S_[i-2]));
                                  }
-                                 tmp_[n_-2] = (std::abs(2*S_[n_-2]*S_[n_-3]-S_[n_-2])*S_[n_-3]+std::abs(S_[n_-3]-S_[n_-4])*S_[n_-2])/(std::abs(2*S_[n_-2]*S_[n_-3]-S_[n_-2])+std::abs(S_[n_-3]-S_[n_-4]));
-                                 tmp_[n_-1] = (std::abs(4*S_[n_-2]*S_[n_-2]*S_[n_-3]-2*S_[n_-2]*S_[n_-3])*S_[n_-2]+std::abs(S_[n_-2]-S_[n_-3])*2*S_[n_-2]*S_[n_-3])/(std::abs(4*S_[n_-2]*S_[n_-2]*S_[n_-3]-2*S_[n_-2]*S_[n_-3])+std::abs(S_[n_-2]-S_[n_-3]));
+                                 tmp_[n_-2] = (abs(2*S_[n_-2]*S_[n_-3]-S_[n_-2])*S_[n_-3]+abs(S_[n_-3]-S_[n_-4])*S_[n_-2])/(abs(2*S_[n_-2]*S_[n_-3]-S_[n_-2])+abs(S_[n_-3]-S_[n_-4]));
+                                 tmp_[n_-1] = (abs(4*S_[n_-2]*S_[n_-2]*S_[n_-3]-2*S_[n_-2]*S_[n_-3])*S_[n_-2]+abs(S_[n_-2]-S_[n_-3])*2*S_[n_-2]*S_[n_-3])/(abs(4*S_[n_-2]*S_[n_-2]*S_[n_-3]-2*S_[n_-2]*S_[n_-3])+abs(S_[n_-2]-S_[n_-3]));
                                  break;
                             case CubicInterpolation::Kruger:
                                 // intermediate points
@@ -645,7 +645,7 @@ namespace QuantLib {
                                     tmp_[0] = 0;
                                 }
                                 else if (S_[0]*S_[1]<0) {
-                                    if (std::fabs(tmp_[0])>std::fabs(3*S_[0])) {
+                                    if (fabs(tmp_[0])>fabs(3*S_[0])) {
                                             tmp_[0] = 3*S_[0];
                                     }
                                 }
@@ -655,7 +655,7 @@ namespace QuantLib {
                                     tmp_[n_-1] = 0;
                                 }
                                 else if (S_[n_-2]*S_[n_-3]<0) {
-                                    if (std::fabs(tmp_[n_-1])>std::fabs(3*S_[n_-2])) {
+                                    if (fabs(tmp_[n_-1])>fabs(3*S_[n_-2])) {
                                         tmp_[n_-1] = 3*S_[n_-2];
                                     }
                                 }
@@ -675,9 +675,9 @@ namespace QuantLib {
                     for (Size i=0; i<n_; ++i) {
                         if (i==0) {
                             if (tmp_[i]*S_[0]>0.0) {
-                                correction = tmp_[i]/std::fabs(tmp_[i]) *
-                                    std::min<Real>(std::fabs(tmp_[i]),
-                                                   std::fabs(3.0*S_[0]));
+                                correction = tmp_[i]/fabs(tmp_[i]) *
+                                    std::min<Real>(fabs(tmp_[i]),
+                                                   fabs(3.0*S_[0]));
                             } else {
                                 correction = 0.0;
                             }
@@ -687,9 +687,9 @@ namespace QuantLib {
                             }
                         } else if (i==n_-1) {
                             if (tmp_[i]*S_[n_-2]>0.0) {
-                                correction = tmp_[i]/std::fabs(tmp_[i]) *
-                                    std::min<Real>(std::fabs(tmp_[i]),
-                                                   std::fabs(3.0*S_[n_-2]));
+                                correction = tmp_[i]/fabs(tmp_[i]) *
+                                    std::min<Real>(fabs(tmp_[i]),
+                                                   fabs(3.0*S_[n_-2]));
                             } else {
                                 correction = 0.0;
                             }
@@ -700,9 +700,9 @@ namespace QuantLib {
                         } else {
                             pm=(S_[i-1]*dx_[i]+S_[i]*dx_[i-1])/
                                 (dx_[i-1]+dx_[i]);
-                            M = 3.0 * std::min(std::min(std::fabs(S_[i-1]),
-                                                        std::fabs(S_[i])),
-                                               std::fabs(pm));
+                            M = 3.0 * std::min(std::min(fabs(S_[i-1]),
+                                                        fabs(S_[i])),
+                                               fabs(pm));
                             if (i>1) {
                                 if ((S_[i-1]-S_[i-2])*(S_[i]-S_[i-1])>0.0) {
                                     pd=(S_[i-1]*(2.0*dx_[i-1]+dx_[i-2])
@@ -710,7 +710,7 @@ namespace QuantLib {
                                         (dx_[i-2]+dx_[i-1]);
                                     if (pm*pd>0.0 && pm*(S_[i-1]-S_[i-2])>0.0) {
                                         M = std::max<Real>(M, 1.5*std::min(
-                                                std::fabs(pm),std::fabs(pd)));
+                                                fabs(pm),fabs(pd)));
                                     }
                                 }
                             }
@@ -720,13 +720,13 @@ namespace QuantLib {
                                         (dx_[i]+dx_[i+1]);
                                     if (pm*pu>0.0 && -pm*(S_[i]-S_[i-1])>0.0) {
                                         M = std::max<Real>(M, 1.5*std::min(
-                                                std::fabs(pm),std::fabs(pu)));
+                                                fabs(pm),fabs(pu)));
                                     }
                                 }
                             }
                             if (tmp_[i]*pm>0.0) {
-                                correction = tmp_[i]/std::fabs(tmp_[i]) *
-                                    std::min(std::fabs(tmp_[i]), M);
+                                correction = tmp_[i]/fabs(tmp_[i]) *
+                                    std::min(fabs(tmp_[i]), M);
                             } else {
                                 correction = 0.0;
                             }
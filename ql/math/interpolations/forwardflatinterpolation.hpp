@@ -96,6 +96,11 @@ namespace QuantLib {
             }
             Real derivative(Real) const override { return 0.0; }
             Real secondDerivative(Real) const override { return 0.0; }
+            bool yDerivatives(Real x, std::vector<Real>& d) const override {
+                d.assign(n_, 0.0);
+                d[x >= this->xBegin_[n_-1] ? n_-1 : this->locate(x)] = 1.0;
+                return true;
+            }
 
           private:
             std::vector<Real> primitive_;
@@ -114,7 +114,7 @@ namespace QuantLib {
             template <class Iterator>
             Real _value(const Iterator& yBegin, Real x) const {
 
-                const Real eps = 10*QL_EPSILON*std::abs(x);
+                const Real eps = 10*QL_EPSILON*abs(x);
                 const auto iter = std::lower_bound(
                     this->xBegin_, this->xEnd_, x - eps);
                 if (iter != this->xEnd_ && *iter - x < eps) {
@@ -89,6 +89,18 @@ namespace QuantLib {
                 Size i = this->locate(x);
                 return this->yBegin_[i] + (x-this->xBegin_[i])*s_[i];
             }
+            void values(const Real* x, Real* y, Size n) const override {
+                if (n == 0)
+                    return;
+                // x is sorted: walk the nodes along with it
+                const Size last = (this->xEnd_-this->xBegin_)-2;
+                Size i = this->locate(x[0]);
+                for (Size j=0; j<n; ++j) {
+                    while (i < last && x[j] >= this->xBegin_[i+1])
+                        ++i;
+                    y[j] = this->yBegin_[i] + (x[j]-this->xBegin_[i])*s_[i];
+                }
+            }
             Real primitive(Real x) const override {
                 Size i = this->locate(x);
                 Real dx = x-this->xBegin_[i];
@@ -100,6 +112,14 @@ namespace QuantLib {
                 return s_[i];
             }
             Real secondDerivative(Real) const override { return 0.0; }
+            bool yDerivatives(Real x, std::vector<Real>& d) const override {
+                Size i = this->locate(x);
+                Real w = (x-this->xBegin_[i])/(this->xBegin_[i+1]-this->xBegin_[i]);
+                d.assign(this->xEnd_-this->xBegin_, 0.0);
+                d[i] = 1.0 - w;
+                d[i+1] = w;
+                return true;
+            }
 
           private:
             std::vector<Real> primitiveConst_, s_;
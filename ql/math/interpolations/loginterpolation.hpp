@@ -372,11 +372,22 @@ namespace QuantLib {
                     QL_REQUIRE(this->yBegin_[i]>0.0,
                                "invalid value (" << this->yBegin_[i]
                                << ") at index " << i);
-                    logY_[i] = std::log(this->yBegin_[i]);
+                    logY_[i] = log(this->yBegin_[i]);
                 }
                 interpolation_.update();
             }
-            Real value(Real x) const override { return std::exp(interpolation_(x, true)); }
+            Real value(Real x) const override { return exp(interpolation_(x, true)); }
+            void values(const Real* x, Real* y, Size n) const override {
+                interpolation_(x, y, n, true);
+                for (Size i=0; i<n; ++i)
+                    y[i] = exp(y[i]);
+            }
+            void enableLocateIndex(bool b) override {
+                interpolation_.enableLocateIndex(b);
+            }
+            // the index of the underlying interpolation is kept up to
+            // date by its own update()
+            void updateLocateIndex() override {}
             Real primitive(Real) const override {
                 QL_FAIL("LogInterpolation primitive not implemented");
             }
@@ -387,6 +398,14 @@ namespace QuantLib {
                 return derivative(x)*interpolation_.derivative(x, true) +
                             value(x)*interpolation_.secondDerivative(x, true);
             }
+            bool yDerivatives(Real x, std::vector<Real>& d) const override {
+                if (!interpolation_.yDerivatives(x, d, true))
+                    return false;
+                Real v = value(x);
+                for (Size i=0; i<d.size(); ++i)
+                    d[i] *= v/this->yBegin_[i];
+                return true;
+            }
 
           private:
             std::vector<Real> logY_;
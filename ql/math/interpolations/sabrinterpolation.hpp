@@ -54,6 +54,11 @@ class SABRWrapper {
         return shiftedSabrVolatility(x, forward_, t_, params_[0], params_[1],
                                      params_[2], params_[3], shift_, volatilityType);
     }
+    Array volatilityGradient(const Real x, const VolatilityType volatilityType) {
+        return unsafeShiftedSabrVolatilityGradient(x, forward_, t_, params_[0], params_[1],
+                                                   params_[2], params_[3], shift_,
+                                                   volatilityType);
+    }
 
   private:
     const Real t_, &forward_;
@@ -71,11 +76,11 @@ struct SABRSpecs {
         if (params[0] == Null<Real>())
             // adapt alpha to beta level
             params[0] = 0.2 * (params[1] < 0.9999 ?
-                                   Real(std::pow(forward + (addParams.empty() ? 0.0 : addParams[0]),
+                                   Real(pow(forward + (addParams.empty() ? 0.0 : addParams[0]),
                                             1.0 - params[1])) :
                                    1.0);
         if (params[2] == Null<Real>())
-            params[2] = std::sqrt(0.4);
+            params[2] = sqrt(0.4);
         if (params[3] == Null<Real>())
             params[3] = 0.0;
     }
@@ -90,7 +95,7 @@ struct SABRSpecs {
             // adapt this to beta level
             if (values[1] < 0.999)
                 values[0] *=
-                    std::pow(forward + (addParams.empty() ? 0.0 : addParams[0]), 1.0 - values[1]);
+                    pow(forward + (addParams.empty() ? 0.0 : addParams[0]), 1.0 - values[1]);
         }
         if (!paramIsFixed[2])
             values[2] = 1.5 * r[j++] + 1E-6;
@@ -103,31 +108,45 @@ struct SABRSpecs {
     Array inverse(const Array &y, const std::vector<bool> &,
                   const std::vector<Real> &, const Real) {
         Array x(4);
-        x[0] = y[0] < 25.0 + eps1() ? Real(std::sqrt(y[0] - eps1()))
+        x[0] = y[0] < 25.0 + eps1() ? Real(sqrt(y[0] - eps1()))
                                     : Real((y[0] - eps1() + 25.0) / 10.0);
         // y_[1] = std::tan(M_PI*(x[1] - 0.5))/dilationFactor();
-        x[1] = std::sqrt(-std::log(y[1]));
-        x[2] = y[2] < 25.0 + eps1() ? Real(std::sqrt(y[2] - eps1()))
+        x[1] = sqrt(-log(y[1]));
+        x[2] = y[2] < 25.0 + eps1() ? Real(sqrt(y[2] - eps1()))
                                     : Real((y[2] - eps1() + 25.0) / 10.0);
-        x[3] = std::asin(y[3] / eps2());
+        x[3] = asin(y[3] / eps2());
         return x;
     }
     Array direct(const Array &x, const std::vector<bool> &,
                  const std::vector<Real> &, const Real) {
         Array y(4);
-        y[0] = std::fabs(x[0]) < 5.0 ? Real(x[0] * x[0] + eps1())
-                                     : Real((10.0 * std::fabs(x[0]) - 25.0) + eps1());
+        y[0] = fabs(x[0]) < 5.0 ? Real(x[0] * x[0] + eps1())
+                                     : Real((10.0 * fabs(x[0]) - 25.0) + eps1());
         // y_[1] = std::atan(dilationFactor_*x[1])/M_PI + 0.5;
-        y[1] = std::fabs(x[1]) < std::sqrt(-std::log(eps1()))
-                   ? std::exp(-(x[1] * x[1]))
+        y[1] = fabs(x[1]) < sqrt(-log(eps1()))
+                   ? exp(-(x[1] * x[1]))
                    : eps1();
-        y[2] = std::fabs(x[2]) < 5.0 ? Real(x[2] * x[2] + eps1())
-                                     : Real((10.0 * std::fabs(x[2]) - 25.0) + eps1());
-        y[3] = std::fabs(x[3]) < 2.5 * M_PI
-                   ? Real(eps2() * std::sin(x[3]))
+        y[2] = fabs(x[2]) < 5.0 ? Real(x[2] * x[2] + eps1())
+                                     : Real((10.0 * fabs(x[2]) - 25.0) + eps1());
+        y[3] = fabs(x[3]) < 2.5 * M_PI
+                   ? Real(eps2() * sin(x[3]))
                    : Real(eps2() * (x[3] > 0.0 ? 1.0 : (-1.0)));
         return y;
     }
+    // derivatives of direct(), which transforms each parameter separately
+    Array directDerivatives(const Array &x, const std::vector<bool> &,
+                            const std::vector<Real> &, const Real) {
+        Array dy(4);
+        dy[0] = fabs(x[0]) < 5.0 ? Real(2.0 * x[0])
+                                      : Real(x[0] > 0.0 ? 10.0 : -10.0);
+        dy[1] = fabs(x[1]) < sqrt(-log(eps1()))
+                    ? Real(-2.0 * x[1] * exp(-(x[1] * x[1])))
+                    : 0.0;
+        dy[2] = fabs(x[2]) < 5.0 ? Real(2.0 * x[2])
+                                      : Real(x[2] > 0.0 ? 10.0 : -10.0);
+        dy[3] = fabs(x[3]) < 2.5 * M_PI ? Real(eps2() * cos(x[3])) : 0.0;
+        return dy;
+    }
     Real weight(const Real strike, const Real forward, const Real stdDev,
                 const std::vector<Real> &addParams) {
         return blackFormulaStdDevDerivative(strike, forward, stdDev, 1.0,
@@ -164,7 +183,8 @@ class SABRInterpolation : public Interpolation {
                       const Real errorAccept = 0.0020,
                       const bool useMaxError = false,
                       const Size maxGuesses = 50, const Real shift = 0.0,
-                      const VolatilityType volatilityType = VolatilityType::ShiftedLognormal) {
+                      const VolatilityType volatilityType = VolatilityType::ShiftedLognormal,
+                      const bool useAnalyticJacobian = false) {
 
         impl_ = ext::shared_ptr<Interpolation::Impl>(
             new detail::XABRInterpolationImpl<I1, I2, detail::SABRSpecs>(
@@ -172,7 +192,7 @@ class SABRInterpolation : public Interpolation {
                 {alpha, beta, nu, rho},
                 {alphaIsFixed, betaIsFixed, nuIsFixed, rhoIsFixed},
                 vegaWeighted, endCriteria, optMethod, errorAccept, useMaxError,
-                maxGuesses, {shift}, volatilityType));
+                maxGuesses, {shift}, volatilityType, useAnalyticJacobian));
     }
     Real expiry() const { return coeffs().t_; }
     Real forward() const { return coeffs().forward_; }
@@ -213,12 +233,15 @@ class SABR {
          const Real errorAccept = 0.0020,
          const bool useMaxError = false,
          const Size maxGuesses = 50,
-         const Real shift = 0.0)
+         const Real shift = 0.0,
+         const VolatilityType volatilityType = VolatilityType::ShiftedLognormal,
+         const bool useAnalyticJacobian = false)
     : t_(t), forward_(forward), alpha_(alpha), beta_(beta), nu_(nu), rho_(rho),
       alphaIsFixed_(alphaIsFixed), betaIsFixed_(betaIsFixed), nuIsFixed_(nuIsFixed),
       rhoIsFixed_(rhoIsFixed), vegaWeighted_(vegaWeighted), endCriteria_(std::move(endCriteria)),
       optMethod_(std::move(optMethod)), errorAccept_(errorAccept), useMaxError_(useMaxError),
-      maxGuesses_(maxGuesses), shift_(shift) {}
+      maxGuesses_(maxGuesses), shift_(shift), volatilityType_(volatilityType),
+      useAnalyticJacobian_(useAnalyticJacobian) {}
     template <class I1, class I2>
     Interpolation interpolate(const I1 &xBegin, const I1 &xEnd,
                               const I2 &yBegin) const {
@@ -226,7 +249,8 @@ class SABR {
                                  beta_, nu_, rho_, alphaIsFixed_, betaIsFixed_,
                                  nuIsFixed_, rhoIsFixed_, vegaWeighted_,
                                  endCriteria_, optMethod_, errorAccept_,
-                                 useMaxError_, maxGuesses_, shift_);
+                                 useMaxError_, maxGuesses_, shift_,
+                                 volatilityType_, useAnalyticJacobian_);
     }
     static const bool global = true;
 
@@ -242,6 +266,8 @@ class SABR {
     const bool useMaxError_;
     const Size maxGuesses_;
     const Real shift_;
+    const VolatilityType volatilityType_;
+    const bool useAnalyticJacobian_;
 };
 }
 
@@ -43,6 +43,7 @@
 #include <termstructures/volatility/volatilitytype.hpp>
 #include <utilities/dataformatters.hpp>
 #include <utilities/null.hpp>
+#include <type_traits>
 #include <utility>
 
 namespace QuantLib::detail {
@@ -96,6 +97,34 @@ template <typename Model> class XABRCoeffHolder {
     std::vector<Real> addParams_;
 };
 
+/*! Models whose instances provide volatilityGradient(), i.e. the
+    derivatives of the volatility with respect to the parameters, and
+    whose transformation provides directDerivatives() can be calibrated
+    with an analytic jacobian.  It is used by optimization methods that
+    ask for the cost function's jacobian, e.g. a LevenbergMarquardt
+    instance with useCostFunctionsJacobian set to true; if no optimizer
+    is given, the interpolation builds its own such instance when
+    useAnalyticJacobian is true.
+
+    \note The default optimizer uses finite differences.  With exact
+          derivatives, Levenberg-Marquardt keeps making slow progress
+          along the degenerate large-alpha/large-nu valley instead of
+          stalling, so that guesses leading there can exhaust the default
+          end criteria; when multiple guesses are tried, a smaller
+          iteration budget should be passed along with the optimizer.
+*/
+template <typename Model, typename = void>
+struct XABRHasAnalyticJacobian : std::false_type {};
+
+template <typename Model>
+struct XABRHasAnalyticJacobian<
+    Model,
+    std::void_t<decltype(std::declval<Model&>().directDerivatives(
+                    std::declval<const Array&>(), std::declval<const std::vector<bool>&>(),
+                    std::declval<const std::vector<Real>&>(), Real())),
+                decltype(std::declval<typename Model::type&>().volatilityGradient(
+                    Real(), VolatilityType()))>> : std::true_type {};
+
 template <class I1, class I2, typename Model>
 class XABRInterpolationImpl final : public Interpolation::templateImpl<I1, I2>,
                                     public XABRCoeffHolder<Model> {
@@ -114,7 +143,8 @@ class XABRInterpolationImpl final : public Interpolation::templateImpl<I1, I2>,
                           const bool useMaxError,
                           const Size maxGuesses,
                           const std::vector<Real>& addParams = std::vector<Real>(),
-                          VolatilityType volatilityType = VolatilityType::ShiftedLognormal)
+                          VolatilityType volatilityType = VolatilityType::ShiftedLognormal,
+                          bool useAnalyticJacobian = false)
     : Interpolation::templateImpl<I1, I2>(xBegin, xEnd, yBegin, 1),
       XABRCoeffHolder<Model>(t, forward, params, paramIsFixed, addParams),
       endCriteria_(std::move(endCriteria)), optMethod_(std::move(optMethod)),
@@ -123,7 +153,7 @@ class XABRInterpolationImpl final : public Interpolation::templateImpl<I1, I2>,
         // if no optimization method or endCriteria is provided, we provide one
         if (!optMethod_)
             optMethod_ = ext::shared_ptr<OptimizationMethod>(
-                new LevenbergMarquardt(1e-8, 1e-8, 1e-8));
+                new LevenbergMarquardt(1e-8, 1e-8, 1e-8, useAnalyticJacobian));
         // optMethod_ = ext::shared_ptr<OptimizationMethod>(new
         //    Simplex(0.01));
         if (!endCriteria_) {
@@ -148,7 +178,7 @@ class XABRInterpolationImpl final : public Interpolation::templateImpl<I1, I2>,
             this->weights_.clear();
             Real weightsSum = 0.0;
             for (; x != this->xEnd_; ++x, ++y) {
-                Real stdDev = std::sqrt((*y) * (*y) * this->t_);
+                Real stdDev = sqrt((*y) * (*y) * this->t_);
                 this->weights_.push_back(Model().weight(*x, this->forward_, stdDev,
                                                         this->addParams_));
                 weightsSum += this->weights_.back();
@@ -263,7 +293,7 @@ class XABRInterpolationImpl final : public Interpolation::templateImpl<I1, I2>,
         I2 y = this->yBegin_;
         auto w = this->weights_.begin();
         for (; x != this->xEnd_; ++x, ++r, ++w, ++y) {
-            *r = (value(*x) - *y) * std::sqrt(*w);
+            *r = (value(*x) - *y) * sqrt(*w);
         }
         return results;
     }
@@ -271,7 +301,7 @@ class XABRInterpolationImpl final : public Interpolation::templateImpl<I1, I2>,
     Real interpolationError() const {
         Size n = this->xEnd_ - this->xBegin_;
         Real squaredError = interpolationSquaredError();
-        return std::sqrt(n * squaredError / (n==1 ? 1 : (n - 1)));
+        return sqrt(n * squaredError / (n==1 ? 1 : (n - 1)));
     }
 
     Real interpolationMaxError() const {
@@ -279,7 +309,7 @@ class XABRInterpolationImpl final : public Interpolation::templateImpl<I1, I2>,
         I1 i = this->xBegin_;
         I2 j = this->yBegin_;
         for (; i != this->xEnd_; ++i, ++j) {
-            error = std::fabs(value(*i) - *j);
+            error = fabs(value(*i) - *j);
             maxError = std::max(maxError, error);
         }
         return maxError;
@@ -308,6 +338,30 @@ class XABRInterpolationImpl final : public Interpolation::templateImpl<I1, I2>,
             return xabr_->interpolationErrors();
         }
 
+        void jacobian(Matrix& jac, const Array& x) const override {
+            if constexpr (XABRHasAnalyticJacobian<Model>::value) {
+                const Array y = Model().direct(x, xabr_->paramIsFixed_,
+                                               xabr_->params_, xabr_->forward_);
+                for (Size i = 0; i < xabr_->params_.size(); ++i)
+                    xabr_->params_[i] = y[i];
+                xabr_->updateModelInstance();
+                const Array dy = Model().directDerivatives(
+                    x, xabr_->paramIsFixed_, xabr_->params_, xabr_->forward_);
+
+                I1 k = xabr_->xBegin_;
+                auto w = xabr_->weights_.begin();
+                for (Size i = 0; k != xabr_->xEnd_; ++k, ++w, ++i) {
+                    const Array dVol = xabr_->modelInstance_->volatilityGradient(
+                        *k, xabr_->volatilityType_);
+                    const Real sqrtW = sqrt(*w);
+                    for (Size j = 0; j < x.size(); ++j)
+                        jac[i][j] = sqrtW * dVol[j] * dy[j];
+                }
+            } else {
+                CostFunction::jacobian(jac, x);
+            }
+        }
+
       private:
         XABRInterpolationImpl *xabr_;
     };
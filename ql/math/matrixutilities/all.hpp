@@ -4,11 +4,13 @@
 #include <math/matrixutilities/basisincompleteordered.hpp>
 #include <math/matrixutilities/bicgstab.hpp>
 #include <math/matrixutilities/choleskydecomposition.hpp>
+#include <math/matrixutilities/csrmatrix.hpp>
 #include <math/matrixutilities/expm.hpp>
 #include <math/matrixutilities/factorreduction.hpp>
 #include <math/matrixutilities/getcovariance.hpp>
 #include <math/matrixutilities/gmres.hpp>
 #include <math/matrixutilities/householder.hpp>
+#include <math/matrixutilities/ilu0preconditioner.hpp>
 #include <math/matrixutilities/pseudosqrt.hpp>
 #include <math/matrixutilities/qrdecomposition.hpp>
 #include <math/matrixutilities/sparseilupreconditioner.hpp>
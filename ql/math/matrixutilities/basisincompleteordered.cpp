@@ -44,7 +44,7 @@ namespace QuantLib {
                 newVector_[k] -= innerProd * currentBasi[k];
         }
 
-        Real norm = std::sqrt(std::inner_product(newVector_.begin(),
+        Real norm = sqrt(std::inner_product(newVector_.begin(),
             newVector_.end(),
             newVector_.begin(), Real(0.0)));
 
@@ -91,7 +91,7 @@ namespace QuantLib {
 
         Real norm(const Matrix& v, Size row)
         {
-            return std::sqrt(normSquared( v,  row));
+            return sqrt(normSquared( v,  row));
         }
 
         Real innerProduct(const Matrix& v, Size row1, const Matrix& w, Size row2)
@@ -181,7 +181,7 @@ namespace QuantLib {
                Real projectionOnOriginalDirection = innerProduct(originalVectors_,j,orthoNormalizedVectors_,j);
                Real sizeMultiplier = prevNormSquared/projectionOnOriginalDirection;
 
-               if (std::fabs(sizeMultiplier) < multiplierCutoff_)
+               if (fabs(sizeMultiplier) < multiplierCutoff_)
                {
                     for (Size t=0; t < dimension_; ++t)
                         currentVector[t] = orthoNormalizedVectors_[j][t]*sizeMultiplier;
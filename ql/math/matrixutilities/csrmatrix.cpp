@@ -0,0 +1,160 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <math/matrixutilities/csrmatrix.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace QuantLib {
+
+    CSRMatrix::CSRMatrix(Size rows,
+                         Size columns,
+                         std::vector<Size> rowPointers,
+                         std::vector<Size> columnIndices,
+                         std::vector<Real> values)
+    : rows_(rows), columns_(columns), rowPointers_(std::move(rowPointers)),
+      columnIndices_(std::move(columnIndices)), values_(std::move(values)) {
+
+        QL_REQUIRE(rowPointers_.size() == rows_+1,
+                   "number of row pointers (" << rowPointers_.size()
+                   << ") must be the number of rows plus one ("
+                   << rows_+1 << ")");
+        QL_REQUIRE(columnIndices_.size() == values_.size()
+                   && rowPointers_.front() == 0
+                   && rowPointers_.back() == values_.size(),
+                   "inconsistent compressed row structure");
+
+        for (Size i=0; i < rows_; ++i) {
+            QL_REQUIRE(rowPointers_[i] <= rowPointers_[i+1],
+                       "row pointers must be non-decreasing");
+            for (Size k=rowPointers_[i]; k < rowPointers_[i+1]; ++k) {
+                QL_REQUIRE(columnIndices_[k] < columns_,
+                           "column index " << columnIndices_[k]
+                           << " out of range");
+                QL_REQUIRE(k == rowPointers_[i]
+                           || columnIndices_[k-1] < columnIndices_[k],
+                           "column indices must be increasing in row " << i);
+            }
+        }
+    }
+
+    CSRMatrix::CSRMatrix(const SparseMatrix& m)
+    : rows_(m.size1()), columns_(m.size2()), rowPointers_(m.size1()+1, 0) {
+
+        const bool square = (rows_ == columns_);
+        const Size filledRows = (m.filled1() > 0) ? m.filled1()-1 : 0;
+
+        columnIndices_.reserve(m.nnz() + (square ? rows_ : 0));
+        values_.reserve(m.nnz() + (square ? rows_ : 0));
+
+        for (Size i=0; i < rows_; ++i) {
+            const Size begin = (i < filledRows) ? m.index1_data()[i]   : 0;
+            const Size end   = (i < filledRows) ? m.index1_data()[i+1] : 0;
+
+            bool diagonalMissing = square;
+            for (Size k=begin; k < end; ++k) {
+                const Size j = m.index2_data()[k];
+                if (diagonalMissing && j >= i) {
+                    if (j > i) {
+                        columnIndices_.push_back(i);
+                        values_.push_back(0.0);
+                    }
+                    diagonalMissing = false;
+                }
+                columnIndices_.push_back(j);
+                values_.push_back(m.value_data()[k]);
+            }
+            if (diagonalMissing) {
+                columnIndices_.push_back(i);
+                values_.push_back(0.0);
+            }
+            rowPointers_[i+1] = values_.size();
+        }
+    }
+
+    Real CSRMatrix::operator()(Size i, Size j) const {
+        QL_REQUIRE(i < rows_ && j < columns_,
+                   "index (" << i << ", " << j << ") out of range");
+
+        const auto begin = columnIndices_.begin() + rowPointers_[i];
+        const auto end = columnIndices_.begin() + rowPointers_[i+1];
+        const auto iter = std::lower_bound(begin, end, j);
+
+        return (iter != end && *iter == j)
+            ? values_[iter - columnIndices_.begin()] : 0.0;
+    }
+
+    std::vector<Size> CSRMatrix::diagonalPositions() const {
+        QL_REQUIRE(rows_ == columns_, "square matrix required");
+
+        std::vector<Size> retVal(rows_);
+        for (Size i=0; i < rows_; ++i) {
+            const auto begin = columnIndices_.begin() + rowPointers_[i];
+            const auto end = columnIndices_.begin() + rowPointers_[i+1];
+            const auto iter = std::lower_bound(begin, end, i);
+            QL_REQUIRE(iter != end && *iter == i,
+                       "diagonal entry of row " << i << " is not stored");
+            retVal[i] = iter - columnIndices_.begin();
+        }
+        return retVal;
+    }
+
+    CSRMatrix& CSRMatrix::operator*=(Real s) {
+        for (Real& v : values_)
+            v *= s;
+        return *this;
+    }
+
+    CSRMatrix& CSRMatrix::addToDiagonal(Real s) {
+        for (Size k : diagonalPositions())
+            values_[k] += s;
+        return *this;
+    }
+
+    Array CSRMatrix::apply(const Array& x) const {
+        Array y(rows_);
+        apply_to(x, y);
+        return y;
+    }
+
+    void CSRMatrix::apply_to(const Array& x, Array& y) const {
+        QL_REQUIRE(x.size() == columns_,
+                   "vectors and sparse matrices with different sizes ("
+                   << x.size() << ", " << rows_ << "x" << columns_ <<
+                   ") cannot be multiplied");
+        QL_REQUIRE(&x != &y, "output buffer must differ from input");
+
+        if (y.size() != rows_)
+            y = Array(rows_);
+
+        const Size* rowPtr = rowPointers_.data();
+        const Size* colIdx = columnIndices_.data();
+        const Real* a = values_.data();
+        const Real* xptr = x.begin();
+        Real* yptr = y.begin();
+
+        const long n = static_cast<long>(rows_);
+        #pragma omp parallel for if(values_.size() > 16384)
+        for (long i=0; i < n; ++i) {
+            Real t = 0.0;
+            for (Size k=rowPtr[i]; k < rowPtr[i+1]; ++k)
+                t += a[k]*xptr[colIdx[k]];
+            yptr[i] = t;
+        }
+    }
+
+}
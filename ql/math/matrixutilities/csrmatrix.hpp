@@ -0,0 +1,94 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file csrmatrix.hpp
+    \brief sparse matrix in compressed sparse row format
+*/
+
+#ifndef quantlib_csr_matrix_hpp
+#define quantlib_csr_matrix_hpp
+
+#include <math/array.hpp>
+#include <math/matrixutilities/sparsematrix.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! sparse matrix in compressed sparse row (CSR) format
+    /*! The non-zero entries of each row are stored contiguously and
+        ordered by column index, which gives a cache-friendly and
+        multithreaded matrix-vector product.  Contrary to the ublas
+        compressed_matrix, the structure is fixed after construction.
+
+        For square matrices the diagonal entries are always stored,
+        even when zero, so that shifts of the diagonal and incomplete
+        factorizations can be applied in place.
+    */
+    class CSRMatrix {
+      public:
+        CSRMatrix() = default;
+        //! build from row pointers, column indices and values
+        /*! column indices must be strictly increasing within each row. */
+        CSRMatrix(Size rows,
+                  Size columns,
+                  std::vector<Size> rowPointers,
+                  std::vector<Size> columnIndices,
+                  std::vector<Real> values);
+        //! convert from the ublas compressed matrix
+        explicit CSRMatrix(const SparseMatrix& m);
+
+        //! \name Inspectors
+        //@{
+        Size rows() const { return rows_; }
+        Size columns() const { return columns_; }
+        Size nonZeros() const { return values_.size(); }
+
+        const std::vector<Size>& rowPointers() const { return rowPointers_; }
+        const std::vector<Size>& columnIndices() const { return columnIndices_; }
+        const std::vector<Real>& values() const { return values_; }
+        std::vector<Real>& values() { return values_; }
+
+        //! element access, returns zero for entries not stored
+        Real operator()(Size i, Size j) const;
+        //! position of the diagonal entry of each row
+        std::vector<Size> diagonalPositions() const;
+        //@}
+
+        //! \name Algebraic operations
+        //@{
+        CSRMatrix& operator*=(Real s);
+        //! adds s to all diagonal entries
+        CSRMatrix& addToDiagonal(Real s);
+
+        Array apply(const Array& x) const;
+        //! computes y = A*x into a preallocated buffer
+        void apply_to(const Array& x, Array& y) const;
+        //@}
+
+      private:
+        Size rows_ = 0, columns_ = 0;
+        std::vector<Size> rowPointers_, columnIndices_;
+        std::vector<Real> values_;
+    };
+
+    inline Array prod(const CSRMatrix& A, const Array& x) {
+        return A.apply(x);
+    }
+
+}
+
+#endif
@@ -50,7 +50,7 @@ namespace QuantLib {
                 previousCorrels[iCol] +=
                     mtrx[iRow][iCol] * mtrx[iRow][iCol];
             previousCorrels[iCol] =
-                std::sqrt((previousCorrels[iCol]-1.)/(n-1.));
+                sqrt((previousCorrels[iCol]-1.)/(n-1.));
         }
 
         // iterative solution
@@ -77,7 +77,7 @@ namespace QuantLib {
                 // strictly is:
                 // abs(\sqrt{\rho}- \sqrt{\rho_{old}})/\sqrt{\rho_{old}}
                 distances.push_back(
-                    std::abs(thisCorrel - previousCorrels[iCol])/
+                    abs(thisCorrel - previousCorrels[iCol])/
                         previousCorrels[iCol]);
             }
             previousCorrels = newCorrels;
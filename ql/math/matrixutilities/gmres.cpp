@@ -111,7 +111,7 @@ namespace QuantLib {
                 h[i+1][j] = h1;
             }
 
-            const Real nu = std::sqrt(squared(h[j][j]) + squared(h[j+1][j]));
+            const Real nu = sqrt(squared(h[j][j]) + squared(h[j+1][j]));
 
             c[j] = h[j][j]/nu;
             s[j] = h[j+1][j]/nu;
@@ -122,7 +122,7 @@ namespace QuantLib {
             z[j+1] = -s[j]*z[j];
             z[j] = c[j] * z[j];
 
-            errors.push_back(std::fabs(z[j+1]/bn));
+            errors.push_back(fabs(z[j+1]/bn));
         }
 
         const Size k = v.size()-1;
@@ -62,7 +62,7 @@ namespace QuantLib {
             const Real eps4 = eps2*eps2;
             const Array v =
                 (a2 - a1*(eps/2.0 - eps2/8.0 + eps3/16.0 - 5/128.0*eps4))
-                / (aDotE*std::sqrt(eps + eps2/4.0 - eps3/8.0 + 5/64.0*eps4));
+                / (aDotE*sqrt(eps + eps2/4.0 - eps3/8.0 + 5/64.0*eps4));
             return v;
         }
         else {
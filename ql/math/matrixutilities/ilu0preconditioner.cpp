@@ -0,0 +1,86 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <math/matrixutilities/ilu0preconditioner.hpp>
+
+namespace QuantLib {
+
+    ILU0Preconditioner::ILU0Preconditioner(const CSRMatrix& A)
+    : lu_(A) {
+        QL_REQUIRE(A.rows() == A.columns(),
+                   "ILU(0) preconditioner works only with square matrices");
+
+        diagonal_ = lu_.diagonalPositions();
+
+        const Size n = lu_.rows();
+        const std::vector<Size>& rowPtr = lu_.rowPointers();
+        const std::vector<Size>& colIdx = lu_.columnIndices();
+        std::vector<Real>& a = lu_.values();
+
+        // position of column j in the current row, or n if not stored
+        std::vector<Size> position(n, n);
+
+        for (Size i=0; i < n; ++i) {
+            for (Size k=rowPtr[i]; k < rowPtr[i+1]; ++k)
+                position[colIdx[k]] = k;
+
+            for (Size k=rowPtr[i]; k < diagonal_[i]; ++k) {
+                const Size j = colIdx[k];
+                const Real pivot = a[diagonal_[j]];
+                QL_REQUIRE(pivot != 0.0, "zero pivot in row " << j);
+
+                const Real l = a[k] /= pivot;
+                for (Size m=diagonal_[j]+1; m < rowPtr[j+1]; ++m) {
+                    const Size p = position[colIdx[m]];
+                    if (p != n)
+                        a[p] -= l*a[m];
+                }
+            }
+            QL_REQUIRE(a[diagonal_[i]] != 0.0, "zero pivot in row " << i);
+
+            for (Size k=rowPtr[i]; k < rowPtr[i+1]; ++k)
+                position[colIdx[k]] = n;
+        }
+    }
+
+    Array ILU0Preconditioner::apply(const Array& b) const {
+        const Size n = lu_.rows();
+        QL_REQUIRE(b.size() == n, "vector of size " << b.size()
+                   << " given, " << n << " required");
+
+        const std::vector<Size>& rowPtr = lu_.rowPointers();
+        const std::vector<Size>& colIdx = lu_.columnIndices();
+        const std::vector<Real>& a = lu_.values();
+
+        Array x(b);
+        for (Size i=0; i < n; ++i) {
+            Real t = x[i];
+            for (Size k=rowPtr[i]; k < diagonal_[i]; ++k)
+                t -= a[k]*x[colIdx[k]];
+            x[i] = t;
+        }
+        for (Size i=n; i > 0; --i) {
+            const Size r = i-1;
+            Real t = x[r];
+            for (Size k=diagonal_[r]+1; k < rowPtr[r+1]; ++k)
+                t -= a[k]*x[colIdx[k]];
+            x[r] = t/a[diagonal_[r]];
+        }
+        return x;
+    }
+
+}
@@ -0,0 +1,54 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file ilu0preconditioner.hpp
+    \brief zero fill-in incomplete LU preconditioner on CSR matrices
+*/
+
+#ifndef quantlib_ilu0_preconditioner_hpp
+#define quantlib_ilu0_preconditioner_hpp
+
+#include <math/matrixutilities/csrmatrix.hpp>
+
+namespace QuantLib {
+
+    //! incomplete LU factorization without fill-in, ILU(0)
+    /*! The factors share the sparsity pattern of the given matrix;
+        L has a unit diagonal and is stored below the diagonal of
+        LU(), U is stored on and above it.
+
+        References:
+        Saad, Yousef. 2003, Iterative methods for sparse linear
+        systems, 2nd edition, section 10.3.2
+    */
+    class ILU0Preconditioner {
+      public:
+        explicit ILU0Preconditioner(const CSRMatrix& A);
+
+        const CSRMatrix& LU() const { return lu_; }
+
+        //! solves L*U*x = b
+        Array apply(const Array& b) const;
+
+      private:
+        CSRMatrix lu_;
+        std::vector<Size> diagonal_;
+    };
+
+}
+
+#endif
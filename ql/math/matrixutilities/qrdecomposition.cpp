@@ -68,7 +68,7 @@ namespace QuantLib {
 
             Array v(m);
             for (Integer i=u-1; i >=0; --i) {
-                if (std::fabs(mT[i][i]) > QL_EPSILON) {
+                if (fabs(mT[i][i]) > QL_EPSILON) {
                     const Real tau = 1.0/mT[i][i];
 
                     std::fill(v.begin(), v.begin()+i, 0.0);
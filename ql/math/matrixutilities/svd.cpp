@@ -44,12 +44,12 @@ namespace QuantLib {
             using (a * sqrt( 1 + (b/a) * (b/a))), rather than
             sqrt(a*a + b*b).
         */
-        Real hypot(const Real &a, const Real &b) {
+        Real hypotenuse(const Real &a, const Real &b) {
             if (a == 0) {
-                return std::fabs(b);
+                return fabs(b);
             } else {
                 Real c = b/a;
-                return std::fabs(a) * std::sqrt(1 + c*c);
+                return fabs(a) * sqrt(1 + c*c);
             }
         }
 
@@ -111,7 +111,7 @@ namespace QuantLib {
                 // Compute 2-norm of k-th column without under/overflow.
                 s_[k] = 0;
                 for (i = k; i < m_; i++) {
-                    s_[k] = hypot(s_[k],A[i][k]);
+                    s_[k] = hypotenuse(s_[k],A[i][k]);
                 }
                 if (s_[k] != 0.0) {
                     if (A[k][k] < 0.0) {
@@ -160,7 +160,7 @@ namespace QuantLib {
                 // Compute 2-norm without under/overflow.
                 e[k] = 0;
                 for (i = k+1; i < n_; i++) {
-                    e[k] = hypot(e[k],e[i]);
+                    e[k] = hypotenuse(e[k],e[i]);
                 }
                 if (e[k] != 0.0) {
                     if (e[k+1] < 0.0) {
@@ -271,7 +271,7 @@ namespace QuantLib {
 
         Integer p = n_, pp = p-1;
         Integer iter = 0;
-        Real eps = std::pow(2.0,-52.0);
+        Real eps = pow(2.0,-52.0);
         while (p > 0) {
             Integer k;
             Integer kase;
@@ -292,8 +292,8 @@ namespace QuantLib {
                 if (k == -1) {
                     break;
                 }
-                if (std::fabs(e[k]) <= eps*(std::fabs(s_[k]) +
-                                            std::fabs(s_[k+1]))) {
+                if (fabs(e[k]) <= eps*(fabs(s_[k]) +
+                                            fabs(s_[k+1]))) {
                     e[k] = 0.0;
                     break;
                 }
@@ -306,9 +306,9 @@ namespace QuantLib {
                     if (ks == k) {
                         break;
                     }
-                    Real t = (ks != p ? Real(std::fabs(e[ks])) : 0.) +
-                        (ks != k+1 ? Real(std::fabs(e[ks-1])) : 0.);
-                    if (std::fabs(s_[ks]) <= eps*t)  {
+                    Real t = (ks != p ? Real(fabs(e[ks])) : 0.) +
+                        (ks != k+1 ? Real(fabs(e[ks-1])) : 0.);
+                    if (fabs(s_[ks]) <= eps*t)  {
                         s_[ks] = 0.0;
                         break;
                     }
@@ -334,7 +334,7 @@ namespace QuantLib {
                   Real f = e[p-2];
                   e[p-2] = 0.0;
                   for (j = p-2; j >= k; --j) {
-                      Real t = hypot(s_[j],f);
+                      Real t = hypotenuse(s_[j],f);
                       Real cs = s_[j]/t;
                       Real sn = f/t;
                       s_[j] = t;
@@ -357,7 +357,7 @@ namespace QuantLib {
                   Real f = e[k-1];
                   e[k-1] = 0.0;
                   for (j = k; j < p; j++) {
-                      Real t = hypot(s_[j],f);
+                      Real t = hypotenuse(s_[j],f);
                       Real cs = s_[j]/t;
                       Real sn = f/t;
                       s_[j] = t;
@@ -380,11 +380,11 @@ namespace QuantLib {
                   Real scale = std::max(
                                      std::max(
                                          std::max(
-                                             std::max(std::fabs(s_[p-1]),
-                                                    std::fabs(s_[p-2])),
-                                             std::fabs(e[p-2])),
-                                         std::fabs(s_[k])),
-                                     std::fabs(e[k]));
+                                             std::max(fabs(s_[p-1]),
+                                                    fabs(s_[p-2])),
+                                             fabs(e[p-2])),
+                                         fabs(s_[k])),
+                                     fabs(e[k]));
                   Real sp = s_[p-1]/scale;
                   Real spm1 = s_[p-2]/scale;
                   Real epm1 = e[p-2]/scale;
@@ -394,7 +394,7 @@ namespace QuantLib {
                   Real c = (sp*epm1)*(sp*epm1);
                   Real shift = 0.0;
                   if ((b != 0.0) || (c != 0.0)) {
-                      shift = std::sqrt(b*b + c);
+                      shift = sqrt(b*b + c);
                       if (b < 0.0) {
                           shift = -shift;
                       }
@@ -406,7 +406,7 @@ namespace QuantLib {
                   // Chase zeros.
 
                   for (j = k; j < p-1; j++) {
-                      Real t = hypot(f,g);
+                      Real t = hypotenuse(f,g);
                       Real cs = f/t;
                       Real sn = g/t;
                       if (j != k) {
@@ -421,7 +421,7 @@ namespace QuantLib {
                           V_[i][j+1] = -sn*V_[i][j] + cs*V_[i][j+1];
                           V_[i][j] = t;
                       }
-                      t = hypot(f,g);
+                      t = hypotenuse(f,g);
                       cs = f/t;
                       sn = g/t;
                       s_[j] = t;
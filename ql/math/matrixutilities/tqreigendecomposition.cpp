@@ -57,13 +57,13 @@ namespace QuantLib {
                     // [ d_[k-1] e_[k] ]
                     // [  e_[k]  d_[k] ]
                     // which is closer to d_[k+1].
-                    const Real t1 = std::sqrt(
+                    const Real t1 = sqrt(
                                           0.25*(d_[k]*d_[k] + d_[k-1]*d_[k-1])
                                           - 0.5*d_[k-1]*d_[k] + e[k]*e[k]);
                     const Real t2 = 0.5*(d_[k]+d_[k-1]);
 
                     const Real lambda =
-                        (std::fabs(t2+t1 - d_[k]) < std::fabs(t2-t1 - d_[k]))?
+                        (fabs(t2+t1 - d_[k]) < fabs(t2-t1 - d_[k]))?
                         Real(t2+t1) : Real(t2-t1);
 
                     if (strategy == CloseEigenValue) {
@@ -83,7 +83,7 @@ namespace QuantLib {
                     const Real h = cosine*e[i];
                     const Real p = sine*e[i];
 
-                    e[i-1] = std::sqrt(p*p+q*q);
+                    e[i-1] = sqrt(p*p+q*q);
                     if (e[i-1] != 0.0) {
                         sine = p/e[i-1];
                         cosine = q/e[i-1];
@@ -142,8 +142,8 @@ namespace QuantLib {
     // see NR for abort assumption as it is
     // not part of the original Wilkinson algorithm
     bool TqrEigenDecomposition::offDiagIsZero(Size k, Array& e) {
-        return std::fabs(d_[k-1])+std::fabs(d_[k])
-            == std::fabs(d_[k-1])+std::fabs(d_[k])+std::fabs(e[k]);
+        return fabs(d_[k-1])+fabs(d_[k])
+            == fabs(d_[k-1])+fabs(d_[k])+fabs(e[k]);
     }
 
 }
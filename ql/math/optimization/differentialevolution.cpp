@@ -299,7 +299,7 @@ namespace QuantLib {
             } catch (Error&) {
                 population[popIter].cost = QL_MAX_REAL;
             }
-            if (!std::isfinite(population[popIter].cost))
+            if (!isfinite(population[popIter].cost))
                 population[popIter].cost = QL_MAX_REAL;
 
         }
@@ -334,7 +334,7 @@ namespace QuantLib {
           case Exponential:
             for (Size coIter = 0;coIter< currGenCrossover_.size(); coIter++){
                 mutationProbabilities[coIter] =
-                    (1.0 - std::pow(currGenCrossover_[coIter],
+                    (1.0 - pow(currGenCrossover_[coIter],
                                     (int) population.front().values.size()))
                     / (population.front().values.size()
                        * (1.0 - currGenCrossover_[coIter]));
@@ -389,7 +389,7 @@ namespace QuantLib {
                 population[j].values[i] = l + (u-l)*rng_.nextReal();
             }
             population[j].cost = p.costFunction().value(population[j].values);
-            if (!std::isfinite(population[j].cost))
+            if (!isfinite(population[j].cost))
                 population[j].cost = QL_MAX_REAL;
         }
     }
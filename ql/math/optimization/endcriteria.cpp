@@ -65,7 +65,7 @@ namespace QuantLib {
                                            const Real xNew,
                                            Size& statStateIterations,
                                            EndCriteria::Type& ecType) const {
-        if (std::fabs(xNew-xOld) >= rootEpsilon_) {
+        if (fabs(xNew-xOld) >= rootEpsilon_) {
             statStateIterations = 0;
             return false;
         }
@@ -81,7 +81,7 @@ namespace QuantLib {
                                             const Real fxNew,
                                             Size& statStateIterations,
                                             EndCriteria::Type& ecType) const {
-        if (std::fabs(fxNew-fxOld) >= functionEpsilon_) {
+        if (fabs(fxNew-fxOld) >= functionEpsilon_) {
             statStateIterations = 0;
             return false;
         }
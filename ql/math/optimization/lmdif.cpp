@@ -135,7 +135,7 @@ agiant = rgiant/floatn;
 
 for( i=0; i<n; i++ )
 {
-xabs = std::fabs(x[i]);
+xabs = fabs(x[i]);
 if( (xabs > rdwarf) && (xabs < agiant) )
     {
 /*
@@ -187,7 +187,7 @@ else
 if(s1 != zero)
     {
     temp = s1 + (s2/x1max)/x1max;
-    ans = x1max*std::sqrt(temp);
+    ans = x1max*sqrt(temp);
     return(ans);
     }
 if(s2 != zero)
@@ -196,11 +196,11 @@ if(s2 != zero)
         temp = s2*(one+(x3max/s2)*(x3max*s3));
     else
         temp = x3max*((s2/x3max)+(x3max*s3));
-    ans = std::sqrt(temp);
+    ans = sqrt(temp);
     }
 else
     {
-    ans = x3max*std::sqrt(s3);
+    ans = x3max*sqrt(s3);
     }
 return(ans);
 /*
@@ -345,11 +345,11 @@ void fdjac2(int m,
 
 
     temp = dmax1(epsfcn, MACHEP);
-    eps = std::sqrt(temp);
+    eps = sqrt(temp);
     ij = 0;
     for (j = 0; j < n; j++) {
         temp = x[j];
-        h = eps * std::fabs(temp);
+        h = eps * fabs(temp);
         if (h == zero)
             h = eps;
         x[j] = temp + h;
@@ -554,7 +554,7 @@ for( k=jp1; k<n; k++ )
         {
         temp = a[j+m*k]/rdiag[k];
         temp = dmax1( zero, one-temp*temp );
-        rdiag[k] *= std::sqrt(temp);
+        rdiag[k] *= sqrt(temp);
         temp = rdiag[k]/wa[k];
         if( (p05*temp*temp) <= MACHEP)
             {
@@ -717,16 +717,16 @@ for( k=j; k<n; k++ )
     if(sdiag[k] == zero)
         continue;
     kk = k + ldr * k;
-    if(std::fabs(r[kk]) < std::fabs(sdiag[k]))
+    if(fabs(r[kk]) < fabs(sdiag[k]))
         {
         cotan = r[kk]/sdiag[k];
-        sin = p5/std::sqrt(p25+p25*cotan*cotan);
+        sin = p5/sqrt(p25+p25*cotan*cotan);
         cos = sin*cotan;
         }
     else
         {
         tan = sdiag[k]/r[kk];
-        cos = p5/std::sqrt(p25+p25*tan*tan);
+        cos = p5/sqrt(p25+p25*tan*tan);
         sin = cos*tan;
         }
 /*
@@ -1050,7 +1050,7 @@ iter += 1;
 */
 if( *par == zero)
     *par = dmax1(DWARF,p001*paru);
-temp = std::sqrt( *par );
+temp = sqrt( *par );
 for( j=0; j<n; j++ )
     wa1[j] = temp*diag[j];
 qrsolv(n,r,ldr,ipvt,wa1,qtb,x,sdiag,wa2);
@@ -1064,7 +1064,7 @@ fp = dxnorm - delta;
 *    of par. also test for the exceptional cases where parl
 *    is zero or the number of iterations has reached 10.
 */
-if( (std::fabs(fp) <= p1*delta)
+if( (fabs(fp) <= p1*delta)
  || ((parl == zero) && (fp <= temp) && (temp < zero))
  || (iter == 10) )
     goto L220;
@@ -1478,7 +1478,7 @@ for( j=0; j<n; j++ )
                 sum += fjac[ij]*(qtf[i]/fnorm);
                 ij += 1; /* fjac[i+m*j] */
                 }
-            gnorm = dmax1(gnorm,std::fabs(sum/wa2[l]));
+            gnorm = dmax1(gnorm,fabs(sum/wa2[l]));
             }
         jj += m;
         }
@@ -1560,7 +1560,7 @@ for( j=0; j<n; j++ )
     jj += m;
     }
 temp1 = enorm(n,wa3)/fnorm;
-temp2 = (std::sqrt(par)*pnorm)/fnorm;
+temp2 = (sqrt(par)*pnorm)/fnorm;
 prered = temp1*temp1 + (temp2*temp2)/p5;
 dirder = -(temp1*temp1 + temp2*temp2);
 /*
@@ -1615,13 +1615,13 @@ if(ratio >= p0001)
 /*
 *       tests for convergence.
 */
-if( (std::fabs(actred) <= ftol)
+if( (fabs(actred) <= ftol)
   && (prered <= ftol)
   && (p5*ratio <= one) )
     *info = 1;
 if(delta <= xtol*xnorm)
     *info = 2;
-if( (std::fabs(actred) <= ftol)
+if( (fabs(actred) <= ftol)
   && (prered <= ftol)
   && (p5*ratio <= one)
   && ( *info == 2) )
@@ -1633,7 +1633,7 @@ if( *info != 0)
 */
 if( *nfev >= maxfev)
     *info = 5;
-if( (std::fabs(actred) <= MACHEP)
+if( (fabs(actred) <= MACHEP)
   && (prered <= MACHEP)
   && (p5*ratio <= one) )
     *info = 6;
@@ -44,4 +44,18 @@ namespace QuantLib {
         return costFunction_.values(actualParameters_);
     }
 
+    void ProjectedCostFunction::jacobian(Matrix& jac,
+                                         const Array& freeParameters) const {
+        mapFreeParameters(freeParameters);
+        Matrix fullJacobian(jac.rows(), actualParameters_.size());
+        costFunction_.jacobian(fullJacobian, actualParameters_);
+        Size j = 0;
+        for (Size k = 0; k < fixParameters_.size(); k++)
+            if (!fixParameters_[k]) {
+                for (Size i = 0; i < jac.rows(); i++)
+                    jac[i][j] = fullJacobian[i][k];
+                ++j;
+            }
+    }
+
 }
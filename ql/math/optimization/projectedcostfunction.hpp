@@ -49,6 +49,8 @@ namespace QuantLib {
             //@{
             Real value(const Array& freeParameters) const override;
             Array values(const Array& freeParameters) const override;
+            //! the columns of the underlying jacobian for the free parameters
+            void jacobian(Matrix& jac, const Array& freeParameters) const override;
             //@}
 
         private:
@@ -62,8 +62,8 @@ namespace QuantLib {
             Real factor2 = factor1 - factor;
             pTry = sum_*factor1 - vertices_[iHighest]*factor2;
             factor *= 0.5;
-        } while (!P.constraint().test(pTry) && std::fabs(factor) > QL_EPSILON);
-        if (std::fabs(factor) <= QL_EPSILON) {
+        } while (!P.constraint().test(pTry) && fabs(factor) > QL_EPSILON);
+        if (fabs(factor) <= QL_EPSILON) {
             return values_[iHighest];
         }
         factor *= 2.0;
@@ -163,12 +163,12 @@ namespace QuantLib {
             if ((vTry <= values_[iLowest]) && (factor == -1.0)) {
                 factor = 2.0;
                 extrapolate(P, iHighest, factor);
-            } else if (std::fabs(factor) > QL_EPSILON) {
+            } else if (fabs(factor) > QL_EPSILON) {
                 if (vTry >= values_[iNextHighest]) {
                     Real vSave = values_[iHighest];
                     factor = 0.5;
                     vTry = extrapolate(P, iHighest, factor);
-                    if (vTry >= vSave && std::fabs(factor) > QL_EPSILON) {
+                    if (vTry >= vSave && fabs(factor) > QL_EPSILON) {
                         for (Size i=0; i<=n; i++) {
                             if (i!=iLowest) {
                                 vertices_[i] =
@@ -180,7 +180,7 @@ namespace QuantLib {
                 }
             }
             // If can't extrapolate given the constraints, exit
-            if (std::fabs(factor) <= QL_EPSILON) {
+            if (fabs(factor) <= QL_EPSILON) {
                 x_ = vertices_[iLowest];
                 Real low = values_[iLowest];
                 P.setFunctionValue(low);
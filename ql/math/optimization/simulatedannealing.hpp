@@ -118,14 +118,14 @@ namespace QuantLib {
             ytry_ = QL_MAX_REAL;
         else
             ytry_ = P.value(ptry_);
-        if (std::isnan(ytry_)) {
+        if (isnan(ytry_)) {
             ytry_ = QL_MAX_REAL;
         }
         if (ytry_ <= yb_) {
             yb_ = ytry_;
             pb_ = ptry_;
         }
-        yflu_ = ytry_ - tt_ * std::log(rng_.next().value);
+        yflu_ = ytry_ - tt_ * log(rng_.next().value);
         if (yflu_ < yhi_) {
             values_[ihi_] = ytry_;
             yhi_ = yflu_;
@@ -163,7 +163,7 @@ namespace QuantLib {
                 values_[i_] = QL_MAX_REAL;
             else
                 values_[i_] = P.value(vertices_[i_]);
-            if (std::isnan(ytry_)) { // handle NAN
+            if (isnan(ytry_)) { // handle NAN
                 values_[i_] = QL_MAX_REAL;
             }
         }
@@ -182,9 +182,9 @@ namespace QuantLib {
                 tt_ = -T_;
                 ilo_ = 0;
                 ihi_ = 1;
-                ynhi_ = values_[0] + tt_ * std::log(rng_.next().value);
+                ynhi_ = values_[0] + tt_ * log(rng_.next().value);
                 ylo_ = ynhi_;
-                yhi_ = values_[1] + tt_ * std::log(rng_.next().value);
+                yhi_ = values_[1] + tt_ * log(rng_.next().value);
                 if (ylo_ > yhi_) {
                     ihi_ = 0;
                     ilo_ = 1;
@@ -193,7 +193,7 @@ namespace QuantLib {
                     ylo_ = ynhi_;
                 }
                 for (i_ = 2; i_ < n_ + 1; i_++) {
-                    yt_ = values_[i_] + tt_ * std::log(rng_.next().value);
+                    yt_ = values_[i_] + tt_ * log(rng_.next().value);
                     if (yt_ <= ylo_) {
                         ilo_ = i_;
                         ylo_ = yt_;
@@ -263,7 +263,7 @@ namespace QuantLib {
             case ConstantBudget:
                 if (iteration_ <= K_)
                     T_ = T0_ *
-                         std::pow(1.0 - (Real)iteration_ / (Real)K_, alpha_);
+                         pow(1.0 - (Real)iteration_ / (Real)K_, alpha_);
                 else
                     T_ = 0.0;
                 break;
@@ -34,6 +34,9 @@
 #include <math/randomnumbers/inversecumulativersg.hpp>
 #include <math/distributions/normaldistribution.hpp>
 #include <math/distributions/poissondistribution.hpp>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
 namespace QuantLib {
 
@@ -54,6 +57,30 @@ namespace QuantLib {
             ursg_type g(dimension, seed);
             return (icInstance ? rsg_type(g, *icInstance) : rsg_type(g));
         }
+        /*! returns a generator for the stream of samples starting at
+            the given one.  Pseudo-random streams cannot be skipped
+            efficiently; the generator is reseeded instead with a
+            seed derived deterministically from the given seed and
+            sample (unless the seed is 0, in which case a random one
+            is used as usual).
+        */
+        static rsg_type make_sequence_generator(Size dimension,
+                                                BigNatural seed,
+                                                Size firstSample) {
+            if (firstSample != 0 && seed != 0) {
+                // the sample is split in 32-bit words, since Size can
+                // be wider than unsigned long (e.g., on 64-bit Windows)
+                const auto sample = static_cast<unsigned long long>(firstSample);
+                MersenneTwisterUniformRng splitter(std::vector<unsigned long>{
+                    seed,
+                    static_cast<unsigned long>(sample & 0xffffffffUL),
+                    static_cast<unsigned long>(sample >> 32)});
+                do {
+                    seed = splitter.nextInt32();
+                } while (seed == 0);
+            }
+            return make_sequence_generator(dimension, seed);
+        }
         // data
         static ext::shared_ptr<IC> icInstance;
     };
@@ -91,6 +118,21 @@ namespace QuantLib {
             ursg_type g(dimension, seed);
             return (icInstance ? rsg_type(g, *icInstance) : rsg_type(g));
         }
+        /*! returns a generator skipped ahead to the given sample, so
+            that consecutive streams reproduce the single sequence.
+        */
+        static rsg_type make_sequence_generator(Size dimension,
+                                                BigNatural seed,
+                                                Size firstSample) {
+            ursg_type g(dimension, seed);
+            if (firstSample != 0) {
+                QL_REQUIRE(firstSample <=
+                               std::numeric_limits<std::uint32_t>::max(),
+                           "cannot skip to sample " << firstSample);
+                g.skipTo(static_cast<std::uint32_t>(firstSample));
+            }
+            return (icInstance ? rsg_type(g, *icInstance) : rsg_type(g));
+        }
         // data
         static ext::shared_ptr<IC> icInstance;
     };
@@ -96,7 +96,7 @@ namespace QuantLib {
 
             Real x = u * normX(i);
 
-            if (std::abs(x) < normX(i + 1)) {
+            if (abs(x) < normX(i + 1)) {
                 return x;
             }
             if (i == 0) {
@@ -114,8 +114,8 @@ namespace QuantLib {
         // compute a random number in the tail by hand
         Real x, y;
         do {
-            x = std::log(uint64Generator_.nextReal()) / normR();
-            y = std::log(uint64Generator_.nextReal());
+            x = log(uint64Generator_.nextReal()) / normR();
+            y = log(uint64Generator_.nextReal());
         } while (-2.0 * y < x * x);
 
         return (u < 0.0) ? x - normR() : normR() - x;
@@ -123,7 +123,7 @@ namespace QuantLib {
 
     template <class RNG>
     inline Real ZigguratGaussianRng<RNG>::pdf(Real x) const {
-        return std::exp(-x * x / 2.0);
+        return exp(-x * x / 2.0);
     }
 
     template <class RNG>
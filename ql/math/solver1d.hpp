@@ -121,10 +121,10 @@ namespace QuantLib {
                     root_ = (xMax_+xMin_)/2.0;
                     return this->impl().solveImpl(f, accuracy);
                 }
-                if (std::fabs(fxMin_) < std::fabs(fxMax_)) {
+                if (fabs(fxMin_) < fabs(fxMax_)) {
                     xMin_ = enforceBounds_(xMin_+growthFactor*(xMin_ - xMax_));
                     fxMin_= f(xMin_);
-                } else if (std::fabs(fxMin_) > std::fabs(fxMax_)) {
+                } else if (fabs(fxMin_) > fabs(fxMax_)) {
                     xMax_ = enforceBounds_(xMax_+growthFactor*(xMax_ - xMin_));
                     fxMax_= f(xMax_);
                 } else if (flipflop == -1) {
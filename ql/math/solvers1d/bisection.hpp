@@ -64,7 +64,7 @@ namespace QuantLib {
                 ++evaluationNumber_;
                 if (fMid <= 0.0)
                     root_ = xMid;
-                if (std::fabs(dx) < xAccuracy || (close(fMid, 0.0))) {
+                if (fabs(dx) < xAccuracy || (close(fMid, 0.0))) {
                     f(root_);
                     ++evaluationNumber_;
                     return root_;
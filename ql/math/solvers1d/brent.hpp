@@ -73,7 +73,7 @@ namespace QuantLib {
                     fxMax_=fxMin_;
                     e=d=root_-xMin_;
                 }
-                if (std::fabs(fxMax_) < std::fabs(froot)) {
+                if (fabs(fxMax_) < fabs(froot)) {
                     xMin_=root_;
                     root_=xMax_;
                     xMax_=xMin_;
@@ -82,15 +82,15 @@ namespace QuantLib {
                     fxMax_=fxMin_;
                 }
                 // Convergence check
-                xAcc1=2.0*QL_EPSILON*std::fabs(root_)+0.5*xAccuracy;
+                xAcc1=2.0*QL_EPSILON*fabs(root_)+0.5*xAccuracy;
                 xMid=(xMax_-root_)/2.0;
-                if (std::fabs(xMid) <= xAcc1 || (close(froot, 0.0))) {
+                if (fabs(xMid) <= xAcc1 || (close(froot, 0.0))) {
                     f(root_);
                     ++evaluationNumber_;
                     return root_;
                 }
-                if (std::fabs(e) >= xAcc1 &&
-                    std::fabs(fxMin_) > std::fabs(froot)) {
+                if (fabs(e) >= xAcc1 &&
+                    fabs(fxMin_) > fabs(froot)) {
 
                     // Attempt inverse quadratic interpolation
                     s=froot/fxMin_;
@@ -104,9 +104,9 @@ namespace QuantLib {
                         q=(q-1.0)*(r-1.0)*(s-1.0);
                     }
                     if (p > 0.0) q = -q;  // Check whether in bounds
-                    p=std::fabs(p);
-                    min1=3.0*xMid*q-std::fabs(xAcc1*q);
-                    min2=std::fabs(e*q);
+                    p=fabs(p);
+                    min1=3.0*xMid*q-fabs(xAcc1*q);
+                    min2=fabs(e*q);
                     if (2.0*p < (min1 < min2 ? min1 : min2)) {
                         e=d;                // Accept interpolation
                         d=p/q;
@@ -121,7 +121,7 @@ namespace QuantLib {
                 }
                 xMin_=root_;
                 fxMin_=froot;
-                if (std::fabs(d) > xAcc1)
+                if (fabs(d) > xAcc1)
                     root_ += d;
                 else
                     root_ += sign(xAcc1,xMid);
@@ -133,7 +133,7 @@ namespace QuantLib {
         }
       private:
         Real sign(Real a, Real b) const {
-            return b >= 0.0 ? Real(std::fabs(a)) : Real(-std::fabs(a));
+            return b >= 0.0 ? Real(fabs(a)) : Real(-fabs(a));
         }
     };
 
@@ -58,7 +58,7 @@ namespace QuantLib {
                     return s.solve(f, xAccuracy, root_+step, xMin_, xMax_);
                 }
 
-                if (std::abs(step) < xAccuracy) {
+                if (abs(step) < xAccuracy) {
                     f(root_);
                     ++evaluationNumber_;
                     return root_;
@@ -79,7 +79,7 @@ namespace QuantLib {
                 // Bisect if (out of range || not decreasing fast enough)
                 if ((((root_-xh)*dfroot-froot)*
                      ((root_-xl)*dfroot-froot) > 0.0)
-                    || (std::fabs(2.0*froot) > std::fabs(dxold*dfroot))) {
+                    || (fabs(2.0*froot) > fabs(dxold*dfroot))) {
 
                     dxold = dx;
                     dx = (xh-xl)/2.0;
@@ -90,7 +90,7 @@ namespace QuantLib {
                     root_ -= dx;
                 }
                 // Convergence criterion
-                if (std::fabs(dx) < xAccuracy) {
+                if (fabs(dx) < xAccuracy) {
                     f(root_);
                     ++evaluationNumber_;
                     return root_;
@@ -61,7 +61,7 @@ namespace QuantLib {
                 // First of two function evaluations per iteraton
                 fxMid = f(xMid);
                 ++evaluationNumber_;
-                s = std::sqrt(fxMid*fxMid-fxMin_*fxMax_);
+                s = sqrt(fxMid*fxMid-fxMin_*fxMax_);
                 if (close(s, 0.0)) {
                     f(root_);
                     ++evaluationNumber_;
@@ -70,7 +70,7 @@ namespace QuantLib {
                 // Updating formula
                 nextRoot = xMid + (xMid - xMin_) *
                     ((fxMin_ >= fxMax_ ? 1.0 : -1.0) * fxMid / s);
-                if (std::fabs(nextRoot-root_) <= xAccuracy) {
+                if (fabs(nextRoot-root_) <= xAccuracy) {
                     f(root_);
                     ++evaluationNumber_;
                     return root_;
@@ -99,7 +99,7 @@ namespace QuantLib {
                     QL_FAIL("never get here.");
                 }
 
-                if (std::fabs(xMax_-xMin_) <= xAccuracy) {
+                if (fabs(xMax_-xMin_) <= xAccuracy) {
                     f(root_);
                     ++evaluationNumber_;
                     return root_;
@@ -111,7 +111,7 @@ namespace QuantLib {
         }
       private:
         Real sign(Real a, Real b) const {
-            return b >= 0.0 ? std::fabs(a) : Real(-std::fabs(a));
+            return b >= 0.0 ? fabs(a) : Real(-fabs(a));
         }
     };
 
@@ -48,7 +48,7 @@ namespace QuantLib {
             }
         }
         */
-        return std::sqrt(adiscr_/(N*N)-bdiscr_/N*cdiscr_+ddiscr_);
+        return sqrt(adiscr_/(N*N)-bdiscr_/N*cdiscr_+ddiscr_);
     }
 
 }
@@ -114,9 +114,9 @@ namespace QuantLib {
         SequenceStatistics::reset(dimension);
 
         adiscr_ = 0.0;
-        bdiscr_ = 1.0/std::pow(2.0, Integer(dimension-1));
+        bdiscr_ = 1.0/pow(2.0, Integer(dimension-1));
         cdiscr_ = 0.0;
-        ddiscr_ = 1.0/std::pow(3.0, Integer(dimension));
+        ddiscr_ = 1.0/pow(3.0, Integer(dimension));
     }
 
 }
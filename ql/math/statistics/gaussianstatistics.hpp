@@ -58,7 +58,7 @@ namespace QuantLib {
             square root of the downside variance.
         */
         Real gaussianDownsideDeviation() const {
-            return std::sqrt(gaussianDownsideVariance());
+            return sqrt(gaussianDownsideVariance());
         }
 
         /*! returns the variance of observations below target
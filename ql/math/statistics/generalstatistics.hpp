@@ -209,11 +209,11 @@ namespace QuantLib {
     }
 
     inline Real GeneralStatistics::standardDeviation() const {
-        return std::sqrt(variance());
+        return sqrt(variance());
     }
 
     inline Real GeneralStatistics::errorEstimate() const {
-        return std::sqrt(variance()/samples());
+        return sqrt(variance()/samples());
     }
 
     inline Real GeneralStatistics::min() const {
@@ -51,7 +51,7 @@ namespace QuantLib {
                 return *std::max_element(samples.begin(), samples.end());
 
             // general situation: middle region and nsample >= 2
-            Size index = static_cast<Size>(std::floor((nsample+a)*prob+a));
+            Size index = static_cast<Size>(floor((nsample+a)*prob+a));
             std::vector<Real> sorted(index+1);
             std::partial_sort_copy(samples.begin(), samples.end(),
                                    sorted.begin(), sorted.end());
@@ -107,24 +107,24 @@ namespace QuantLib {
             switch (algorithm_) {
               case Sturges: {
                   bins_ = static_cast<Size>(
-                           std::ceil(std::log(static_cast<Real>(data_.size()))
-                                     /std::log(2.0) + 1));
+                           ceil(log(static_cast<Real>(data_.size()))
+                                     /log(2.0) + 1));
                   break;
               }
               case FD: {
                   Real r1 = quantile(data_, 0.25);
                   Real r2 = quantile(data_, 0.75);
-                  Real h = 2.0 * (r2-r1) * std::pow(static_cast<Real>(data_.size()), -1.0/3.0);
-                  bins_ = static_cast<Size>(std::ceil((max-min)/h));
+                  Real h = 2.0 * (r2-r1) * pow(static_cast<Real>(data_.size()), -1.0/3.0);
+                  bins_ = static_cast<Size>(ceil((max-min)/h));
                   break;
               }
               case Scott: {
                   IncrementalStatistics summary;
                   summary.addSequence(data_.begin(), data_.end());
                   Real variance = summary.variance();
-                  Real h = 3.5 * std::sqrt(variance)
-                         * std::pow(static_cast<Real>(data_.size()), -1.0/3.0);
-                  bins_ = static_cast<Size>(std::ceil((max-min)/h));
+                  Real h = 3.5 * sqrt(variance)
+                         * pow(static_cast<Real>(data_.size()), -1.0/3.0);
+                  bins_ = static_cast<Size>(ceil((max-min)/h));
                   break;
               }
               case None:
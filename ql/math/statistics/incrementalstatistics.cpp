@@ -54,11 +54,11 @@ namespace QuantLib {
     }
 
     Real IncrementalStatistics::standardDeviation() const {
-        return std::sqrt(variance());
+        return sqrt(variance());
     }
 
     Real IncrementalStatistics::errorEstimate() const {
-        return std::sqrt(variance() / (samples()));
+        return sqrt(variance() / (samples()));
     }
 
     Real IncrementalStatistics::skewness() const {
@@ -66,9 +66,17 @@ namespace QuantLib {
         Real n = static_cast<Real>(samples());
         Real r1 = n / (n - 2.0);
         Real r2 = (n - 1.0) / (n - 2.0);
-        return std::sqrt(r1 * r2) * 
-               boost::accumulators::extract_result<
-                   boost::accumulators::tag::weighted_skewness>(acc_);
+        // same formula as boost::accumulators::tag::weighted_skewness,
+        // which calls std::sqrt and thus only works with built-in types
+        Real m = boost::accumulators::extract_result<
+            boost::accumulators::tag::weighted_mean>(acc_);
+        Real m2 = boost::accumulators::extract_result<
+            boost::accumulators::tag::weighted_moment<2> >(acc_);
+        Real m3 = boost::accumulators::extract_result<
+            boost::accumulators::tag::weighted_moment<3> >(acc_);
+        Real v = m2 - m * m;
+        return sqrt(r1 * r2) *
+               ((m3 - 3.0 * m2 * m + 2.0 * m * m * m) / (v * sqrt(v)));
     }
 
     Real IncrementalStatistics::kurtosis() const {
@@ -120,7 +128,7 @@ namespace QuantLib {
     }
 
     Real IncrementalStatistics::downsideDeviation() const {
-        return std::sqrt(downsideVariance());
+        return sqrt(downsideVariance());
     }
 
     void IncrementalStatistics::add(Real value, Real valueWeight) {
@@ -133,7 +133,7 @@ namespace QuantLib {
 
     template <class S>
     inline Real GenericRiskStatistics<S>::semiDeviation() const {
-        return std::sqrt(semiVariance());
+        return sqrt(semiVariance());
     }
 
     template <class S>
@@ -143,7 +143,7 @@ namespace QuantLib {
 
     template <class S>
     inline Real GenericRiskStatistics<S>::downsideDeviation() const {
-        return std::sqrt(downsideVariance());
+        return sqrt(downsideVariance());
     }
 
     // template definitions
@@ -276,7 +276,7 @@ namespace QuantLib {
                         correlation[i][j] = 1.0;
                     } else {
                         correlation[i][j] *=
-                            1.0/std::sqrt(variances[i]*variances[j]);
+                            1.0/sqrt(variances[i]*variances[j]);
                     }
                 } else {
                     if (variances[i]==0.0 && variances[j]==0) {
@@ -285,7 +285,7 @@ namespace QuantLib {
                         correlation[i][j] = 0.0;
                     } else {
                         correlation[i][j] *=
-                            1.0/std::sqrt(variances[i]*variances[j]);
+                            1.0/sqrt(variances[i]*variances[j]);
                     }
                 }
             } // j for
@@ -103,7 +103,7 @@ namespace QuantLib {
     class [[deprecated("Part of the old FD framework; copy this function in your codebase if needed")]] LogGrid : public TransformedGrid {
     public:
         LogGrid(const Array &grid) :
-            TransformedGrid(grid, [](Real x) -> Real { return std::log(x); }){};
+            TransformedGrid(grid, [](Real x) -> Real { return log(x); }){};
         const Array & logGridArray() const { return transformedGridArray();}
         Real logGrid(Size i) const { return transformedGrid(i);}
     };
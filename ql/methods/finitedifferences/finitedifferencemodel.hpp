@@ -105,7 +105,7 @@ namespace QuantLib {
                 // miss a stopping time at "to" due to numerical issues
                 Time next = (i < steps -1)? t-dt : to;
 
-                if (std::fabs(to-next) < std::sqrt(QL_EPSILON)) next = to;
+                if (fabs(to-next) < sqrt(QL_EPSILON)) next = to;
                 bool hit = false;
                 for (Integer j = static_cast<Integer>(stoppingTimes_.size())-1; j >= 0 ; --j) {
                     if (next <= stoppingTimes_[j] && stoppingTimes_[j] < now) {
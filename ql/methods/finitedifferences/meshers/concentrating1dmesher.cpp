@@ -71,7 +71,7 @@ namespace QuantLib {
                 if (!close(cPoint, start) && !close(cPoint, end)) {
                     const Real z0 = -c1 / (c2 - c1);
                     const Real u0 =
-                        std::max(std::min(std::lround(z0 * (size - 1)),
+                        std::max(std::min(lround(z0 * (size - 1)),
                                           static_cast<long>(size) - 2),
                                  1L) /
                         ((Real)(size - 1));
@@ -87,7 +87,7 @@ namespace QuantLib {
             for (Size i = 1; i < size - 1; ++i) {
                 const Real li = requireCPoint ? (*transform)(i*dx) : i*dx;
                 locations_[i] = cPoint
-                    + density*std::sinh(c1*(1.0 - li) + c2*li);
+                    + density*sinh(c1*(1.0 - li) + c2*li);
             }
         }
         else {
@@ -124,7 +124,7 @@ namespace QuantLib {
                 for (Size i=0; i < points_.size(); ++i) {
                     s+=1.0/(betas_[i] + squared(y - points_[i]));
                 }
-                return a/std::sqrt(s);
+                return a/sqrt(s);
             }
 
             AdaptiveRungeKutta<> rk_;
@@ -40,11 +40,11 @@ namespace QuantLib {
         const Real start = 0.0;
         const Real end   = 1.0-eps;
         const Real dx    = (end-start)/(steps-1);
-        const Real scale = 1/(1-std::exp(-beta/jumpIntensity));
+        const Real scale = 1/(1-exp(-beta/jumpIntensity));
 
         for (Size i=0; i < steps; ++i) {
             const Real p = start + i*dx;
-            locations_[i] = scale*(-1.0/eta*std::log(1.0-p));
+            locations_[i] = scale*(-1.0/eta*log(1.0-p));
         }
 
         for (Size i=0; i < steps-1; ++i) {
@@ -56,21 +56,21 @@ namespace QuantLib {
                                     
     Real ExponentialJump1dMesher::jumpSizeDensity(Real x, Time t) const {
         const Real a    = 1.0-jumpIntensity_/beta_;
-        const Real norm = 1.0-std::exp(-jumpIntensity_*t);
+        const Real norm = 1.0-exp(-jumpIntensity_*t);
         const Real gammaValue 
-            = std::exp(GammaFunction().logValue(1.0-jumpIntensity_/beta_));
+            = exp(GammaFunction().logValue(1.0-jumpIntensity_/beta_));
         return jumpIntensity_*gammaValue/norm
-                    *( incompleteGammaFunction(a, x*std::exp(beta_*t)*eta_)
+                    *( incompleteGammaFunction(a, x*exp(beta_*t)*eta_)
                       -incompleteGammaFunction(a, x*eta_))
-                    *std::pow(eta_, jumpIntensity_/beta_)
-                    /(beta_*std::pow(x, a));
+                    *pow(eta_, jumpIntensity_/beta_)
+                    /(beta_*pow(x, a));
     }
     
     Real ExponentialJump1dMesher::jumpSizeDensity(Real x) const {
         const Real a = 1.0-jumpIntensity_/beta_;
         const Real gammaValue 
-                = std::exp(GammaFunction().logValue(jumpIntensity_/beta_));
-        return std::exp(-x*eta_)*std::pow(x, -a) * std::pow(eta_, 1.0-a) 
+                = exp(GammaFunction().logValue(jumpIntensity_/beta_));
+        return exp(-x*eta_)*pow(x, -a) * pow(eta_, 1.0-a) 
                 / gammaValue;
     }
 
@@ -86,10 +86,10 @@ namespace QuantLib {
         const Real a    = jumpIntensity_/beta_;
         const Real xmin = std::min(x, QL_EPSILON);
         const Real gammaValue 
-                = std::exp(GammaFunction().logValue(jumpIntensity_/beta_));
+                = exp(GammaFunction().logValue(jumpIntensity_/beta_));
         
         const Real lowerEps = 
-            (std::pow(xmin, a)/a - std::pow(xmin, a+1)/(a+1))/gammaValue;
+            (pow(xmin, a)/a - pow(xmin, a+1)/(a+1))/gammaValue;
         
         return lowerEps + GaussLobattoIntegral(10000, 1e-12)(
             [&](Real _x){ return jumpSizeDensity(_x); },
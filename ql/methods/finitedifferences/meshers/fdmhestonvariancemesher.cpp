@@ -40,7 +40,7 @@ namespace QuantLib {
                                     const std::vector<Real>& vGrid)
             : variance(pGrid.begin(), pGrid.end(), vGrid.begin()) {}
             Real operator()(Real x) const {
-                return std::sqrt(variance(x, true));
+                return sqrt(variance(x, true));
             }
             LinearInterpolation variance;
         };
@@ -61,10 +61,10 @@ namespace QuantLib {
             
             for (Size l=1; l<=tAvgSteps; ++l) {
                 const Real t = (maturity*l)/tAvgSteps;
-                const Real ncp = 4*process->kappa()*std::exp(-process->kappa()*t)/(squared(mixedSigma)
-                    *(1-std::exp(-process->kappa()*t)))*process->v0();
+                const Real ncp = 4*process->kappa()*exp(-process->kappa()*t)/(squared(mixedSigma)
+                    *(1-exp(-process->kappa()*t)))*process->v0();
                 const Real k = squared(mixedSigma)
-                    *(1-std::exp(-process->kappa()*t))/(4*process->kappa());
+                    *(1-exp(-process->kappa()*t))/(4*process->kappa());
 
                 const Real qMin = 0.0; // v_min = 0.0;
                 const Real qMax = std::max(process->v0(),
@@ -106,7 +106,7 @@ namespace QuantLib {
         catch (const Error&) {
             // use default mesh
             const Real vol = mixedSigma*
-                std::sqrt(process->theta()/(2*process->kappa()));
+                sqrt(process->theta()/(2*process->kappa()));
 
             const Real mean = process->theta();
             const Real upperBound = std::max(process->v0()+4*vol, mean+4*vol);
@@ -125,12 +125,12 @@ namespace QuantLib {
         std::sort(pGrid.begin(), pGrid.end());
         volaEstimate_ = GaussLobattoIntegral(100000, 1e-4)(
             interpolated_volatility(pGrid, vGrid),
-                pGrid.front(), pGrid.back())*std::pow(skewHint, 1.5);
+                pGrid.front(), pGrid.back())*pow(skewHint, 1.5);
 
         const Real v0 = process->v0();
         for (Size i=1; i<vGrid.size(); ++i) {
             if (vGrid[i-1] <= v0 && vGrid[i] >= v0) {
-                if (std::fabs(vGrid[i-1] - v0) < std::fabs(vGrid[i] - v0))
+                if (fabs(vGrid[i-1] - v0) < fabs(vGrid[i] - v0))
                     vGrid[i-1] = v0;
                 else
                     vGrid[i] = v0;
@@ -194,8 +194,8 @@ namespace QuantLib {
                     u[i] = epsilon + ((1-2*epsilon)/(sAvgSteps-1))*i;
                     const Real x = InverseCumulativeNormal()(u[i]);
 
-                    const Real gf = x*vol*std::sqrt(t);
-                    const Real f = fwd*std::exp(gf);
+                    const Real gf = x*vol*sqrt(t);
+                    const Real f = fwd*exp(gf);
 
                     sig[i] = squared(leverageFct->localVol(t, f, true));
                 }
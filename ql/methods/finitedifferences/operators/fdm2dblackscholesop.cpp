@@ -145,6 +145,44 @@ namespace QuantLib {
         return solve_splitting(0, r, dt);
     }
 
+    void Fdm2dBlackScholesOp::apply_to(const Array& x, Array& out) const {
+        opX_.apply_to(x, out);
+        opY_.apply_to(x, tmp_);
+        out += tmp_;
+
+        corrMapT_.apply_to(x, tmp_);
+        for (Size i=0; i < out.size(); ++i)
+            out[i] += tmp_[i] + currentForwardRate_*x[i];
+    }
+
+    void Fdm2dBlackScholesOp::apply_mixed_to(const Array& x, Array& out) const {
+        corrMapT_.apply_to(x, out);
+        for (Size i=0; i < out.size(); ++i)
+            out[i] += currentForwardRate_*x[i];
+    }
+
+    void Fdm2dBlackScholesOp::apply_direction_to(Size direction,
+                                                 const Array& x,
+                                                 Array& out) const {
+        if (direction == 0)
+            opX_.apply_to(x, out);
+        else if (direction == 1)
+            opY_.apply_to(x, out);
+        else
+            QL_FAIL("direction is too large");
+    }
+
+    void Fdm2dBlackScholesOp::solve_splitting_to(Size direction,
+                                                 const Array& x, Real s,
+                                                 Array& out) const {
+        if (direction == 0)
+            opX_.solve_splitting_to(direction, x, s, out);
+        else if (direction == 1)
+            opY_.solve_splitting_to(direction, x, s, out);
+        else
+            QL_FAIL("direction is too large");
+    }
+
     std::vector<SparseMatrix> Fdm2dBlackScholesOp::toMatrixDecomp() const {
         return {
             opX_.toMatrix(),
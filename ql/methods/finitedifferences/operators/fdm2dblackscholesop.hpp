@@ -54,6 +54,11 @@ namespace QuantLib {
         Array solve_splitting(Size direction, const Array& x, Real s) const override;
         Array preconditioner(const Array& r, Real s) const override;
 
+        void apply_to(const Array& x, Array& out) const override;
+        void apply_mixed_to(const Array& x, Array& out) const override;
+        void apply_direction_to(Size direction, const Array& x, Array& out) const override;
+        void solve_splitting_to(Size direction, const Array& x, Real s, Array& out) const override;
+
         std::vector<SparseMatrix> toMatrixDecomp() const override;
 
       private:
@@ -67,6 +72,7 @@ namespace QuantLib {
         NinePointLinearOp corrMapT_;
         const NinePointLinearOp corrMapTemplate_;
         const Real illegalLocalVolOverwrite_;
+        mutable Array tmp_;
     };
 }
 #endif
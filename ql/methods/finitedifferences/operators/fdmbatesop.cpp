@@ -40,7 +40,7 @@ namespace QuantLib {
                            const Size integroIntegrationOrder,
                            const ext::shared_ptr<FdmQuantoHelper>& quantoHelper)
     : lambda_(batesProcess->lambda()), delta_(batesProcess->delta()), nu_(batesProcess->nu()),
-      m_(std::exp(nu_ + 0.5 * delta_ * delta_) - 1.0),
+      m_(exp(nu_ + 0.5 * delta_ * delta_) - 1.0),
       gaussHermiteIntegration_(integroIntegrationOrder), mesher_(mesher), bcSet_(std::move(bcSet)),
       hestonOp_(new FdmHestonOp(
           mesher,
@@ -83,7 +83,7 @@ namespace QuantLib {
                 = dirichlet->applyAfterApplying(x, valueOfDerivative);
         }
 
-        return std::exp(-y*y)*valueOfDerivative;
+        return exp(-y*y)*valueOfDerivative;
     }
     
     Array FdmBatesOp::integro(const Array& r) const {
@@ -25,6 +25,7 @@
 #include <methods/finitedifferences/operators/fdmblackscholesop.hpp>
 #include <methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <methods/finitedifferences/operators/secondderivativeop.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib {
@@ -85,7 +86,7 @@ namespace QuantLib {
                 mapT_.axpyb(
                     Array(1, r - q - 0.5*v)
                         - quantoHelper_->quantoAdjustment(
-                            Array(1, std::sqrt(v)), t1, t2),
+                            Array(1, sqrt(v)), t1, t2),
                     dxMap_,
                     dxxMap_.mult(0.5*Array(mesher_->layout()->size(), v)),
                     Array(1, -r));
@@ -130,8 +131,67 @@ namespace QuantLib {
         return solve_splitting(direction_, r, dt);
     }
 
+    void FdmBlackScholesOp::apply_to(const Array& r, Array& out) const {
+        mapT_.apply_to(r, out);
+    }
+
+    void FdmBlackScholesOp::apply_mixed_to(const Array& r, Array& out) const {
+        out.resize(r.size());
+        std::fill(out.begin(), out.end(), 0.0);
+    }
+
+    void FdmBlackScholesOp::apply_direction_to(Size direction,
+                                               const Array& r,
+                                               Array& out) const {
+        if (direction == direction_)
+            mapT_.apply_to(r, out);
+        else {
+            out.resize(r.size());
+            std::fill(out.begin(), out.end(), 0.0);
+        }
+    }
+
+    void FdmBlackScholesOp::solve_splitting_to(Size direction,
+                                               const Array& r, Real dt,
+                                               Array& out) const {
+        if (direction == direction_)
+            mapT_.solve_splitting_to(r, dt, 1.0, out, tmp_);
+        else if (&out != &r) {
+            out.resize(r.size());
+            std::copy(r.begin(), r.end(), out.begin());
+        }
+    }
+
+    void FdmBlackScholesOp::solve_splitting_columns_to(Size direction,
+                                                       const Array& r, Real dt,
+                                                       Array& out, Size n) const {
+        QL_REQUIRE(n == mesher_->layout()->size(), "inconsistent array size");
+        if (direction == direction_)
+            mapT_.solve_splitting_columns_to(r, dt, 1.0, out, tmp_);
+        else if (&out != &r) {
+            out.resize(r.size());
+            std::copy(r.begin(), r.end(), out.begin());
+        }
+    }
+
     std::vector<SparseMatrix> FdmBlackScholesOp::toMatrixDecomp() const {
         return std::vector<SparseMatrix>(1, mapT_.toMatrix());
     }
 
+    Array FdmBlackScholesOp::apply_vega(const Array& r,
+                                        Time t1, Time t2) const {
+        QL_REQUIRE(localVol_ == nullptr && quantoHelper_ == nullptr,
+                   "volatility derivative is not available for local "
+                   "volatility or quanto adjustments");
+        QL_REQUIRE(t2 > t1, "t2 (" << t2 << ") must be larger "
+                   "than t1 (" << t1 << ")");
+
+        // d/dsigma of the forward variance (t2*sigma2^2-t1*sigma1^2)/(t2-t1)
+        const Real dv = 2.0*(t2*volTS_->blackVol(t2, strike_, true)
+            - ((t1 > 0.0) ? t1*volTS_->blackVol(t1, strike_, true) : 0.0))
+            /(t2-t1);
+
+        return 0.5*dv*(dxxMap_.apply(r) - dxMap_.apply(r));
+    }
+
 }
@@ -55,8 +55,22 @@ namespace QuantLib {
         Array solve_splitting(Size direction, const Array& r, Real s) const override;
         Array preconditioner(const Array& r, Real s) const override;
 
+        void apply_to(const Array& r, Array& out) const override;
+        void apply_mixed_to(const Array& r, Array& out) const override;
+        void apply_direction_to(Size direction, const Array& r, Array& out) const override;
+        void solve_splitting_to(Size direction, const Array& r, Real s, Array& out) const override;
+        void solve_splitting_columns_to(Size direction, const Array& r, Real s,
+                                        Array& out, Size n) const override;
+
         std::vector<SparseMatrix> toMatrixDecomp() const override;
 
+        //! derivative of the operator w.r.t. a parallel volatility shift
+        /*! applies the derivative for the time step [t1, t2] w.r.t. a
+            parallel shift of the Black volatility at the strike. Local
+            volatility and quanto adjustments are not supported.
+        */
+        Array apply_vega(const Array& r, Time t1, Time t2) const;
+
       private:
         const ext::shared_ptr<FdmMesher> mesher_;
         const ext::shared_ptr<YieldTermStructure> rTS_, qTS_;
@@ -70,6 +84,7 @@ namespace QuantLib {
         const Real illegalLocalVolOverwrite_;
         const Size direction_;
         const ext::shared_ptr<FdmQuantoHelper> quantoHelper_;
+        mutable Array tmp_;
     };
 }
 
@@ -204,7 +204,7 @@ namespace QuantLib {
             const Size nx = iter.coordinates()[0];
 
             if (iter.coordinates()[1] == 0) {
-                const Real x = std::exp(mesher_->location(iter, 0));
+                const Real x = exp(mesher_->location(iter, 0));
                 const Real spot = std::min(leverageFct_->maxStrike(),
                                            std::max(leverageFct_->minStrike(), x));
                 v[nx] = std::max(0.01, leverageFct_->localVol(time, spot, true));
@@ -224,6 +224,12 @@ namespace QuantLib {
         retVal[1] = mapY_->toMatrix();
         retVal[2] = correlation_->toMatrix();
 
+        if (leverageFct_ != nullptr) {
+            // the mixed derivative is applied to L_*u, see apply()
+            for (Size k=0; k < retVal[2].nnz(); ++k)
+                retVal[2].value_data()[k] *= L_[retVal[2].index2_data()[k]];
+        }
+
         return retVal;
     }
 
@@ -83,7 +83,7 @@ namespace QuantLib {
             const Size nx = iter.coordinates()[0];
 
             if (iter.coordinates()[1] == 0) {
-                const Real x = std::exp(mesher_->location(iter, 0));
+                const Real x = exp(mesher_->location(iter, 0));
                 const Real spot = std::min(leverageFct_->maxStrike(),
                                            std::max(leverageFct_->minStrike(), x));
                 v[nx] = std::max(0.01, leverageFct_->localVol(time, spot, true));
@@ -185,6 +185,43 @@ namespace QuantLib {
         return solve_splitting(1, solve_splitting(0, r, dt), dt) ;
     }
 
+    void FdmHestonOp::apply_to(const Array& u, Array& out) const {
+        dyMap_.getMap().apply_to(u, out);
+        dxMap_.getMap().apply_to(u, tmp_);
+        out += tmp_;
+
+        correlationMap_.apply_to(u, tmp_);
+        const Array& l = dxMap_.getL();
+        for (Size i=0; i < out.size(); ++i)
+            out[i] += l[i]*tmp_[i];
+    }
+
+    void FdmHestonOp::apply_mixed_to(const Array& r, Array& out) const {
+        correlationMap_.apply_to(r, out);
+        out *= dxMap_.getL();
+    }
+
+    void FdmHestonOp::apply_direction_to(Size direction,
+                                         const Array& r, Array& out) const {
+        if (direction == 0)
+            dxMap_.getMap().apply_to(r, out);
+        else if (direction == 1)
+            dyMap_.getMap().apply_to(r, out);
+        else
+            QL_FAIL("direction too large");
+    }
+
+    void FdmHestonOp::solve_splitting_to(Size direction,
+                                         const Array& r, Real a,
+                                         Array& out) const {
+        if (direction == 0)
+            dxMap_.getMap().solve_splitting_to(r, a, 1.0, out, tmp_);
+        else if (direction == 1)
+            dyMap_.getMap().solve_splitting_to(r, a, 1.0, out, tmp_);
+        else
+            QL_FAIL("direction too large");
+    }
+
     std::vector<SparseMatrix> FdmHestonOp::toMatrixDecomp() const {
         return {
             dxMap_.getMap().toMatrix(),
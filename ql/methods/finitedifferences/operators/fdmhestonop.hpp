@@ -103,12 +103,18 @@ namespace QuantLib {
         Array solve_splitting(Size direction, const Array& r, Real s) const override;
         Array preconditioner(const Array& r, Real s) const override;
 
+        void apply_to(const Array& r, Array& out) const override;
+        void apply_mixed_to(const Array& r, Array& out) const override;
+        void apply_direction_to(Size direction, const Array& r, Array& out) const override;
+        void solve_splitting_to(Size direction, const Array& r, Real s, Array& out) const override;
+
         std::vector<SparseMatrix> toMatrixDecomp() const override;
 
       private:
         NinePointLinearOp correlationMap_;
         FdmHestonVariancePart dyMap_;
         FdmHestonEquityPart dxMap_;
+        mutable Array tmp_;
     };
 }
 
@@ -37,6 +37,15 @@ namespace QuantLib {
         virtual ~FdmLinearOp() = default;
         virtual array_type apply(const array_type& r) const = 0;
 
+        /*! writes the result of apply(r) into \c out, which is resized
+            if needed and must not be the same array as \c r.
+            Operators override this to avoid allocating a new array
+            at each call.
+        */
+        virtual void apply_to(const array_type& r, array_type& out) const {
+            out = apply(r);
+        }
+
         virtual SparseMatrix toMatrix() const = 0;
     };
 }
@@ -28,6 +28,7 @@
 
 #include <math/matrixutilities/sparsematrix.hpp>
 #include <methods/finitedifferences/operators/fdmlinearop.hpp>
+#include <algorithm>
 #include <numeric>
 
 namespace QuantLib {
@@ -45,6 +46,40 @@ namespace QuantLib {
         virtual Array solve_splitting(Size direction, const Array& r, Real s) const = 0;
         virtual Array preconditioner(const Array& r, Real s) const = 0;
 
+        /*! \name Output-buffer versions
+            These write their result into \c out, which is resized if
+            needed; \c out must not be the same array as \c r except
+            for solve_splitting_to.  Operators override them to run
+            without heap allocations once their buffers are set up.
+        */
+        //@{
+        virtual void apply_mixed_to(const Array& r, Array& out) const {
+            out = apply_mixed(r);
+        }
+        virtual void apply_direction_to(Size direction, const Array& r, Array& out) const {
+            out = apply_direction(direction, r);
+        }
+        virtual void solve_splitting_to(Size direction, const Array& r, Real s, Array& out) const {
+            out = solve_splitting(direction, r, s);
+        }
+        /*! solves the splitting system for several right-hand sides
+            of size \c n stored one after the other in \c r; \c out
+            can be the same array as \c r.  Operators override it to
+            share the elimination between the right-hand sides.
+        */
+        virtual void solve_splitting_columns_to(Size direction, const Array& r, Real s,
+                                                Array& out, Size n) const {
+            QL_REQUIRE(n > 0 && r.size() % n == 0, "inconsistent array size");
+            Array x(n), y(n);
+            out.resize(r.size());
+            for (Size j=0; j < r.size()/n; ++j) {
+                std::copy(r.begin() + j*n, r.begin() + (j+1)*n, x.begin());
+                solve_splitting_to(direction, x, s, y);
+                std::copy(y.begin(), y.end(), out.begin() + j*n);
+            }
+        }
+        //@}
+
         virtual std::vector<SparseMatrix> toMatrixDecomp() const {
             QL_FAIL(" ublas representation is not implemented");
         }
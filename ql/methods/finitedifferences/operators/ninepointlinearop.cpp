@@ -109,10 +109,18 @@ namespace QuantLib {
 
     Array NinePointLinearOp::apply(const Array& u) const {
 
+        Array retVal(u.size());
+        apply_to(u, retVal);
+        return retVal;
+    }
+
+    void NinePointLinearOp::apply_to(const Array& u, Array& out) const {
+
         QL_REQUIRE(u.size() == mesher_->layout()->size(),"inconsistent length of r "
                     << u.size() << " vs " << mesher_->layout()->size());
+        QL_REQUIRE(&u != &out, "input and output arrays must differ");
 
-        Array retVal(u.size());
+        out.resize(u.size());
         // direct access to make the following code faster.
         const Real *a00(a00_.get()), *a01(a01_.get()), *a02(a02_.get());
         const Real *a10(a10_.get()), *a11(a11_.get()), *a12(a12_.get());
@@ -121,9 +129,9 @@ namespace QuantLib {
         const Size *i10(i10_.get()),                   *i12(i12_.get());
         const Size *i20(i20_.get()), *i21(i21_.get()), *i22(i22_.get());
 
-        //#pragma omp parallel for
-        for (Size i=0; i < retVal.size(); ++i) {
-            retVal[i] =   a00[i]*u[i00[i]]
+        #pragma omp parallel for if(out.size() > 4096)
+        for (long i=0; i < (long)out.size(); ++i) {
+            out[i] =      a00[i]*u[i00[i]]
                         + a01[i]*u[i01[i]]
                         + a02[i]*u[i02[i]]
                         + a10[i]*u[i10[i]]
@@ -133,7 +141,6 @@ namespace QuantLib {
                         + a21[i]*u[i21[i]]
                         + a22[i]*u[i22[i]];
         }
-        return retVal;
     }
 
     SparseMatrix NinePointLinearOp::toMatrix() const {
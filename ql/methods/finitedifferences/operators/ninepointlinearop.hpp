@@ -45,6 +45,7 @@ namespace QuantLib {
         ~NinePointLinearOp() override = default;
 
         Array apply(const Array& r) const override;
+        void apply_to(const Array& r, Array& out) const override;
         NinePointLinearOp mult(const Array& u) const;
 
         void swap(NinePointLinearOp& m) noexcept;
@@ -24,6 +24,7 @@
 #include <methods/finitedifferences/tridiagonaloperator.hpp>
 #include <methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <methods/finitedifferences/operators/triplebandlinearop.hpp>
+#include <algorithm>
 
 namespace QuantLib {
 
@@ -33,28 +34,16 @@ namespace QuantLib {
     : direction_(direction),
       i0_       (new Size[mesher->layout()->size()]),
       i2_       (new Size[mesher->layout()->size()]),
-      reverseIndex_ (new Size[mesher->layout()->size()]),
       lower_    (new Real[mesher->layout()->size()]),
       diag_     (new Real[mesher->layout()->size()]),
       upper_    (new Real[mesher->layout()->size()]),
       mesher_(mesher) {
 
-        std::vector<Size> newDim(mesher->layout()->dim());
-        std::iter_swap(newDim.begin(), newDim.begin()+direction_);
-        std::vector<Size> newSpacing = FdmLinearOpLayout(newDim).spacing();
-        std::iter_swap(newSpacing.begin(), newSpacing.begin()+direction_);
-
         for (const auto& iter : *mesher->layout()) {
             const Size i = iter.index();
 
             i0_[i] = mesher->layout()->neighbourhood(iter, direction, -1);
             i2_[i] = mesher->layout()->neighbourhood(iter, direction,  1);
-
-            const std::vector<Size>& coordinates = iter.coordinates();
-            const Size newIndex =
-                  std::inner_product(coordinates.begin(), coordinates.end(),
-                                     newSpacing.begin(), Size(0));
-            reverseIndex_[newIndex] = i;
         }
     }
 
@@ -62,7 +51,6 @@ namespace QuantLib {
     : direction_(m.direction_),
       i0_   (new Size[m.mesher_->layout()->size()]),
       i2_   (new Size[m.mesher_->layout()->size()]),
-      reverseIndex_(new Size[m.mesher_->layout()->size()]),
       lower_(new Real[m.mesher_->layout()->size()]),
       diag_ (new Real[m.mesher_->layout()->size()]),
       upper_(new Real[m.mesher_->layout()->size()]),
@@ -70,8 +58,6 @@ namespace QuantLib {
         const Size len = m.mesher_->layout()->size();
         std::copy(m.i0_.get(), m.i0_.get() + len, i0_.get());
         std::copy(m.i2_.get(), m.i2_.get() + len, i2_.get());
-        std::copy(m.reverseIndex_.get(), m.reverseIndex_.get()+len,
-                  reverseIndex_.get());
         std::copy(m.lower_.get(), m.lower_.get() + len, lower_.get());
         std::copy(m.diag_.get(),  m.diag_.get() + len,  diag_.get());
         std::copy(m.upper_.get(), m.upper_.get() + len, upper_.get());
@@ -82,7 +68,6 @@ namespace QuantLib {
         std::swap(direction_, m.direction_);
 
         i0_.swap(m.i0_); i2_.swap(m.i2_);
-        reverseIndex_.swap(m.reverseIndex_);
         lower_.swap(m.lower_); diag_.swap(m.diag_); upper_.swap(m.upper_);
     }
 
@@ -222,7 +207,16 @@ namespace QuantLib {
     }
 
     Array TripleBandLinearOp::apply(const Array& r) const {
-        QL_REQUIRE(r.size() == mesher_->layout()->size(), "inconsistent length of r");
+        Array retVal(r.size());
+        apply_to(r, retVal);
+        return retVal;
+    }
+
+    void TripleBandLinearOp::apply_to(const Array& r, Array& out) const {
+        const Size size = mesher_->layout()->size();
+        QL_REQUIRE(r.size() == size, "inconsistent length of r");
+        QL_REQUIRE(&r != &out, "input and output arrays must differ");
+        out.resize(size);
 
         const Real* lptr = lower_.get();
         const Real* dptr = diag_.get();
@@ -230,13 +224,10 @@ namespace QuantLib {
         const Size* i0ptr = i0_.get();
         const Size* i2ptr = i2_.get();
 
-        array_type retVal(r.size());
-        //#pragma omp parallel for
-        for (Size i=0; i < mesher_->layout()->size(); ++i) {
-            retVal[i] = r[i0ptr[i]]*lptr[i]+r[i]*dptr[i]+r[i2ptr[i]]*uptr[i];
+        #pragma omp parallel for if(size > 4096)
+        for (long i=0; i < (long)size; ++i) {
+            out[i] = r[i0ptr[i]]*lptr[i]+r[i]*dptr[i]+r[i2ptr[i]]*uptr[i];
         }
-
-        return retVal;
     }
 
     SparseMatrix TripleBandLinearOp::toMatrix() const {
@@ -254,7 +245,17 @@ namespace QuantLib {
 
 
     Array TripleBandLinearOp::solve_splitting(const Array& r, Real a, Real b) const {
-        QL_REQUIRE(r.size() == mesher_->layout()->size(), "inconsistent size of rhs");
+        Array retVal(r.size()), tmp(r.size());
+        solve_splitting_to(r, a, b, retVal, tmp);
+        return retVal;
+    }
+
+    void TripleBandLinearOp::solve_splitting_to(const Array& r, Real a, Real b,
+                                                Array& out, Array& tmp) const {
+        const Size size = mesher_->layout()->size();
+        QL_REQUIRE(r.size() == size, "inconsistent size of rhs");
+        QL_REQUIRE(&r != &tmp && &out != &tmp,
+                   "workspace must differ from input and output arrays");
 
 #ifdef QL_EXTRA_SAFETY_CHECKS
         for (const auto& iter : *mesher_->layout()) {
@@ -266,36 +267,141 @@ namespace QuantLib {
         }
 #endif
 
-        Array retVal(r.size()), tmp(r.size());
+        out.resize(size);
+        tmp.resize(size);
 
         const Real* lptr = lower_.get();
         const Real* dptr = diag_.get();
         const Real* uptr = upper_.get();
+        const Real* rptr = r.begin();
+        Real* optr = out.begin();
+        Real* tptr = tmp.begin();
+
+        // The operator doesn't couple different grid lines along
+        // direction_ (see the safety checks above), so each of them is
+        // an independent tridiagonal system.  In the layout, element j
+        // of the lines starting at base+c, c = 0,...,stride-1, is stored
+        // at base + j*stride + c; that is, the lines along a non-leading
+        // direction are interleaved.  The Thomson algorithm below thus
+        // sweeps a chunk of lines at once, with a vectorizable inner
+        // loop over the lines and no index indirection, and the chunks
+        // are distributed among threads.
+        const Size lineLength = mesher_->layout()->dim()[direction_];
+        const Size stride = mesher_->layout()->spacing()[direction_];
+        const Size chunkSize = std::min(stride, Size(128));
+        const Size nChunks = (stride + chunkSize - 1)/chunkSize;
+        const long nTasks = long(size/(stride*lineLength)*nChunks);
+        long failures = 0;
+
+        #pragma omp parallel for reduction(+:failures) if(nTasks > 1 && size > 4096)
+        for (long k=0; k < nTasks; ++k) {
+            const Size base = (Size(k)/nChunks)*stride*lineLength;
+            const Size c0 = base + (Size(k)%nChunks)*chunkSize;
+            const Size c1 = std::min(c0 + chunkSize, base + stride);
+
+            // forward sweep; tmp holds the modified upper diagonal
+            #pragma omp simd reduction(+:failures)
+            for (Size i=c0; i < c1; ++i) {
+                const Real d = a*dptr[i]+b;
+                failures += (d == 0.0) ? 1 : 0;
+                const Real bet = 1.0/d;
+                optr[i] = rptr[i]*bet;
+                tptr[i] = a*uptr[i]*bet;
+            }
+            for (Size j=1; j < lineLength; ++j) {
+                const Size offset = j*stride;
+                #pragma omp simd reduction(+:failures)
+                for (Size i=c0+offset; i < c1+offset; ++i) {
+                    const Real d = b+a*(dptr[i]-tptr[i-stride]*lptr[i]);
+                    failures += (d == 0.0) ? 1 : 0;
+                    const Real bet = 1.0/d;
+                    // r[i] is read before out[i] is written, so that
+                    // the two can be the same array
+                    optr[i] = (rptr[i]-a*lptr[i]*optr[i-stride])*bet;
+                    tptr[i] = a*uptr[i]*bet;
+                }
+            }
 
-        // Thomson algorithm to solve a tridiagonal system.
-        // Example code taken from Tridiagonalopertor and
-        // changed to fit for the triple band operator.
-        Size rim1 = reverseIndex_[0];
-        Real bet=1.0/(a*dptr[rim1]+b);
-        QL_REQUIRE(bet != 0.0, "division by zero");
-        retVal[reverseIndex_[0]] = r[rim1]*bet;
+            // back substitution
+            for (Size j=lineLength-1; j > 0; --j) {
+                const Size offset = (j-1)*stride;
+                #pragma omp simd
+                for (Size i=c0+offset; i < c1+offset; ++i)
+                    optr[i] -= tptr[i]*optr[i+stride];
+            }
+        }
+        QL_ENSURE(failures == 0, "division by zero");
+    }
 
-        for (Size j=1; j<=mesher_->layout()->size()-1; j++){
-            const Size ri = reverseIndex_[j];
-            tmp[j] = a*uptr[rim1]*bet;
+    void TripleBandLinearOp::solve_splitting_columns_to(const Array& r, Real a, Real b,
+                                                        Array& out, Array& tmp) const {
+        const Size size = mesher_->layout()->size();
+        QL_REQUIRE(!r.empty() && r.size() % size == 0, "inconsistent size of rhs");
+        QL_REQUIRE(&r != &tmp && &out != &tmp,
+                   "workspace must differ from input and output arrays");
 
-            bet=b+a*(dptr[ri]-tmp[j]*lptr[ri]);
-            QL_ENSURE(bet != 0.0, "division by zero");
-            bet=1.0/bet;
+        out.resize(r.size());
+        tmp.resize(2*size);
 
-            retVal[ri] = (r[ri]-a*lptr[ri]*retVal[rim1])*bet;
-            rim1 = ri;
+        const Real* lptr = lower_.get();
+        const Real* dptr = diag_.get();
+        const Real* uptr = upper_.get();
+        // modified upper diagonal and inverse pivots of the elimination
+        Real* tptr = tmp.begin();
+        Real* bptr = tmp.begin() + size;
+
+        const Size lineLength = mesher_->layout()->dim()[direction_];
+        const Size stride = mesher_->layout()->spacing()[direction_];
+        const Size block = stride*lineLength;
+
+        // elimination, see solve_splitting_to for the memory layout
+        long failures = 0;
+        for (Size base=0; base < size; base += block) {
+            #pragma omp simd reduction(+:failures)
+            for (Size i=base; i < base+stride; ++i) {
+                const Real d = a*dptr[i]+b;
+                failures += (d == 0.0) ? 1 : 0;
+                bptr[i] = 1.0/d;
+                tptr[i] = a*uptr[i]*bptr[i];
+            }
+            for (Size j=1; j < lineLength; ++j) {
+                const Size offset = base + j*stride;
+                #pragma omp simd reduction(+:failures)
+                for (Size i=offset; i < offset+stride; ++i) {
+                    const Real d = b+a*(dptr[i]-tptr[i-stride]*lptr[i]);
+                    failures += (d == 0.0) ? 1 : 0;
+                    bptr[i] = 1.0/d;
+                    tptr[i] = a*uptr[i]*bptr[i];
+                }
+            }
+        }
+        QL_ENSURE(failures == 0, "division by zero");
+
+        // forward and back substitution for each right-hand side
+        const long nColumns = long(r.size()/size);
+
+        #pragma omp parallel for if(nColumns > 1 && r.size() > 4096)
+        for (long k=0; k < nColumns; ++k) {
+            const Real* rptr = r.begin() + Size(k)*size;
+            Real* optr = out.begin() + Size(k)*size;
+
+            for (Size base=0; base < size; base += block) {
+                #pragma omp simd
+                for (Size i=base; i < base+stride; ++i)
+                    optr[i] = rptr[i]*bptr[i];
+                for (Size j=1; j < lineLength; ++j) {
+                    const Size offset = base + j*stride;
+                    #pragma omp simd
+                    for (Size i=offset; i < offset+stride; ++i)
+                        optr[i] = (rptr[i]-a*lptr[i]*optr[i-stride])*bptr[i];
+                }
+                for (Size j=lineLength-1; j > 0; --j) {
+                    const Size offset = base + (j-1)*stride;
+                    #pragma omp simd
+                    for (Size i=offset; i < offset+stride; ++i)
+                        optr[i] -= tptr[i]*optr[i+stride];
+                }
+            }
         }
-        // cannot be j>=0 with Size j
-        for (Size j=mesher_->layout()->size()-2; j>0; --j)
-            retVal[reverseIndex_[j]] -= tmp[j+1]*retVal[reverseIndex_[j+1]];
-        retVal[reverseIndex_[0]] -= tmp[1]*retVal[reverseIndex_[1]];
-
-        return retVal;
     }
 }
@@ -46,7 +46,22 @@ namespace QuantLib {
         ~TripleBandLinearOp() override = default;
 
         Array apply(const Array& r) const override;
+        void apply_to(const Array& r, Array& out) const override;
         Array solve_splitting(const Array& r, Real a, Real b = 1.0) const;
+        /*! allocation-free version of solve_splitting; \c out can be the
+            same array as \c r, whereas \c tmp is used as workspace.
+            Both are resized if needed.
+        */
+        void solve_splitting_to(const Array& r, Real a, Real b,
+                                Array& out, Array& tmp) const;
+        /*! solves the same system for several right-hand sides, stored
+            one after the other in \c r.  The elimination is performed
+            once for all of them, each right-hand side only costs a
+            forward and a backward substitution.  As above, \c out can
+            be the same array as \c r and \c tmp is used as workspace.
+        */
+        void solve_splitting_columns_to(const Array& r, Real a, Real b,
+                                        Array& out, Array& tmp) const;
 
         TripleBandLinearOp mult(const Array& u) const;
         // interpret u as the diagonal of a diagonal matrix, multiplied on LHS
@@ -68,7 +83,6 @@ namespace QuantLib {
 
         Size direction_;
         std::unique_ptr<Size[]> i0_, i2_;
-        std::unique_ptr<Size[]> reverseIndex_;
         std::unique_ptr<Real[]> lower_, diag_, upper_;
 
         ext::shared_ptr<FdmMesher> mesher_;
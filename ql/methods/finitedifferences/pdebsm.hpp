@@ -44,7 +44,7 @@ namespace QuantLib {
         Real diffusion(Time t, Real x) const override { return process_->diffusion(t, x); }
         Real drift(Time t, Real x) const override { return process_->drift(t, x); }
         Real discount(Time t, Real) const override {
-            if (std::fabs(t) < 1e-8) t = 0;
+            if (fabs(t) < 1e-8) t = 0;
             return process_->riskFreeRate()->
                 forwardRate(t,t,Continuous,NoFrequency,true);
         }
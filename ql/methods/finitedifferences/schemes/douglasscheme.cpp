@@ -20,6 +20,7 @@
 */
 
 #include <methods/finitedifferences/schemes/douglasscheme.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib {
@@ -34,16 +35,20 @@ namespace QuantLib {
         bcSet_.setTime(std::max(0.0, t-dt_));
 
         bcSet_.applyBeforeApplying(*map_);
-        Array y = a + dt_*map_->apply(a);
-        bcSet_.applyAfterApplying(y);
+        map_->apply_to(a, y_);
+        y_ *= dt_;
+        y_ += a;
+        bcSet_.applyAfterApplying(y_);
 
         for (Size i=0; i < map_->size(); ++i) {
-            Array rhs = y - theta_*dt_*map_->apply_direction(i, a);
-            y = map_->solve_splitting(i, rhs, -theta_*dt_);
+            map_->apply_direction_to(i, a, rhs_);
+            rhs_ *= -theta_*dt_;
+            rhs_ += y_;
+            map_->solve_splitting_to(i, rhs_, -theta_*dt_, y_);
         }
-        bcSet_.applyAfterSolving(y);
+        bcSet_.applyAfterSolving(y_);
 
-        a = y;
+        std::copy(y_.begin(), y_.end(), a.begin());
     }
 
     void DouglasScheme::setStep(Time dt) {
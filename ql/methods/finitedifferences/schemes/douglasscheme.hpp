@@ -54,6 +54,8 @@ namespace QuantLib {
         const Real theta_;
         const ext::shared_ptr<FdmLinearOpComposite> map_;
         const BoundaryConditionSchemeHelper bcSet_;
+        // workspace, allocated at the first step
+        Array y_, rhs_;
     };
 }
 
@@ -37,7 +37,9 @@ namespace QuantLib {
         bcSet_.setTime(std::max(0.0, t-dt_));
 
         bcSet_.applyBeforeApplying(*map_);
-        a += (theta*dt_) * map_->apply(a);
+        map_->apply_to(a, tmp_);
+        tmp_ *= theta*dt_;
+        a += tmp_;
         bcSet_.applyAfterApplying(a);
     }
 
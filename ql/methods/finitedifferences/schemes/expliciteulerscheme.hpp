@@ -55,6 +55,8 @@ namespace QuantLib {
         Time dt_;
         const ext::shared_ptr<FdmLinearOpComposite> map_;
         const BoundaryConditionSchemeHelper bcSet_;
+        // workspace, allocated at the first step
+        Array tmp_;
     };
 }
 
@@ -22,6 +22,7 @@
 #include <functional.hpp>
 #include <math/matrixutilities/bicgstab.hpp>
 #include <math/matrixutilities/gmres.hpp>
+#include <math/matrixutilities/ilu0preconditioner.hpp>
 #include <methods/finitedifferences/schemes/impliciteulerscheme.hpp>
 #include <utility>
 
@@ -53,10 +54,25 @@ namespace QuantLib {
             a = map_->solve_splitting(0, a, -theta*dt_);
         }
         else {
-            auto preconditioner = [&](const Array& _a){ return map_->preconditioner(_a, -theta*dt_); };
-            auto applyF = [&](const Array& _a){ return apply(_a, theta); };
+            QuantLib::BiCGstab::MatrixMult preconditioner, applyF;
+            CSRMatrix m;
+            ext::shared_ptr<ILU0Preconditioner> ilu;
+
+            if (solverType_ == SparseBiCGstab || solverType_ == SparseGMRES) {
+                m = CSRMatrix(map_->toMatrix());
+                m *= -theta*dt_;
+                m.addToDiagonal(1.0);
+                ilu = ext::make_shared<ILU0Preconditioner>(m);
+
+                preconditioner = [&](const Array& _a){ return ilu->apply(_a); };
+                applyF = [&](const Array& _a){ return m.apply(_a); };
+            }
+            else {
+                preconditioner = [&](const Array& _a){ return map_->preconditioner(_a, -theta*dt_); };
+                applyF = [&](const Array& _a){ return apply(_a, theta); };
+            }
 
-            if (solverType_ == BiCGstab) {
+            if (solverType_ == BiCGstab || solverType_ == SparseBiCGstab) {
                 const BiCGStabResult result =
                     QuantLib::BiCGstab(applyF, std::max(Size(10), a.size()),
                         relTol_, preconditioner).solve(a, a);
@@ -64,7 +80,7 @@ namespace QuantLib {
                 (*iterations_) += result.iterations;
                 a = result.x;
             }
-            else if (solverType_ == GMRES) {
+            else if (solverType_ == GMRES || solverType_ == SparseGMRES) {
                 const GMRESResult result =
                     QuantLib::GMRES(applyF, std::max(Size(10), a.size() / 10U), relTol_,
                                     preconditioner)
@@ -34,7 +34,12 @@ namespace QuantLib {
 
     class ImplicitEulerScheme {
       public:
-        enum SolverType { BiCGstab, GMRES };
+        /*! The sparse variants assemble the system matrix as a
+            CSRMatrix once per step via FdmLinearOp::toMatrix() and
+            precondition the Krylov solver with its ILU(0)
+            factorization instead of the operator splitting.
+        */
+        enum SolverType { BiCGstab, GMRES, SparseBiCGstab, SparseGMRES };
 
         // typedefs
         typedef OperatorTraits<FdmLinearOp> traits;
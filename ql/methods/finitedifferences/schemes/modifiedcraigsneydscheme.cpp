@@ -18,6 +18,7 @@
 */
 
 #include <methods/finitedifferences/schemes/modifiedcraigsneydscheme.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib {
@@ -34,28 +35,43 @@ namespace QuantLib {
         bcSet_.setTime(std::max(0.0, t-dt_));
 
         bcSet_.applyBeforeApplying(*map_);
-        Array y = a + dt_*map_->apply(a);
-        bcSet_.applyAfterApplying(y);
+        map_->apply_to(a, y_);
+        y_ *= dt_;
+        y_ += a;
+        bcSet_.applyAfterApplying(y_);
 
-        Array y0 = y;
+        y0_.resize(y_.size());
+        std::copy(y_.begin(), y_.end(), y0_.begin());
 
         for (Size i=0; i < map_->size(); ++i) {
-            Array rhs = y - theta_*dt_*map_->apply_direction(i, a);
-            y = map_->solve_splitting(i, rhs, -theta_*dt_);
+            map_->apply_direction_to(i, a, rhs_);
+            rhs_ *= -theta_*dt_;
+            rhs_ += y_;
+            map_->solve_splitting_to(i, rhs_, -theta_*dt_, y_);
         }
 
+        tmp_.resize(y_.size());
+        std::copy(y_.begin(), y_.end(), tmp_.begin());
+        tmp_ -= a;
+
         bcSet_.applyBeforeApplying(*map_);
-        Array yt =  y0 + mu_*dt_*map_->apply_mixed(y-a)
-                  +(0.5-mu_)*dt_*map_->apply(y-a);;
-        bcSet_.applyAfterApplying(yt);
+        map_->apply_mixed_to(tmp_, rhs_);
+        rhs_ *= mu_*dt_;
+        y0_ += rhs_;
+        map_->apply_to(tmp_, rhs_);
+        rhs_ *= (0.5-mu_)*dt_;
+        y0_ += rhs_;
+        bcSet_.applyAfterApplying(y0_);
 
         for (Size i=0; i < map_->size(); ++i) {
-            Array rhs = yt - theta_*dt_*map_->apply_direction(i, a);
-            yt = map_->solve_splitting(i, rhs, -theta_*dt_);
+            map_->apply_direction_to(i, a, rhs_);
+            rhs_ *= -theta_*dt_;
+            rhs_ += y0_;
+            map_->solve_splitting_to(i, rhs_, -theta_*dt_, y0_);
         }
-        bcSet_.applyAfterSolving(yt);
+        bcSet_.applyAfterSolving(y0_);
 
-        a = yt;
+        std::copy(y0_.begin(), y0_.end(), a.begin());
     }
 
     void ModifiedCraigSneydScheme::setStep(Time dt) {
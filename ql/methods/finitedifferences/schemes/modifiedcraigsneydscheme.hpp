@@ -61,6 +61,8 @@ namespace QuantLib {
         const Real mu_;
         const ext::shared_ptr<FdmLinearOpComposite> map_;
         const BoundaryConditionSchemeHelper bcSet_;
+        // workspace, allocated at the first step
+        Array y_, y0_, rhs_, tmp_;
     };
 }
 
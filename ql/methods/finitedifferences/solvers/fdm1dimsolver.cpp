@@ -29,16 +29,43 @@
 
 namespace QuantLib {
 
+    namespace {
+
+        ext::shared_ptr<FdmStepConditionComposite> joinedConditions(
+            const ext::shared_ptr<FdmSnapshotCondition>& thetaCondition,
+            const ext::shared_ptr<FdmTangentSensitivityCondition>& tangent,
+            const ext::shared_ptr<FdmStepConditionComposite>& condition) {
+
+            if (tangent == nullptr)
+                return FdmStepConditionComposite::joinConditions(
+                    thetaCondition, condition);
+
+            // the tangent condition applies the original conditions
+            return FdmStepConditionComposite::joinConditions(
+                thetaCondition,
+                ext::make_shared<FdmStepConditionComposite>(
+                    std::list<std::vector<Time> >(
+                        1, condition->stoppingTimes()),
+                    FdmStepConditionComposite::Conditions(1, tangent)));
+        }
+    }
+
     Fdm1DimSolver::Fdm1DimSolver(const FdmSolverDesc& solverDesc,
                                  const FdmSchemeDesc& schemeDesc,
-                                 ext::shared_ptr<FdmLinearOpComposite> op)
+                                 ext::shared_ptr<FdmLinearOpComposite> op,
+                                 FdmTangentSensitivityCondition::Source tangentSource)
     : solverDesc_(solverDesc), schemeDesc_(schemeDesc), op_(std::move(op)),
       thetaCondition_(ext::make_shared<FdmSnapshotCondition>(
           0.99 * std::min(1.0 / 365.0,
                           solverDesc.condition->stoppingTimes().empty() ?
                               solverDesc.maturity :
                               solverDesc.condition->stoppingTimes().front()))),
-      conditions_(FdmStepConditionComposite::joinConditions(thetaCondition_, solverDesc.condition)),
+      tangentCondition_((tangentSource
+                         && FdmTangentSensitivityCondition::isSupported(schemeDesc)) ?
+          ext::make_shared<FdmTangentSensitivityCondition>(
+              op_, std::move(tangentSource), solverDesc.condition, schemeDesc) :
+          ext::shared_ptr<FdmTangentSensitivityCondition>()),
+      conditions_(joinedConditions(thetaCondition_, tangentCondition_, solverDesc.condition)),
       x_(solverDesc.mesher->layout()->size()), initialValues_(solverDesc.mesher->layout()->size()),
       resultValues_(solverDesc.mesher->layout()->size()) {
 
@@ -55,6 +82,16 @@ namespace QuantLib {
         Array rhs(initialValues_.size());
         std::copy(initialValues_.begin(), initialValues_.end(), rhs.begin());
 
+        if (tangentCondition_ != nullptr) {
+            // as in FdmBackwardSolver::rollback
+            const Time dampingTo = (solverDesc_.dampingSteps != 0U)
+                ? Time(solverDesc_.maturity
+                       - (solverDesc_.maturity*solverDesc_.dampingSteps)
+                         /(solverDesc_.timeSteps + solverDesc_.dampingSteps))
+                : Null<Time>();
+            tangentCondition_->reset(rhs, solverDesc_.maturity, dampingTo);
+        }
+
         FdmBackwardSolver(op_, solverDesc_.bcSet, conditions_, schemeDesc_)
             .rollback(rhs, solverDesc_.maturity, 0.0,
                       solverDesc_.timeSteps, solverDesc_.dampingSteps);
@@ -62,6 +99,12 @@ namespace QuantLib {
         std::copy(rhs.begin(), rhs.end(), resultValues_.begin());
         interpolation_ = ext::make_shared<MonotonicCubicNaturalSpline>(x_.begin(), x_.end(),
                                         resultValues_.begin());
+
+        if (tangentCondition_ != nullptr) {
+            tangentValues_ = tangentCondition_->getValues();
+            tangentInterpolation_ = ext::make_shared<CubicNaturalSpline>(
+                x_.begin(), x_.end(), tangentValues_.begin());
+        }
     }
 
     Real Fdm1DimSolver::interpolateAt(Real x) const {
@@ -94,4 +137,12 @@ namespace QuantLib {
         calculate();
         return interpolation_->secondDerivative(x);
     }
+
+    Real Fdm1DimSolver::tangentAt(Real x) const {
+        if (tangentCondition_ == nullptr)
+            return Null<Real>();
+
+        calculate();
+        return (*tangentInterpolation_)(x);
+    }
 }
@@ -28,6 +28,7 @@
 #include <patterns/lazyobject.hpp>
 #include <methods/finitedifferences/solvers/fdmsolverdesc.hpp>
 #include <methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
+#include <methods/finitedifferences/stepconditions/fdmtangentsensitivitycondition.hpp>
 
 
 namespace QuantLib {
@@ -39,7 +40,9 @@ namespace QuantLib {
       public:
         Fdm1DimSolver(const FdmSolverDesc& solverDesc,
                       const FdmSchemeDesc& schemeDesc,
-                      ext::shared_ptr<FdmLinearOpComposite> op);
+                      ext::shared_ptr<FdmLinearOpComposite> op,
+                      FdmTangentSensitivityCondition::Source tangentSource
+                          = FdmTangentSensitivityCondition::Source());
 
         Real interpolateAt(Real x) const;
         Real thetaAt(Real x) const;
@@ -47,6 +50,13 @@ namespace QuantLib {
         Real derivativeX(Real x) const;
         Real derivativeXX(Real x) const;
 
+        //! sensitivity w.r.t. the parameter of the tangent source term
+        /*! returns Null<Real>() if no tangent source was given or if
+            the scheme is not supported, see
+            FdmTangentSensitivityCondition::isSupported().
+        */
+        Real tangentAt(Real x) const;
+
       protected:
         void performCalculations() const override;
 
@@ -56,11 +66,14 @@ namespace QuantLib {
         const ext::shared_ptr<FdmLinearOpComposite> op_;
 
         const ext::shared_ptr<FdmSnapshotCondition> thetaCondition_;
+        const ext::shared_ptr<FdmTangentSensitivityCondition> tangentCondition_;
         const ext::shared_ptr<FdmStepConditionComposite> conditions_;
 
         std::vector<Real> x_, initialValues_;
         mutable Array resultValues_;
         mutable ext::shared_ptr<CubicInterpolation> interpolation_;
+        mutable Array tangentValues_;
+        mutable ext::shared_ptr<CubicInterpolation> tangentInterpolation_;
     };
 }
 
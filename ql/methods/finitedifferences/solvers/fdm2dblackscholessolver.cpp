@@ -57,16 +57,16 @@ namespace QuantLib {
 
     Real Fdm2dBlackScholesSolver::valueAt(Real u, Real v) const {
         calculate();
-        const Real x = std::log(u);
-        const Real y = std::log(v);
+        const Real x = log(u);
+        const Real y = log(v);
 
         return solver_->interpolateAt(x, y);
     }
     
     Real Fdm2dBlackScholesSolver::thetaAt(Real u, Real v) const {
         calculate();
-        const Real x = std::log(u);
-        const Real y = std::log(v);
+        const Real x = log(u);
+        const Real y = log(v);
         return solver_->thetaAt(x, y);
     }
 
@@ -74,8 +74,8 @@ namespace QuantLib {
     Real Fdm2dBlackScholesSolver::deltaXat(Real u, Real v) const {
         calculate();
 
-        const Real x = std::log(u);
-        const Real y = std::log(v);
+        const Real x = log(u);
+        const Real y = log(v);
 
         return solver_->derivativeX(x, y)/u;
     }
@@ -83,8 +83,8 @@ namespace QuantLib {
     Real Fdm2dBlackScholesSolver::deltaYat(Real u, Real v) const {
         calculate();
 
-        const Real x = std::log(u);
-        const Real y = std::log(v);
+        const Real x = log(u);
+        const Real y = log(v);
 
         return solver_->derivativeY(x, y)/v;
     }
@@ -92,8 +92,8 @@ namespace QuantLib {
     Real Fdm2dBlackScholesSolver::gammaXat(Real u, Real v) const {
         calculate();
         
-        const Real x = std::log(u);
-        const Real y = std::log(v);
+        const Real x = log(u);
+        const Real y = log(v);
         
         return (solver_->derivativeXX(x, y)
                 -solver_->derivativeX(x, y))/(u*u);
@@ -102,8 +102,8 @@ namespace QuantLib {
     Real Fdm2dBlackScholesSolver::gammaYat(Real u, Real v) const {
         calculate();
         
-        const Real x = std::log(u);
-        const Real y = std::log(v);
+        const Real x = log(u);
+        const Real y = log(v);
         
         return (solver_->derivativeYY(x, y)
                 -solver_->derivativeY(x, y))/(v*v);
@@ -112,8 +112,8 @@ namespace QuantLib {
     Real Fdm2dBlackScholesSolver::gammaXYat(Real u, Real v) const {
         calculate();
 
-        const Real x = std::log(u);
-        const Real y = std::log(v);
+        const Real x = log(u);
+        const Real y = log(v);
 
         return solver_->derivativeXY(x, y)/(u*v);
     }
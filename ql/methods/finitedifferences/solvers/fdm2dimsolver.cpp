@@ -29,16 +29,43 @@
 
 namespace QuantLib {
 
+    namespace {
+
+        ext::shared_ptr<FdmStepConditionComposite> joinedConditions(
+            const ext::shared_ptr<FdmSnapshotCondition>& thetaCondition,
+            const ext::shared_ptr<FdmTangentSensitivityCondition>& tangent,
+            const ext::shared_ptr<FdmStepConditionComposite>& condition) {
+
+            if (tangent == nullptr)
+                return FdmStepConditionComposite::joinConditions(
+                    thetaCondition, condition);
+
+            // the tangent condition applies the original conditions
+            return FdmStepConditionComposite::joinConditions(
+                thetaCondition,
+                ext::make_shared<FdmStepConditionComposite>(
+                    std::list<std::vector<Time> >(
+                        1, condition->stoppingTimes()),
+                    FdmStepConditionComposite::Conditions(1, tangent)));
+        }
+    }
+
     Fdm2DimSolver::Fdm2DimSolver(const FdmSolverDesc& solverDesc,
                                  const FdmSchemeDesc& schemeDesc,
-                                 ext::shared_ptr<FdmLinearOpComposite> op)
+                                 ext::shared_ptr<FdmLinearOpComposite> op,
+                                 FdmTangentSensitivityCondition::Source tangentSource)
     : solverDesc_(solverDesc), schemeDesc_(schemeDesc), op_(std::move(op)),
       thetaCondition_(ext::make_shared<FdmSnapshotCondition>(
           0.99 * std::min(1.0 / 365.0,
                           solverDesc.condition->stoppingTimes().empty() ?
                               solverDesc.maturity :
                               solverDesc.condition->stoppingTimes().front()))),
-      conditions_(FdmStepConditionComposite::joinConditions(thetaCondition_, solverDesc.condition)),
+      tangentCondition_((tangentSource
+                         && FdmTangentSensitivityCondition::isSupported(schemeDesc)) ?
+          ext::make_shared<FdmTangentSensitivityCondition>(
+              op_, std::move(tangentSource), solverDesc.condition, schemeDesc) :
+          ext::shared_ptr<FdmTangentSensitivityCondition>()),
+      conditions_(joinedConditions(thetaCondition_, tangentCondition_, solverDesc.condition)),
       initialValues_(solverDesc.mesher->layout()->size()),
       resultValues_(solverDesc.mesher->layout()->dim()[1], solverDesc.mesher->layout()->dim()[0]) {
 
@@ -64,6 +91,16 @@ namespace QuantLib {
         Array rhs(initialValues_.size());
         std::copy(initialValues_.begin(), initialValues_.end(), rhs.begin());
 
+        if (tangentCondition_ != nullptr) {
+            // as in FdmBackwardSolver::rollback
+            const Time dampingTo = (solverDesc_.dampingSteps != 0U)
+                ? Time(solverDesc_.maturity
+                       - (solverDesc_.maturity*solverDesc_.dampingSteps)
+                         /(solverDesc_.timeSteps + solverDesc_.dampingSteps))
+                : Null<Time>();
+            tangentCondition_->reset(rhs, solverDesc_.maturity, dampingTo);
+        }
+
         FdmBackwardSolver(op_, solverDesc_.bcSet, conditions_, schemeDesc_)
             .rollback(rhs, solverDesc_.maturity, 0.0,
                       solverDesc_.timeSteps, solverDesc_.dampingSteps);
@@ -72,6 +109,14 @@ namespace QuantLib {
         interpolation_ = ext::make_shared<BicubicSpline>(x_.begin(), x_.end(),
                               y_.begin(), y_.end(),
                               resultValues_);
+
+        if (tangentCondition_ != nullptr) {
+            const Array& tangent = tangentCondition_->getValues();
+            tangentValues_ = Matrix(resultValues_.rows(), resultValues_.columns());
+            std::copy(tangent.begin(), tangent.end(), tangentValues_.begin());
+            tangentInterpolation_ = ext::make_shared<BicubicSpline>(
+                x_.begin(), x_.end(), y_.begin(), y_.end(), tangentValues_);
+        }
     }
 
     Real Fdm2DimSolver::interpolateAt(Real x, Real y) const {
@@ -120,4 +165,11 @@ namespace QuantLib {
         return interpolation_->derivativeXY(x, y);
     }
 
+    Real Fdm2DimSolver::tangentAt(Real x, Real y) const {
+        if (tangentCondition_ == nullptr)
+            return Null<Real>();
+
+        calculate();
+        return (*tangentInterpolation_)(x, y);
+    }
 }
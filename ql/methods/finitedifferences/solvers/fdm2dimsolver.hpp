@@ -28,6 +28,7 @@
 #include <patterns/lazyobject.hpp>
 #include <methods/finitedifferences/solvers/fdmsolverdesc.hpp>
 #include <methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
+#include <methods/finitedifferences/stepconditions/fdmtangentsensitivitycondition.hpp>
 
 
 namespace QuantLib {
@@ -39,7 +40,9 @@ namespace QuantLib {
       public:
         Fdm2DimSolver(const FdmSolverDesc& solverDesc,
                       const FdmSchemeDesc& schemeDesc,
-                      ext::shared_ptr<FdmLinearOpComposite> op);
+                      ext::shared_ptr<FdmLinearOpComposite> op,
+                      FdmTangentSensitivityCondition::Source tangentSource
+                          = FdmTangentSensitivityCondition::Source());
 
         Real interpolateAt(Real x, Real y) const;
         Real thetaAt(Real x, Real y) const;
@@ -50,6 +53,13 @@ namespace QuantLib {
         Real derivativeYY(Real x, Real y) const;
         Real derivativeXY(Real x, Real y) const;
 
+        //! sensitivity w.r.t. the parameter of the tangent source term
+        /*! returns Null<Real>() if no tangent source was given or if
+            the scheme is not supported, see
+            FdmTangentSensitivityCondition::isSupported().
+        */
+        Real tangentAt(Real x, Real y) const;
+
       protected:
         void performCalculations() const override;
 
@@ -59,11 +69,14 @@ namespace QuantLib {
         const ext::shared_ptr<FdmLinearOpComposite> op_;
 
         const ext::shared_ptr<FdmSnapshotCondition> thetaCondition_;
+        const ext::shared_ptr<FdmTangentSensitivityCondition> tangentCondition_;
         const ext::shared_ptr<FdmStepConditionComposite> conditions_;
 
         std::vector<Real> x_, y_, initialValues_;
         mutable Matrix resultValues_;
         mutable ext::shared_ptr<BicubicSpline> interpolation_;
+        mutable Matrix tangentValues_;
+        mutable ext::shared_ptr<BicubicSpline> tangentInterpolation_;
     };
 }
 
@@ -35,13 +35,270 @@
 #include <methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
 #include <methods/finitedifferences/stepconditions/fdmstepconditioncomposite.hpp>
 #include <mathconstants.hpp>
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 
 namespace QuantLib {
-    
-    FdmSchemeDesc::FdmSchemeDesc(FdmSchemeType aType, Real aTheta, Real aMu)
-    : type(aType), theta(aTheta), mu(aMu) { }
+
+    namespace {
+
+        // calls f(j, column) on each of the columns of length n stacked
+        // in a, copying them in and out of the given buffer
+        template <class F>
+        void forEachColumn(Array& a, Size n, Array& buffer, const F& f) {
+            buffer.resize(n);
+            for (Size j=0; j < a.size()/n; ++j) {
+                const Array::iterator begin = a.begin() + j*n;
+                std::copy(begin, begin + n, buffer.begin());
+                f(j, buffer);
+                std::copy(buffer.begin(), buffer.end(), begin);
+            }
+        }
+
+        // block-diagonal operator acting on stacked columns
+        class FdmBatchOp : public FdmLinearOpComposite {
+          public:
+            FdmBatchOp(ext::shared_ptr<FdmLinearOpComposite> op, Size n)
+            : op_(std::move(op)), n_(n) {}
+
+            Size size() const override { return op_->size(); }
+            void setTime(Time t1, Time t2) override { op_->setTime(t1, t2); }
+
+            Array apply(const Array& r) const override {
+                Array retVal;
+                apply_to(r, retVal);
+                return retVal;
+            }
+            Array apply_mixed(const Array& r) const override {
+                Array retVal;
+                apply_mixed_to(r, retVal);
+                return retVal;
+            }
+            Array apply_direction(Size direction, const Array& r) const override {
+                Array retVal;
+                apply_direction_to(direction, r, retVal);
+                return retVal;
+            }
+            Array solve_splitting(Size direction, const Array& r, Real s) const override {
+                Array retVal;
+                solve_splitting_to(direction, r, s, retVal);
+                return retVal;
+            }
+            Array preconditioner(const Array& r, Real s) const override {
+                Array retVal = r;
+                forEachColumn(retVal, n_, x_, [&](Size, Array& x) {
+                    x = op_->preconditioner(x, s);
+                });
+                return retVal;
+            }
+
+            void apply_to(const Array& r, Array& out) const override {
+                map(r, out, [&](const Array& x, Array& y) { op_->apply_to(x, y); });
+            }
+            void apply_mixed_to(const Array& r, Array& out) const override {
+                map(r, out, [&](const Array& x, Array& y) { op_->apply_mixed_to(x, y); });
+            }
+            void apply_direction_to(Size direction, const Array& r, Array& out) const override {
+                map(r, out, [&](const Array& x, Array& y) {
+                    op_->apply_direction_to(direction, x, y);
+                });
+            }
+            void solve_splitting_to(Size direction, const Array& r, Real s, Array& out) const override {
+                // one elimination for all the columns, where supported
+                op_->solve_splitting_columns_to(direction, r, s, out, n_);
+            }
+
+          private:
+            template <class F>
+            void map(const Array& r, Array& out, const F& f) const {
+                QL_REQUIRE(r.size() % n_ == 0, "inconsistent array size");
+                x_.resize(n_);
+                out.resize(r.size());
+                for (Size j=0; j < r.size()/n_; ++j) {
+                    std::copy(r.begin() + j*n_, r.begin() + (j+1)*n_, x_.begin());
+                    f(x_, y_);
+                    std::copy(y_.begin(), y_.end(), out.begin() + j*n_);
+                }
+            }
+
+            const ext::shared_ptr<FdmLinearOpComposite> op_;
+            const Size n_;
+            mutable Array x_, y_;
+        };
+
+        // applies a boundary condition to each of the stacked columns
+        class FdmBatchBoundaryCondition : public BoundaryCondition<FdmLinearOp> {
+          public:
+            FdmBatchBoundaryCondition(ext::shared_ptr<BoundaryCondition<FdmLinearOp> > bc,
+                                      ext::shared_ptr<FdmLinearOpComposite> op,
+                                      Size n)
+            : bc_(std::move(bc)), op_(std::move(op)), n_(n) {}
+
+            void applyBeforeApplying(operator_type&) const override {
+                bc_->applyBeforeApplying(*op_);
+            }
+            void applyAfterApplying(array_type& a) const override {
+                forEachColumn(a, n_, x_, [&](Size, Array& x) {
+                    bc_->applyAfterApplying(x);
+                });
+            }
+            void applyBeforeSolving(operator_type&, array_type& rhs) const override {
+                forEachColumn(rhs, n_, x_, [&](Size, Array& x) {
+                    bc_->applyBeforeSolving(*op_, x);
+                });
+            }
+            void applyAfterSolving(array_type& a) const override {
+                forEachColumn(a, n_, x_, [&](Size, Array& x) {
+                    bc_->applyAfterSolving(x);
+                });
+            }
+            void setTime(Time t) override { bc_->setTime(t); }
+
+          private:
+            const ext::shared_ptr<BoundaryCondition<FdmLinearOp> > bc_;
+            const ext::shared_ptr<FdmLinearOpComposite> op_;
+            const Size n_;
+            mutable Array x_;
+        };
+
+        // applies the common and the column-specific step conditions
+        class FdmBatchStepCondition : public StepCondition<Array> {
+          public:
+            FdmBatchStepCondition(
+                ext::shared_ptr<FdmStepConditionComposite> common,
+                std::vector<ext::shared_ptr<FdmStepConditionComposite> > conditions,
+                Size n)
+            : common_(std::move(common)), conditions_(std::move(conditions)), n_(n) {}
+
+            void applyTo(Array& a, Time t) const override {
+                forEachColumn(a, n_, x_, [&](Size j, Array& x) {
+                    common_->applyTo(x, t);
+                    if (!conditions_.empty())
+                        conditions_[j]->applyTo(x, t);
+                });
+            }
+
+          private:
+            const ext::shared_ptr<FdmStepConditionComposite> common_;
+            const std::vector<ext::shared_ptr<FdmStepConditionComposite> > conditions_;
+            const Size n_;
+            mutable Array x_;
+        };
+
+        // rolls back with step sizes controlled by step doubling, see
+        // FdmSchemeDesc::withAdaptiveTimeStepping(). Stops after maxSteps
+        // accepted steps, if given, and returns the time reached.
+        template <class Evolver>
+        Time adaptiveRollback(Evolver& evolver, Array& a,
+                              Time from, Time to, Time initialStep,
+                              Real tolerance, Size order,
+                              const FdmStepConditionComposite& condition,
+                              Size maxSteps = Null<Size>()) {
+            QL_REQUIRE(from >= to,
+                       "trying to roll back from " << from << " to " << to);
+            QL_REQUIRE(tolerance > 0.0,
+                       "positive tolerance required, " << tolerance << " given");
+
+            std::vector<Time> stoppingTimes = condition.stoppingTimes();
+            std::sort(stoppingTimes.begin(), stoppingTimes.end());
+
+            if (!stoppingTimes.empty() && stoppingTimes.back() == from)
+                condition.applyTo(a, from);
+
+            const Time eps = sqrt(QL_EPSILON);
+            const Time minStep = 1e-8*std::max(Time(1.0), from-to);
+            const Size maxAttempts = 1000000;
+            const Real exponent = 1.0/(order + 1.0);
+
+            Array full, half;
+            Time t = from, h = std::max(initialStep, minStep);
+            for (Size attempts=0, steps=0;
+                 t - to > eps && (maxSteps == Null<Size>() || steps < maxSteps);
+                 ++attempts) {
+                QL_REQUIRE(attempts < maxAttempts,
+                           "maximum number of adaptive time steps exceeded");
+
+                // the next stopping time is hit exactly, and a small
+                // remainder in front of it is avoided
+                const auto iter = std::lower_bound(
+                    stoppingTimes.begin(), stoppingTimes.end(), t - eps);
+                const Time target = (iter != stoppingTimes.begin())
+                    ? std::max(to, *(iter-1)) : to;
+
+                const Time dt = (t - h < target + 0.25*h) ? t - target : h;
+                const Time next = (dt == t - target) ? target : t - dt;
+
+                full = a;
+                evolver.setStep(dt);
+                evolver.step(full, t);
+                condition.applyTo(full, next);
+
+                half = a;
+                evolver.setStep(0.5*dt);
+                evolver.step(half, t);
+                condition.applyTo(half, t - 0.5*dt);
+                evolver.step(half, t - 0.5*dt);
+                condition.applyTo(half, next);
+
+                Real error = 0.0, norm = 1.0;
+                for (Size i=0; i < a.size(); ++i) {
+                    error = std::max(error, Real(fabs(half[i] - full[i])));
+                    norm = std::max(norm, Real(fabs(half[i])));
+                }
+                error /= norm;
+
+                const bool accepted = (error <= tolerance || dt <= minStep);
+                if (accepted) {
+                    a.swap(half);
+                    t = next;
+                    ++steps;
+                }
+
+                // a rejected step must shrink enough to not be
+                // stretched to the same stopping time again
+                const Real factor = (error > 0.0)
+                    ? Real(0.9*pow(tolerance/error, exponent)) : Real(4.0);
+                h = std::max(minStep, dt*std::max(Real(0.2),
+                    std::min(accepted ? Real(4.0) : Real(0.7), factor)));
+            }
+            return t;
+        }
+
+        template <class Evolver>
+        void rollbackWith(Evolver& evolver, Array& a,
+                          Time from, Time to, Size steps,
+                          const FdmStepConditionComposite& condition,
+                          const FdmSchemeDesc& schemeDesc) {
+            if (schemeDesc.adaptiveTolerance == Null<Real>()) {
+                FiniteDifferenceModel<Evolver>
+                    model(evolver, condition.stoppingTimes());
+                model.rollback(a, from, to, steps, condition);
+            }
+            else {
+                const Size order =
+                    (   schemeDesc.type == FdmSchemeDesc::ImplicitEulerType
+                     || schemeDesc.type == FdmSchemeDesc::ExplicitEulerType)
+                    ? 1 : 2;
+                adaptiveRollback(evolver, a, from, to, (from-to)/steps,
+                                 schemeDesc.adaptiveTolerance, order,
+                                 condition);
+            }
+        }
+
+    }
+
+    FdmSchemeDesc::FdmSchemeDesc(FdmSchemeType aType, Real aTheta, Real aMu,
+                                 Real aAdaptiveTolerance)
+    : type(aType), theta(aTheta), mu(aMu),
+      adaptiveTolerance(aAdaptiveTolerance) { }
+
+    FdmSchemeDesc FdmSchemeDesc::withAdaptiveTimeStepping(Real tolerance) const {
+        QL_REQUIRE(tolerance > 0.0,
+                   "positive tolerance required, " << tolerance << " given");
+        return {type, theta, mu, tolerance};
+    }
 
     FdmSchemeDesc FdmSchemeDesc::Douglas() { return {FdmSchemeDesc::DouglasType, 0.5, 0.0}; }
 
@@ -56,11 +313,11 @@ namespace QuantLib {
     }
     
     FdmSchemeDesc FdmSchemeDesc::Hundsdorfer() {
-        return {FdmSchemeDesc::HundsdorferType, 0.5 + std::sqrt(3.0) / 6, 0.5};
+        return {FdmSchemeDesc::HundsdorferType, 0.5 + sqrt(3.0) / 6, 0.5};
     }
     
     FdmSchemeDesc FdmSchemeDesc::ModifiedHundsdorfer() {
-        return {FdmSchemeDesc::HundsdorferType, 1.0 - std::sqrt(2.0) / 2, 0.5};
+        return {FdmSchemeDesc::HundsdorferType, 1.0 - sqrt(2.0) / 2, 0.5};
     }
     
     FdmSchemeDesc FdmSchemeDesc::ExplicitEuler() {
@@ -95,14 +352,24 @@ namespace QuantLib {
 
         const Time deltaT = from - to;
         const Size allSteps = steps + dampingSteps;
-        const Time dampingTo = from - (deltaT*dampingSteps)/allSteps;
+        Time dampingTo = from - (deltaT*dampingSteps)/allSteps;
 
         if ((dampingSteps != 0U) && schemeDesc_.type != FdmSchemeDesc::ImplicitEulerType) {
             ImplicitEulerScheme implicitEvolver(map_, bcSet_);    
-            FiniteDifferenceModel<ImplicitEulerScheme> 
-                    dampingModel(implicitEvolver, condition_->stoppingTimes());
-            dampingModel.rollback(rhs, from, dampingTo, 
-                                  dampingSteps, *condition_);
+            if (schemeDesc_.adaptiveTolerance == Null<Real>()) {
+                FiniteDifferenceModel<ImplicitEulerScheme> 
+                        dampingModel(implicitEvolver, condition_->stoppingTimes());
+                dampingModel.rollback(rhs, from, dampingTo, 
+                                      dampingSteps, *condition_);
+            }
+            else {
+                // the damping steps are error-controlled as well,
+                // otherwise their first-order error would dominate
+                dampingTo = adaptiveRollback(
+                    implicitEvolver, rhs, from, to, deltaT/allSteps,
+                    schemeDesc_.adaptiveTolerance, 1, *condition_,
+                    dampingSteps);
+            }
         }
 
         switch (schemeDesc_.type) {
@@ -110,35 +377,30 @@ namespace QuantLib {
             {
                 HundsdorferScheme hsEvolver(schemeDesc_.theta, schemeDesc_.mu, 
                                             map_, bcSet_);
-                FiniteDifferenceModel<HundsdorferScheme> 
-                               hsModel(hsEvolver, condition_->stoppingTimes());
-                hsModel.rollback(rhs, dampingTo, to, steps, *condition_);
+                rollbackWith(hsEvolver, rhs, dampingTo, to, steps,
+                             *condition_, schemeDesc_);
             }
             break;
           case FdmSchemeDesc::DouglasType:
             {
                 DouglasScheme dsEvolver(schemeDesc_.theta, map_, bcSet_);
-                FiniteDifferenceModel<DouglasScheme> 
-                               dsModel(dsEvolver, condition_->stoppingTimes());
-                dsModel.rollback(rhs, dampingTo, to, steps, *condition_);
+                rollbackWith(dsEvolver, rhs, dampingTo, to, steps,
+                             *condition_, schemeDesc_);
             }
             break;
           case FdmSchemeDesc::CrankNicolsonType:
             {
               CrankNicolsonScheme cnEvolver(schemeDesc_.theta, map_, bcSet_);
-              FiniteDifferenceModel<CrankNicolsonScheme>
-                             cnModel(cnEvolver, condition_->stoppingTimes());
-              cnModel.rollback(rhs, dampingTo, to, steps, *condition_);
-
+              rollbackWith(cnEvolver, rhs, dampingTo, to, steps,
+                           *condition_, schemeDesc_);
             }
             break;
           case FdmSchemeDesc::CraigSneydType:
             {
                 CraigSneydScheme csEvolver(schemeDesc_.theta, schemeDesc_.mu, 
                                            map_, bcSet_);
-                FiniteDifferenceModel<CraigSneydScheme> 
-                               csModel(csEvolver, condition_->stoppingTimes());
-                csModel.rollback(rhs, dampingTo, to, steps, *condition_);
+                rollbackWith(csEvolver, rhs, dampingTo, to, steps,
+                             *condition_, schemeDesc_);
             }
             break;
           case FdmSchemeDesc::ModifiedCraigSneydType:
@@ -146,34 +408,30 @@ namespace QuantLib {
                 ModifiedCraigSneydScheme csEvolver(schemeDesc_.theta, 
                                                    schemeDesc_.mu,
                                                    map_, bcSet_);
-                FiniteDifferenceModel<ModifiedCraigSneydScheme> 
-                              mcsModel(csEvolver, condition_->stoppingTimes());
-                mcsModel.rollback(rhs, dampingTo, to, steps, *condition_);
+                rollbackWith(csEvolver, rhs, dampingTo, to, steps,
+                             *condition_, schemeDesc_);
             }
             break;
           case FdmSchemeDesc::ImplicitEulerType:
             {
                 ImplicitEulerScheme implicitEvolver(map_, bcSet_);
-                FiniteDifferenceModel<ImplicitEulerScheme> 
-                   implicitModel(implicitEvolver, condition_->stoppingTimes());
-                implicitModel.rollback(rhs, from, to, allSteps, *condition_);
+                rollbackWith(implicitEvolver, rhs, from, to, allSteps,
+                             *condition_, schemeDesc_);
             }
             break;
           case FdmSchemeDesc::ExplicitEulerType:
             {
                 ExplicitEulerScheme explicitEvolver(map_, bcSet_);
-                FiniteDifferenceModel<ExplicitEulerScheme> 
-                   explicitModel(explicitEvolver, condition_->stoppingTimes());
-                explicitModel.rollback(rhs, dampingTo, to, steps, *condition_);
+                rollbackWith(explicitEvolver, rhs, dampingTo, to, steps,
+                             *condition_, schemeDesc_);
             }
             break;
           case FdmSchemeDesc::MethodOfLinesType:
             {
                 MethodOfLinesScheme methodOfLines(
                     schemeDesc_.theta, schemeDesc_.mu, map_, bcSet_);
-                FiniteDifferenceModel<MethodOfLinesScheme>
-                   molModel(methodOfLines, condition_->stoppingTimes());
-                molModel.rollback(rhs, dampingTo, to, steps, *condition_);
+                rollbackWith(methodOfLines, rhs, dampingTo, to, steps,
+                             *condition_, schemeDesc_);
             }
             break;
           case FdmSchemeDesc::TrBDF2Type:
@@ -188,13 +446,56 @@ namespace QuantLib {
                 TrBDF2Scheme<CraigSneydScheme> trBDF2(
                     schemeDesc_.theta, map_, hsEvolver, bcSet_,schemeDesc_.mu);
 
-                FiniteDifferenceModel<TrBDF2Scheme<CraigSneydScheme> >
-                   trBDF2Model(trBDF2, condition_->stoppingTimes());
-                trBDF2Model.rollback(rhs, dampingTo, to, steps, *condition_);
+                rollbackWith(trBDF2, rhs, dampingTo, to, steps,
+                             *condition_, schemeDesc_);
             }
             break;
           default:
             QL_FAIL("Unknown scheme type");
         }
     }
+
+    void FdmBackwardSolver::rollback(
+        std::vector<array_type>& a,
+        Time from, Time to,
+        Size steps, Size dampingSteps,
+        const std::vector<ext::shared_ptr<FdmStepConditionComposite> >& conditions) {
+
+        QL_REQUIRE(!a.empty(), "no arrays given");
+        QL_REQUIRE(conditions.empty() || conditions.size() == a.size(),
+                   "wrong number of step conditions (" << conditions.size()
+                   << ") for " << a.size() << " arrays");
+
+        const Size n = a.front().size();
+        QL_REQUIRE(n > 0, "empty arrays given");
+        for (const auto& column : a)
+            QL_REQUIRE(column.size() == n, "arrays must have the same size");
+
+        Array stacked(n*a.size());
+        for (Size j=0; j < a.size(); ++j)
+            std::copy(a[j].begin(), a[j].end(), stacked.begin() + j*n);
+
+        FdmBoundaryConditionSet bcSet;
+        bcSet.reserve(bcSet_.size());
+        for (const auto& bc : bcSet_)
+            bcSet.push_back(
+                ext::make_shared<FdmBatchBoundaryCondition>(bc, map_, n));
+
+        std::list<std::vector<Time> > stoppingTimes(1, condition_->stoppingTimes());
+        for (const auto& c : conditions) {
+            QL_REQUIRE(c != nullptr, "null step condition given");
+            stoppingTimes.push_back(c->stoppingTimes());
+        }
+        const FdmStepConditionComposite::Conditions batchCondition(
+            1, ext::make_shared<FdmBatchStepCondition>(condition_, conditions, n));
+
+        FdmBackwardSolver(ext::make_shared<FdmBatchOp>(map_, n), bcSet,
+                          ext::make_shared<FdmStepConditionComposite>(
+                              stoppingTimes, batchCondition),
+                          schemeDesc_)
+            .rollback(stacked, from, to, steps, dampingSteps);
+
+        for (Size j=0; j < a.size(); ++j)
+            std::copy(stacked.begin() + j*n, stacked.begin() + (j+1)*n, a[j].begin());
+    }
 }
@@ -26,6 +26,7 @@
 #define quantlib_fdm_backward_solver_hpp
 
 #include <methods/finitedifferences/utilities/fdmboundaryconditionset.hpp>
+#include <utilities/null.hpp>
 
 namespace QuantLib {
 
@@ -39,10 +40,25 @@ namespace QuantLib {
                              MethodOfLinesType, TrBDF2Type,
                              CrankNicolsonType };
 
-        FdmSchemeDesc(FdmSchemeType type, Real theta, Real mu);
+        FdmSchemeDesc(FdmSchemeType type, Real theta, Real mu,
+                      Real adaptiveTolerance = Null<Real>());
 
         const FdmSchemeType type;
         const Real theta, mu;
+        //! tolerance of the adaptive time stepping, Null if disabled
+        const Real adaptiveTolerance;
+
+        /*! returns a copy of this description with adaptive time
+            stepping enabled.  Each time step is then compared with
+            two steps of half the size and the step size is chosen
+            such that the local error estimate, measured in the
+            maximum norm relative to the maximum norm of the
+            solution (or absolute, if the latter is smaller than
+            one), stays below the given tolerance.  The number of
+            time steps given to the solver only sets the initial
+            step size; stopping times are still hit exactly.
+        */
+        FdmSchemeDesc withAdaptiveTimeStepping(Real tolerance) const;
 
         // some default scheme descriptions
         static FdmSchemeDesc Douglas(); //same as Crank-Nicolson in 1 dimension
@@ -71,6 +87,20 @@ namespace QuantLib {
                       Time from, Time to,
                       Size steps, Size dampingSteps);
 
+        /*! rolls back several arrays, e.g., the payoffs of a strike
+            ladder, on the same mesh and time grid.  The operator is
+            set up once per time step for all of them.  Besides the
+            condition passed to the constructor, the i-th element of
+            \c conditions (if any) is applied to the i-th array only;
+            each condition is also called at the stopping times of
+            the others.
+        */
+        void rollback(std::vector<array_type>& a,
+                      Time from, Time to,
+                      Size steps, Size dampingSteps,
+                      const std::vector<ext::shared_ptr<FdmStepConditionComposite> >&
+                          conditions = {});
+
       protected:
         const ext::shared_ptr<FdmLinearOpComposite> map_;
         const FdmBoundaryConditionSet bcSet_;
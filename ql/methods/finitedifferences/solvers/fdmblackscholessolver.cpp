@@ -33,44 +33,75 @@ namespace QuantLib {
                                                  const FdmSchemeDesc& schemeDesc,
                                                  bool localVol,
                                                  Real illegalLocalVolOverwrite,
-                                                 Handle<FdmQuantoHelper> quantoHelper)
+                                                 Handle<FdmQuantoHelper> quantoHelper,
+                                                 bool calculateVega)
     : process_(std::move(process)), strike_(strike), solverDesc_(std::move(solverDesc)),
       schemeDesc_(schemeDesc), localVol_(localVol),
-      illegalLocalVolOverwrite_(illegalLocalVolOverwrite), quantoHelper_(std::move(quantoHelper)) {
+      illegalLocalVolOverwrite_(illegalLocalVolOverwrite), quantoHelper_(std::move(quantoHelper)),
+      calculateVega_(calculateVega && !localVol_ && quantoHelper_.empty()) {
 
         registerWith(process_);
         registerWith(quantoHelper_);
     }
 
+    FdmBlackScholesSolver::FdmBlackScholesSolver(FdmSolverDesc solverDesc,
+                                                 const FdmSchemeDesc& schemeDesc,
+                                                 ext::shared_ptr<FdmLinearOpComposite> op,
+                                                 bool calculateVega)
+    : strike_(Null<Real>()), solverDesc_(std::move(solverDesc)),
+      schemeDesc_(schemeDesc), localVol_(false),
+      illegalLocalVolOverwrite_(-Null<Real>()), op_(std::move(op)),
+      calculateVega_(calculateVega) {
+        QL_REQUIRE(op_, "null operator given");
+    }
+
     void FdmBlackScholesSolver::performCalculations() const {
-            const ext::shared_ptr<FdmBlackScholesOp> op(
-            ext::make_shared<FdmBlackScholesOp>(
+        const ext::shared_ptr<FdmLinearOpComposite> op = (op_ != nullptr)
+            ? op_
+            : ext::make_shared<FdmBlackScholesOp>(
                 solverDesc_.mesher, process_.currentLink(), strike_,
                 localVol_, illegalLocalVolOverwrite_, 0,
                 (quantoHelper_.empty())
                     ? ext::shared_ptr<FdmQuantoHelper>()
-                    : quantoHelper_.currentLink()));
+                    : quantoHelper_.currentLink());
+
+        FdmTangentSensitivityCondition::Source vegaSource;
+        if (calculateVega_) {
+            const ext::shared_ptr<FdmBlackScholesOp> bsOp =
+                ext::dynamic_pointer_cast<FdmBlackScholesOp>(op);
+            QL_REQUIRE(bsOp, "vega requires a Black-Scholes operator");
 
-        solver_ = ext::make_shared<Fdm1DimSolver>(solverDesc_, schemeDesc_, op);
+            vegaSource = [bsOp](const Array& u, Time t1, Time t2) {
+                return bsOp->apply_vega(u, t1, t2);
+            };
+        }
+
+        solver_ = ext::make_shared<Fdm1DimSolver>(
+            solverDesc_, schemeDesc_, op, vegaSource);
     }
 
     Real FdmBlackScholesSolver::valueAt(Real s) const {
         calculate();
-        return solver_->interpolateAt(std::log(s));
+        return solver_->interpolateAt(log(s));
     }
 
     Real FdmBlackScholesSolver::deltaAt(Real s) const {
         calculate();
-        return solver_->derivativeX(std::log(s))/s;
+        return solver_->derivativeX(log(s))/s;
     }
 
     Real FdmBlackScholesSolver::gammaAt(Real s) const {
         calculate();
-        return (solver_->derivativeXX(std::log(s))
-                -solver_->derivativeX(std::log(s)))/(s*s);
+        return (solver_->derivativeXX(log(s))
+                -solver_->derivativeX(log(s)))/(s*s);
     }
 
     Real FdmBlackScholesSolver::thetaAt(Real s) const {
-        return solver_->thetaAt(std::log(s));
+        return solver_->thetaAt(log(s));
+    }
+
+    Real FdmBlackScholesSolver::vegaAt(Real s) const {
+        calculate();
+        return solver_->tangentAt(log(s));
     }
 }
@@ -34,6 +34,7 @@
 namespace QuantLib {
 
     class Fdm1DimSolver;
+    class FdmLinearOpComposite;
     class FdmSnapshotCondition;
     class GeneralizedBlackScholesProcess;
 
@@ -45,12 +46,28 @@ namespace QuantLib {
                               const FdmSchemeDesc& schemeDesc = FdmSchemeDesc::Douglas(),
                               bool localVol = false,
                               Real illegalLocalVolOverwrite = -Null<Real>(),
-                              Handle<FdmQuantoHelper> quantoHelper = Handle<FdmQuantoHelper>());
+                              Handle<FdmQuantoHelper> quantoHelper = Handle<FdmQuantoHelper>(),
+                              bool calculateVega = false);
+        //! rolls back with an already assembled Black-Scholes operator
+        /*! The operator must be defined on the mesher of the solver
+            description; it is not rebuilt on notifications.
+        */
+        FdmBlackScholesSolver(FdmSolverDesc solverDesc,
+                              const FdmSchemeDesc& schemeDesc,
+                              ext::shared_ptr<FdmLinearOpComposite> op,
+                              bool calculateVega = false);
 
         Real valueAt(Real s) const;
         Real deltaAt(Real s) const;
         Real gammaAt(Real s) const;
         Real thetaAt(Real s) const;
+        //! vega from the tangent-linear rollback
+        /*! available if requested, neither local volatility nor
+            quanto adjustments are used and the scheme is supported by
+            FdmTangentSensitivityCondition (e.g., not with adaptive
+            time stepping); Null<Real>() otherwise.
+        */
+        Real vegaAt(Real s) const;
 
       protected:
         void performCalculations() const override;
@@ -63,6 +80,8 @@ namespace QuantLib {
         const bool localVol_;
         const Real illegalLocalVolOverwrite_;
         const Handle<FdmQuantoHelper> quantoHelper_;
+        const ext::shared_ptr<FdmLinearOpComposite> op_;
+        const bool calculateVega_;
 
         mutable ext::shared_ptr<Fdm1DimSolver> solver_;
     };
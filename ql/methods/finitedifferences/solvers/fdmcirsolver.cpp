@@ -51,22 +51,22 @@ namespace QuantLib {
 
     Real FdmCIRSolver::valueAt(Real s, Real r) const {
         calculate();
-        return solver_->interpolateAt(std::log(s), r);
+        return solver_->interpolateAt(log(s), r);
     }
 
     Real FdmCIRSolver::deltaAt(Real s, Real r) const {
         calculate();
-        return solver_->derivativeX(std::log(s), r)/s;
+        return solver_->derivativeX(log(s), r)/s;
     }
 
     Real FdmCIRSolver::gammaAt(Real s, Real r) const {
         calculate();
-        const Real x = std::log(s);
+        const Real x = log(s);
         return (solver_->derivativeXX(x, r)-solver_->derivativeX(x, r))/(s*s);
     }
 
     Real FdmCIRSolver::thetaAt(Real s, Real r) const {
         calculate();
-        return solver_->thetaAt(std::log(s), r);
+        return solver_->thetaAt(log(s), r);
     }
 }
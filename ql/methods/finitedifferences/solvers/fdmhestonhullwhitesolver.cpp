@@ -51,7 +51,7 @@ namespace QuantLib {
     Real FdmHestonHullWhiteSolver::valueAt(Real s, Real v, Rate r) const {
         calculate();
 
-        const Real x = std::log(s);
+        const Real x = log(s);
         return solver_->interpolateAt(x, v, r);
     }
 
@@ -69,7 +69,7 @@ namespace QuantLib {
     Real FdmHestonHullWhiteSolver::thetaAt(Real s, Real v, Rate r) const {
         calculate();
 
-        const Real x = std::log(s);
+        const Real x = log(s);
         return solver_->thetaAt(x, v, r);
     }
 }
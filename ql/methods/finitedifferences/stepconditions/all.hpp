@@ -8,4 +8,5 @@
 #include <methods/finitedifferences/stepconditions/fdmsimpleswingcondition.hpp>
 #include <methods/finitedifferences/stepconditions/fdmsnapshotcondition.hpp>
 #include <methods/finitedifferences/stepconditions/fdmstepconditioncomposite.hpp>
+#include <methods/finitedifferences/stepconditions/fdmtangentsensitivitycondition.hpp>
 
@@ -0,0 +1,128 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+
+#include <methods/finitedifferences/schemes/impliciteulerscheme.hpp>
+#include <methods/finitedifferences/stepconditions/fdmstepconditioncomposite.hpp>
+#include <methods/finitedifferences/stepconditions/fdmtangentsensitivitycondition.hpp>
+#include <methods/finitedifferences/utilities/fdmdividendhandler.hpp>
+#include <utility>
+
+namespace QuantLib {
+
+    FdmTangentSensitivityCondition::FdmTangentSensitivityCondition(
+        ext::shared_ptr<FdmLinearOpComposite> op,
+        Source source,
+        ext::shared_ptr<StepCondition<Array> > condition,
+        const FdmSchemeDesc& schemeDesc)
+    : op_(std::move(op)), source_(std::move(source)),
+      condition_(std::move(condition)), schemeDesc_(schemeDesc),
+      implicit_(ext::make_shared<ImplicitEulerScheme>(op_)) {
+        QL_REQUIRE(op_ != nullptr, "null operator given");
+        QL_REQUIRE(source_, "null source term given");
+        QL_REQUIRE(isSupported(schemeDesc_),
+                   "scheme not supported for tangent sensitivities");
+    }
+
+    bool FdmTangentSensitivityCondition::isSupported(
+        const FdmSchemeDesc& schemeDesc) {
+        return schemeDesc.adaptiveTolerance == Null<Real>()
+            && (schemeDesc.type == FdmSchemeDesc::ImplicitEulerType
+                || (schemeDesc.type == FdmSchemeDesc::DouglasType
+                    && schemeDesc.theta >= 0.5 && schemeDesc.theta <= 1.0));
+    }
+
+    void FdmTangentSensitivityCondition::reset(const Array& values, Time t,
+                                               Time dampingTo) {
+        t_ = t;
+        dampingTo_ = dampingTo;
+        u_ = values;
+        v_ = Array(values.size(), 0.0);
+    }
+
+    void FdmTangentSensitivityCondition::applyTo(Array& a, Time t) const {
+        QL_REQUIRE(t_ != Null<Time>(), "sensitivity rollback is not reset");
+        QL_REQUIRE(t <= t_, "time " << t << " is later than the last "
+                   "time " << t_ << " of the sensitivity rollback");
+        QL_REQUIRE(a.size() == v_.size(), "inconsistent array sizes");
+
+        if (t < t_) {
+            const Time dt = t_ - t;
+
+            if (schemeDesc_.type == FdmSchemeDesc::ImplicitEulerType
+                || (dampingTo_ != Null<Time>() && t >= dampingTo_)) {
+                // the implicit Euler step of the main rollback,
+                // (I - dt L) V(t) = V(t_) + dt*S(u(t))
+                Array y = source_(a, t, t_);
+                y *= dt;
+                y += v_;
+                implicit_->setStep(dt);
+                implicit_->step(y, t_);
+                v_ = y;
+            }
+            else {
+                // the Douglas step of the main rollback,
+                // V(t) = V(t_) + dt*(L V + theta*S(u(t)) + (1-theta)*S(u(t_)))
+                // with the implicit part split along the directions
+                const Real theta = schemeDesc_.theta;
+                op_->setTime(t, t_);
+                Array y = op_->apply(v_);
+                y += theta*source_(a, t, t_) + (1.0-theta)*source_(u_, t, t_);
+                y *= dt;
+                y += v_;
+
+                for (Size i=0; i < op_->size(); ++i) {
+                    Array rhs = op_->apply_direction(i, v_);
+                    rhs *= -theta*dt;
+                    rhs += y;
+                    y = op_->solve_splitting(i, rhs, -theta*dt);
+                }
+                v_ = y;
+            }
+        }
+
+        if (condition_ != nullptr)
+            applyCondition(condition_, a, t);
+
+        u_ = a;
+        t_ = t;
+    }
+
+    void FdmTangentSensitivityCondition::applyCondition(
+        const ext::shared_ptr<StepCondition<Array> >& c,
+        Array& a, Time t) const {
+
+        if (const auto composite =
+                ext::dynamic_pointer_cast<FdmStepConditionComposite>(c)) {
+            for (const auto& iter : composite->conditions())
+                applyCondition(iter, a, t);
+        }
+        else if (ext::dynamic_pointer_cast<FdmDividendHandler>(c) != nullptr) {
+            // a linear map of the solution, hence of the sensitivity
+            c->applyTo(a, t);
+            c->applyTo(v_, t);
+        }
+        else {
+            const Array unconstrained = a;
+            c->applyTo(a, t);
+
+            for (Size i=0; i < a.size(); ++i)
+                if (a[i] != unconstrained[i])
+                    v_[i] = 0.0;
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+
+/*! \file fdmtangentsensitivitycondition.hpp
+    \brief tangent-linear parameter sensitivity along the rollback
+*/
+
+#ifndef quantlib_fdm_tangent_sensitivity_condition_hpp
+#define quantlib_fdm_tangent_sensitivity_condition_hpp
+
+#include <methods/finitedifferences/stepcondition.hpp>
+#include <methods/finitedifferences/operators/fdmlinearopcomposite.hpp>
+#include <methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
+#include <utilities/null.hpp>
+#include <functional>
+
+namespace QuantLib {
+
+    class ImplicitEulerScheme;
+
+    //! tangent-linear sensitivity of the solution w.r.t. a model parameter
+    /*! Rolls back the sensitivity \f$ V = \partial u / \partial p \f$
+        alongside the solution \f$ u \f$ by solving the tangent equation
+        \f[
+            V_t + L V + \frac{\partial L}{\partial p} u = 0
+        \f]
+        with the scheme of the main rollback, using its operator: a
+        Douglas step with the same theta, or an implicit Euler step
+        for the implicit Euler scheme and for the damping steps.
+        The source term \f$ \frac{\partial L}{\partial p} u \f$ for a
+        step between \f$ t_1 \f$ and \f$ t_2 \f$ is given by a callback.
+
+        The wrapped condition is applied to the solution first.  Dividend
+        handlers map the solution linearly and are applied to the
+        sensitivity as well; wherever any other condition, e.g. an
+        exercise condition, changes the solution the sensitivity is set
+        to zero.  Only the last time slice of the solution is kept, hence
+        a single rollback delivers both the prices and the sensitivity.
+
+        \warning the condition keeps state between time steps; it must
+                 be reset before each rollback and cannot be used with
+                 adaptive time stepping, which applies step conditions
+                 to trial steps. Boundary conditions are not applied to
+                 the sensitivity.
+    */
+    class FdmTangentSensitivityCondition : public StepCondition<Array> {
+      public:
+        typedef std::function<Array(const Array&, Time, Time)> Source;
+
+        FdmTangentSensitivityCondition(
+            ext::shared_ptr<FdmLinearOpComposite> op,
+            Source source,
+            ext::shared_ptr<StepCondition<Array> > condition
+                = ext::shared_ptr<StepCondition<Array> >(),
+            const FdmSchemeDesc& schemeDesc = FdmSchemeDesc::Douglas());
+
+        //! whether the sensitivity can follow a rollback with the given scheme
+        static bool isSupported(const FdmSchemeDesc& schemeDesc);
+
+        /*! starts a new rollback from the given values at time t;
+            the steps ending at or after dampingTo are damping steps.
+        */
+        void reset(const Array& values, Time t,
+                   Time dampingTo = Null<Time>());
+
+        void applyTo(Array& a, Time t) const override;
+
+        const Array& getValues() const { return v_; }
+
+      private:
+        void applyCondition(const ext::shared_ptr<StepCondition<Array> >& c,
+                            Array& a, Time t) const;
+
+        const ext::shared_ptr<FdmLinearOpComposite> op_;
+        const Source source_;
+        const ext::shared_ptr<StepCondition<Array> > condition_;
+        const FdmSchemeDesc schemeDesc_;
+        const ext::shared_ptr<ImplicitEulerScheme> implicit_;
+
+        mutable Time t_ = Null<Time>(), dampingTo_ = Null<Time>();
+        mutable Array u_, v_;
+    };
+}
+
+#endif
@@ -46,11 +46,11 @@ namespace QuantLib {
     }
 
     Real CEVRNDCalculator::X(Real f) const {
-        return std::pow(f, 2.0*(1.0-beta_))/squared(alpha_*(1.0-beta_));
+        return pow(f, 2.0*(1.0-beta_))/squared(alpha_*(1.0-beta_));
     }
 
     Real CEVRNDCalculator::invX(Real x) const {
-        return std::pow(x*squared(alpha_*(1.0-beta_)),
+        return pow(x*squared(alpha_*(1.0-beta_)),
                         1.0/(2.0*(1.0-beta_)));
     }
 
@@ -92,8 +92,8 @@ namespace QuantLib {
         const Real p = (b+2*c)/squared(b+c);
         const Real m = (h-1)*(1-3*h);
 
-        const Real u = (std::pow(a/(b+c), h) - (1 + h*p*(h-1-0.5*(2-h)*m*p)))/
-                (h*std::sqrt(2*p)*(1+0.5*m*p));
+        const Real u = (pow(a/(b+c), h) - (1 + h*p*(h-1-0.5*(2-h)*m*p)))/
+                (h*sqrt(2*p)*(1+0.5*m*p));
 
         return u - x;
     }
@@ -49,7 +49,7 @@ namespace QuantLib {
          Array tmp = mesher_->locations(equityDirection);
          Size spacing = mesher_->layout()->spacing()[equityDirection];
          for (Size i = 0; i < x_.size(); ++i) {
-             x_[i] = std::exp(tmp[i*spacing]);
+             x_[i] = exp(tmp[i*spacing]);
          }
     }
 
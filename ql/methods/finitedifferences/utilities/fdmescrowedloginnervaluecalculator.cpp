@@ -38,7 +38,7 @@ namespace QuantLib {
     Real FdmEscrowedLogInnerValueCalculator::innerValue(
         const FdmLinearOpIterator& iter, Time t) {
 
-        const Real s_t = std::exp(mesher_->location(iter, direction_));
+        const Real s_t = exp(mesher_->location(iter, direction_));
         const Real spot = s_t - escrowedDividendAdj_->dividendAdjustment(t);
 
         return (*payoff_)(spot);
@@ -111,7 +111,7 @@ namespace QuantLib {
         Size direction)
     : FdmCellAveragingInnerValue(
         payoff, mesher, direction,
-        [](Real x) -> Real { return std::exp(x); }) {}
+        [](Real x) -> Real { return exp(x); }) {}
 
 
     FdmLogBasketInnerValue::FdmLogBasketInnerValue(ext::shared_ptr<BasketPayoff> payoff,
@@ -122,7 +122,7 @@ namespace QuantLib {
                                     const FdmLinearOpIterator& iter, Time) {
         Array x(mesher_->layout()->dim().size());
         for (Size i=0; i < x.size(); ++i) {
-            x[i] = std::exp(mesher_->location(iter, i));
+            x[i] = exp(mesher_->location(iter, i));
         }
         
         return (*payoff_)(x);
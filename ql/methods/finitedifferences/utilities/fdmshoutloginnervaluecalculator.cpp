@@ -47,7 +47,7 @@ namespace QuantLib {
     Real FdmShoutLogInnerValueCalculator::innerValue(
         const FdmLinearOpIterator& iter, Time t) {
 
-        const Real s_t = std::exp(mesher_->location(iter, direction_));
+        const Real s_t = exp(mesher_->location(iter, direction_));
 
         const DiscountFactor qf =
             escrowedDividendAdj_->dividendYield()->discount(maturity_)/
@@ -59,7 +59,7 @@ namespace QuantLib {
 
         const Real fwd = s_t*qf/df;
         const Volatility stdDev = blackVolatility_->blackForwardVol(
-            t, maturity_, s_t)*std::sqrt(maturity_-t);
+            t, maturity_, s_t)*sqrt(maturity_-t);
 
         const Real npv = blackFormula(
             payoff_->optionType(), s_t, fwd, stdDev, df);
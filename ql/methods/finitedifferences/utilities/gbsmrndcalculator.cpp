@@ -54,7 +54,7 @@ namespace QuantLib {
             = process_->dividendYield()->discount(t, true);
 
         const Real forward = process_->x0() * dD / dR;
-        const Real stdDev = std::sqrt(
+        const Real stdDev = sqrt(
             process_->blackVolatility()->blackVariance(t, k, true));
 
         if (forward <= k) {
@@ -76,12 +76,12 @@ namespace QuantLib {
             / process_->riskFreeRate()->discount(t, true)
             * process_->dividendYield()->discount(t, true);
 
-        const Volatility atmVariance = std::sqrt(
+        const Volatility atmVariance = sqrt(
             process_->blackVolatility()->blackVariance(t, fwd, true));
 
         const Real atmX = InverseCumulativeNormal()(q);
 
-        const Real guess = fwd*std::exp(atmVariance*atmX);
+        const Real guess = fwd*exp(atmVariance*atmX);
 
         Real lower = guess;
         while (guess/lower < 65535.0 && cdf(lower, t) > q)
@@ -50,7 +50,7 @@ namespace {
 
         std::complex<Real> omega(const HestonParams& p, Real p_x) {
            const std::complex<Real> g = gamma(p, p_x);
-           return std::sqrt(g*g
+           return sqrt(g*g
                   + p.sigma*p.sigma*std::complex<Real>(p_x*p_x, -p_x));
         }
 
@@ -59,7 +59,7 @@ namespace {
             CpxPv_Helper(const HestonParams& p, Real x, Time t)
               : p_(p), t_(t), x_(x),
                 c_inf_(std::min(10.0, std::max(0.0001,
-                      std::sqrt(1.0-squared(p_.rho))/p_.sigma))
+                      sqrt(1.0-squared(p_.rho))/p_.sigma))
                       *(p_.v0 + p_.kappa*p_.theta*t))  {}
 
             Real operator()(Real x) const {
@@ -71,7 +71,7 @@ namespace {
                     return 0.0;
                 }
 
-                const Real u_x = std::max(QL_EPSILON, -std::log(p_x)/c_inf_);
+                const Real u_x = std::max(QL_EPSILON, -log(p_x)/c_inf_);
                 return std::real(phi(u_x)
                         /((p_x*c_inf_)*std::complex<Real>(0.0, u_x)));
             }
@@ -82,7 +82,7 @@ namespace {
                     return std::complex<Real>(0.0, 0.0);
                 }
 
-                const Real u_x = -std::log(x)/c_inf_;
+                const Real u_x = -log(x)/c_inf_;
                 return phi(u_x)/(x*c_inf_);
             }
 
@@ -92,11 +92,11 @@ namespace {
                 const std::complex<Real> o = omega(p_, p_x);
                 const std::complex<Real> gamma = (g-o)/(g+o);
 
-                return 2.0*std::exp(std::complex<Real>(0.0, p_x*x_)
+                return 2.0*exp(std::complex<Real>(0.0, p_x*x_)
                         - p_.v0*std::complex<Real>(p_x*p_x, -p_x)
-                          /(g+o*(1.0+std::exp(-o*t_))/(1.0-std::exp(-o*t_)))
+                          /(g+o*(1.0+exp(-o*t_))/(1.0-exp(-o*t_)))
                          +p_.kappa*p_.theta/sigma2*(
-                           (g-o)*t_ - 2.0*std::log((1.0-gamma*std::exp(-o*t_))
+                           (g-o)*t_ - 2.0*log((1.0-gamma*exp(-o*t_))
                                                                /(1.0-gamma))));
             }
 
@@ -110,14 +110,14 @@ namespace {
     HestonRNDCalculator::HestonRNDCalculator(ext::shared_ptr<HestonProcess> hestonProcess,
                                              Real integrationEps,
                                              Size maxIntegrationIterations)
-    : hestonProcess_(std::move(hestonProcess)), x0_(std::log(hestonProcess_->s0()->value())),
+    : hestonProcess_(std::move(hestonProcess)), x0_(log(hestonProcess_->s0()->value())),
       integrationEps_(integrationEps), maxIntegrationIterations_(maxIntegrationIterations) {}
 
     Real HestonRNDCalculator::x_t(Real x, Time t) const {
         const DiscountFactor dr = hestonProcess_->riskFreeRate()->discount(t);
         const DiscountFactor dq = hestonProcess_->dividendYield()->discount(t);
 
-        return x - x0_ + std::log(dr/dq);
+        return x - x0_ + log(dr/dq);
     }
 
     Real HestonRNDCalculator::pdf(Real x, Time t) const {
@@ -141,7 +141,7 @@ namespace {
         const Real theta = hestonProcess_->theta();
 
         const Volatility expVol
-            = std::sqrt(theta + (v0-theta)*(1-std::exp(-kappa*t))/(t*kappa));
+            = sqrt(theta + (v0-theta)*(1-exp(-kappa*t))/(t*kappa));
 
         const ext::shared_ptr<BlackScholesMertonProcess> bsmProcess(
             ext::make_shared<BlackScholesMertonProcess>(
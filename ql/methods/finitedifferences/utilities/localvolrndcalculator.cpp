@@ -93,17 +93,17 @@ namespace QuantLib {
 
         if (t <= tMin) {
             const Volatility vol = localVol_->localVol(0.0, spot_->value());
-            const Volatility stdDev = vol * std::sqrt(t);
+            const Volatility stdDev = vol * sqrt(t);
             const Real xm = - 0.5 * stdDev * stdDev +
-                std::log(spot_->value() * qTS_->discount(t)/rTS_->discount(t));
+                log(spot_->value() * qTS_->discount(t)/rTS_->discount(t));
 
             return GaussianDistribution(xm, stdDev)(x);
         }
         else if (t <= timeGrid_->at(1)) {
             const Volatility vol = localVol_->localVol(0.0, spot_->value());
-            const Volatility stdDev = vol * std::sqrt(tMin);
+            const Volatility stdDev = vol * sqrt(tMin);
             const Real xm = - 0.5 * stdDev * stdDev +
-                std::log(spot_->value() * qTS_->discount(tMin)/rTS_->discount(tMin));
+                log(spot_->value() * qTS_->discount(tMin)/rTS_->discount(tMin));
 
             const GaussianDistribution gaussianPDF(xm, stdDev);
 
@@ -174,7 +174,7 @@ namespace QuantLib {
             const Real stepSize = 0.02*(
                     xm_[0]->locations().back() - xm_[0]->locations().front());
             return RiskNeutralDensityCalculator::InvCDFHelper(
-                this, std::log(spot_->value()),
+                this, log(spot_->value()),
                 0.1*localVolProbEps_, maxIter_, stepSize).inverseCDF(p, t);
         }
         else {
@@ -205,7 +205,7 @@ namespace QuantLib {
         }
         else {
             return ext::make_shared<Predefined1dMesher>(
-                std::vector<Real>(xGrid_, std::log(spot_->value())));
+                std::vector<Real>(xGrid_, log(spot_->value())));
         }
     }
 
@@ -221,11 +221,11 @@ namespace QuantLib {
                                                         : 0.5*sT);
         const Volatility vol = localVol_->localVol(0.0, spot_->value());
 
-        const Volatility stdDev = vol * std::sqrt(t);
+        const Volatility stdDev = vol * sqrt(t);
         Real xm = - 0.5 * stdDev * stdDev +
-            std::log(spot_->value() * qTS_->discount(t)/rTS_->discount(t));
+            log(spot_->value() * qTS_->discount(t)/rTS_->discount(t));
 
-        const Volatility stdDevOfFirstStep = vol * std::sqrt(sT);
+        const Volatility stdDevOfFirstStep = vol * sqrt(sT);
         const Real normInvEps = InverseCumulativeNormal()(1 - localVolProbEps_);
 
         Real sLowerBound = xm - normInvEps * stdDevOfFirstStep;
@@ -238,7 +238,7 @@ namespace QuantLib {
         Array p(mesher->size());
         Array x(mesher->locations().begin(), mesher->locations().end());
 
-        const GaussianDistribution gaussianPDF(xm, vol * std::sqrt(t));
+        const GaussianDistribution gaussianPDF(xm, vol * sqrt(t));
 
         for (Size idx=0; idx < p.size(); ++idx) {
             p[idx] = gaussianPDF(x[idx]);
@@ -263,11 +263,11 @@ namespace QuantLib {
 
             // leaking probability mass?
             const Real maxLeftValue =
-                std::max(std::fabs(*std::min_element(p.begin(), p.begin()+b)),
-                         std::fabs(*std::max_element(p.begin(), p.begin()+b)));
+                std::max(fabs(*std::min_element(p.begin(), p.begin()+b)),
+                         fabs(*std::max_element(p.begin(), p.begin()+b)));
             const Real maxRightValue =
-                std::max(std::fabs(*std::min_element(p.end()-b, p.end())),
-                         std::fabs(*std::max_element(p.end()-b, p.end())));
+                std::max(fabs(*std::min_element(p.end()-b, p.end())),
+                         fabs(*std::max_element(p.end()-b, p.end())));
 
             if (std::max(maxLeftValue, maxRightValue) > localVolProbEps_) {
                 rescaleTimeSteps_.push_back(i);
@@ -278,13 +278,13 @@ namespace QuantLib {
                 xm = DiscreteSimpsonIntegral()(x, x*p);
                 Array vols(x.size());
                 for (Size j=0; j < vols.size(); ++j) {
-                    vols[j] = localVol_->localVol(t + dt, std::exp(x[j]));
+                    vols[j] = localVol_->localVol(t + dt, exp(x[j]));
                 }
 
                 const Real vm = DiscreteSimpsonIntegral()(x, vols)
                     /(x.back() - x.front());
 
-                const Real scalingFactor = vm*std::sqrt(0.5*timeGrid_->back());
+                const Real scalingFactor = vm*sqrt(0.5*timeGrid_->back());
 
                 if (maxLeftValue > localVolProbEps_)
                     sLowerBound -= scalingFactor*(oldUpperBound-oldLowerBound);
@@ -32,7 +32,7 @@ namespace QuantLib {
 
 
     Real SquareRootProcessRNDCalculator::pdf(Real v, Time t) const {
-        const Real e   = std::exp(-kappa_*t);
+        const Real e   = exp(-kappa_*t);
         const Real k   = d_/(1-e);
         const Real ncp = k*v0_*e;
 
@@ -43,7 +43,7 @@ namespace QuantLib {
     }
 
     Real SquareRootProcessRNDCalculator::cdf(Real v, Time t) const {
-        const Real e   = std::exp(-kappa_*t);
+        const Real e   = exp(-kappa_*t);
         const Real k   = d_/(1-e);
         const Real ncp = k*v0_*e;
 
@@ -54,7 +54,7 @@ namespace QuantLib {
     }
 
     Real SquareRootProcessRNDCalculator::invcdf(Real q, Time t) const {
-        const Real e   = std::exp(-kappa_*t);
+        const Real e   = exp(-kappa_*t);
         const Real k   = d_/(1-e);
         const Real ncp = k*v0_*e;
 
@@ -68,8 +68,8 @@ namespace QuantLib {
         const Real alpha = 0.5*df_;
         const Real beta = alpha/theta_;
 
-        return std::pow(beta, alpha)*std::pow(v, alpha-1)
-                *std::exp(-beta*v-boost::math::lgamma(alpha));
+        return pow(beta, alpha)*pow(v, alpha-1)
+                *exp(-beta*v-boost::math::lgamma(alpha));
     }
 
     Real SquareRootProcessRNDCalculator::stationary_cdf(Real v) const {
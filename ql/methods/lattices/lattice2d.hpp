@@ -72,7 +72,7 @@ namespace QuantLib {
                                           ext::shared_ptr<T> tree2,
                                           Real correlation)
     : TreeLattice<Impl>(tree1->timeGrid(), T::branches * T::branches), tree1_(tree1),
-      tree2_(std::move(tree2)), m_(T::branches, T::branches), rho_(std::fabs(correlation)) {
+      tree2_(std::move(tree2)), m_(T::branches, T::branches), rho_(fabs(correlation)) {
 
         // what happens here?
         if (correlation < 0.0 && T::branches == 3) {
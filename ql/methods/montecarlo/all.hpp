@@ -1,6 +1,7 @@
 /* This file is automatically generated; do not edit.     */
 /* Add the files to be included into Makefile.am instead. */
 
+#include <methods/montecarlo/batchpathgenerator.hpp>
 #include <methods/montecarlo/brownianbridge.hpp>
 #include <methods/montecarlo/earlyexercisepathpricer.hpp>
 #include <methods/montecarlo/exercisestrategy.hpp>
@@ -14,6 +15,7 @@
 #include <methods/montecarlo/nodedata.hpp>
 #include <methods/montecarlo/parametricexercise.hpp>
 #include <methods/montecarlo/path.hpp>
+#include <methods/montecarlo/pathbatch.hpp>
 #include <methods/montecarlo/pathgenerator.hpp>
 #include <methods/montecarlo/pathpricer.hpp>
 #include <methods/montecarlo/sample.hpp>
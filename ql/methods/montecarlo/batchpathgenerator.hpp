@@ -0,0 +1,165 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file batchpathgenerator.hpp
+    \brief Generates batches of random paths using a sequence generator
+*/
+
+#ifndef quantlib_montecarlo_batch_path_generator_hpp
+#define quantlib_montecarlo_batch_path_generator_hpp
+
+#include <methods/montecarlo/brownianbridge.hpp>
+#include <methods/montecarlo/pathbatch.hpp>
+#include <stochasticprocess.hpp>
+#include <utility>
+#include <vector>
+
+namespace QuantLib {
+
+    //! Generates batches of random paths using a sequence generator
+    /*! The paths are the same that would be returned by successive
+        calls to PathGenerator (for one-factor processes) or
+        MultiPathGenerator (for multi-factor ones) using the same
+        sequence generator.  However, they are evolved one time step
+        at a time for the whole batch through
+        StochasticProcess::evolveBatch, which allows processes to
+        calculate state-independent quantities only once per step.
+
+        The Brownian bridge is only supported for one-factor
+        processes.
+
+        \ingroup mcarlo
+
+        \test the generated paths are checked against the ones
+              returned by the single-path generators.
+    */
+    template <class GSG>
+    class BatchPathGenerator {
+      public:
+        typedef PathBatch sample_type;
+        BatchPathGenerator(ext::shared_ptr<StochasticProcess>,
+                           TimeGrid timeGrid,
+                           GSG generator,
+                           bool brownianBridge,
+                           Size batchSize);
+        //! \name inspectors
+        //@{
+        const sample_type& next() const;
+        //! antithetic paths of the last generated batch
+        const sample_type& antithetic() const;
+        Size batchSize() const { return batchSize_; }
+        const TimeGrid& timeGrid() const { return timeGrid_; }
+        //@}
+      private:
+        void evolve(const std::vector<Real>& dw) const;
+        ext::shared_ptr<StochasticProcess> process_;
+        TimeGrid timeGrid_;
+        GSG generator_;
+        bool brownianBridge_;
+        Size batchSize_, factors_;
+        BrownianBridge bb_;
+        mutable sample_type next_;
+        mutable std::vector<Real> dw_, antitheticDw_, temp_;
+    };
+
+
+    // template definitions
+
+    template <class GSG>
+    BatchPathGenerator<GSG>::BatchPathGenerator(
+                                  ext::shared_ptr<StochasticProcess> process,
+                                  TimeGrid timeGrid,
+                                  GSG generator,
+                                  bool brownianBridge,
+                                  Size batchSize)
+    : process_(std::move(process)), timeGrid_(std::move(timeGrid)),
+      generator_(std::move(generator)), brownianBridge_(brownianBridge),
+      batchSize_(batchSize), factors_(process_->factors()), bb_(timeGrid_),
+      next_(timeGrid_, process_->size(), batchSize),
+      dw_(generator_.dimension()*batchSize),
+      antitheticDw_(generator_.dimension()*batchSize),
+      temp_(generator_.dimension()) {
+
+        QL_REQUIRE(timeGrid_.size() > 1, "no times given");
+        QL_REQUIRE(generator_.dimension() == factors_*(timeGrid_.size()-1),
+                   "dimension (" << generator_.dimension()
+                   << ") is not equal to ("
+                   << factors_ << " * " << timeGrid_.size()-1
+                   << ") the number of factors "
+                   << "times the number of time steps");
+        QL_REQUIRE(!brownianBridge_ || factors_ == 1,
+                   "Brownian bridge not supported for multi-factor processes");
+    }
+
+    template <class GSG>
+    const typename BatchPathGenerator<GSG>::sample_type&
+    BatchPathGenerator<GSG>::next() const {
+
+        typedef typename GSG::sample_type sequence_type;
+
+        // the random numbers are transposed so that the increments
+        // for a given time step and factor are contiguous
+        const Size n = batchSize_, d = generator_.dimension();
+        std::vector<Real>& weights = next_.weights();
+        for (Size p=0; p<n; ++p) {
+            const sequence_type& sequence = generator_.nextSequence();
+            weights[p] = sequence.weight;
+            if (brownianBridge_) {
+                bb_.transform(sequence.value.begin(),
+                              sequence.value.end(),
+                              temp_.begin());
+                for (Size k=0; k<d; ++k)
+                    dw_[k*n+p] = temp_[k];
+            } else {
+                for (Size k=0; k<d; ++k)
+                    dw_[k*n+p] = sequence.value[k];
+            }
+        }
+
+        evolve(dw_);
+        return next_;
+    }
+
+    template <class GSG>
+    const typename BatchPathGenerator<GSG>::sample_type&
+    BatchPathGenerator<GSG>::antithetic() const {
+        for (Size k=0; k<dw_.size(); ++k)
+            antitheticDw_[k] = -dw_[k];
+        evolve(antitheticDw_);
+        return next_;
+    }
+
+    template <class GSG>
+    void BatchPathGenerator<GSG>::evolve(const std::vector<Real>& dw) const {
+        const Size n = batchSize_;
+
+        Array x0 = process_->initialValues();
+        for (Size j=0; j<x0.size(); ++j)
+            std::fill(next_.values(0, j), next_.values(0, j) + n, x0[j]);
+
+        for (Size i=1; i<timeGrid_.size(); ++i) {
+            process_->evolveBatch(timeGrid_[i-1], next_.values(i-1),
+                                  timeGrid_.dt(i-1),
+                                  dw.data() + (i-1)*factors_*n,
+                                  next_.values(i), n);
+        }
+    }
+
+}
+
+
+#endif
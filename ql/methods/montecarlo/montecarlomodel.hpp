@@ -28,7 +28,11 @@
 #include <math/statistics/statistics.hpp>
 #include <methods/montecarlo/mctraits.hpp>
 #include <shared_ptr.hpp>
+#include <algorithm>
+#include <exception>
+#include <functional>
 #include <utility>
+#include <vector>
 
 namespace QuantLib {
 
@@ -58,6 +62,11 @@ namespace QuantLib {
         typedef typename path_generator_type::sample_type sample_type;
         typedef typename path_pricer_type::result_type result_type;
         typedef S stats_type;
+        //! returns a path generator starting at the given sample
+        typedef std::function<ext::shared_ptr<path_generator_type>(Size)>
+            path_generator_factory;
+        typedef std::function<ext::shared_ptr<path_pricer_type>()>
+            path_pricer_factory;
         // constructor
         MonteCarloModel(
             ext::shared_ptr<path_generator_type> pathGenerator,
@@ -75,8 +84,33 @@ namespace QuantLib {
             isControlVariate_ = static_cast<bool>(cvPathPricer_);
         }
         void addSamples(Size samples);
+        //! add samples split over independent random streams
+        /*! The samples are divided into \c streams contiguous
+            blocks.  The generators for each block are obtained from
+            the passed factories by passing the index of the first
+            sample in the block; the index is counted from the first
+            sample ever added to the model.  If no pricer factory is
+            given, the model pricer is shared between streams and
+            must be thread-safe; the control-variate pricer is
+            always shared.
+
+            \warning this method should not be mixed with the
+                     single-stream one on the same model, since the
+                     latter keeps drawing from the original generator.
+        */
+        void addSamples(Size samples,
+                        Size streams,
+                        const path_generator_factory& pathGenerators,
+                        const path_pricer_factory& pathPricers =
+                            path_pricer_factory(),
+                        const path_generator_factory& cvPathGenerators =
+                            path_generator_factory());
         const stats_type& sampleAccumulator() const;
       private:
+        std::pair<result_type, Real> nextSample(
+            const path_generator_type& pathGenerator,
+            const path_pricer_type& pathPricer,
+            const path_generator_type* cvPathGenerator) const;
         ext::shared_ptr<path_generator_type> pathGenerator_;
         ext::shared_ptr<path_pricer_type> pathPricer_;
         stats_type sampleAccumulator_;
@@ -85,43 +119,124 @@ namespace QuantLib {
         result_type cvOptionValue_;
         bool isControlVariate_;
         ext::shared_ptr<path_generator_type> cvPathGenerator_;
+        Size simulatedSamples_ = 0;
     };
 
     // inline definitions
     template <template <class> class MC, class RNG, class S>
-    inline void MonteCarloModel<MC,RNG,S>::addSamples(Size samples) {
-        for(Size j = 1; j <= samples; j++) {
-
-            const sample_type& path = pathGenerator_->next();
-            result_type price = (*pathPricer_)(path.value);
+    inline std::pair<typename MonteCarloModel<MC,RNG,S>::result_type, Real>
+    MonteCarloModel<MC,RNG,S>::nextSample(
+                        const path_generator_type& pathGenerator,
+                        const path_pricer_type& pathPricer,
+                        const path_generator_type* cvPathGenerator) const {
+
+        const sample_type& path = pathGenerator.next();
+        result_type price = pathPricer(path.value);
+
+        if (isControlVariate_) {
+            if (cvPathGenerator == nullptr) {
+                price += cvOptionValue_-(*cvPathPricer_)(path.value);
+            }
+            else {
+                const sample_type& cvPath = cvPathGenerator->next();
+                price += cvOptionValue_-(*cvPathPricer_)(cvPath.value);
+            }
+        }
 
+        if (isAntitheticVariate_) {
+            const sample_type& atPath = pathGenerator.antithetic();
+            result_type price2 = pathPricer(atPath.value);
             if (isControlVariate_) {
-                if (!cvPathGenerator_) {
-                    price += cvOptionValue_-(*cvPathPricer_)(path.value);
-                }
+                if (cvPathGenerator == nullptr)
+                    price2 += cvOptionValue_-(*cvPathPricer_)(atPath.value);
                 else {
-                    const sample_type& cvPath = cvPathGenerator_->next();
-                    price += cvOptionValue_-(*cvPathPricer_)(cvPath.value);
+                    const sample_type& cvPath = cvPathGenerator->antithetic();
+                    price2 += cvOptionValue_-(*cvPathPricer_)(cvPath.value);
                 }
             }
 
-            if (isAntitheticVariate_) {
-                const sample_type& atPath = pathGenerator_->antithetic();
-                result_type price2 = (*pathPricer_)(atPath.value);
-                if (isControlVariate_) {
-                    if (!cvPathGenerator_)
-                        price2 += cvOptionValue_-(*cvPathPricer_)(atPath.value);
-                    else {
-                        const sample_type& cvPath = cvPathGenerator_->antithetic();
-                        price2 += cvOptionValue_-(*cvPathPricer_)(cvPath.value);
-                    }
-                }
+            return { (price+price2)/2.0, path.weight };
+        } else {
+            return { price, path.weight };
+        }
+    }
 
-                sampleAccumulator_.add((price+price2)/2.0, path.weight);
-            } else {
-                sampleAccumulator_.add(price, path.weight);
+    template <template <class> class MC, class RNG, class S>
+    inline void MonteCarloModel<MC,RNG,S>::addSamples(Size samples) {
+        for(Size j = 1; j <= samples; j++) {
+            std::pair<result_type, Real> sample =
+                nextSample(*pathGenerator_, *pathPricer_,
+                           cvPathGenerator_.get());
+            sampleAccumulator_.add(sample.first, sample.second);
+        }
+        simulatedSamples_ += samples;
+    }
+
+    template <template <class> class MC, class RNG, class S>
+    inline void MonteCarloModel<MC,RNG,S>::addSamples(
+                              Size samples,
+                              Size streams,
+                              const path_generator_factory& pathGenerators,
+                              const path_pricer_factory& pathPricers,
+                              const path_generator_factory& cvPathGenerators) {
+        QL_REQUIRE(streams > 0, "at least one stream required");
+        QL_REQUIRE(pathGenerators, "no path-generator factory given");
+        QL_REQUIRE(!cvPathGenerator_ || cvPathGenerators,
+                   "no control-variate path-generator factory given");
+        if (samples == 0)
+            return;
+        streams = std::min(streams, samples);
+
+        // generators and pricers are built on the calling thread,
+        // since building them usually involves market data
+        std::vector<Size> firstSample(streams+1);
+        for (Size k=0; k<=streams; ++k)
+            firstSample[k] = simulatedSamples_ + (samples*k)/streams;
+
+        std::vector<ext::shared_ptr<path_generator_type> >
+            generators(streams), cvGenerators(streams);
+        std::vector<ext::shared_ptr<path_pricer_type> > pricers(streams);
+        for (Size k=0; k<streams; ++k) {
+            generators[k] = pathGenerators(firstSample[k]);
+            pricers[k] = pathPricers ? pathPricers() : pathPricer_;
+            if (cvPathGenerator_)
+                cvGenerators[k] = cvPathGenerators(firstSample[k]);
+        }
+
+        std::vector<std::vector<std::pair<result_type, Real> > >
+            results(streams);
+        std::vector<std::exception_ptr> errors(streams);
+
+        // the first path is priced on the calling thread so that any
+        // lazily-calculated process data are available to all streams
+        results[0].reserve(firstSample[1]-firstSample[0]);
+        results[0].push_back(nextSample(*generators[0], *pricers[0],
+                                        cvGenerators[0].get()));
+
+        #pragma omp parallel for
+        for (long k=0; k<(long)streams; ++k) {
+            try {
+                std::vector<std::pair<result_type, Real> >& r = results[k];
+                const Size n = firstSample[k+1]-firstSample[k];
+                r.reserve(n);
+                while (r.size() < n)
+                    r.push_back(nextSample(*generators[k], *pricers[k],
+                                           cvGenerators[k].get()));
+            } catch (...) {
+                errors[k] = std::current_exception();
             }
         }
+
+        for (Size k=0; k<streams; ++k) {
+            if (errors[k])
+                std::rethrow_exception(errors[k]);
+        }
+
+        for (Size k=0; k<streams; ++k) {
+            for (const auto& sample : results[k])
+                sampleAccumulator_.add(sample.first, sample.second);
+        }
+        simulatedSamples_ += samples;
     }
 
     template <template <class> class MC, class RNG, class S>
@@ -0,0 +1,120 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file pathbatch.hpp
+    \brief batch of random walks stored by time step
+*/
+
+#ifndef quantlib_montecarlo_path_batch_hpp
+#define quantlib_montecarlo_path_batch_hpp
+
+#include <methods/montecarlo/multipath.hpp>
+#include <utility>
+#include <vector>
+
+namespace QuantLib {
+
+    //! batch of (possibly multi-asset) random walks
+    /*! The values are stored as a structure of arrays: for each
+        point of the time grid and each asset, the values on all
+        paths are contiguous in memory.  This allows path pricers to
+        process whole batches with vectorizable loops.
+
+        \ingroup mcarlo
+
+        \note each path includes the initial asset value as its
+              first point.
+    */
+    class PathBatch {
+      public:
+        PathBatch(TimeGrid timeGrid, Size assets, Size paths);
+        //! \name inspectors
+        //@{
+        Size assetNumber() const { return assets_; }
+        Size pathNumber() const { return paths_; }
+        //! number of points in each path
+        Size length() const { return timeGrid_.size(); }
+        const TimeGrid& timeGrid() const { return timeGrid_; }
+        //@}
+        //! \name access to components
+        //@{
+        //! values of the given asset at the \f$ i \f$-th point on all paths
+        const Real* values(Size i, Size asset = 0) const;
+        Real* values(Size i, Size asset = 0);
+        //! weights of the paths
+        const std::vector<Real>& weights() const { return weights_; }
+        std::vector<Real>& weights() { return weights_; }
+        //@}
+        //! \name conversion to single paths
+        //@{
+        Path path(Size p, Size asset = 0) const;
+        MultiPath multiPath(Size p) const;
+        //@}
+      private:
+        TimeGrid timeGrid_;
+        Size assets_, paths_;
+        std::vector<Real> values_;
+        std::vector<Real> weights_;
+    };
+
+
+    // inline definitions
+
+    inline PathBatch::PathBatch(TimeGrid timeGrid, Size assets, Size paths)
+    : timeGrid_(std::move(timeGrid)), assets_(assets), paths_(paths),
+      values_(timeGrid_.size()*assets*paths), weights_(paths, 1.0) {
+        QL_REQUIRE(assets > 0, "no assets given");
+        QL_REQUIRE(paths > 0, "no paths given");
+    }
+
+    inline const Real* PathBatch::values(Size i, Size asset) const {
+        #if defined(QL_EXTRA_SAFETY_CHECKS)
+        QL_REQUIRE(i < length(), "point (" << i << ") out of range");
+        QL_REQUIRE(asset < assets_, "asset (" << asset << ") out of range");
+        #endif
+        return values_.data() + (i*assets_ + asset)*paths_;
+    }
+
+    inline Real* PathBatch::values(Size i, Size asset) {
+        #if defined(QL_EXTRA_SAFETY_CHECKS)
+        QL_REQUIRE(i < length(), "point (" << i << ") out of range");
+        QL_REQUIRE(asset < assets_, "asset (" << asset << ") out of range");
+        #endif
+        return values_.data() + (i*assets_ + asset)*paths_;
+    }
+
+    inline Path PathBatch::path(Size p, Size asset) const {
+        QL_REQUIRE(p < paths_, "path (" << p << ") out of range");
+        QL_REQUIRE(asset < assets_, "asset (" << asset << ") out of range");
+        Array values(length());
+        for (Size i=0; i<length(); ++i)
+            values[i] = values_[(i*assets_ + asset)*paths_ + p];
+        return Path(timeGrid_, values);
+    }
+
+    inline MultiPath PathBatch::multiPath(Size p) const {
+        std::vector<Path> paths;
+        paths.reserve(assets_);
+        for (Size j=0; j<assets_; ++j)
+            paths.push_back(path(p, j));
+        return MultiPath(paths);
+    }
+
+}
+
+
+#endif
@@ -75,10 +75,10 @@ namespace QuantLib {
             switch (params.trafoType) {
                 case FdmSquareRootFwdOp::Log:
                   {
-                    lowerBound = std::log(lowerBound);
-                    upperBound = std::log(upperBound);
+                    lowerBound = log(lowerBound);
+                    upperBound = log(upperBound);
 
-                    const Real v0Center = std::log(v0);
+                    const Real v0Center = log(v0);
 
                     cPoints = {
                         std::make_tuple(lowerBound, lowerBoundDensity, false),
@@ -138,7 +138,7 @@ namespace QuantLib {
                     const Size idx = iter.index();
                     const Real nu = mesher->location(iter, 1);
 
-                    tp[idx] = p[idx]*std::pow(nu, alpha-1);
+                    tp[idx] = p[idx]*pow(nu, alpha-1);
                 }
 
                 return FdmMesherIntegral(
@@ -240,7 +240,9 @@ namespace QuantLib {
               case FdmSchemeDesc::ImplicitEulerType:
                   return ext::shared_ptr<FdmScheme>(
                       new FdmSchemeWrapper<ImplicitEulerScheme>(
-                          new ImplicitEulerScheme(op)));
+                          new ImplicitEulerScheme(
+                              op, ImplicitEulerScheme::bc_set(), 1e-8,
+                              ImplicitEulerScheme::SparseBiCGstab)));
               case FdmSchemeDesc::ExplicitEulerType:
                   return ext::shared_ptr<FdmScheme>(
                       new FdmSchemeWrapper<ExplicitEulerScheme>(
@@ -322,7 +324,7 @@ namespace QuantLib {
         std::vector<Time> times(1, tIdx);
         times.reserve(Size(T*params_.tMinStepsPerYear));
         while (tIdx < T) {
-            const Real decayFactor = std::exp(-params_.tStepNumberDecay*tIdx);
+            const Real decayFactor = exp(-params_.tStepNumberDecay*tIdx);
             const Time dt = maxDt*decayFactor + minDt*(1.0-decayFactor);
 
             times.push_back(std::min(T, tIdx+=dt));
@@ -384,7 +386,7 @@ namespace QuantLib {
                 xMesher.at(1), vMesher.at(1));
 
         const Volatility lv0
-            = localVol_->localVol(0.0, spot->value())/std::sqrt(v0);
+            = localVol_->localVol(0.0, spot->value())/sqrt(v0);
 
         ext::shared_ptr<Matrix> L(new Matrix(xGrid, timeGrid->size()));
 
@@ -401,13 +403,13 @@ namespace QuantLib {
             if (xMesher[i]->locations().front()
                   == xMesher[i]->locations().back()) {
                 std::fill(vStrikes[i]->begin(), vStrikes[i]->end(),
-                    std::exp(xMesher[i]->locations().front()));
+                    exp(xMesher[i]->locations().front()));
             }
             else {
                 std::transform(xMesher[i]->locations().begin(),
                                xMesher[i]->locations().end(),
                                vStrikes[i]->begin(),
-                               [](Real x) -> Real { return std::exp(x); });
+                               [](Real x) -> Real { return exp(x); });
             }
         }
 
@@ -426,6 +428,12 @@ namespace QuantLib {
             logEntries_.push_back(entry);
         }
 
+        // schemes are kept between time slices as long as neither the
+        // operator nor the scheme type changes, so that their
+        // workspaces are allocated only once
+        ext::shared_ptr<FdmScheme> fdmScheme;
+        FdmSchemeDesc::FdmSchemeType fdmSchemeType = params_.schemeDesc.type;
+
         for (Size i=2; i < times.size(); ++i) {
             const Time t = timeGrid->at(i);
             const Time dt = t - timeGrid->at(i-1);
@@ -443,6 +451,7 @@ namespace QuantLib {
                 hestonFwdOp = ext::shared_ptr<FdmLinearOpComposite>(
                                 new FdmHestonFwdOp(mesher, hestonProcess,
                                                trafoType, leverageFct, mixingFactor_));
+                fdmScheme.reset();
             }
 
             Array pn = p;
@@ -453,6 +462,14 @@ namespace QuantLib {
                     mesher->getFdm1dMeshers()[1]->locations().begin(),
                     mesher->getFdm1dMeshers()[1]->locations().end());
 
+            // weights of the variance integrals, independent of x
+            const Array pWeight = (trafoType == FdmSquareRootFwdOp::Power)
+                ? Pow(v, alpha-1) : Array(v.size(), 1.0);
+            const Array vpWeight = (trafoType == FdmSquareRootFwdOp::Log)
+                ? Exp(v)
+                : (trafoType == FdmSquareRootFwdOp::Power)
+                ? Pow(v, alpha) : v;
+
             // predictor corrector steps
             for (Size r=0; r < params_.predictionCorretionSteps; ++r) {
                 const FdmSchemeDesc fdmSchemeDesc
@@ -460,40 +477,36 @@ namespace QuantLib {
                         ? FdmSchemeDesc::ImplicitEuler()
                         : params_.schemeDesc;
 
-                const ext::shared_ptr<FdmScheme> fdmScheme(
-                    fdmSchemeFactory(fdmSchemeDesc, hestonFwdOp));
+                if (!fdmScheme || fdmSchemeDesc.type != fdmSchemeType) {
+                    fdmScheme = fdmSchemeFactory(fdmSchemeDesc, hestonFwdOp);
+                    fdmSchemeType = fdmSchemeDesc.type;
+                }
 
+                Array pSlice(vGrid);
                 for (Size j=0; j < x.size(); ++j) {
-                    Array pSlice(vGrid);
                     for (Size k=0; k < vGrid; ++k)
                         pSlice[k] = pn[j + k*xGrid];
 
-                    const Real pInt = (trafoType == FdmSquareRootFwdOp::Power)
-                       ? DiscreteSimpsonIntegral()(v, Pow(v, alpha-1)*pSlice)
-                       : DiscreteSimpsonIntegral()(v, pSlice);
-
-                    const Real vpInt = (trafoType == FdmSquareRootFwdOp::Log)
-                      ? DiscreteSimpsonIntegral()(v, Exp(v)*pSlice)
-                      : (trafoType == FdmSquareRootFwdOp::Power)
-                      ? DiscreteSimpsonIntegral()(v, Pow(v, alpha)*pSlice)
-                      : DiscreteSimpsonIntegral()(v, v*pSlice);
+                    const Real pInt
+                        = DiscreteSimpsonIntegral()(v, pWeight*pSlice);
+                    const Real vpInt
+                        = DiscreteSimpsonIntegral()(v, vpWeight*pSlice);
 
                     const Real scale = pInt/vpInt;
                     const Volatility localVol = localVol_->localVol(t, x[j]);
 
                     const Real l = (scale >= 0.0)
-                      ? localVol*std::sqrt(scale) : Real(1.0);
+                      ? localVol*sqrt(scale) : Real(1.0);
 
                     (*L)[j][i] = std::min(50.0, std::max(0.001, l));
-
-                    leverageFct->setInterpolation(Linear());
                 }
+                leverageFct->updateInterpolation(i);
 
                 const Real sLowerBound = std::max(x.front(),
-                    std::exp(localVolRND.invcdf(
+                    exp(localVolRND.invcdf(
                         params_.leverageFctPropEps, t)));
                 const Real sUpperBound = std::min(x.back(),
-                    std::exp(localVolRND.invcdf(
+                    exp(localVolRND.invcdf(
                         1.0-params_.leverageFctPropEps, t)));
 
                 const Real lowerL = leverageFct->localVol(t, sLowerBound);
@@ -511,7 +524,7 @@ namespace QuantLib {
                     else if ((*L)[j][i] == Null<Real>())
                         QL_FAIL("internal error");
                 }
-                leverageFct->setInterpolation(Linear());
+                leverageFct->updateInterpolation(i);
 
                 pn = p;
 
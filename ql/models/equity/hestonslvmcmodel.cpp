@@ -33,9 +33,46 @@
 #include <boost/multi_array.hpp>
 #pragma pop_macro("BOOST_DISABLE_ASSERTS")
 
+#include <algorithm>
+#include <exception>
 #include <utility>
 
 namespace QuantLib {
+
+    namespace {
+        // sorts blocks of the vector concurrently and merges them
+        // pairwise. Equal elements are indistinguishable, therefore
+        // the result is the same as the one of std::sort.
+        template <class T>
+        void blockSort(std::vector<T>& v) {
+            const Size nBlocks = std::min(Size(16),
+                std::max(Size(1), v.size()/Size(16384)));
+
+            std::vector<Size> bounds(nBlocks+1);
+            for (Size i=0; i <= nBlocks; ++i)
+                bounds[i] = (i*v.size())/nBlocks;
+
+            #pragma omp parallel for
+            for (long i=0; i < (long)nBlocks; ++i)
+                std::sort(v.begin()+bounds[i], v.begin()+bounds[i+1]);
+
+            for (Size width=1; width < nBlocks; width*=2) {
+                const long nMerges = (long)((nBlocks+2*width-1)/(2*width));
+
+                #pragma omp parallel for
+                for (long m=0; m < nMerges; ++m) {
+                    const Size lo = 2*width*m;
+                    const Size mid = std::min(lo+width, nBlocks);
+                    const Size hi = std::min(lo+2*width, nBlocks);
+                    if (mid < hi)
+                        std::inplace_merge(v.begin()+bounds[lo],
+                                           v.begin()+bounds[mid],
+                                           v.begin()+bounds[hi]);
+                }
+            }
+        }
+    }
+
     HestonSLVMCModel::HestonSLVMCModel(
         Handle<LocalVolTermStructure> localVol,
         Handle<HestonModel> hestonModel,
@@ -93,7 +130,7 @@ namespace QuantLib {
         const Date referenceDate = hestonProcess->riskFreeRate()->referenceDate();
 
         const Volatility lv0
-            = localVol_->localVol(0.0, spot->value())/std::sqrt(v0);
+            = localVol_->localVol(0.0, spot->value())/sqrt(v0);
 
         const ext::shared_ptr<Matrix> L(new Matrix(nBins_, timeGrid_->size()));
 
@@ -101,7 +138,7 @@ namespace QuantLib {
             vStrikes(timeGrid_->size());
         for (Size i=0; i < timeGrid_->size(); ++i) {
             const Integer u = nBins_/2;
-            const Real dx = spot->value()*std::sqrt(QL_EPSILON);
+            const Real dx = spot->value()*sqrt(QL_EPSILON);
 
             vStrikes[i] = ext::make_shared<std::vector<Real> >(nBins_);
 
@@ -147,22 +184,47 @@ namespace QuantLib {
             const Time t = timeGrid_->at(n-1);
             const Time dt = timeGrid_->dt(n-1);
 
-            Array x0(2), dw(2);
+            const auto evolvePaths = [&](Size from, Size to) {
+                Array x0(2), dw(2);
 
-            for (Size i=0; i < calibrationPaths_; ++i) {
-                x0[0] = pairs[i].first;
-                x0[1] = pairs[i].second;
+                for (Size i=from; i < to; ++i) {
+                    x0[0] = pairs[i].first;
+                    x0[1] = pairs[i].second;
 
-                dw[0] = paths[i][n-1][0];
-                dw[1] = paths[i][n-1][1];
+                    dw[0] = paths[i][n-1][0];
+                    dw[1] = paths[i][n-1][1];
 
-                x0 = slvProcess->evolve(t, x0, dt, dw);
+                    x0 = slvProcess->evolve(t, x0, dt, dw);
 
-                pairs[i].first = x0[0];
-                pairs[i].second = x0[1];
+                    pairs[i].first = x0[0];
+                    pairs[i].second = x0[1];
+                }
+            };
+
+            // the first path is evolved on the calling thread so that
+            // any lazily-calculated term-structure data are available
+            // to all threads; the remaining paths are evolved in blocks.
+            evolvePaths(0, 1);
+
+            const Size blockSize = 1024;
+            const Size nBlocks = (calibrationPaths_ + blockSize - 2)/blockSize;
+            std::vector<std::exception_ptr> errors(nBlocks);
+
+            #pragma omp parallel for
+            for (long b=0; b < (long)nBlocks; ++b) {
+                try {
+                    evolvePaths(1 + b*blockSize,
+                        std::min(calibrationPaths_, 1 + (b+1)*blockSize));
+                } catch (...) {
+                    errors[b] = std::current_exception();
+                }
+            }
+            for (const auto& error : errors) {
+                if (error)
+                    std::rethrow_exception(error);
             }
 
-            std::sort(pairs.begin(), pairs.end());
+            blockSort(pairs);
 
             Size s = 0U, e = 0U;
             for (Size i=0; i < nBins_; ++i) {
@@ -176,12 +238,12 @@ namespace QuantLib {
                 sum/=inc;
 
                 vStrikes[n]->at(i) = 0.5*(pairs[e-1].first + pairs[s].first);
-                (*L)[i][n] = std::sqrt(squared(localVol_->localVol(t, vStrikes[n]->at(i), true))/sum);
+                (*L)[i][n] = sqrt(squared(localVol_->localVol(t, vStrikes[n]->at(i), true))/sum);
 
                 s = e;
             }
 
-            leverageFunction_->setInterpolation<Linear>();
+            leverageFunction_->updateInterpolation(n);
         }
     }
 }
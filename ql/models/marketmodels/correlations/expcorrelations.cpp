@@ -58,9 +58,9 @@ namespace QuantLib {
                     if (time<=rateTimes[j]) {
                         correlations[i][j] = correlations[j][i] =
                             longTermCorr + (1.0-longTermCorr) *
-                            std::exp(-beta*std::fabs(
-                                std::pow(rateTimes[i]-time, gamma) -
-                                std::pow(rateTimes[j]-time, gamma)
+                            exp(-beta*fabs(
+                                pow(rateTimes[i]-time, gamma) -
+                                pow(rateTimes[j]-time, gamma)
                                 )
                             );
                     }
@@ -80,7 +80,7 @@ namespace QuantLib {
         QL_REQUIRE(forwards.size()==numberOfRates_,
                    "mismatch between forwards and rateTimes");
         for (Size i=0; i<numberOfRates_; ++i)
-            initialLogForwards_[i] = std::log(forwards[i] +
+            initialLogForwards_[i] = log(forwards[i] +
                                               displacements_[i]);
         calculators_[initialStep_].compute(forwards, initialDrifts_);
     }
@@ -119,7 +119,7 @@ namespace QuantLib {
             logForwards_[i] +=
                 std::inner_product(A.row_begin(i), A.row_end(i),
                                    brownians_.begin(), Real(0.0));
-            forwards_[i] = std::exp(logForwards_[i]) - displacements_[i];
+            forwards_[i] = exp(logForwards_[i]) - displacements_[i];
         }
 
         // same as PC evolver with two steps dropped
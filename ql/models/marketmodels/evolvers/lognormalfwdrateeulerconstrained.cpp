@@ -85,7 +85,7 @@ namespace QuantLib {
         QL_REQUIRE(forwards.size()==numberOfRates_,
                    "mismatch between forwards and rateTimes");
         for (Size i=0; i<numberOfRates_; ++i)
-            initialLogForwards_[i] = std::log(forwards[i] +
+            initialLogForwards_[i] = log(forwards[i] +
                                               displacements_[i]);
         calculators_[initialStep_].compute(forwards, initialDrifts_);
     }
@@ -143,7 +143,7 @@ namespace QuantLib {
         isConstraintActive_ = isConstraintActive;
 
         for (unsigned long i=0; i < rateConstraints_.size(); i++)
-            rateConstraints_[i] = std::log(rateConstraints_[i]+displacements_[i]);
+            rateConstraints_[i] = log(rateConstraints_[i]+displacements_[i]);
     }
 
 
@@ -213,7 +213,7 @@ namespace QuantLib {
         }
 
         for (Size i=alive; i<numberOfRates_; i++)
-            forwards_[i] = std::exp(logForwards_[i]) - displacements_[i];
+            forwards_[i] = exp(logForwards_[i]) - displacements_[i];
 
         // c) update curve state
         curveState_.setOnForwardRates(forwards_);
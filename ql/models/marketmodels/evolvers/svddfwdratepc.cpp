@@ -101,7 +101,7 @@ namespace QuantLib {
         QL_REQUIRE(forwards.size()==numberOfRates_,
                    "mismatch between forwards and rateTimes");
         for (Size i=0; i<numberOfRates_; ++i)
-             initialLogForwards_[i] = std::log(forwards[i] +
+             initialLogForwards_[i] = log(forwards[i] +
                                                displacements_[i]);
         calculators_[initialStep_].compute(forwards, initialDrifts_);
     }
@@ -168,7 +168,7 @@ namespace QuantLib {
             logForwards_[i] += sdMultiplier*
                 std::inner_product(A.row_begin(i), A.row_end(i),
                                    brownians_.begin(), Real(0.0));
-            forwards_[i] = std::exp(logForwards_[i]) - displacements_[i];
+            forwards_[i] = exp(logForwards_[i]) - displacements_[i];
         }
 
         // c) recompute drifts D2 using the predicted forwards;
@@ -177,7 +177,7 @@ namespace QuantLib {
         // d) correct forwards using both drifts
         for (Size i=alive; i<numberOfRates_; ++i) {
             logForwards_[i] += varianceMultiplier*(drifts2_[i]-drifts1_[i])/2.0;
-            forwards_[i] = std::exp(logForwards_[i]) - displacements_[i];
+            forwards_[i] = exp(logForwards_[i]) - displacements_[i];
         }
 
         // e) update curve state
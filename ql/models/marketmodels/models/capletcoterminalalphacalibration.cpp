@@ -123,7 +123,7 @@ namespace QuantLib {
         std::vector<std::vector<Volatility> > newVols;
         std::vector<Volatility> theseNewVols(numberOfRates);
         std::vector<Volatility> firstRateVols(numberOfRates);
-        firstRateVols[0] = std::sqrt(displacedSwapVariances[0]->variances()[0]);
+        firstRateVols[0] = sqrt(displacedSwapVariances[0]->variances()[0]);
         std::vector<Volatility> secondRateVols(numberOfRates);
         std::vector<Real> correlations(numberOfRates);
         newVols.push_back(firstRateVols);
@@ -141,7 +141,7 @@ namespace QuantLib {
             const std::vector<Real>& var =
                                     displacedSwapVariances[i+1]->variances();
             for (Size j =0; j < i+2; ++j)
-                secondRateVols[j] = std::sqrt(var[j]);
+                secondRateVols[j] = sqrt(var[j]);
 
             for (Size k=0; k < i+1; k++) {
                 Real correlation=0.0;
@@ -153,7 +153,7 @@ namespace QuantLib
 
             for (Size i=0; i < numberBigRates; ++i)
             {
-                modelSwaptionVols[i] = std::sqrt(swaptionTotCovariance[i][i]/periodsmm->evolution().rateTimes()[i]);
+                modelSwaptionVols[i] = sqrt(swaptionTotCovariance[i][i]/periodsmm->evolution().rateTimes()[i]);
                 Real scale = marketSwaptionVols[i]/modelSwaptionVols[i];
                 scalingFactors[i] *= scale; // since applied to vol
 
@@ -164,7 +164,7 @@ namespace QuantLib
             for (Size i=0; i < numberBigRates; ++i)
                 modelSwaptionVolsMatrix[iterationsDone][i] = modelSwaptionVols[i];
 
-            periodSwaptionRmsError = std::sqrt(totalSwaptionError/numberBigRates);
+            periodSwaptionRmsError = sqrt(totalSwaptionError/numberBigRates);
             errorImprovement = previousError -periodSwaptionRmsError;
             previousError = periodSwaptionRmsError;
         }
@@ -702,7 +702,7 @@ namespace QuantLib {
                 means[j] = sums[j]/numberOfPaths;
                 Real meanSq = sumsqs[j]/numberOfPaths;
                 Real variance = meanSq - means[j]*means[j];
-                errors[j] = std::sqrt(variance/numberOfPaths);
+                errors[j] = sqrt(variance/numberOfPaths);
 
             }
     }
@@ -1138,7 +1138,7 @@ namespace QuantLib {
                 means[j] = sums[j]/numberOfPaths;
                 Real meanSq = sumsqs[j]/numberOfPaths;
                 Real variance = meanSq - means[j]*means[j];
-                errors[j] = std::sqrt(variance/numberOfPaths);
+                errors[j] = sqrt(variance/numberOfPaths);
 
             }
     }
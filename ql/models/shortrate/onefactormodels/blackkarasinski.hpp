@@ -79,9 +79,9 @@ namespace QuantLib {
               ext::shared_ptr<StochasticProcess1D>(new OrnsteinUhlenbeckProcess(alpha, sigma))),
           fitting_(std::move(fitting)) {}
 
-        Real variable(Time t, Rate r) const override { return std::log(r) - fitting_(t); }
+        Real variable(Time t, Rate r) const override { return log(r) - fitting_(t); }
 
-        Real shortRate(Time t, Real x) const override { return std::exp(x + fitting_(t)); }
+        Real shortRate(Time t, Real x) const override { return exp(x + fitting_(t)); }
 
       private:
         Parameter fitting_;
@@ -53,9 +53,9 @@ namespace QuantLib {
     Real ExtendedCoxIngersollRoss::A(Time t, Time s) const {
         Real pt = termStructure()->discount(t);
         Real ps = termStructure()->discount(s);
-        Real value = CoxIngersollRoss::A(t,s)*std::exp(B(t,s)*phi_(t))*
-            (ps*CoxIngersollRoss::A(0.0,t)*std::exp(-B(0.0,t)*x0()))/
-            (pt*CoxIngersollRoss::A(0.0,s)*std::exp(-B(0.0,s)*x0()));
+        Real value = CoxIngersollRoss::A(t,s)*exp(B(t,s)*phi_(t))*
+            (ps*CoxIngersollRoss::A(0.0,t)*exp(-B(0.0,t)*x0()))/
+            (pt*CoxIngersollRoss::A(0.0,s)*exp(-B(0.0,s)*x0()));
         return value;
     }
 
@@ -78,25 +78,25 @@ namespace QuantLib {
         }
 
         Real sigma2 = sigma()*sigma();
-        Real h = std::sqrt(k()*k() + 2.0*sigma2);
+        Real h = sqrt(k()*k() + 2.0*sigma2);
         Real r0 = termStructure()->forwardRate(0.0, 0.0,
                                                Continuous, NoFrequency);
         Real b = B(t,s);
 
-        Real rho = 2.0*h/(sigma2*(std::exp(h*t) - 1.0));
+        Real rho = 2.0*h/(sigma2*(exp(h*t) - 1.0));
         Real psi = (k() + h)/sigma2;
 
         Real df = 4.0*k()*theta()/sigma2;
-        Real ncps = 2.0*rho*rho*(r0-phi_(0.0))*std::exp(h*t)/(rho+psi+b);
-        Real ncpt = 2.0*rho*rho*(r0-phi_(0.0))*std::exp(h*t)/(rho+psi);
+        Real ncps = 2.0*rho*rho*(r0-phi_(0.0))*exp(h*t)/(rho+psi+b);
+        Real ncpt = 2.0*rho*rho*(r0-phi_(0.0))*exp(h*t)/(rho+psi);
 
         NonCentralCumulativeChiSquareDistribution chis(df, ncps);
         NonCentralCumulativeChiSquareDistribution chit(df, ncpt);
 
-        Real discountShift = (discountT*CoxIngersollRoss::A(0.0,s)*std::exp(-B(0.0,s)*x0()))/
-        (discountS*CoxIngersollRoss::A(0.0,t)*std::exp(-B(0.0,t)*x0()));
+        Real discountShift = (discountT*CoxIngersollRoss::A(0.0,s)*exp(-B(0.0,s)*x0()))/
+        (discountS*CoxIngersollRoss::A(0.0,t)*exp(-B(0.0,t)*x0()));
         
-        Real z = (std::log(CoxIngersollRoss::A(t,s)/strike)-std::log(discountShift))/b;
+        Real z = (log(CoxIngersollRoss::A(t,s)/strike)-log(discountShift))/b;
         Real call = discountS*chis(2.0*z*(rho+psi+b)) -
             strike*discountT*chit(2.0*z*(rho+psi));
         if (type == Option::Call)
@@ -122,8 +122,8 @@ namespace QuantLib {
             Real value(const Array&, Time t) const override {
                 Rate forwardRate =
                     termStructure_->forwardRate(t, t, Continuous, NoFrequency);
-                Real h = std::sqrt(k_*k_ + 2.0*sigma_*sigma_);
-                Real expth = std::exp(t*h);
+                Real h = sqrt(k_*k_ + 2.0*sigma_*sigma_);
+                Real expth = exp(t*h);
                 Real temp = 2.0*h + (k_+h)*(expth-1.0);
                 Real phi = forwardRate -
                     2.0*k_*theta_*(expth - 1.0)/temp -
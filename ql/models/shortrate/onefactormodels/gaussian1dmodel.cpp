@@ -213,12 +213,12 @@ Real Gaussian1dModel::gaussianPolynomialIntegral(
                                ca = 2.0 * c, da = M_SQRT2 * d;
     const boost::math::ntl::RR x0 = y0 * M_SQRT1_2, x1 = y1 * M_SQRT1_2;
     const boost::math::ntl::RR res =
-        (0.125 * (3.0 * aa + 2.0 * ca + 4.0 * e) * std::erf(x1) -
-         1.0 / (4.0 * M_SQRTPI) * std::exp(-x1 * x1) *
+        (0.125 * (3.0 * aa + 2.0 * ca + 4.0 * e) * erf(x1) -
+         1.0 / (4.0 * M_SQRTPI) * exp(-x1 * x1) *
              (2.0 * aa * x1 * x1 * x1 + 3.0 * aa * x1 +
               2.0 * ba * (x1 * x1 + 1.0) + 2.0 * ca * x1 + 2.0 * da)) -
-        (0.125 * (3.0 * aa + 2.0 * ca + 4.0 * e) * std::erf(x0) -
-         1.0 / (4.0 * M_SQRTPI) * std::exp(-x0 * x0) *
+        (0.125 * (3.0 * aa + 2.0 * ca + 4.0 * e) * erf(x0) -
+         1.0 / (4.0 * M_SQRTPI) * exp(-x0 * x0) *
              (2.0 * aa * x0 * x0 * x0 + 3.0 * aa * x0 +
               2.0 * ba * (x0 * x0 + 1.0) + 2.0 * ca * x0 + 2.0 * da));
     return NTL::to_double(res.value());
@@ -226,12 +226,12 @@ Real Gaussian1dModel::gaussianPolynomialIntegral(
     const Real aa = 4.0 * a, ba = 2.0 * M_SQRT2 * b, ca = 2.0 * c,
                da = M_SQRT2 * d;
     const Real x0 = y0 * M_SQRT1_2, x1 = y1 * M_SQRT1_2;
-    return (0.125 * (3.0 * aa + 2.0 * ca + 4.0 * e) * std::erf(x1) -
-            1.0 / (4.0 * M_SQRTPI) * std::exp(-x1 * x1) *
+    return (0.125 * (3.0 * aa + 2.0 * ca + 4.0 * e) * erf(x1) -
+            1.0 / (4.0 * M_SQRTPI) * exp(-x1 * x1) *
                 (2.0 * aa * x1 * x1 * x1 + 3.0 * aa * x1 +
                  2.0 * ba * (x1 * x1 + 1.0) + 2.0 * ca * x1 + 2.0 * da)) -
-           (0.125 * (3.0 * aa + 2.0 * ca + 4.0 * e) * std::erf(x0) -
-            1.0 / (4.0 * M_SQRTPI) * std::exp(-x0 * x0) *
+           (0.125 * (3.0 * aa + 2.0 * ca + 4.0 * e) * erf(x0) -
+            1.0 / (4.0 * M_SQRTPI) * exp(-x0 * x0) *
                 (2.0 * aa * x0 * x0 * x0 + 3.0 * aa * x0 +
                  2.0 * ba * (x0 * x0 + 1.0) + 2.0 * ca * x0 + 2.0 * da));
 #endif
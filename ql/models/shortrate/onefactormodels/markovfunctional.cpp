@@ -142,7 +142,7 @@ namespace QuantLib {
         normalIntegralW_ = gaussHermite.weights();
         for (Size i = 0; i < normalIntegralX_.size(); i++) {
             normalIntegralW_[i] *=
-                std::exp(-normalIntegralX_[i] * normalIntegralX_[i]) * M_1_SQRTPI;
+                exp(-normalIntegralX_[i] * normalIntegralX_[i]) * M_1_SQRTPI;
             normalIntegralX_[i] *= M_SQRT2;
         }
 
@@ -622,7 +622,7 @@ namespace QuantLib {
                 // implementation optimizes the case t=0.0 then using the
                 // initial yts
                 modelOutputs_.modelZerorate_.push_back(
-                    -std::log(zerobond(times_[i], 1.0E-10)) / times_[i]);
+                    -log(zerobond(times_[i], 1.0E-10)) / times_[i]);
             }
 
             // volatility surface
@@ -87,76 +87,34 @@ namespace QuantLib {
 
 #else
 
-#include <boost/signals2/signal_type.hpp>
-
 namespace QuantLib {
 
-    namespace detail {
-
-        class Signal {
-          public:
-            typedef boost::signals2::signal_type<
-                void(),
-                boost::signals2::keywords::mutex_type<std::recursive_mutex> >
-                ::type signal_type;
-
-            void connect(const signal_type::slot_type& slot) {
-                sig_.connect(slot);
-            }
-
-            template <class T>
-            void disconnect(const T& slot) {
-                sig_.disconnect(slot);
-            }
-
-            void operator()() const {
-                sig_();
-            }
-          private:
-            signal_type sig_;
-        };
-
-        template <class T>
-        class ProxyUpdater {
-            T* proxy_;
-          public:
-            explicit ProxyUpdater(const ext::shared_ptr<T>& observerProxy)
-            : proxy_(observerProxy.get()) {}
-
-            void operator()() const {
-                proxy_->update();
-            }
-
-            bool operator==(const ProxyUpdater<T>& other) const {
-                return proxy_ == other.proxy_;
-            }
-
-            bool operator!=(const ProxyUpdater<T>& other) const {
-                return proxy_ != other.proxy_;
-            }
-        };
-
-    }
-
-    void Observable::registerObserver(const ext::shared_ptr<Observer::Proxy>& observerProxy) {
-        {
-            std::lock_guard<std::recursive_mutex> lock(mutex_);
-            observers_.insert(observerProxy);
+    void Observable::registerObserver(
+                const ext::shared_ptr<Observer::Proxy>& observerProxy) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (positions_.emplace(observerProxy.get(),
+                               observers_.size()).second) {
+            observers_.push_back(observerProxy);
+            atomic_store(&snapshot_, ext::shared_ptr<const set_type>());
         }
-
-        detail::Signal::signal_type::slot_type slot {detail::ProxyUpdater<Observer::Proxy>(observerProxy)};
-        #if defined(QL_USE_STD_SHARED_PTR)
-        sig_->connect(slot.track_foreign(observerProxy));
-        #else
-        sig_->connect(slot.track(observerProxy));
-        #endif
     }
 
-    void Observable::unregisterObserver(const ext::shared_ptr<Observer::Proxy>& observerProxy,
-                                        bool disconnect) {
+    void Observable::unregisterObserver(
+                const ext::shared_ptr<Observer::Proxy>& observerProxy) {
         {
-            std::lock_guard<std::recursive_mutex> lock(mutex_);
-            observers_.erase(observerProxy);
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto i = positions_.find(observerProxy.get());
+            if (i != positions_.end()) {
+                // move the last observer into the vacated slot
+                const Size position = i->second;
+                positions_.erase(i);
+                if (position != observers_.size()-1) {
+                    observers_[position] = std::move(observers_.back());
+                    positions_[observers_[position].get()] = position;
+                }
+                observers_.pop_back();
+                atomic_store(&snapshot_, ext::shared_ptr<const set_type>());
+            }
         }
 
         if (ObservableSettings::instance().updatesDeferred()) {
@@ -164,40 +122,60 @@ namespace QuantLib {
             if (ObservableSettings::instance().updatesDeferred())
                 ObservableSettings::instance().unregisterDeferredObserver(observerProxy);
         }
+    }
 
-        if (disconnect) {
-            sig_->disconnect(detail::ProxyUpdater<Observer::Proxy>(observerProxy));
+    ext::shared_ptr<const Observable::set_type> Observable::observers() const {
+        // the snapshot is only accessed through the atomic functions
+        // (found by ADL for both std and boost pointers) so that
+        // readers don't need the lock unless the list changed.
+        ext::shared_ptr<const set_type> snapshot = atomic_load(&snapshot_);
+        if (!snapshot) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            snapshot = atomic_load(&snapshot_);
+            if (!snapshot) {
+                snapshot = ext::make_shared<const set_type>(observers_);
+                atomic_store(&snapshot_, snapshot);
+            }
         }
+        return snapshot;
     }
 
     void Observable::notifyObservers() {
-        if (ObservableSettings::instance().updatesEnabled()) {
-            sig_->operator()();
-        }
-        else {
+        if (!ObservableSettings::instance().updatesEnabled()) {
             bool updatesEnabled = false;
             {
                 std::lock_guard<std::mutex> sLock(ObservableSettings::instance().mutex_);
                 updatesEnabled = ObservableSettings::instance().updatesEnabled();
 
-                if (ObservableSettings::instance().updatesDeferred()) {
-                    std::lock_guard<std::recursive_mutex> lock(mutex_);
-                    ObservableSettings::instance().registerDeferredObservers(observers_);
-                }
+                // repeated notifications of the same observers are
+                // coalesced in the deferred set
+                if (ObservableSettings::instance().updatesDeferred())
+                    ObservableSettings::instance().registerDeferredObservers(*observers());
             }
 
-            if (updatesEnabled)
-                sig_->operator()();
+            if (!updatesEnabled)
+                return;
         }
-    }
 
-    Observable::Observable()
-    : sig_(new detail::Signal()) { }
-
-    Observable::Observable(const Observable&)
-    : sig_(new detail::Signal()) {
-        // the observer set is not copied; no observer asked to
-        // register with this object
+        const ext::shared_ptr<const set_type> observers = this->observers();
+        if (!observers->empty()) {
+            bool successful = true;
+            std::string errMsg;
+            for (const auto& observer : *observers) {
+                try {
+                    observer->update();
+                } catch (std::exception& e) {
+                    // see the comment in the single-threaded
+                    // implementation above
+                    successful = false;
+                    errMsg = e.what();
+                } catch (...) {
+                    successful = false;
+                }
+            }
+            QL_ENSURE(successful,
+                  "could not notify one or more observers: " << errMsg);
+        }
     }
 
 }
@@ -267,6 +267,8 @@ namespace QuantLib {
 #include <mutex>
 #include <set>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace QuantLib {
 
@@ -360,37 +362,44 @@ namespace QuantLib {
         set_type observables_;
     };
 
-    namespace detail {
-        class Signal;
-    }
-
     //! Object that notifies its changes to a set of observers
-    /*! \ingroup patterns */
+    /*! The observers are kept in a contiguous list guarded by a
+        mutex; notification works on an immutable snapshot of the
+        list, which is rebuilt only after the list changes.  This
+        way, repeated notifications from any number of threads don't
+        take the lock, and observers can register or unregister
+        while a notification is in progress.
+
+        \ingroup patterns
+    */
     class Observable {
         friend class Observer;
         friend class ObservableSettings;
       private:
-        typedef std::set<ext::shared_ptr<Observer::Proxy>> set_type;
+        typedef std::vector<ext::shared_ptr<Observer::Proxy>> set_type;
       public:
         typedef set_type::iterator iterator;
 
         // constructors, assignment, destructor
-        Observable();
+        Observable() = default;
         Observable(const Observable&);
         Observable& operator=(const Observable&);
-        virtual ~Observable() {}
+        virtual ~Observable() = default;
         /*! This method should be called at the end of non-const methods
             or when the programmer desires to notify any changes.
         */
         void notifyObservers();
       private:
         void registerObserver(const ext::shared_ptr<Observer::Proxy>&);
-        void unregisterObserver(
-            const ext::shared_ptr<Observer::Proxy>& proxy, bool disconnect);
+        void unregisterObserver(const ext::shared_ptr<Observer::Proxy>&);
+        ext::shared_ptr<const set_type> observers() const;
 
-        ext::shared_ptr<detail::Signal> sig_;
         set_type observers_;
-        mutable std::recursive_mutex mutex_;
+        // position of each proxy in observers_
+        std::unordered_map<const Observer::Proxy*, Size> positions_;
+        // read-only copy of observers_, reset when the latter changes
+        mutable ext::shared_ptr<const set_type> snapshot_;
+        mutable std::mutex mutex_;
     };
 
     //! global repository for run-time library settings
@@ -474,6 +483,11 @@ namespace QuantLib {
     }
 
 
+    inline Observable::Observable(const Observable&) {
+        // the observer set is not copied; no observer asked to
+        // register with this object
+    }
+
     /*! \warning notification is sent before the copy constructor has
              a chance of actually change the data
              members. Therefore, observers whose update() method
@@ -509,7 +523,7 @@ namespace QuantLib {
         }
 
         for (const auto& observable : observables_)
-            observable->unregisterObserver(proxy_, true);
+            observable->unregisterObserver(proxy_);
 
         {
             std::lock_guard<std::recursive_mutex> lock(o.mutex_);
@@ -527,7 +541,7 @@ namespace QuantLib {
             proxy_->deactivate();
 
         for (const auto& observable : observables_)
-            observable->unregisterObserver(proxy_, false);
+            observable->unregisterObserver(proxy_);
     }
 
     inline std::pair<Observer::iterator, bool>
@@ -559,7 +573,7 @@ namespace QuantLib {
         std::lock_guard<std::recursive_mutex> lock(mutex_);
 
         if (h && proxy_)  {
-            h->unregisterObserver(proxy_, true);
+            h->unregisterObserver(proxy_);
         }
 
         return observables_.erase(h);
@@ -569,7 +583,7 @@ namespace QuantLib {
         std::lock_guard<std::recursive_mutex> lock(mutex_);
 
         for (const auto& observable : observables_)
-            observable->unregisterObserver(proxy_, true);
+            observable->unregisterObserver(proxy_);
 
         observables_.clear();
     }
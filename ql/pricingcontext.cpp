@@ -0,0 +1,82 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <pricingcontext.hpp>
+
+namespace QuantLib {
+
+    PricingContext::PricingContext()
+    : evaluationDate_(Settings::instance().evaluationDate().value()),
+      includeReferenceDateEvents_(
+          Settings::instance().includeReferenceDateEvents()),
+      includeTodaysCashFlows_(Settings::instance().includeTodaysCashFlows()),
+      enforcesTodaysHistoricFixings_(
+          Settings::instance().enforcesTodaysHistoricFixings()),
+      fixings_(IndexManager::instance().data_) {}
+
+    std::vector<std::string> PricingContext::histories() const {
+        std::vector<std::string> temp;
+        temp.reserve(fixings_->size());
+        for (const auto& i : *fixings_)
+            temp.push_back(i.first);
+        return temp;
+    }
+
+    TimeSeries<Real>& PricingContext::fixings(const std::string& name) {
+        // the fixings might be shared with the index manager or with
+        // other contexts, which must not see the change
+        if (fixings_.use_count() > 1)
+            fixings_ = ext::make_shared<history_map>(*fixings_);
+        return (*fixings_)[name];
+    }
+
+    const TimeSeries<Real>&
+    PricingContext::fixings(const std::string& name) const {
+        static const TimeSeries<Real> empty;
+        auto i = fixings_->find(name);
+        return i != fixings_->end() ? i->second : empty;
+    }
+
+    void PricingContext::clearHistories() {
+        fixings_ = ext::make_shared<history_map>();
+    }
+
+    void PricingContext::install() const {
+        Settings& settings = Settings::instance();
+        settings.includeReferenceDateEvents() = includeReferenceDateEvents_;
+        settings.includeTodaysCashFlows() = includeTodaysCashFlows_;
+        settings.enforcesTodaysHistoricFixings() =
+            enforcesTodaysHistoricFixings_;
+        IndexManager::instance().setHistories(fixings_);
+        // last, so that observers see the new fixings when notified
+        settings.evaluationDate() = evaluationDate_;
+    }
+
+
+    ScopedPricingContext::ScopedPricingContext(const PricingContext& context) {
+        context.install();
+    }
+
+    ScopedPricingContext::~ScopedPricingContext() {
+        try {
+            saved_.install();
+        } catch (...) {
+            // nothing we can do except bailing out.
+        }
+    }
+
+}
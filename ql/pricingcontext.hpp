@@ -0,0 +1,118 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file pricingcontext.hpp
+    \brief self-contained pricing settings and fixings
+*/
+
+#ifndef quantlib_pricing_context_hpp
+#define quantlib_pricing_context_hpp
+
+#include <indexes/indexmanager.hpp>
+#include <settings.hpp>
+
+namespace QuantLib {
+
+    //! self-contained copy of the run-time settings and index fixings
+    /*! A pricing context holds the evaluation date, the flags
+        otherwise stored in Settings, and the past fixings otherwise
+        stored in the IndexManager.  It is a plain value: it can be
+        built on one thread, modified for a given scenario, and
+        handed to a task running on any other thread, which installs
+        it through a ScopedPricingContext instance.  The fixings
+        are shared with the IndexManager and with copies of the
+        context until either of them is modified, so that capturing
+        and installing a context doesn't copy them.
+
+        \warning Settings and IndexManager are thread-local only
+                 when QL_ENABLE_SESSIONS is defined; without it,
+                 contexts must not be installed on concurrent
+                 threads.  Also, objects are notified of changes in
+                 the settings of the thread they registered on;
+                 market data shared between tasks should therefore
+                 not depend on the evaluation date.
+    */
+    class PricingContext {
+      public:
+        typedef IndexManager::history_map history_map;
+        //! captures the settings and fixings in use on the current thread
+        PricingContext();
+        //! \name settings
+        //@{
+        //! the evaluation date; the null date means today's date
+        Date& evaluationDate() { return evaluationDate_; }
+        const Date& evaluationDate() const { return evaluationDate_; }
+        bool& includeReferenceDateEvents() {
+            return includeReferenceDateEvents_;
+        }
+        bool includeReferenceDateEvents() const {
+            return includeReferenceDateEvents_;
+        }
+        ext::optional<bool>& includeTodaysCashFlows() {
+            return includeTodaysCashFlows_;
+        }
+        ext::optional<bool> includeTodaysCashFlows() const {
+            return includeTodaysCashFlows_;
+        }
+        bool& enforcesTodaysHistoricFixings() {
+            return enforcesTodaysHistoricFixings_;
+        }
+        bool enforcesTodaysHistoricFixings() const {
+            return enforcesTodaysHistoricFixings_;
+        }
+        //@}
+        //! \name fixings
+        //@{
+        //! names of the indexes for which fixings are stored
+        std::vector<std::string> histories() const;
+        //! fixings of the index with the given (case-insensitive) name
+        /*! \warning the returned reference must not be kept after
+                     the context is copied or installed.
+        */
+        TimeSeries<Real>& fixings(const std::string& name);
+        const TimeSeries<Real>& fixings(const std::string& name) const;
+        void clearHistories();
+        //@}
+        /*! replaces the settings and fixings of the current thread
+            with the contents of this context.  Observers of the
+            evaluation date and of the index fixings are notified.
+        */
+        void install() const;
+      private:
+        Date evaluationDate_;
+        bool includeReferenceDateEvents_;
+        ext::optional<bool> includeTodaysCashFlows_;
+        bool enforcesTodaysHistoricFixings_;
+        ext::shared_ptr<history_map> fixings_;
+    };
+
+
+    //! helper class to install a pricing context for a given scope
+    /*! The settings and fixings in use on the current thread are
+        restored when the instance goes out of scope.
+    */
+    class ScopedPricingContext { // NOLINT(cppcoreguidelines-special-member-functions)
+      public:
+        explicit ScopedPricingContext(const PricingContext& context);
+        ~ScopedPricingContext();
+      private:
+        PricingContext saved_;
+    };
+
+}
+
+#endif
@@ -108,7 +108,7 @@ namespace QuantLib {
             for (Size i=0; i < rho.rows(); ++i)
                 for (Size j=i; j < rho.columns(); ++j)
                     rho[i][j] = rho[j][i] =
-                        variances[std::min(i,j)] / std::sqrt(variances[i]*variances[j]);
+                        variances[std::min(i,j)] / sqrt(variances[i]*variances[j]);
 
             const Handle<YieldTermStructure> zeroTS(
                 ext::make_shared<FlatForward>(rTS->referenceDate(), 0.0, rTS->dayCounter())
@@ -119,7 +119,7 @@ namespace QuantLib {
             for (Size i=0; i < futureFixings; ++i) {
                 const Date& fixingDate = fixingDates[i];
                 const Volatility sig = volTS->blackVol(fixingDate, payoff->strike())
-                    * std::sqrt(fixingTimes[i]/fixingTimes.back());
+                    * sqrt(fixingTimes[i]/fixingTimes.back());
 
                 processes.emplace_back(
                     ext::make_shared<GeneralizedBlackScholesProcess>(
@@ -160,7 +160,7 @@ namespace QuantLib {
                 strike,
                 process_->x0()/(pastFixings + futureFixings)
                     *qTS->discount(fixingDates.back())/rTS->discount(fixingDates.back()),
-                std::sqrt(volTS->blackVariance(fixingDates.back(), strike)),
+                sqrt(volTS->blackVariance(fixingDates.back(), strike)),
                 rTS->discount(exerciseDate)
             );
         }
@@ -76,9 +76,9 @@ namespace QuantLib {
             zeroRate(maturity, divdc, Continuous, NoFrequency);
         Real b = riskFreeRate - dividendYield;
 
-        Real Se = (std::fabs(b) > 1000*QL_EPSILON) 
+        Real Se = (fabs(b) > 1000*QL_EPSILON) 
             ? Real((spot/(T*b))*(exp((b-riskFreeRate)*T2)-exp(-riskFreeRate*T2)))
-            : Real(spot*T2/T * std::exp(-riskFreeRate*T2));
+            : Real(spot*T2/T * exp(-riskFreeRate*T2));
 
         Real X;
         if (T2 < T) {
@@ -89,7 +89,7 @@ namespace QuantLib {
             X = strike;
         }
 
-        Real m = (std::fabs(b) > 1000*QL_EPSILON) ? ((exp(b*T2)-1)/b) : T2;
+        Real m = (fabs(b) > 1000*QL_EPSILON) ? ((exp(b*T2)-1)/b) : T2;
 
         Real M = (2*spot*spot/(b+volatility*volatility)) *
             (((exp((2*b+volatility*volatility)*T2)-1)
@@ -66,7 +66,8 @@ namespace QuantLib {
              Size requiredSamples,
              Real requiredTolerance,
              Size maxSamples,
-             BigNatural seed);
+             BigNatural seed,
+             Size streams = 1);
       protected:
         ext::shared_ptr<path_pricer_type> pathPricer() const override;
         ext::shared_ptr<path_pricer_type> controlPathPricer() const override;
@@ -110,7 +111,8 @@ namespace QuantLib {
              Size requiredSamples,
              Real requiredTolerance,
              Size maxSamples,
-             BigNatural seed)
+             BigNatural seed,
+             Size streams)
     : MCDiscreteAveragingAsianEngineBase<SingleVariate,RNG,S>(process,
                                                               brownianBridge,
                                                               antitheticVariate,
@@ -118,7 +120,10 @@ namespace QuantLib {
                                                               requiredSamples,
                                                               requiredTolerance,
                                                               maxSamples,
-                                                              seed) {}
+                                                              seed,
+                                                              Null<Size>(),
+                                                              Null<Size>(),
+                                                              streams) {}
 
     template <class RNG, class S>
     inline
@@ -196,6 +201,7 @@ namespace QuantLib {
         MakeMCDiscreteArithmeticAPEngine& withSeed(BigNatural seed);
         MakeMCDiscreteArithmeticAPEngine& withAntitheticVariate(bool b = true);
         MakeMCDiscreteArithmeticAPEngine& withControlVariate(bool b = true);
+        MakeMCDiscreteArithmeticAPEngine& withStreams(Size streams);
         // conversion to pricing engine
         operator ext::shared_ptr<PricingEngine>() const;
       private:
@@ -205,6 +211,7 @@ namespace QuantLib {
         Real tolerance_;
         bool brownianBridge_ = true;
         BigNatural seed_ = 0;
+        Size streams_ = 1;
     };
 
     template <class RNG, class S>
@@ -270,6 +277,13 @@ namespace QuantLib {
         return *this;
     }
 
+    template <class RNG, class S>
+    inline MakeMCDiscreteArithmeticAPEngine<RNG,S>&
+    MakeMCDiscreteArithmeticAPEngine<RNG,S>::withStreams(Size streams) {
+        streams_ = streams;
+        return *this;
+    }
+
     template <class RNG, class S>
     inline
     MakeMCDiscreteArithmeticAPEngine<RNG,S>::operator ext::shared_ptr<PricingEngine>()
@@ -280,7 +294,8 @@ namespace QuantLib {
                                                 antithetic_, controlVariate_,
                                                 samples_, tolerance_,
                                                 maxSamples_,
-                                                seed_));
+                                                seed_,
+                                                streams_));
     }
 
 
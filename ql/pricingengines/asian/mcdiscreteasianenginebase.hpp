@@ -73,7 +73,8 @@ namespace QuantLib {
                                            Size maxSamples,
                                            BigNatural seed,
                                            Size timeSteps = Null<Size>(),
-                                           Size timeStepsPerYear = Null<Size>());
+                                           Size timeStepsPerYear = Null<Size>(),
+                                           Size streams = 1);
         void calculate() const override {
             try {
                 McSimulation<MC,RNG,S>::calculate(requiredTolerance_,
@@ -116,6 +117,18 @@ namespace QuantLib {
                          new path_generator_type(process_, grid,
                                                  gen, brownianBridge_));
         }
+        ext::shared_ptr<path_generator_type>
+        skippedPathGenerator(Size firstSample) const override {
+
+            Size dimensions = process_->factors();
+            TimeGrid grid = this->timeGrid();
+            typename RNG::rsg_type gen =
+                RNG::make_sequence_generator(dimensions*(grid.size()-1),seed_,
+                                             firstSample);
+            return ext::shared_ptr<path_generator_type>(
+                         new path_generator_type(process_, grid,
+                                                 gen, brownianBridge_));
+        }
         Real controlVariateValue() const override;
         // data members
         ext::shared_ptr<StochasticProcess> process_;
@@ -139,8 +152,10 @@ namespace QuantLib {
         Size maxSamples,
         BigNatural seed,
         Size timeSteps,
-        Size timeStepsPerYear)
-    : McSimulation<MC, RNG, S>(antitheticVariate, controlVariate), process_(std::move(process)),
+        Size timeStepsPerYear,
+        Size streams)
+    : McSimulation<MC, RNG, S>(antitheticVariate, controlVariate, streams),
+      process_(std::move(process)),
       requiredSamples_(requiredSamples), maxSamples_(maxSamples), timeSteps_(timeSteps),
       timeStepsPerYear_(timeStepsPerYear), requiredTolerance_(requiredTolerance),
       brownianBridge_(brownianBridge), seed_(seed) {
@@ -93,7 +93,7 @@ void TurnbullWakemanAsianEngine::calculate() const {
 
         spotVars.push_back(
             process_->blackVolatility()->blackVariance(times.back(), effectiveStrike));
-        spotVolsVec.push_back(std::sqrt(spotVars.back() / times.back()));
+        spotVolsVec.push_back(sqrt(spotVars.back() / times.back()));
 
         EA += forwards.back();
     }
@@ -132,7 +132,7 @@ namespace QuantLib {
     }
 
     Real AnalyticBarrierEngine::stdDeviation() const {
-        return std::sqrt(process_->blackVolatility()->blackVariance(
+        return sqrt(process_->blackVolatility()->blackVariance(
                         arguments_.exercise->lastDate(),
                         strike()));
     }
@@ -180,7 +180,7 @@ namespace QuantLib {
 
     Real AnalyticBarrierEngine::A(Real phi) const {
         Real x1 =
-            std::log(underlying()/strike())/stdDeviation() + muSigma();
+            log(underlying()/strike())/stdDeviation() + muSigma();
         Real N1 = f_(phi*x1);
         Real N2 = f_(phi*(x1-stdDeviation()));
 
@@ -190,7 +190,7 @@ namespace QuantLib {
 
     Real AnalyticBarrierEngine::B(Real phi) const {
         Real x2 =
-            std::log(underlying()/barrier())/stdDeviation() + muSigma();
+            log(underlying()/barrier())/stdDeviation() + muSigma();
         Real N1 = f_(phi*x2);
         Real N2 = f_(phi*(x2-stdDeviation()));
         return phi*(underlying() * dividendDiscount() * N1
@@ -199,9 +199,9 @@ namespace QuantLib {
 
     Real AnalyticBarrierEngine::C(Real eta, Real phi) const {
         Real HS = barrier()/underlying();
-        Real powHS0 = std::pow(HS, 2 * mu());
+        Real powHS0 = pow(HS, 2 * mu());
         Real powHS1 = powHS0 * HS * HS;
-        Real y1 = std::log(barrier()*HS/strike())/stdDeviation() + muSigma();
+        Real y1 = log(barrier()*HS/strike())/stdDeviation() + muSigma();
         Real N1 = f_(eta*y1);
         Real N2 = f_(eta*(y1-stdDeviation()));
         // when N1 or N2 are zero, the corresponding powHS might
@@ -212,9 +212,9 @@ namespace QuantLib {
 
     Real AnalyticBarrierEngine::D(Real eta, Real phi) const {
         Real HS = barrier()/underlying();
-        Real powHS0 = std::pow(HS, 2 * mu());
+        Real powHS0 = pow(HS, 2 * mu());
         Real powHS1 = powHS0 * HS * HS;
-        Real y2 = std::log(barrier()/underlying())/stdDeviation() + muSigma();
+        Real y2 = log(barrier()/underlying())/stdDeviation() + muSigma();
         Real N1 = f_(eta*y2);
         Real N2 = f_(eta*(y2-stdDeviation()));
         // when N1 or N2 are zero, the corresponding powHS might
@@ -225,11 +225,11 @@ namespace QuantLib {
 
     Real AnalyticBarrierEngine::E(Real eta) const {
         if (rebate() > 0) {
-            Real powHS0 = std::pow(barrier()/underlying(), 2 * mu());
+            Real powHS0 = pow(barrier()/underlying(), 2 * mu());
             Real x2 =
-                std::log(underlying()/barrier())/stdDeviation() + muSigma();
+                log(underlying()/barrier())/stdDeviation() + muSigma();
             Real y2 =
-                std::log(barrier()/underlying())/stdDeviation() + muSigma();
+                log(barrier()/underlying())/stdDeviation() + muSigma();
             Real N1 = f_(eta*(x2 - stdDeviation()));
             Real N2 = f_(eta*(y2 - stdDeviation()));
             // when N2 is zero, powHS0 might be infinity, resulting in
@@ -244,13 +244,13 @@ namespace QuantLib {
         if (rebate() > 0) {
             Rate m = mu();
             Volatility vol = volatility();
-            Real lambda = std::sqrt(m*m + 2.0*riskFreeRate()/(vol * vol));
+            Real lambda = sqrt(m*m + 2.0*riskFreeRate()/(vol * vol));
             Real HS = barrier()/underlying();
-            Real powHSplus = std::pow(HS, m + lambda);
-            Real powHSminus = std::pow(HS, m - lambda);
+            Real powHSplus = pow(HS, m + lambda);
+            Real powHSminus = pow(HS, m - lambda);
 
             Real sigmaSqrtT = stdDeviation();
-            Real z = std::log(barrier()/underlying())/sigmaSqrtT
+            Real z = log(barrier()/underlying())/sigmaSqrtT
                 + lambda * sigmaSqrtT;
 
             Real N1 = f_(eta * z);
@@ -166,21 +166,21 @@ namespace QuantLib {
         Real rho_ = rho();
         Real HSMu = HS(S, barrier, 2 * mu_);
         Real HSMu1 = HS(S, barrier, 2 * (mu_ + 1));
-        Real X1 = strike * std::exp(-r * T);
+        Real X1 = strike * exp(-r * T);
 
         if (strike < barrier){
             switch (barrierType) {
               case Barrier::DownOut:
-                result = S * std::exp((b - r) * T);
+                result = S * exp((b - r) * T);
                 result *= (M(g1_, e1_, rho_) - HSMu1 * M(g3_, -e3_, -rho_));
                 result -= X1 * (M(g2_, e2_, rho_)-HSMu*M(g4_, -e4_, -rho_));
                 return result;
 
               case Barrier::UpOut:
-                result = S * std::exp((b - r) * T);
+                result = S * exp((b - r) * T);
                 result *= (M(-g1_, -e1_, rho_) - HSMu1 * M(-g3_, e3_, -rho_));
                 result -= X1 * (M(-g2_, -e2_, rho_) - HSMu * M(-g4_, e4_, -rho_));
-                result -= S * std::exp((b - r) * T) * 
+                result -= S * exp((b - r) * T) * 
                           (M(-d1(strike, b), -e1_, rho_) - HSMu1 * 
                           M(e3_, -f1(barrier, strike, b),-rho_));
                 result += X1 * (M(-d2(strike, b), -e2_, rho_) - HSMu * 
@@ -212,15 +212,15 @@ namespace QuantLib {
         Real rho_ = rho();
         Real HSMu = HS(S, barrier, 2 * mu_);
         Real HSMu1 = HS(S, barrier, 2 * (mu_ + 1));
-        Real X1 = strike * std::exp(-r * T);
+        Real X1 = strike * exp(-r * T);
 
         if (strike > barrier) {
-            result = S * std::exp((b - r) * T);
+            result = S * exp((b - r) * T);
             result *= (M(d1(strike, b), e1_, rho_) - HSMu1 * M(f1(barrier, strike, b), -e3_, -rho_));
             result -= X1 * (M(d2(strike, b), e2_, rho_) - HSMu * M(f2(barrier, strike, b), -e4_, -rho_));
             return result;
         } else {
-            Real S1 = S * std::exp((b - r) * T);
+            Real S1 = S * exp((b - r) * T);
             result = S1;
             result *= (M(-g1_, -e1_, rho_) - HSMu1 * M(-g3_,e3_,-rho_));
             result -= X1 * (M(-g2_, -e2_, rho_) - HSMu * M(-g4_, e4_, -rho_));
@@ -264,10 +264,10 @@ namespace QuantLib {
         Real HSMu1 = HS(S, barrier, 2 * (mu_ + 1));
 
         Real result;
-        result = S * std::exp((b - r) * T);
+        result = S * exp((b - r) * T);
         result *= (M(d1(strike, b), eta * e1_, eta * rho_)-HSMu1 * 
                   M(f1(barrier, strike, b), eta * e3_, eta * rho_));
-        result -= (strike * std::exp(-r * T) * 
+        result -= (strike * exp(-r * T) * 
                   (M(d2(strike, b),eta * e2_, eta * rho_) - HSMu *
                   M(f2(barrier, strike, b), eta * e4_, eta * rho_)));
         return result;
@@ -293,13 +293,13 @@ namespace QuantLib {
         Real S = underlying();
         Real T = residualTime();
         Real sigma = volatility(T, strike);
-        return (std::log(S / strike) + 2 * std::log(barrier / S) + 
-              (b + (std::pow(sigma, 2) / 2))*T) / (sigma*std::sqrt(T));
+        return (log(S / strike) + 2 * log(barrier / S) + 
+              (b + (pow(sigma, 2) / 2))*T) / (sigma*sqrt(T));
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::f2(Real barrier, Real strike, Rate b) const {
         Time T = residualTime();
-        return f1(barrier, strike, b) - volatility(T, strike) * std::sqrt(T);
+        return f1(barrier, strike, b) - volatility(T, strike) * sqrt(T);
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::M(Real a, Real b, Real rho) const {
@@ -308,7 +308,7 @@ namespace QuantLib {
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::rho() const {
-        return std::sqrt(coverEventTime() / residualTime());
+        return sqrt(coverEventTime() / residualTime());
     }
 
     Rate AnalyticPartialTimeBarrierOptionEngine::mu(Real strike, Rate b) const {
@@ -319,64 +319,64 @@ namespace QuantLib {
     Real AnalyticPartialTimeBarrierOptionEngine::d1(Real strike, Rate b) const {
         Time T2 = residualTime();
         Volatility vol = volatility(T2, strike);
-        return (std::log(underlying() / strike) + (b + vol * vol / 2) * T2) / (std::sqrt(T2) * vol);
+        return (log(underlying() / strike) + (b + vol * vol / 2) * T2) / (sqrt(T2) * vol);
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::d2(Real strike, Rate b) const {
         Time T2 = residualTime();
         Volatility vol = volatility(T2, strike);
-        return d1(strike, b) - vol * std::sqrt(T2);
+        return d1(strike, b) - vol * sqrt(T2);
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::e1(Real barrier, Real strike, Rate b) const {
         Time T1 = coverEventTime();
         Volatility vol = volatility(T1, strike);
-        return (std::log(underlying() / barrier) + (b + vol * vol / 2) * T1) / (std::sqrt(T1) * vol);
+        return (log(underlying() / barrier) + (b + vol * vol / 2) * T1) / (sqrt(T1) * vol);
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::e2(Real barrier, Real strike, Rate b) const {
         Time T1 = coverEventTime();
         Volatility vol = volatility(T1, strike);
-        return e1(barrier, strike, b) - vol * std::sqrt(T1);
+        return e1(barrier, strike, b) - vol * sqrt(T1);
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::e3(Real barrier, Real strike, Rate b) const {
         Time T1 = coverEventTime();
         Real vol = volatility(T1, strike);
-        return e1(barrier, strike, b) + (2 * std::log(barrier / underlying()) / (vol * std::sqrt(T1)));
+        return e1(barrier, strike, b) + (2 * log(barrier / underlying()) / (vol * sqrt(T1)));
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::e4(Real barrier, Real strike, Rate b) const {
         Time t = coverEventTime();
-        return e3(barrier, strike, b) - volatility(t, strike) * std::sqrt(t);
+        return e3(barrier, strike, b) - volatility(t, strike) * sqrt(t);
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::g1(Real barrier, Real strike, Rate b) const {
         Time T2 = residualTime();
         Volatility vol = volatility(T2, strike);
-        return (std::log(underlying() / barrier) + (b + vol * vol / 2) * T2) / (std::sqrt(T2) * vol);
+        return (log(underlying() / barrier) + (b + vol * vol / 2) * T2) / (sqrt(T2) * vol);
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::g2(Real barrier, Real strike, Rate b) const {
         Time T2 = residualTime();
         Volatility vol = volatility(T2, strike);
-        return g1(barrier, strike, b) - vol * std::sqrt(T2);
+        return g1(barrier, strike, b) - vol * sqrt(T2);
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::g3(Real barrier, Real strike, Rate b) const {
         Time T2 = residualTime();
         Real vol = volatility(T2, strike);
-        return g1(barrier, strike, b) + (2 * std::log(barrier / underlying()) /(vol * std::sqrt(T2)));
+        return g1(barrier, strike, b) + (2 * log(barrier / underlying()) /(vol * sqrt(T2)));
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::g4(Real barrier, Real strike, Rate b) const {
         Time T2 = residualTime();
         Real vol = volatility(T2, strike);
-        return g3(barrier, strike, b) - vol * std::sqrt(T2);
+        return g3(barrier, strike, b) - vol * sqrt(T2);
     }
 
     Real AnalyticPartialTimeBarrierOptionEngine::HS(Real S, Real H, Real power) const {
-        return std::pow((H / S), power);
+        return pow((H / S), power);
     }
 
 }
@@ -138,9 +138,9 @@ namespace QuantLib {
             maxTimeSteps_ > timeSteps_ && s0 > 0 && arguments_.barrier > 0) {
             Real divisor;
             if (s0 > arguments_.barrier)
-               divisor = std::pow(std::log(s0 / arguments_.barrier), 2);
+               divisor = pow(log(s0 / arguments_.barrier), 2);
             else
-               divisor = std::pow(std::log(arguments_.barrier / s0), 2);
+               divisor = pow(log(arguments_.barrier / s0), 2);
             if (!close(divisor,0)) {
                 for (Size i=1; i < timeSteps_ ; ++i) {
                     Size optimum = Size(( i*i * v*v * maturity) / divisor);
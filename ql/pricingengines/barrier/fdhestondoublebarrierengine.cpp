@@ -67,8 +67,8 @@ namespace QuantLib {
         const ext::shared_ptr<StrikedTypePayoff> payoff =
             ext::dynamic_pointer_cast<StrikedTypePayoff>(arguments_.payoff);
 
-        Real xMin = std::log(arguments_.barrier_lo);
-        Real xMax = std::log(arguments_.barrier_hi);
+        Real xMin = log(arguments_.barrier_lo);
+        Real xMax = log(arguments_.barrier_hi);
 
         const ext::shared_ptr<Fdm1dMesher> equityMesher(
             new FdmBlackScholesMesher(
@@ -67,9 +67,9 @@ namespace QuantLib {
                 vol = diffProcess_->diffusion(timeGrid[i],asset_price);
                 dt = timeGrid.dt(i);
 
-                x = std::log(new_asset_price / asset_price);
-                y = 0.5*(x - std::sqrt (x*x - 2*vol*vol*dt*std::log(u[i])));
-                y = asset_price * std::exp(y);
+                x = log(new_asset_price / asset_price);
+                y = 0.5*(x - sqrt (x*x - 2*vol*vol*dt*log(u[i])));
+                y = asset_price * exp(y);
                 if (y <= barrier_) {
                     isOptionActive = true;
                     if (knockNode == null)
@@ -86,9 +86,9 @@ namespace QuantLib {
                 vol = diffProcess_->diffusion(timeGrid[i],asset_price);
                 dt = timeGrid.dt(i);
 
-                x = std::log(new_asset_price / asset_price);
-                y = 0.5*(x + std::sqrt(x*x - 2*vol*vol*dt*std::log((1-u[i]))));
-                y = asset_price * std::exp(y);
+                x = log(new_asset_price / asset_price);
+                y = 0.5*(x + sqrt(x*x - 2*vol*vol*dt*log((1-u[i]))));
+                y = asset_price * exp(y);
                 if (y >= barrier_) {
                     isOptionActive = true;
                     if (knockNode == null)
@@ -105,9 +105,9 @@ namespace QuantLib {
                 vol = diffProcess_->diffusion(timeGrid[i],asset_price);
                 dt = timeGrid.dt(i);
 
-                x = std::log(new_asset_price / asset_price);
-                y = 0.5*(x - std::sqrt(x*x - 2*vol*vol*dt*std::log(u[i])));
-                y = asset_price * std::exp(y);
+                x = log(new_asset_price / asset_price);
+                y = 0.5*(x - sqrt(x*x - 2*vol*vol*dt*log(u[i])));
+                y = asset_price * exp(y);
                 if (y <= barrier_) {
                     isOptionActive = false;
                     if (knockNode == null)
@@ -124,9 +124,9 @@ namespace QuantLib {
                 vol = diffProcess_->diffusion(timeGrid[i],asset_price);
                 dt = timeGrid.dt(i);
 
-                x = std::log(new_asset_price / asset_price);
-                y = 0.5*(x + std::sqrt(x*x - 2*vol*vol*dt*std::log((1-u[i]))));
-                y = asset_price * std::exp(y);
+                x = log(new_asset_price / asset_price);
+                y = 0.5*(x + sqrt(x*x - 2*vol*vol*dt*log((1-u[i]))));
+                y = asset_price * exp(y);
                 if (y >= barrier_) {
                     isOptionActive = false;
                     if (knockNode == null)
@@ -74,7 +74,8 @@ namespace QuantLib {
                         Real requiredTolerance,
                         Size maxSamples,
                         bool isBiased,
-                        BigNatural seed);
+                        BigNatural seed,
+                        Size streams = 1);
         void calculate() const override {
             Real spot = process_->x0();
             QL_REQUIRE(spot > 0.0, "negative or null underlying given");
@@ -99,6 +100,15 @@ namespace QuantLib {
                          new path_generator_type(process_,
                                                  grid, gen, brownianBridge_));
         }
+        ext::shared_ptr<path_generator_type>
+        skippedPathGenerator(Size firstSample) const override {
+            TimeGrid grid = timeGrid();
+            typename RNG::rsg_type gen =
+                RNG::make_sequence_generator(grid.size()-1,seed_,firstSample);
+            return ext::shared_ptr<path_generator_type>(
+                         new path_generator_type(process_,
+                                                 grid, gen, brownianBridge_));
+        }
         ext::shared_ptr<path_pricer_type> pathPricer() const override;
         // data members
         ext::shared_ptr<GeneralizedBlackScholesProcess> process_;
@@ -126,6 +136,7 @@ namespace QuantLib {
         MakeMCBarrierEngine& withMaxSamples(Size samples);
         MakeMCBarrierEngine& withBias(bool b = true);
         MakeMCBarrierEngine& withSeed(BigNatural seed);
+        MakeMCBarrierEngine& withStreams(Size streams);
         // conversion to pricing engine
         operator ext::shared_ptr<PricingEngine>() const;
       private:
@@ -134,6 +145,7 @@ namespace QuantLib {
         Size steps_, stepsPerYear_, samples_, maxSamples_;
         Real tolerance_;
         BigNatural seed_ = 0;
+        Size streams_ = 1;
     };
 
 
@@ -193,8 +205,10 @@ namespace QuantLib {
         Real requiredTolerance,
         Size maxSamples,
         bool isBiased,
-        BigNatural seed)
-    : McSimulation<SingleVariate, RNG, S>(antitheticVariate, false), process_(std::move(process)),
+        BigNatural seed,
+        Size streams)
+    : McSimulation<SingleVariate, RNG, S>(antitheticVariate, false, streams),
+      process_(std::move(process)),
       timeSteps_(timeSteps), timeStepsPerYear_(timeStepsPerYear), requiredSamples_(requiredSamples),
       maxSamples_(maxSamples), requiredTolerance_(requiredTolerance), isBiased_(isBiased),
       brownianBridge_(brownianBridge), seed_(seed) {
@@ -346,6 +360,13 @@ namespace QuantLib {
         return *this;
     }
 
+    template <class RNG, class S>
+    inline MakeMCBarrierEngine<RNG,S>&
+    MakeMCBarrierEngine<RNG,S>::withStreams(Size streams) {
+        streams_ = streams;
+        return *this;
+    }
+
     template <class RNG, class S>
     inline
     MakeMCBarrierEngine<RNG,S>::operator ext::shared_ptr<PricingEngine>()
@@ -363,7 +384,8 @@ namespace QuantLib {
                                    samples_, tolerance_,
                                    maxSamples_,
                                    biased_,
-                                   seed_));
+                                   seed_,
+                                   streams_));
     }
 
 }
@@ -39,13 +39,13 @@ namespace QuantLib {
         const Real a = f2 + k;
         const Real b = f2/a;
 
-        const Real sigma1 = std::sqrt(variance1);
-        const Real sigma2 = std::sqrt(variance2);
+        const Real sigma1 = sqrt(variance1);
+        const Real sigma2 = sqrt(variance2);
 
-        const Real stdev = std::sqrt(
+        const Real stdev = sqrt(
             variance1 + b*b*variance2 - 2*rho_*b*sigma1*sigma2);
 
-        const Real lfa = std::log(f1/a);
+        const Real lfa = log(f1/a);
 
         const Real d1 =
             (lfa + (0.5*variance1 + 0.5*b*b*variance2 - b*rho_*sigma1*sigma2))/stdev;
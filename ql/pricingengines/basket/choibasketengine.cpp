@@ -96,13 +96,13 @@ namespace QuantLib {
 
         const Matrix Sigma = getCovariance(stdDev.begin(), stdDev.end(), rho_);
         Array vStar1 = Sigma*g;
-        vStar1 /= std::sqrt(DotProduct(g, vStar1));
+        vStar1 /= sqrt(DotProduct(g, vStar1));
 
         const Matrix C = CholeskyDecomposition(Sigma);
 
-        const Real eps = 100*std::sqrt(QL_EPSILON);
+        const Real eps = 100*sqrt(QL_EPSILON);
         // publication sets tol=0, pyfeng implementation sets tol=0.01
-        const Real tol = 100*std::sqrt(QL_EPSILON);
+        const Real tol = 100*sqrt(QL_EPSILON);
 
         bool flip = false;
         for (Size i=0; i < n_; ++i)
@@ -147,11 +147,11 @@ namespace QuantLib {
 
         std::vector<Size> nIntOrder(n_-1);
         Real lambda = lambda_;
-        const Real alpha = 1/std::abs(DotProduct(g, vStar1));
+        const Real alpha = 1/abs(DotProduct(g, vStar1));
         do {
             const Real intScale = lambda * alpha;
             for (Size i=0; i < n_-1; ++i)
-                nIntOrder[i] = Size(std::lround(1 + intScale*sv[i]));
+                nIntOrder[i] = Size(lround(1 + intScale*sv[i]));
 
             lambda*=0.9;
             QL_REQUIRE(lambda/lambda_ > 1e-10,
@@ -166,7 +166,7 @@ namespace QuantLib {
             quotes.push_back(ext::make_shared<SimpleQuote>(fwd[i]));
 
             const Handle<BlackVolTermStructure> bv = processes_[i]->blackVolatility();
-            const Volatility vol = vStar1[i] / std::sqrt(
+            const Volatility vol = vStar1[i] / sqrt(
                 bv->dayCounter().yearFraction(bv->referenceDate(), maturityDate)
             );
             p.push_back(
@@ -198,7 +198,7 @@ namespace QuantLib {
             nIntOrder,
             [](const Size n) { return ext::make_shared<GaussHermiteIntegration>(n); }
         );
-        const Real normFactor = std::pow(M_PI, -0.5*nIntOrder.size());
+        const Real normFactor = pow(M_PI, -0.5*nIntOrder.size());
 
         std::vector<Real> dStore;
         dStore.reserve(ghq.weights().size());
@@ -209,7 +209,7 @@ namespace QuantLib {
                 quotes[i]->setValue(f[i]);
 
             dStore.push_back(ext::any_cast<Real>(option.additionalResults().at("d")));
-            return std::exp(-DotProduct(z, z)) * option.NPV();
+            return exp(-DotProduct(z, z)) * option.NPV();
         };
 
         results_.value = ghq(bsm1dPricer) * normFactor;
@@ -231,9 +231,9 @@ namespace QuantLib {
                     const Real d = dStore[dStoreCounter++];
                     const Real vz = std::inner_product(
                         v.row_begin(k), v.row_end(k), z.begin(), Real(0.0));
-                    const Real f = std::exp(-M_SQRT2*vz - vq[k]);
+                    const Real f = exp(-M_SQRT2*vz - vq[k]);
 
-                    return std::exp(-DotProduct(z, z)) * f * N(d + vStar1[k]);
+                    return exp(-DotProduct(z, z)) * f * N(d + vStar1[k]);
                 };
 
                 fwdDelta[k] = dr0*weights[k]*(ghq(deltaPricer) * normFactor + putIndicator);
@@ -247,9 +247,9 @@ namespace QuantLib {
                     const auto fHatPricer =  [&](const Array& z) -> Real {
                         const Real vz = std::inner_product(
                             v.row_begin(k), v.row_end(k), z.begin(), Real(0.0));
-                        const Real f = std::exp(-M_SQRT2*vz - vq[k]);
+                        const Real f = exp(-M_SQRT2*vz - vq[k]);
 
-                        return std::exp(-DotProduct(z, z)) * f;
+                        return exp(-DotProduct(z, z)) * f;
                     };
                 fHat[k] = ghq(fHatPricer) * normFactor;
                 }
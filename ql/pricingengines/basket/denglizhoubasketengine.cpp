@@ -117,7 +117,7 @@ namespace QuantLib {
         if (M > 1) {
             Array F(M), vol(M);
             for (Size i=0; i < M; ++i) {
-                vol[i] = std::sqrt(std::get<4>(p[i]));
+                vol[i] = sqrt(std::get<4>(p[i]));
                 F[i] = std::get<0>(p[i])*std::get<2>(p[i])*std::get<3>(p[i])/dr0;
             }
 
@@ -146,11 +146,11 @@ namespace QuantLib {
                     rhoHat += rho[std::get<1>(p[M+i])][std::get<1>(p[j])]*vol[j]*F[j];
 
                 nRho[i+1][0] = nRho[0][i+1]
-                      = std::min(1.0, std::max(-1.0, rhoHat/(std::sqrt(v_s)*F0)));
+                      = std::min(1.0, std::max(-1.0, rhoHat/(sqrt(v_s)*F0)));
             }
         }
         else {
-            _s[0]  = std::abs(std::get<0>(p[0])*std::get<2>(p[0]));
+            _s[0]  = abs(std::get<0>(p[0])*std::get<2>(p[0]));
             _dq[0] = std::get<3>(p[0]);
             _v[0]  = std::get<4>(p[0]);
             for (Size i=0; i < N+1; ++i)
@@ -158,7 +158,7 @@ namespace QuantLib {
         }
 
         for (Size i=0; i < N; ++i) {
-            _s[i+1]  = std::abs(std::get<0>(p[M+i])*std::get<2>(p[M+i]));
+            _s[i+1]  = abs(std::get<0>(p[M+i])*std::get<2>(p[M+i]));
             _dq[i+1] = std::get<3>(p[M+i]);
             _v[i+1]  = std::get<4>(p[M+i]);
 
@@ -183,7 +183,7 @@ namespace QuantLib {
         const Real psi = 1.0/
             (1.0 + std::inner_product(
                  D.row_begin(i), D.row_end(i), D.row_begin(i), Real(0.0)));
-        const Real sqrtPsi = std::sqrt(psi);
+        const Real sqrtPsi = sqrt(psi);
 
         const Real n_uSqrtPsi = NormalDistribution()(u*sqrtPsi);
         const Real J_0 = CumulativeNormalDistribution()(u*sqrtPsi);
@@ -213,7 +213,7 @@ namespace QuantLib {
 
         const Real R = std::accumulate(
             mu.begin()+1, mu.end(), Real(0),
-            [](Real a, Real b) -> Real { return a + std::exp(b); }
+            [](Real a, Real b) -> Real { return a + exp(b); }
         );
 
         const Size N = x.size()-1;
@@ -228,15 +228,15 @@ namespace QuantLib {
 
         const Real sig_xy = 1.0 - DotProduct(sig10, sig11Inv10);
         QL_REQUIRE(sig_xy > 0.0, "approximation loses validity");
-        const Real sqSig_xy = std::sqrt(sig_xy);
+        const Real sqSig_xy = sqrt(sig_xy);
 
         const Real a = -0.5/sqSig_xy;
         Matrix E(N, N);
         for (Size i=1; i <= N; ++i)
             for (Size j=i; j <= N; ++j)
                 E(i-1, j-1) = E(j-1, i-1) =
-                     a*(((i==j)? squared(nu[j])*std::exp(mu[j])/(nu[0]*(R+K)) : Real(0.0))
-                        -nu[i]*nu[j]*std::exp(mu[i]+mu[j])/(nu[0]*squared(R + K)) );
+                     a*(((i==j)? squared(nu[j])*exp(mu[j])/(nu[0]*(R+K)) : Real(0.0))
+                        -nu[i]*nu[j]*exp(mu[i]+mu[j])/(nu[0]*squared(R + K)) );
 
         const Matrix F = sqSig11*E*sqSig11;
 
@@ -250,7 +250,7 @@ namespace QuantLib {
                  );
         }
 
-        const Real c = -(std::log(R + K) - mu[0])/(nu[0]*sqSig_xy);
+        const Real c = -(log(R + K) - mu[0])/(nu[0]*sqSig_xy);
 
         const Array d = (sig11Inv10
             - Exp(Array(mu.begin()+1, mu.end()))*Array(nu.begin()+1,nu.end())/(nu[0]*(R+K)))/sqSig_xy;
@@ -281,11 +281,11 @@ namespace QuantLib {
 
         const Matrix DF = DM*F;
 
-        Real npv = dr*std::exp(mu[0] + 0.5*squared(nu[0])) * I(C[0], trF2, DM, DF, 0)
+        Real npv = dr*exp(mu[0] + 0.5*squared(nu[0])) * I(C[0], trF2, DM, DF, 0)
             - K*dr*I(C.back(), trF2, DM, DF, N+1);
 
         for (Size k=1; k <= N; ++k)
-            npv -= dr*std::exp(mu[k] + 0.5*squared(nu[k])) * I(C[k], trF2, DM, DF, k);
+            npv -= dr*exp(mu[k] + 0.5*squared(nu[k])) * I(C[k], trF2, DM, DF, k);
 
         return npv;
     }
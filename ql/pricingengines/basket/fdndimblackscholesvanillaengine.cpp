@@ -133,7 +133,7 @@ namespace QuantLib {
 
         const Date maturityDate = arguments_.exercise->lastDate();
         const Time maturity = processes_[0]->time(maturityDate);
-        const Real sqrtT = std::sqrt(maturity);
+        const Real sqrtT = sqrt(maturity);
 
         const detail::VectorBsmProcessExtractor pExtractor(processes_);
         const Array s = pExtractor.getSpot();
@@ -152,14 +152,14 @@ namespace QuantLib {
         for (Size i=0; i < processes_.size(); ++i) {
             const Size xGrid = (xGrids_.size() > 1)
                 ? xGrids_[i]
-                : std::max(Size(4), Size(xGrids_[0]*std::pow(l[i]/l[0], 0.1)));
+                : std::max(Size(4), Size(xGrids_[0]*pow(l[i]/l[0], 0.1)));
             QL_REQUIRE(xGrid >= 4, "minimum grid size is four");
 
             const Real xStepStize = (1.0-2*eps)/(xGrid-1);
 
             std::vector<Real> x(xGrid);
             for (Size j=0; j < xGrid; ++j)
-                x[j] = 1.3*std::sqrt(l[i])*sqrtT
+                x[j] = 1.3*sqrt(l[i])*sqrtT
                     *InverseCumulativeNormal()(eps + j*xStepStize);
 
             meshers.emplace_back(ext::make_shared<Predefined1dMesher>(x));
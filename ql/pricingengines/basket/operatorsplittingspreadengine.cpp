@@ -45,12 +45,12 @@ namespace QuantLib {
                 return callPrice - df*(f1-f2-k);
         };
 
-        const Real vol1 = std::sqrt(variance1);
-        const Real vol2 = std::sqrt(variance2);
+        const Real vol1 = sqrt(variance1);
+        const Real vol2 = sqrt(variance2);
         const Real sig2 = vol2*f2/(f2+k);
-        const Real sig_m = std::sqrt(variance1 +sig2*(sig2 - 2*rho_*vol1));
+        const Real sig_m = sqrt(variance1 +sig2*(sig2 - 2*rho_*vol1));
 
-        const Real d1 = (std::log(f1) - std::log(f2 + k))/sig_m + 0.5*sig_m;
+        const Real d1 = (log(f1) - log(f2 + k))/sig_m + 0.5*sig_m;
         const Real d2 = d1 - sig_m;
 
         const CumulativeNormalDistribution N;
@@ -92,21 +92,21 @@ namespace QuantLib {
         const Real vol22 = vol2*vol2;
         const Real vol23 = vol22*vol2;
 
-        if (rs < std::pow(QL_EPSILON, 0.625)) {
+        if (rs < pow(QL_EPSILON, 0.625)) {
             const Real vol24 = vol22*vol22;
             const Real vol26 = vol22*vol24;
             const Real k2 = k*k;
             const Real R22 = R2*R2;
             const Real R24 = R22*R22;
             const Real kmR22 = squared(k-R2);
-            const Real lnR1 = std::log(R1);
+            const Real lnR1 = log(R1);
             
             const Real ooPlt = -0.0625*(k2*kmR22*vol26*(-8*R22*R24*(7*k2 - 7*k*R2 + R22)*vol12*vol12 
                 + kmR22*R24*vol12*(-112*k*R2 + 16*R22 + k2*(124 + 3*vol12))*vol22 - 2*kmR22*kmR22*R22*
                 (-28*k*R2 + 4*R22 + k2*(34 + 3*vol12))*vol24 + 3*k2*kmR22*kmR22*kmR22*vol26 - 4*k*(k -R2)*
                 R24*lnR1*(-4*R22*vol12 + 4*kmR22*vol22 + 3*k*(k - R2)*vol22*lnR1)))
-                /(std::exp(squared(-(R22*vol12) + kmR22*vol22 +    2*R22*lnR1)/(8*R24*vol12 - 8*kmR22*R22*vol22))*
-                M_SQRTPI*M_SQRT2*R22*R24*R2*squared(R22*vol12 - kmR22*vol22)*std::sqrt(vol12 - (kmR22*vol22)/R22));
+                /(exp(squared(-(R22*vol12) + kmR22*vol22 +    2*R22*lnR1)/(8*R24*vol12 - 8*kmR22*R22*vol22))*
+                M_SQRTPI*M_SQRT2*R22*R24*R2*squared(R22*vol12 - kmR22*vol22)*sqrt(vol12 - (kmR22*vol22)/R22));
 
             return callPutParityPrice(kirkCallNPV + 0.5*oPlt + 0.125*ooPlt);        
         } 
@@ -123,9 +123,9 @@ namespace QuantLib {
         const Real iR24 = iR22*iR22;
         const Real a = vol12 - 2*F2*iR2*rho_*vol1*vol2 + F22*iR22*vol22;
         const Real a2 = a*a;
-        const Real b = a/2+std::log(R1);
+        const Real b = a/2+log(R1);
         const Real b2 = b*b;
-        const Real c = std::sqrt(a);
+        const Real c = sqrt(a);
         const Real d = b/c;
         const Real e = rho_*vol1 - F2*iR2*vol2;
         const Real e2 = e*e;
@@ -137,7 +137,7 @@ namespace QuantLib {
         const Real l = b*iat - c;
         const Real m = f*(1 - (R2*rho_*vol1)/(F2*vol2)) - (e*iR2*k*(d*l + (j*vol12)/(e*e))*vol2)/(2.*c);
         const Real n = (iat*(1 - (R2*rho_*vol1)/(F2*vol2)))/R1 - (e*iR2*k*((f*iat)/R1 + b/(a*R1))*vol2)/(2.*c);
-        const Real o = df*std::exp(-0.5*f*f);
+        const Real o = df*exp(-0.5*f*f);
         const Real p = d*l + (j*vol12)/(e*e);
         const Real q = (-2*j*vol12*(-(iR2*vol2) + F2*iR22*vol2))/(e*e*e);
         const Real s = q - (b2*g)/(2.*a2) - (b*f*g)/(2.*a*c) + (f*g)/(2.*c);
@@ -45,7 +45,7 @@ namespace QuantLib {
 
             Real s = 0.0;
             for (Size i=0; i < a_.size(); ++i)
-                s += a_[i]*std::exp(sig_[i]*x);
+                s += a_[i]*exp(sig_[i]*x);
             return s - K_;
         }
 
@@ -54,7 +54,7 @@ namespace QuantLib {
 
             Real s = 0.0;
             for (Size i=0; i < a_.size(); ++i)
-                s += a_[i]*sig_[i]*std::exp(sig_[i]*x);
+                s += a_[i]*sig_[i]*exp(sig_[i]*x);
             return s;
         }
 
@@ -63,7 +63,7 @@ namespace QuantLib {
 
             Real s = 0.0;
             for (Size i=0; i < a_.size(); ++i)
-                s += a_[i]*squared(sig_[i])*std::exp(sig_[i]*x);
+                s += a_[i]*squared(sig_[i])*exp(sig_[i]*x);
             return s;
         }
 
@@ -100,7 +100,7 @@ namespace QuantLib {
 
             // linear approximation
             const Real denom = std::accumulate(attr.begin(), attr.end(), Real(0.0));
-            const Real xInit = (std::abs(denom) > 1000*QL_EPSILON)
+            const Real xInit = (abs(denom) > 1000*QL_EPSILON)
                 ? std::min(10.0, std::max(-10.0,
                       (K_ - std::accumulate(a_.begin(), a_.end(), Real(0.0)))/denom)
                   )
@@ -87,7 +87,7 @@ namespace QuantLib::detail {
             return extractProcesses(
                 [maturityDate](const auto& p) -> Volatility {
                     const Time maturity = p->blackVolatility()->timeFromReference(maturityDate);
-                    return p->blackVolatility()->blackVol(maturityDate, p->x0())*std::sqrt(maturity);
+                    return p->blackVolatility()->blackVol(maturityDate, p->x0())*sqrt(maturity);
                 }
             );
         }
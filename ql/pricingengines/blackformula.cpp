@@ -82,7 +82,7 @@ namespace QuantLib {
         if (strike==0.0)
             return (optionType==Option::Call ? Real(forward*discount) : 0.0);
 
-        Real d1 = std::log(forward/strike)/stdDev + 0.5*stdDev;
+        Real d1 = log(forward/strike)/stdDev + 0.5*stdDev;
         Real d2 = d1 - stdDev;
         CumulativeNormalDistribution phi;
         Real nd1 = phi(sign * d1);
@@ -106,6 +106,90 @@ namespace QuantLib {
             payoff->strike(), forward, stdDev, discount, displacement);
     }
 
+    void blackFormula(Size n,
+                      const Option::Type* optionTypes,
+                      const Real* strikes,
+                      const Real* forwards,
+                      const Real* stdDevs,
+                      const Real* discounts,
+                      Real* values,
+                      Real* forwardDerivatives,
+                      Real* stdDevDerivatives,
+                      Real displacement)
+    {
+        for (Size i=0; i<n; ++i) {
+            checkParameters(strikes[i], forwards[i], displacement);
+            QL_REQUIRE(stdDevs[i]>=0.0,
+                       "stdDev (" << stdDevs[i] << ") must be non-negative");
+            QL_REQUIRE(discounts[i]>0.0,
+                       "discount (" << discounts[i] << ") must be positive");
+        }
+
+        // the options are processed in blocks small enough for the
+        // intermediate results to stay in the cache; the degenerate
+        // cases are dealt with by selecting the results at the end
+        // of the block, so that all loops are free of branches.
+        const Size blockSize = 256;
+        Real d[2*blockSize], nd[2*blockSize];
+        const CumulativeNormalDistribution phi;
+        const NormalDistribution density;
+
+        for (Size begin=0; begin<n; begin+=blockSize) {
+            const Size m = std::min(blockSize, n-begin);
+            const Option::Type* type = optionTypes + begin;
+            const Real* k = strikes + begin;
+            const Real* f = forwards + begin;
+            const Real* s = stdDevs + begin;
+
+            for (Size i=0; i<m; ++i) {
+                const Real sign = (type[i] == Option::Call) ? 1.0 : -1.0;
+                const Real d1 = log((f[i]+displacement)/(k[i]+displacement))/s[i]
+                              + 0.5*s[i];
+                d[i] = sign*d1;
+                d[m+i] = sign*(d1-s[i]);
+            }
+
+            phi.transform(d, d+2*m, nd);
+
+            for (Size i=0; i<m; ++i) {
+                const Real sign = (type[i] == Option::Call) ? 1.0 : -1.0;
+                const Real discount = discounts[begin+i];
+                const Real forward = f[i]+displacement, strike = k[i]+displacement;
+                const Real value =
+                    discount * sign * (forward*nd[i] - strike*nd[m+i]);
+                const Real intrinsic =
+                    std::max((f[i]-k[i]) * sign, Real(0.0)) * discount;
+                const Real zeroStrike = (sign > 0.0) ? Real(forward*discount) : 0.0;
+                values[begin+i] = (s[i] == 0.0) ? intrinsic
+                                : (strike == 0.0) ? zeroStrike : value;
+            }
+
+            if (forwardDerivatives != nullptr) {
+                for (Size i=0; i<m; ++i) {
+                    const Real sign = (type[i] == Option::Call) ? 1.0 : -1.0;
+                    const Real discount = discounts[begin+i];
+                    const Real strike = k[i]+displacement;
+                    const Real itm = ((f[i]-k[i]) * sign > 0.0) ? 1.0 : 0.0;
+                    const Real zeroStrike = (sign > 0.0) ? discount : 0.0;
+                    forwardDerivatives[begin+i] =
+                        (s[i] == 0.0) ? Real(sign * itm * discount)
+                        : (strike == 0.0) ? zeroStrike
+                        : Real(sign * nd[i] * discount);
+                }
+            }
+
+            if (stdDevDerivatives != nullptr) {
+                for (Size i=0; i<m; ++i) {
+                    const Real forward = f[i]+displacement, strike = k[i]+displacement;
+                    // the density is symmetric, so the sign of d1 is irrelevant
+                    const Real vega = discounts[begin+i] * forward * density(d[i]);
+                    stdDevDerivatives[begin+i] =
+                        (s[i] == 0.0 || strike == 0.0) ? 0.0 : vega;
+                }
+            }
+        }
+    }
+
     Real blackFormulaForwardDerivative(Option::Type optionType,
                                        Real strike,
                                        Real forward,
@@ -130,7 +214,7 @@ namespace QuantLib {
         if (strike == 0.0)
             return (optionType == Option::Call ? discount : 0.0);
 
-        Real d1 = std::log(forward/strike)/stdDev + 0.5*stdDev;
+        Real d1 = log(forward/strike)/stdDev + 0.5*stdDev;
         CumulativeNormalDistribution phi;
         return sign * phi(sign * d1) * discount;
     }
@@ -163,7 +247,7 @@ namespace QuantLib {
         strike = strike + displacement;
         if (strike==forward)
             // Brenner-Subrahmanyan (1988) and Feinstein (1988) ATM approx.
-            stdDev = blackPrice/discount*std::sqrt(2.0 * M_PI)/forward;
+            stdDev = blackPrice/discount*sqrt(2.0 * M_PI)/forward;
         else {
             // Corrado and Miller extended moneyness approximation
             Real moneynessDelta = Integer(optionType) * (forward-strike);
@@ -176,9 +260,9 @@ namespace QuantLib {
                 temp2=0.0;
                 // 2. Manaster-Koehler (1982) efficient Newton-Raphson seed
                 //return std::fabs(std::log(forward/strike))*std::sqrt(2.0);
-            temp2 = std::sqrt(temp2);
+            temp2 = sqrt(temp2);
             temp += temp2;
-            temp *= std::sqrt(2.0 * M_PI);
+            temp *= sqrt(2.0 * M_PI);
             stdDev = temp/(forward+strike);
         }
         QL_ENSURE(stdDev>=0.0,
@@ -234,10 +318,10 @@ namespace QuantLib {
                                                          1.0, 0.0);
             Real ds = 0.0;
             Real tmp = d1 * d1 + 2.0 * d2 * dc;
-            if (std::fabs(d2) > 1E-10 && tmp >= 0.0)
-                ds = (-d1 + std::sqrt(tmp)) / d2; // second order approximation
+            if (fabs(d2) > 1E-10 && tmp >= 0.0)
+                ds = (-d1 + sqrt(tmp)) / d2; // second order approximation
             else
-                if(std::fabs(d1) > 1E-10)
+                if(fabs(d1) > 1E-10)
                     ds = dc / d1; // first order approximation
             stdDev = s0 + ds;
         }
@@ -262,7 +346,7 @@ namespace QuantLib {
     namespace {
         Real Af(Real x) {
             return 0.5*(1.0+boost::math::sign(x)
-                *std::sqrt(1.0-std::exp(-M_2_PI*x*x)));
+                *sqrt(1.0-exp(-M_2_PI*x*x)));
         }
     }
 
@@ -280,40 +364,40 @@ namespace QuantLib {
 
         const Real ey = F/K;
         const Real ey2 = ey*ey;
-        const Real y = std::log(ey);
+        const Real y = log(ey);
         const Real alpha = marketValue/(K*df);
         const Real R = 2 * alpha + ((type == Option::Call) ? Real(-ey + 1.0) : ey - 1.0);
         const Real R2 = R*R;
 
-        const Real a = std::exp((1.0-M_2_PI)*y);
+        const Real a = exp((1.0-M_2_PI)*y);
         const Real A = squared(a - 1.0/a);
-        const Real b = std::exp(M_2_PI*y);
+        const Real b = exp(M_2_PI*y);
         const Real B = 4.0*(b + 1/b)
             - 2*K/F*(a + 1.0/a)*(ey2 + 1 - R2);
         const Real C = (R2-squared(ey-1))*(squared(ey+1)-R2)/ey2;
 
-        const Real beta = 2*C/(B+std::sqrt(B*B+4*A*C));
-        const Real gamma = -M_PI_2*std::log(beta);
+        const Real beta = 2*C/(B+sqrt(B*B+4*A*C));
+        const Real gamma = -M_PI_2*log(beta);
 
         if (y >= 0.0) {
             const Real M0 = K*df*(
-                (type == Option::Call) ? Real(ey*Af(std::sqrt(2*y)) - 0.5)
-                                       : 0.5-ey*Af(-std::sqrt(2*y)));
+                (type == Option::Call) ? Real(ey*Af(sqrt(2*y)) - 0.5)
+                                       : 0.5-ey*Af(-sqrt(2*y)));
 
             if (marketValue <= M0)
-                return std::sqrt(gamma+y)-std::sqrt(gamma-y);
+                return sqrt(gamma+y)-sqrt(gamma-y);
             else
-                return std::sqrt(gamma+y)+std::sqrt(gamma-y);
+                return sqrt(gamma+y)+sqrt(gamma-y);
         }
         else {
             const Real M0 = K*df*(
-                (type == Option::Call) ? Real(0.5*ey - Af(-std::sqrt(-2*y)))
-                                       : Af(std::sqrt(-2*y)) - 0.5*ey);
+                (type == Option::Call) ? Real(0.5*ey - Af(-sqrt(-2*y)))
+                                       : Af(sqrt(-2*y)) - 0.5*ey);
 
             if (marketValue <= M0)
-                return std::sqrt(gamma-y)-std::sqrt(gamma+y);
+                return sqrt(gamma-y)-sqrt(gamma+y);
             else
-                return std::sqrt(gamma+y)+std::sqrt(gamma-y);
+                return sqrt(gamma+y)+sqrt(gamma-y);
         }
     }
 
@@ -343,7 +427,7 @@ namespace QuantLib {
             QL_REQUIRE(undiscountedBlackPrice>=0.0,
                        "undiscounted Black price (" <<
                        undiscountedBlackPrice << ") must be non-negative");
-            signedMoneyness_ = Integer(optionType) * std::log((forward+displacement)/(strike+displacement));
+            signedMoneyness_ = Integer(optionType) * log((forward+displacement)/(strike+displacement));
         }
 
         Real operator()(Real stdDev) const {
@@ -452,16 +536,137 @@ namespace QuantLib {
             forward, blackPrice, discount, displacement, guess, accuracy, maxIterations);
     }
 
+    Size blackFormulaImpliedStdDev(Size n,
+                                   const Option::Type* optionTypes,
+                                   const Real* strikes,
+                                   const Real* forwards,
+                                   const Real* blackPrices,
+                                   const Real* discounts,
+                                   Real* stdDevs,
+                                   Real displacement,
+                                   Real accuracy,
+                                   Natural iterations)
+    {
+        QL_REQUIRE(accuracy>0.0,
+                   "accuracy (" << accuracy << ") must be positive");
+
+        // as in the single-quote version, out-of-the-money options
+        // are used since they have the greater vega/price ratio.
+        // Invalid quotes are marked and given dummy parameters, so
+        // that the iterations can run on the whole block unchanged.
+        const Size blockSize = 256;
+        Real sign[blockSize], x[blockSize], k[blockSize], f[blockSize];
+        Real price[blockSize], sigma[blockSize], step[blockSize];
+        Real d[2*blockSize], nd[2*blockSize];
+        bool valid[blockSize];
+        const CumulativeNormalDistribution phi;
+        Size failures = 0;
+
+        for (Size begin=0; begin<n; begin+=blockSize) {
+            const Size m = std::min(blockSize, n-begin);
+
+            for (Size i=0; i<m; ++i) {
+                const Size j = begin+i;
+                const Real strike = strikes[j]+displacement,
+                           forward = forwards[j]+displacement,
+                           discount = discounts[j];
+                Real value = blackPrices[j];
+                Option::Type type = optionTypes[j];
+                const Real otherValue =
+                    value - Integer(type) * (forwards[j]-strikes[j]) * discount;
+
+                valid[i] = strike > 0.0 && forward > 0.0 && discount > 0.0
+                    && value >= 0.0 && otherValue >= 0.0;
+                if (valid[i]) {
+                    if ((type == Option::Put && strike > forward) ||
+                        (type == Option::Call && strike < forward)) {
+                        type = Option::Type(-type);
+                        value = otherValue;
+                    }
+                    value /= discount;
+                    // the out-of-the-money value must be below the
+                    // forward (for calls) or the strike (for puts)
+                    valid[i] = value < ((type == Option::Call) ? forward : strike);
+                }
+
+                if (valid[i]) {
+                    sign[i] = Integer(type);
+                    x[i] = log(forward/strike);
+                    k[i] = strike;
+                    f[i] = forward;
+                    price[i] = value;
+                    sigma[i] = (value == 0.0) ? 0.0 :
+                        blackFormulaImpliedStdDevApproximationRS(
+                            type, strike, forward, value, 1.0, 0.0);
+                    // fallback for the (rare) cases in which the
+                    // approximation breaks down numerically
+                    if (value > 0.0 &&
+                        (!isfinite(sigma[i]) || sigma[i] <= 0.0))
+                        sigma[i] = sqrt(2.0*fabs(x[i])) + 0.1;
+                } else {
+                    sign[i] = 1.0;
+                    x[i] = 0.0;
+                    k[i] = f[i] = 1.0;
+                    price[i] = 0.1;
+                    sigma[i] = 0.25;
+                }
+                step[i] = 0.0;
+            }
+
+            for (Natural iteration=0; iteration<iterations; ++iteration) {
+                for (Size i=0; i<m; ++i) {
+                    const Real s = std::max(sigma[i], QL_EPSILON);
+                    const Real d1 = x[i]/s + 0.5*s;
+                    d[i] = sign[i]*d1;
+                    d[m+i] = sign[i]*(d1-s);
+                }
+
+                phi.transform(d, d+2*m, nd);
+
+                for (Size i=0; i<m; ++i) {
+                    const Real s = std::max(sigma[i], QL_EPSILON);
+                    const Real d1 = sign[i]*d[i], d2 = d1 - s;
+                    // Householder's method of order 3 for
+                    // g(s) = Black(s) - price; the derivatives follow
+                    // from g' = F n(d1), dd1/ds = -d2/s, dd2/ds = -d1/s.
+                    const Real g = sign[i]*(f[i]*nd[i] - k[i]*nd[m+i]) - price[i];
+                    const Real g1 = f[i] * M_1_SQRTPI * M_SQRT1_2
+                                  * exp(-0.5*d1*d1);
+                    const Real h = d1*d2/s;
+                    const Real g2 = g1*h;
+                    const Real g3 = g1*(h*h - 3.0*x[i]*x[i]/(s*s*s*s) - 0.25);
+                    const Real num = 6.0*g*g1*g1 - 3.0*g*g*g2;
+                    const Real den = 6.0*g1*g1*g1 - 6.0*g*g1*g2 + g*g*g3;
+                    const Real next = s - num/den;
+                    // halving keeps the iterate positive
+                    const Real safe = (next > 0.0) ? next : Real(0.5*s);
+                    step[i] = (sigma[i] == 0.0) ? Real(0.0) : Real(safe - s);
+                    sigma[i] = (sigma[i] == 0.0) ? Real(0.0) : safe;
+                }
+            }
+
+            for (Size i=0; i<m; ++i) {
+                const bool converged = valid[i] && isfinite(sigma[i])
+                    && fabs(step[i]) <= accuracy;
+                stdDevs[begin+i] = converged ? sigma[i] : Null<Real>();
+                if (!converged)
+                    ++failures;
+            }
+        }
+
+        return failures;
+    }
+
 
     namespace {
         Real Np(Real x, Real v) {
             return CumulativeNormalDistribution()(x/v + 0.5*v);
         }
         Real Nm(Real x, Real v) {
-            return std::exp(-x)*CumulativeNormalDistribution()(x/v - 0.5*v);
+            return exp(-x)*CumulativeNormalDistribution()(x/v - 0.5*v);
         }
         Real phi(Real x, Real v) {
-            const Real ax = 2*std::fabs(x);
+            const Real ax = 2*fabs(x);
             const Real v2 = v*v;
             return (v2-ax)/(v2+ax);
         }
@@ -476,7 +681,7 @@ namespace QuantLib {
             // slower than the boost replacement.
             const Real k = MaddockInverseCumulativeNormal()(q);
 
-            return k + std::sqrt(k*k + 2*std::fabs(x));
+            return k + sqrt(k*k + 2*fabs(x));
         }
     }
 
@@ -511,7 +716,7 @@ namespace QuantLib {
                 "stdDev guess (" << guess << ") must be non-negative");
         }
 
-        Real x = std::log(forward/strike);
+        Real x = log(forward/strike);
         Real cs = (optionType == Option::Call)
             ? Real(blackPrice / (forward*discount))
             : (blackPrice/ (forward*discount) + 1.0 - strike/forward);
@@ -533,7 +738,7 @@ namespace QuantLib {
             vk = vkp1;
             const Real alphaK = (1+w)/(1+phi(x,vk));
             vkp1 = alphaK*G(vk,x,cs,w) + (1-alphaK)*vk;
-            dv = std::fabs(vkp1 - vk);
+            dv = fabs(vkp1 - vk);
         } while (dv > accuracy && ++nIter < maxIterations);
 
         QL_REQUIRE(dv <= accuracy, "max iterations exceeded");
@@ -576,7 +781,7 @@ namespace QuantLib {
         strike = strike + displacement;
         if (strike==0.0)
             return (optionType == Option::Call ? 1.0 : 0.0);
-        Real d2 = std::log(forward/strike)/stdDev - 0.5*stdDev;
+        Real d2 = log(forward/strike)/stdDev - 0.5*stdDev;
         CumulativeNormalDistribution phi;
         return phi(sign * d2);
     }
@@ -607,7 +812,7 @@ namespace QuantLib {
         strike = strike + displacement;
         if (strike == 0.0)
             return (optionType == Option::Call ? 1.0 : 0.0);
-        Real d1 = std::log(forward/strike)/stdDev + 0.5*stdDev;
+        Real d1 = log(forward/strike)/stdDev + 0.5*stdDev;
         CumulativeNormalDistribution phi;
         return phi(sign * d1);
     }
@@ -632,7 +837,7 @@ namespace QuantLib {
                                      forward,
                                      stdDev,
                                      discount,
-                                     displacement)*std::sqrt(expiry);
+                                     displacement)*sqrt(expiry);
     }
 
     Real blackFormulaStdDevDerivative(Rate strike,
@@ -653,7 +858,7 @@ namespace QuantLib {
         if (stdDev==0.0 || strike==0.0)
             return 0.0;
 
-        Real d1 = std::log(forward/strike)/stdDev + .5*stdDev;
+        Real d1 = log(forward/strike)/stdDev + .5*stdDev;
         return discount * forward *
             CumulativeNormalDistribution().derivative(d1);
     }
@@ -686,8 +891,8 @@ namespace QuantLib {
         if (stdDev==0.0 || strike==0.0)
             return 0.0;
 
-        Real d1 = std::log(forward/strike)/stdDev + .5*stdDev;
-        Real d1p = -std::log(forward/strike)/(stdDev*stdDev) + .5;
+        Real d1 = log(forward/strike)/stdDev + .5*stdDev;
+        Real d1p = -log(forward/strike)/(stdDev*stdDev) + .5;
         return discount * forward *
             NormalDistribution().derivative(d1) * d1p;
     }
@@ -714,7 +919,7 @@ namespace QuantLib {
                    "discount (" << discount << ") must be positive");
         Real d = (forward-strike) * Integer(optionType), h = d / stdDev;
         if (stdDev==0.0)
-            return discount*std::max(d, 0.0);
+            return discount*std::max(d, Real(0.0));
         CumulativeNormalDistribution phi;
         Real result = discount*(stdDev*phi.derivative(h) + d*phi(h));
         QL_ENSURE(result>=0.0,
@@ -791,7 +996,7 @@ namespace QuantLib {
         const Real den = B0 + eta * (B1 + eta * (B2 + eta * (B3 + eta * (B4 + eta
                     * (B5 + eta * (B6 + eta * (B7 + eta * (B8 + eta * B9))))))));
 
-        return std::sqrt(eta) * (num / den);
+        return sqrt(eta) * (num / den);
 
     }
 
@@ -802,7 +1007,7 @@ namespace QuantLib {
                                              Real bachelierPrice,
                                              Real discount) {
 
-        const static Real SQRT_QL_EPSILON = std::sqrt(QL_EPSILON);
+        const static Real SQRT_QL_EPSILON = sqrt(QL_EPSILON);
 
         QL_REQUIRE(tte>0.0,
                    "tte (" << tte << ") must be positive");
@@ -825,11 +1030,11 @@ namespace QuantLib {
         nu = std::max(-1.0 + QL_EPSILON, std::min(nu,1.0 - QL_EPSILON));
 
         // nu / arctanh(nu) -> 1 as nu -> 0
-        Real eta = (std::fabs(nu) < SQRT_QL_EPSILON) ? 1.0 : Real(nu / boost::math::atanh(nu));
+        Real eta = (fabs(nu) < SQRT_QL_EPSILON) ? 1.0 : Real(nu / boost::math::atanh(nu));
 
         Real heta = h(eta);
 
-        Real impliedBpvol = std::sqrt(M_PI / (2 * tte)) * straddlePremium * heta;
+        Real impliedBpvol = sqrt(M_PI / (2 * tte)) * straddlePremium * heta;
 
         return impliedBpvol;
     }
@@ -864,7 +1069,7 @@ namespace QuantLib {
                      g * g * (0.6635646938 - g * g * (0.14528712196 - 0.010472855461 * g * g)));
                 xbar = g * (0.3989422804014326 + xibar * g * g);
             } else {
-                Real h = std::sqrt(-std::log(-PhiTildeStar));
+                Real h = sqrt(-log(-PhiTildeStar));
                 xbar =
                     (9.4883409779 - h * (9.6320903635 - h * (0.58556997323 + 2.1464093351 * h))) /
                     (1.0 - h * (0.65174820867 + h * (1.5120247828 + 6.6437847132E-5 * h)));
@@ -897,12 +1102,12 @@ namespace QuantLib {
         // handle case strike = forward
 
         if (close_enough(strike, forward)) {
-            return bachelierPrice / (std::sqrt(tte) * phi(0.0));
+            return bachelierPrice / (sqrt(tte) * phi(0.0));
         }
 
         // handle case strike != forward
 
-        Real timeValue = bachelierPrice - std::max(theta * (forward - strike), 0.0);
+        Real timeValue = bachelierPrice - std::max(theta * (forward - strike), Real(0.0));
 
         if (close_enough(timeValue, 0.0))
             return 0.0;
@@ -913,9 +1118,9 @@ namespace QuantLib {
                                         << "): option price implies negative time value ("
                                         << timeValue << ")");
 
-        Real PhiTildeStar = -std::abs(timeValue / (strike - forward));
+        Real PhiTildeStar = -abs(timeValue / (strike - forward));
         Real xstar = inversePhiTilde(PhiTildeStar);
-        Real impliedVol = std::abs((strike - forward) / (xstar * std::sqrt(tte)));
+        Real impliedVol = abs((strike - forward) / (xstar * sqrt(tte)));
 
         return impliedVol;
     }
@@ -956,7 +1161,7 @@ namespace QuantLib {
                    "stdDev (" << stdDev << ") must be non-negative");
         Real d = (forward - strike) * Integer(optionType), h = d / stdDev;
         if (stdDev==0.0)
-            return std::max(d, 0.0);
+            return std::max(d, Real(0.0));
         CumulativeNormalDistribution phi;
         Real result = phi(h);
         return result;
@@ -60,6 +60,30 @@ namespace QuantLib {
                       Real discount = 1.0,
                       Real displacement = 0.0);
 
+    /*! Black 1976 formula for a batch of \f$ n \f$ options, whose
+        parameters are passed as separate arrays.  The option values
+        are written into \p values and, when the corresponding
+        pointers are not null, their derivatives with respect to the
+        forward and to the standard deviation are written into
+        \p forwardDerivatives and \p stdDevDerivatives.  The results
+        are the same as those returned by the single-option functions,
+        but the calculations are arranged in loops that the compiler
+        can vectorize.
+
+        \warning instead of volatility it uses standard deviation,
+                 i.e. volatility*sqrt(timeToMaturity)
+    */
+    void blackFormula(Size n,
+                      const Option::Type* optionTypes,
+                      const Real* strikes,
+                      const Real* forwards,
+                      const Real* stdDevs,
+                      const Real* discounts,
+                      Real* values,
+                      Real* forwardDerivatives = nullptr,
+                      Real* stdDevDerivatives = nullptr,
+                      Real displacement = 0.0);
+
     /*! Black 1976 model forward derivative
         \warning instead of volatility it uses standard deviation,
                  i.e. volatility*sqrt(timeToMaturity)
@@ -191,6 +215,33 @@ namespace QuantLib {
                                    Real accuracy = 1.0e-6,
                                    Natural maxIterations = 100);
 
+    /*! Black 1976 implied standard deviations for a batch of
+        \f$ n \f$ quotes, whose parameters are passed as separate
+        arrays.  The initial guess is given by the Radoicic-Stefanica
+        approximation and refined by a fixed number of third-order
+        Householder iterations, which are performed for all the
+        quotes of the batch at once.
+
+        No exception is thrown for single quotes; the standard
+        deviations of the quotes that can't be inverted (invalid
+        parameters, prices outside the no-arbitrage bounds, or no
+        convergence within the given accuracy) are set to
+        Null<Real>() instead.  The number of such quotes is returned.
+
+        \warning instead of volatility it uses standard deviation,
+                 i.e. volatility*sqrt(timeToMaturity)
+    */
+    Size blackFormulaImpliedStdDev(Size n,
+                                   const Option::Type* optionTypes,
+                                   const Real* strikes,
+                                   const Real* forwards,
+                                   const Real* blackPrices,
+                                   const Real* discounts,
+                                   Real* stdDevs,
+                                   Real displacement = 0.0,
+                                   Real accuracy = 1.0e-6,
+                                   Natural iterations = 3);
+
     /*! Black 1976 implied standard deviation,
          i.e. volatility*sqrt(timeToMaturity)
 
@@ -104,12 +104,12 @@ namespace QuantLib {
                 Date fixingDate = arguments_.fixingDates[i];
                 Time sqrtTime = 0.0;
                 if (fixingDate > today)
-                    sqrtTime = std::sqrt(vol_->timeFromReference(fixingDate));
+                    sqrtTime = sqrt(vol_->timeFromReference(fixingDate));
 
                 if (type == CapFloor::Cap || type == CapFloor::Collar) {
                     Rate strike = arguments_.capRates[i];
                     if (sqrtTime>0.0) {
-                        stdDevs[i] = std::sqrt(vol_->blackVariance(fixingDate,
+                        stdDevs[i] = sqrt(vol_->blackVariance(fixingDate,
                                                                    strike));
                         vegas[i] = blackFormulaStdDevDerivative(strike,
                             forward, stdDevs[i], discountedAccrual, displacement_) 
@@ -127,7 +127,7 @@ namespace QuantLib {
                     Real floorletVega = 0.0;
                     Real floorletDelta = 0.0;
                     if (sqrtTime>0.0) {
-                        stdDevs[i] = std::sqrt(vol_->blackVariance(fixingDate,
+                        stdDevs[i] = sqrt(vol_->blackVariance(fixingDate,
                                                                    strike));
                         floorletVega = blackFormulaStdDevDerivative(strike,
                             forward, stdDevs[i], discountedAccrual, displacement_) 
@@ -79,7 +79,7 @@ namespace QuantLib {
                 process_->blackVolatility()->blackForwardVariance(
                                         resetDates[i-1],resetDates[i],strike);
 
-            BlackCalculator black(payoff, forward, std::sqrt(variance), discount);
+            BlackCalculator black(payoff, forward, sqrt(variance), discount);
 
             DayCounter rfdc  = process_->riskFreeRate()->dayCounter();
             DayCounter divdc = process_->dividendYield()->dayCounter();
@@ -80,7 +80,7 @@ namespace QuantLib {
                                         resetDates[i-1],resetDates[i],
                                         underlying * moneyness->strike());
 
-            BlackCalculator black(payoff, forward, std::sqrt(variance), rDiscount);
+            BlackCalculator black(payoff, forward, sqrt(variance), rDiscount);
 
             DayCounter rfdc  = process_->riskFreeRate()->dayCounter();
             DayCounter divdc = process_->dividendYield()->dayCounter();
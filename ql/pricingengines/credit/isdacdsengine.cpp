@@ -176,8 +176,8 @@ namespace QuantLib {
             Real P1 = discountCurve_->discount(d1);
             Real Q1 = probability_->survivalProbability(d1);
 
-            Real fhat = std::log(P0) - std::log(P1);
-            Real hhat = std::log(Q0) - std::log(Q1);
+            Real fhat = log(P0) - log(P1);
+            Real hhat = log(Q0) - log(Q1);
             Real fhphh = fhat + hhat;
 
             if (fhphh < 1E-4 && numericalFix_ == Taylor) {
@@ -250,8 +250,8 @@ namespace QuantLib {
                     Real t1 = discountCurve_->timeFromReference(*node);
                     Real P1 = discountCurve_->discount(*node);
                     Real Q1 = probability_->survivalProbability(*node);
-                    Real fhat = std::log(P0) - std::log(P1);
-                    Real hhat = std::log(Q0) - std::log(Q1);
+                    Real fhat = log(P0) - log(P1);
+                    Real hhat = log(Q0) - log(Q1);
                     Real fhphh = fhat + hhat;
                     if (fhphh < 1E-4 && numericalFix_ == Taylor) {
                         // see above, terms up to (f+h)^3 seem more than enough,
@@ -89,14 +89,14 @@ namespace QuantLib {
             vanillaPayoff = ext::make_shared<PlainVanillaPayoff>(
                                           Option::Call, strike(Option::Call));
             //QuantLib requires sigma * sqrt(t) rather than just sigma/volatility
-            vol = volatility(t) * std::sqrt(t);
+            vol = volatility(t) * sqrt(t);
             growth = dividendDiscount(t);
             discount = riskFreeDiscount(t);
         } else{
             Time t=putMaturity()-2*T;
             vanillaPayoff = ext::make_shared<PlainVanillaPayoff>(
                                             Option::Put, strike(Option::Put));
-            vol = volatility(t) * std::sqrt(t);
+            vol = volatility(t) * sqrt(t);
             growth = dividendDiscount(t);
             discount = riskFreeDiscount(t);
         }
@@ -121,7 +121,7 @@ namespace QuantLib {
         Real epsilon = 0.001;
 
         //Newton-Raphson process
-        while (std::fabs(yi) > epsilon){
+        while (fabs(yi) > epsilon){
             Sv = Sv - yi / di;
 
             bs=bsCalculator(Sv,Option::Call);
@@ -129,7 +129,7 @@ namespace QuantLib {
              // added end-strike discarded
              k<strikes.end()-1;
              ++k) {
-            slope = std::fabs((computeLogPayoff(*(k+1), f) -
+            slope = fabs((computeLogPayoff(*(k+1), f) -
                                computeLogPayoff(*k, f))/
                               (*(k+1) - *k));
             ext::shared_ptr<StrikedTypePayoff> payoff(
@@ -147,7 +147,7 @@ namespace QuantLib {
                          const Real strike,
                          const Real callPutStrikeBoundary) const {
         Real f = callPutStrikeBoundary;
-        return (2.0/residualTime()) * (((strike - f)/f) - std::log(strike/f));
+        return (2.0/residualTime()) * (((strike - f)/f) - log(strike/f));
     }
 
 
@@ -173,7 +173,7 @@ namespace QuantLib {
         return 2.0 * riskFreeRate() -
             2.0/residualTime() *
             (((underlying()/riskFreeDiscount() - f)/f) +
-             std::log(f/underlying())) +
+             log(f/underlying())) +
             optionsValue/riskFreeDiscount();
     }
 
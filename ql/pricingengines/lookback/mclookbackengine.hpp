@@ -50,7 +50,8 @@ namespace QuantLib {
                          Size requiredSamples,
                          Real requiredTolerance,
                          Size maxSamples,
-                         BigNatural seed);
+                         BigNatural seed,
+                         Size streams = 1);
         void calculate() const override {
             Real spot = process_->x0();
             QL_REQUIRE(spot > 0.0, "negative or null underlying given");
@@ -74,6 +75,15 @@ namespace QuantLib {
                          new path_generator_type(process_,
                                                  grid, gen, brownianBridge_));
         }
+        ext::shared_ptr<path_generator_type>
+        skippedPathGenerator(Size firstSample) const override {
+            TimeGrid grid = timeGrid();
+            typename RNG::rsg_type gen =
+                RNG::make_sequence_generator(grid.size()-1,seed_,firstSample);
+            return ext::shared_ptr<path_generator_type>(
+                         new path_generator_type(process_,
+                                                 grid, gen, brownianBridge_));
+        }
         ext::shared_ptr<path_pricer_type> pathPricer() const override;
         // data members
         ext::shared_ptr<GeneralizedBlackScholesProcess> process_;
@@ -100,6 +110,7 @@ namespace QuantLib {
         MakeMCLookbackEngine& withAbsoluteTolerance(Real tolerance);
         MakeMCLookbackEngine& withMaxSamples(Size samples);
         MakeMCLookbackEngine& withSeed(BigNatural seed);
+        MakeMCLookbackEngine& withStreams(Size streams);
         // conversion to pricing engine
         operator ext::shared_ptr<PricingEngine>() const;
       private:
@@ -108,6 +119,7 @@ namespace QuantLib {
         Size steps_, stepsPerYear_, samples_, maxSamples_;
         Real tolerance_;
         BigNatural seed_ = 0;
+        Size streams_ = 1;
     };
 
 
@@ -123,8 +135,10 @@ namespace QuantLib {
         Size requiredSamples,
         Real requiredTolerance,
         Size maxSamples,
-        BigNatural seed)
-    : McSimulation<SingleVariate, RNG, S>(antitheticVariate, false), process_(std::move(process)),
+        BigNatural seed,
+        Size streams)
+    : McSimulation<SingleVariate, RNG, S>(antitheticVariate, false, streams),
+      process_(std::move(process)),
       timeSteps_(timeSteps), timeStepsPerYear_(timeStepsPerYear), requiredSamples_(requiredSamples),
       maxSamples_(maxSamples), requiredTolerance_(requiredTolerance),
       brownianBridge_(brownianBridge), seed_(seed) {
@@ -271,6 +285,13 @@ namespace QuantLib {
         return *this;
     }
 
+    template <class I, class RNG, class S>
+    inline MakeMCLookbackEngine<I,RNG,S>&
+    MakeMCLookbackEngine<I,RNG,S>::withStreams(Size streams) {
+        streams_ = streams;
+        return *this;
+    }
+
     template <class I, class RNG, class S>
     inline MakeMCLookbackEngine<I,RNG,S>::operator ext::shared_ptr<PricingEngine>() const {
         QL_REQUIRE(steps_ != Null<Size>() || stepsPerYear_ != Null<Size>(),
@@ -287,7 +308,8 @@ namespace QuantLib {
                                           samples_,
                                           tolerance_,
                                           maxSamples_,
-                                          seed_));
+                                          seed_,
+                                          streams_));
     }
 
 }
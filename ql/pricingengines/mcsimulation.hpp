@@ -66,13 +66,29 @@ namespace QuantLib {
                        Size requiredSamples,
                        Size maxSamples) const;
       protected:
+        /*! If more than one stream is requested, the samples are
+            split over independent random streams which are simulated
+            concurrently when OpenMP is enabled; see
+            MonteCarloModel::addSamples for details.  In this case,
+            the engine must implement skippedPathGenerator() and
+            return a new (and thread-safe) pricer from each call to
+            pathPricer().
+        */
         McSimulation(bool antitheticVariate,
-                     bool controlVariate)
+                     bool controlVariate,
+                     Size streams = 1)
         : antitheticVariate_(antitheticVariate),
-          controlVariate_(controlVariate) {}
+          controlVariate_(controlVariate), streams_(streams) {
+            QL_REQUIRE(streams_ > 0, "at least one stream required");
+        }
         virtual ext::shared_ptr<path_pricer_type> pathPricer() const = 0;
         virtual ext::shared_ptr<path_generator_type> pathGenerator()
                                                                    const = 0;
+        //! path generator whose sequence starts at the given sample
+        virtual ext::shared_ptr<path_generator_type>
+        skippedPathGenerator(Size) const {
+            QL_FAIL("engine does not support multiple random streams");
+        }
         virtual TimeGrid timeGrid() const = 0;
         virtual ext::shared_ptr<path_pricer_type> controlPathPricer() const {
             return ext::shared_ptr<path_pricer_type>();
@@ -81,6 +97,10 @@ namespace QuantLib {
         controlPathGenerator() const {
             return ext::shared_ptr<path_generator_type>();
         }
+        virtual ext::shared_ptr<path_generator_type>
+        skippedControlPathGenerator(Size) const {
+            QL_FAIL("engine does not support multiple random streams");
+        }
         virtual ext::shared_ptr<PricingEngine> controlPricingEngine() const {
             return ext::shared_ptr<PricingEngine>();
         }
@@ -97,6 +117,9 @@ namespace QuantLib {
         
         mutable ext::shared_ptr<MonteCarloModel<MC,RNG,S> > mcModel_;
         bool antitheticVariate_, controlVariate_;
+        Size streams_;
+      private:
+        void addSamples(Size samples) const;
     };
 
 
@@ -109,7 +132,7 @@ namespace QuantLib {
         Size sampleNumber =
             mcModel_->sampleAccumulator().samples();
         if (sampleNumber<minSamples) {
-            mcModel_->addSamples(minSamples-sampleNumber);
+            addSamples(minSamples-sampleNumber);
             sampleNumber = mcModel_->sampleAccumulator().samples();
         }
 
@@ -131,7 +154,7 @@ namespace QuantLib {
             // do not exceed maxSamples
             nextBatch = std::min(nextBatch, maxSamples-sampleNumber);
             sampleNumber += nextBatch;
-            mcModel_->addSamples(nextBatch);
+            addSamples(nextBatch);
             error = result_type(mcModel_->sampleAccumulator().errorEstimate());
         }
 
@@ -149,7 +172,7 @@ namespace QuantLib {
                    "number of already simulated samples (" << sampleNumber
                    << ") greater than requested samples (" << samples << ")");
 
-        mcModel_->addSamples(samples-sampleNumber);
+        addSamples(samples-sampleNumber);
 
         return result_type(mcModel_->sampleAccumulator().mean());
     }
@@ -206,6 +229,21 @@ namespace QuantLib {
 
     }
 
+    template <template <class> class MC, class RNG, class S>
+    inline void McSimulation<MC,RNG,S>::addSamples(Size samples) const {
+        if (streams_ == 1) {
+            mcModel_->addSamples(samples);
+        } else {
+            mcModel_->addSamples(
+                samples, streams_,
+                [this](Size n) { return this->skippedPathGenerator(n); },
+                [this]() { return this->pathPricer(); },
+                [this](Size n) {
+                    return this->skippedControlPathGenerator(n);
+                });
+        }
+    }
+
     template <template <class> class MC, class RNG, class S>
     inline typename McSimulation<MC,RNG,S>::result_type
         McSimulation<MC,RNG,S>::errorEstimate() const {
@@ -77,7 +77,7 @@ namespace QuantLib {
                 ext::shared_ptr<SmileSection> sec =
                     swaptionVolatility->smileSection(
                         expiry,
-                        static_cast<Size>(std::lround(swapLength * 12.0)) * Months,
+                        static_cast<Size>(lround(swapLength * 12.0)) * Months,
                         true);
                 Real atmStrike = sec->atmLevel();
                 Real atmVol;
@@ -188,10 +188,10 @@ namespace QuantLib {
 
                 Real maturity = fabs(solution[1]);
 
-                Size years = (Size)std::floor(maturity);
+                Size years = (Size)floor(maturity);
                 maturity -= (Real)years;
                 maturity *= 12.0;
-                Size months = (Size)std::floor(maturity + 0.5);
+                Size months = (Size)floor(maturity + 0.5);
                 if (years == 0 && months == 0)
                     months = 1; // ensure a maturity of at least one months
                 // maturity -= (Real)months; maturity *= 365.25;
@@ -145,25 +145,25 @@ namespace QuantLib {
                 for (Real val : vals) {
                     res += val * val;
                 }
-                return std::sqrt(res / vals.size());
+                return sqrt(res / vals.size());
             }
 
             Array values(const Array& v) const override {
                 // transformations
                 int type = type_; // start with same type as non standard
                                   // underlying (1 means payer, -1 receiver)
-                Real nominal = std::fabs(v[0]);
+                Real nominal = fabs(v[0]);
                 if (v[0] < 0.0)
                     type *= -1;
-                Real maturity = std::min(std::fabs(v[1]), maxMaturity_);
+                Real maturity = std::min(fabs(v[1]), maxMaturity_);
 
                 Real fixedRate = v[2]; // allow for negative rates explicitly
                 // (though it might not be reasonable for calibration depending
                 // on the model to calibrate and the market instrument quotation)
-                Size years = (Size)std::floor(maturity);
+                Size years = (Size)floor(maturity);
                 maturity -= (Real)years;
                 maturity *= 12.0;
-                Size months = (Size)std::floor(maturity);
+                Size months = (Size)floor(maturity);
                 Real alpha = 1.0 - (maturity - (Real)months);
                 if (years == 0 && months == 0) {
                     months = 1;  // ensure a maturity of at least one month ...
@@ -89,7 +89,7 @@ namespace QuantLib {
         Real vega(const Real strike, const Real atmForward, const Real stdDev,
                   const Real exerciseTime, const Real annuity,
                   const Real displacement) {
-            return std::sqrt(exerciseTime) *
+            return sqrt(exerciseTime) *
                    blackFormulaStdDevDerivative(strike, atmForward, stdDev,
                                                 annuity, displacement);
         }
@@ -112,7 +112,7 @@ namespace QuantLib {
         }
         Real vega(const Real strike, const Real atmForward, const Real stdDev,
                   const Real exerciseTime, const Real annuity, const Real) {
-            return std::sqrt(exerciseTime) *
+            return sqrt(exerciseTime) *
                    bachelierBlackFormulaStdDevDerivative(
                        strike, atmForward, stdDev, annuity);
         }
@@ -256,7 +256,7 @@ namespace QuantLib {
         Real spread = swap->spread();
         if (spread!=0.0) {
             Spread correction =
-                spread * std::fabs(swap->floatingLegBPS() / swap->fixedLegBPS());
+                spread * fabs(swap->floatingLegBPS() / swap->fixedLegBPS());
             strike -= correction;
             atmForward -= correction;
             results_.additionalResults["spreadCorrection"] = correction;
@@ -271,7 +271,7 @@ namespace QuantLib {
             (arguments_.settlementType == Settlement::Cash &&
              arguments_.settlementMethod ==
                  Settlement::CollateralizedCashPrice)) {
-            annuity = std::fabs(swap->fixedLegBPS()) / basisPoint;
+            annuity = fabs(swap->fixedLegBPS()) / basisPoint;
         } else if (arguments_.settlementType == Settlement::Cash &&
                    arguments_.settlementMethod == Settlement::ParYieldCurve) {
             DayCounter dayCount = firstCoupon->dayCounter();
@@ -289,7 +289,7 @@ namespace QuantLib {
                 CashFlows::bps(fixedLeg,
                         InterestRate(atmForward, dayCount, Compounded, freq),
                         false, discountDate);
-            annuity = std::fabs(fixedLegCashBPS / basisPoint) *
+            annuity = fabs(fixedLegCashBPS / basisPoint) *
                       discountCurve_->discount(discountDate);
         } else {
             QL_FAIL("invalid (settlementType, settlementMethod) pair");
@@ -302,7 +302,7 @@ namespace QuantLib {
 
         // swapLength is rounded to whole months. To ensure we can read a variance
         // and a shift from vol_ we floor swapLength at 1/12 here therefore.
-        swapLength = std::max(swapLength, 1.0 / 12.0);
+        swapLength = std::max(swapLength, Time(1.0 / 12.0));
         results_.additionalResults["swapLength"] = swapLength;
 
         Real variance = vol_->blackVariance(exerciseDate, swapLength, strike);
@@ -311,7 +311,7 @@ namespace QuantLib {
             vol_->volatilityType() == ShiftedLognormal ?
             vol_->shift(exerciseDate, swapLength) : 0.0;
 
-        Real stdDev = std::sqrt(variance);
+        Real stdDev = sqrt(variance);
         results_.additionalResults["stdDev"] = stdDev;
         Option::Type w = (swap->type() == Swap::Payer) ? Option::Call : Option::Put;
         results_.value = Spec().value(w, strike, atmForward, stdDev, annuity, displacement);
@@ -322,7 +322,7 @@ namespace QuantLib {
         results_.additionalResults["delta"] = Spec().delta(
             w, strike, atmForward, stdDev, annuity, displacement);
         results_.additionalResults["timeToExpiry"] = exerciseTime;
-        results_.additionalResults["impliedVolatility"] = Real(stdDev / std::sqrt(exerciseTime));
+        results_.additionalResults["impliedVolatility"] = Real(stdDev / sqrt(exerciseTime));
         results_.additionalResults["forwardPrice"] = Real(results_.value / discountCurve_->discount(exerciseDate));
     }
 
@@ -58,7 +58,7 @@ namespace QuantLib {
             auto swap = arguments_.swap;
             swap->setPricingEngine(ext::make_shared<DiscountingSwapEngine>(model_->termStructure(), false));
             Spread correction = swap->spread() *
-                std::fabs(swap->floatingLegBPS() / swap->fixedLegBPS());
+                fabs(swap->floatingLegBPS() / swap->fixedLegBPS());
             Rate fixedRate = swap->fixedRate() - correction;
 
             results_.value =  model_->swaption(arguments_, fixedRate,
@@ -228,7 +228,7 @@ namespace QuantLib {
                 if (event1Time != Null<Real>()) {
                     Real zSpreadDf = oas_.empty()
                                          ? Real(1.0)
-                                         : std::exp(-oas_->value() *
+                                         : exp(-oas_->value() *
                                                     (event1Time - event0Time));
                     Array yg =
                         model_->yGrid(stddevs_, integrationPoints_, event1Time,
@@ -343,7 +343,7 @@ namespace QuantLib {
                             Real zSpreadDf =
                                 oas_.empty()
                                     ? Real(1.0)
-                                    : std::exp(-oas_->value() *
+                                    : exp(-oas_->value() *
                                                (event1Time - event0Time));
                             Array yg = model_->yGrid(
                                 stddevs_, integrationPoints_, event1Time,
@@ -438,7 +438,7 @@ namespace QuantLib {
                         Real zSpreadDf =
                             oas_.empty()
                                 ? Real(1.0)
-                                : std::exp(
+                                : exp(
                                       -oas_->value() *
                                       (model_->termStructure()
                                            ->dayCounter()
@@ -522,7 +522,7 @@ namespace QuantLib {
                         Real zSpreadDf =
                             oas_.empty()
                                 ? Real(1.0)
-                                : std::exp(
+                                : exp(
                                       -oas_->value() *
                                       (model_->termStructure()
                                            ->dayCounter()
@@ -602,7 +602,7 @@ namespace QuantLib {
                             zSpreadDf =
                                 oas_.empty()
                                     ? Real(1.0)
-                                    : std::exp(-oas_->value() *
+                                    : exp(-oas_->value() *
                                                (model_->termStructure()
                                                     ->dayCounter()
                                                     .yearFraction(event0,
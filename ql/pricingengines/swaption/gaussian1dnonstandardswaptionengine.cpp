@@ -207,7 +207,7 @@ namespace QuantLib {
                 if (expiry1Time != Null<Real>()) {
                     Real zSpreadDf =
                         oas_.empty() ? Real(1.0)
-                                     : std::exp(-oas_->value() *
+                                     : exp(-oas_->value() *
                                                 (expiry1Time - expiry0Time));
                     Array yg = model_->yGrid(stddevs_, integrationPoints_,
                                              expiry1Time, expiry0Time,
@@ -277,7 +277,7 @@ namespace QuantLib {
                             Real zSpreadDf =
                                 oas_.empty()
                                     ? Real(1.0)
-                                    : std::exp(-oas_->value() *
+                                    : exp(-oas_->value() *
                                                (expiry1Time - expiry0Time));
                             Array yg = model_->yGrid(
                                 stddevs_, integrationPoints_, expiry1Time,
@@ -362,7 +362,7 @@ namespace QuantLib {
                         Real zSpreadDf =
                             oas_.empty()
                                 ? Real(1.0)
-                                : std::exp(
+                                : exp(
                                       -oas_->value() *
                                       (model_->termStructure()
                                            ->dayCounter()
@@ -393,7 +393,7 @@ namespace QuantLib {
                         Real zSpreadDf =
                             oas_.empty()
                                 ? Real(1.0)
-                                : std::exp(
+                                : exp(
                                       -oas_->value() *
                                       (model_->termStructure()
                                            ->dayCounter()
@@ -415,7 +415,7 @@ namespace QuantLib {
                         zSpreadDf =
                             oas_.empty()
                                 ? Real(1.0)
-                                : std::exp(
+                                : exp(
                                       -oas_->value() *
                                       (model_->termStructure()
                                            ->dayCounter()
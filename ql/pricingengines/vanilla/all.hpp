@@ -19,6 +19,7 @@
 #include <pricingengines/vanilla/coshestonengine.hpp>
 #include <pricingengines/vanilla/discretizedvanillaoption.hpp>
 #include <pricingengines/vanilla/exponentialfittinghestonengine.hpp>
+#include <pricingengines/vanilla/fdrichardsonvanillaengine.hpp>
 #include <pricingengines/vanilla/hestonexpansionengine.hpp>
 #include <pricingengines/vanilla/integralengine.hpp>
 #include <pricingengines/vanilla/jumpdiffusionengine.hpp>
@@ -71,7 +71,7 @@ namespace QuantLib {
                                               arguments_.exercise->lastDate(),
                                               payoff->strike());
 
-        BlackCalculator black(payoff, forwardPrice, std::sqrt(variance),
+        BlackCalculator black(payoff, forwardPrice, sqrt(variance),
                               riskFreeDiscount);
 
         results_.value = black.value();
@@ -69,7 +69,7 @@ namespace QuantLib {
         QL_REQUIRE(spot > 0.0, "negative or null underlying given");
         Real forwardPrice = spot * dividendDiscount / riskFreeDiscountForFwdEstimation;
 
-        BlackCalculator black(payoff, forwardPrice, std::sqrt(variance),df);
+        BlackCalculator black(payoff, forwardPrice, sqrt(variance),df);
 
 
         results_.value = black.value();
@@ -110,7 +110,7 @@ namespace QuantLib {
         results_.additionalResults["riskFreeDiscount"] = riskFreeDiscountForFwdEstimation;
         results_.additionalResults["forward"] = forwardPrice;
         results_.additionalResults["strike"] = payoff->strike();
-        results_.additionalResults["volatility"] = Real(std::sqrt(variance / tte));
+        results_.additionalResults["volatility"] = Real(sqrt(variance / tte));
         results_.additionalResults["timeToExpiry"] = tte;
     }
 
@@ -28,7 +28,7 @@ namespace QuantLib {
     namespace {
 
         Real g_k(Real t, Real kappa){
-            return (1 - std::exp(- kappa * t )) / kappa;
+            return (1 - exp(- kappa * t )) / kappa;
         }
 
         class integrand_vasicek {
@@ -82,8 +82,8 @@ namespace QuantLib {
         Real zcb = vasicekProcess_->discountBond(t, T, r_t);
         Real epsilon = payoff->optionType() == Option::Call ? 1 : -1;
         Real upsilon = (*simpsonIntegral_)(integrand_vasicek(sigma_s, sigma_r, correlation_, kappa, T), t, T);
-        Real d_positive = (std::log((S_t / K) / zcb) + upsilon / 2) / std::sqrt(upsilon);
-        Real d_negative = (std::log((S_t / K) / zcb) - upsilon / 2) / std::sqrt(upsilon);
+        Real d_positive = (log((S_t / K) / zcb) + upsilon / 2) / sqrt(upsilon);
+        Real d_negative = (log((S_t / K) / zcb) - upsilon / 2) / sqrt(upsilon);
         Real n_d1 = f(epsilon * d_positive);
         Real n_d2 = f(epsilon * d_negative);
 
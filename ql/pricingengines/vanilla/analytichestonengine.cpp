@@ -61,7 +61,7 @@ namespace QuantLib {
             integrand1(Real c_inf, std::function<Real(Real)> f) : c_inf_(c_inf), f_(std::move(f)) {}
             Real operator()(Real x) const {
                 if ((1.0-x)*c_inf_ > QL_EPSILON)
-                    return f_(-std::log(0.5-0.5*x)/c_inf_)/((1.0-x)*c_inf_);
+                    return f_(-log(0.5-0.5*x)/c_inf_)/((1.0-x)*c_inf_);
                 else
                     return 0.0;
             }
@@ -75,7 +75,7 @@ namespace QuantLib {
             integrand2(Real c_inf, std::function<Real(Real)> f) : c_inf_(c_inf), f_(std::move(f)) {}
             Real operator()(Real x) const {
                 if (x*c_inf_ > QL_EPSILON) {
-                    return f_(-std::log(x)/c_inf_)/(x*c_inf_);
+                    return f_(-log(x)/c_inf_)/(x*c_inf_);
                 } else {
                     return 0.0;
                 }
@@ -94,11 +94,11 @@ namespace QuantLib {
 
         class u_Max {
           public:
-            u_Max(Real c_inf, Real epsilon) : c_inf_(c_inf), logEpsilon_(std::log(epsilon)) {}
+            u_Max(Real c_inf, Real epsilon) : c_inf_(c_inf), logEpsilon_(log(epsilon)) {}
 
             Real operator()(Real u) const {
                 ++evaluations_;
-                return c_inf_*u + std::log(u) + logEpsilon_;
+                return c_inf_*u + log(u) + logEpsilon_;
             }
 
             Size evaluations() const { return evaluations_; }
@@ -111,11 +111,11 @@ namespace QuantLib {
 
         class uHat_Max {
           public:
-            uHat_Max(Real v0T2, Real epsilon) : v0T2_(v0T2), logEpsilon_(std::log(epsilon)) {}
+            uHat_Max(Real v0T2, Real epsilon) : v0T2_(v0T2), logEpsilon_(log(epsilon)) {}
 
             Real operator()(Real u) const {
                 ++evaluations_;
-                return v0T2_*u*u + std::log(u) + logEpsilon_;
+                return v0T2_*u*u + log(u) + logEpsilon_;
             }
 
             Size evaluations() const { return evaluations_; }
@@ -169,9 +169,9 @@ namespace QuantLib {
         v0_(v0),
         cpxLog_(cpxLog),
         term_(term),
-        x_(std::log(s0)),
-        sx_(std::log(strike)),
-        dd_(x_-std::log(ratio)),
+        x_(log(s0)),
+        sx_(log(strike)),
+        dd_(x_-log(ratio)),
         sigma2_(sigma_*sigma_),
         rsigma_(rho*sigma_),
         t0_(kappa - ((j== 1)? rho*sigma : Real(0))),
@@ -186,9 +186,9 @@ namespace QuantLib {
 
         const std::complex<Real> t1 = t0_+std::complex<Real>(0, -rpsig);
         const std::complex<Real> d =
-            std::sqrt(t1*t1 - sigma2_*phi
+            sqrt(t1*t1 - sigma2_*phi
                       *std::complex<Real>(-phi, (j_== 1)? 1 : -1));
-        const std::complex<Real> ex = std::exp(-d*term_);
+        const std::complex<Real> ex = exp(-d*term_);
         const std::complex<Real> addOnTerm =
             engine_ != nullptr ? engine_->addOnTerm(phi, term_, j_) : Real(0.0);
 
@@ -197,10 +197,10 @@ namespace QuantLib {
                 if (sigma_ > 1e-5) {
                     const std::complex<Real> p = (t1-d)/(t1+d);
                     const std::complex<Real> g
-                                            = std::log((1.0 - p*ex)/(1.0 - p));
+                                            = log((1.0 - p*ex)/(1.0 - p));
 
                     return
-                        std::exp(v0_*(t1-d)*(1.0-ex)/(sigma2_*(1.0-ex*p))
+                        exp(v0_*(t1-d)*(1.0-ex)/(sigma2_*(1.0-ex*p))
                                  + (kappa_*theta_)/sigma2_*((t1-d)*term_-2.0*g)
                                  + std::complex<Real>(0.0, phi*(dd_-sx_))
                                  + addOnTerm
@@ -213,7 +213,7 @@ namespace QuantLib {
                     const std::complex<Real> g = p*(1.0-ex);
 
                     return
-                        std::exp(v0_*td*(1.0-ex)/(1.0-p*ex)
+                        exp(v0_*td*(1.0-ex)/(1.0-p*ex)
                                  + (kappa_*theta_)*(td*term_-2.0*g/sigma2_)
                                  + std::complex<Real>(0.0, phi*(dd_-sx_))
                                  + addOnTerm
@@ -224,11 +224,11 @@ namespace QuantLib {
                 // use l'Hospital's rule to get lim_{phi->0}
                 if (j_ == 1) {
                     const Real kmr = rsigma_-kappa_;
-                    if (std::fabs(kmr) > 1e-7) {
+                    if (fabs(kmr) > 1e-7) {
                         return dd_-sx_
-                            + (std::exp(kmr*term_)*kappa_*theta_
+                            + (exp(kmr*term_)*kappa_*theta_
                                -kappa_*theta_*(kmr*term_+1.0) ) / (2*kmr*kmr)
-                            - v0_*(1.0-std::exp(kmr*term_)) / (2.0*kmr);
+                            - v0_*(1.0-exp(kmr*term_)) / (2.0*kmr);
                     }
                     else
                         // \kappa = \rho * \sigma
@@ -237,9 +237,9 @@ namespace QuantLib {
                 }
                 else {
                     return dd_-sx_
-                        - (std::exp(-kappa_*term_)*kappa_*theta_
+                        - (exp(-kappa_*term_)*kappa_*theta_
                            +kappa_*theta_*(kappa_*term_-1.0))/(2*kappa_*kappa_)
-                        - v0_*(1.0-std::exp(-kappa_*term_))/(2*kappa_);
+                        - v0_*(1.0-exp(-kappa_*term_))/(2*kappa_);
                 }
             }
         }
@@ -250,18 +250,18 @@ namespace QuantLib {
             std::complex<Real> g;
 
             // the exp of the following expression is needed.
-            const std::complex<Real> e = std::log(p)+d*term_;
+            const std::complex<Real> e = log(p)+d*term_;
 
             // does it fit to the machine precision?
-            if (std::exp(-e.real()) > QL_EPSILON) {
-                g = std::log((1.0 - p/ex)/(1.0 - p));
+            if (exp(-e.real()) > QL_EPSILON) {
+                g = log((1.0 - p/ex)/(1.0 - p));
             } else {
                 // use a "big phi" approximation
-                g = d*term_ + std::log(p/(p - 1.0));
+                g = d*term_ + log(p/(p - 1.0));
 
                 if (g.imag() > M_PI || g.imag() <= -M_PI) {
                     // get back to principal branch of the complex logarithm
-                    Real im = std::fmod(g.imag(), 2*M_PI);
+                    Real im = fmod(g.imag(), 2*M_PI);
                     if (im > M_PI)
                         im -= 2*M_PI;
                     else if (im <= -M_PI)
@@ -286,7 +286,7 @@ namespace QuantLib {
             g_km1_ = g.imag();
             g += std::complex<Real>(0, 2*b_*M_PI);
 
-            return std::exp(v0_*(t1+d)*(ex-1.0)/(sigma2_*(ex-p))
+            return exp(v0_*(t1+d)*(ex-1.0)/(sigma2_*(ex-p))
                             + (kappa_*theta_)/sigma2_*((t1+d)*term_-2.0*g)
                             + std::complex<Real>(0,phi*(dd_-sx_))
                             + addOnTerm
@@ -308,7 +308,7 @@ namespace QuantLib {
       theta_(enginePtr->model_->theta()),
       sigma_(enginePtr->model_->sigma()),
       rho_(enginePtr->model_->rho()),
-      eps_(std::pow(2, -int(0.5*std::numeric_limits<Real>::digits))),
+      eps_(pow(2, -int(0.5*std::numeric_limits<Real>::digits))),
       enginePtr_(enginePtr)
       {
         km_ = k(0.0, -1);
@@ -410,14 +410,14 @@ namespace QuantLib {
 
     std::pair<Real, Real> AnalyticHestonEngine::OptimalAlpha::findMinima(
         Real lower, Real upper, Real strike) const {
-        const Real freq = std::log(fwd_/strike);
+        const Real freq = log(fwd_/strike);
 
         return boost::math::tools::brent_find_minima(
             [freq, this](Real alpha) -> Real {
                 ++evaluations_;
                 const std::complex<Real> z(0, -(alpha+1));
                 return enginePtr_->lnChF(z, t_).real()
-                    - std::log(alpha*(alpha+1)) + alpha*freq;
+                    - log(alpha*(alpha+1)) + alpha*freq;
             },
             lower, upper, int(0.5*std::numeric_limits<Real>::digits)
         );
@@ -427,21 +427,21 @@ namespace QuantLib {
         const Real beta = kappa_ - sigma_*rho_*k;
 
         if (k >= km_ && k <= kp_) {
-            const Real D = std::sqrt(beta*beta - sigma_*sigma_*k*(k-1));
-            return std::log((beta-D)/(beta+D)) / D;
+            const Real D = sqrt(beta*beta - sigma_*sigma_*k*(k-1));
+            return log((beta-D)/(beta+D)) / D;
         }
         else {
             const Real D_imag =
-                std::sqrt(-(beta*beta - sigma_*sigma_*k*(k-1)));
+                sqrt(-(beta*beta - sigma_*sigma_*k*(k-1)));
 
             return 2/D_imag
-                * ( ((beta>0.0)? M_PI : 0.0) - std::atan(D_imag/beta) );
+                * ( ((beta>0.0)? M_PI : 0.0) - atan(D_imag/beta) );
         }
     }
 
     Real AnalyticHestonEngine::OptimalAlpha::k(Real x, Integer sgn) const {
         return ( (sigma_ - 2*rho_*kappa_)
-                + sgn*std::sqrt(
+                + sgn*sqrt(
                       squared(sigma_-2*rho_*kappa_)
                     + 4*(kappa_*kappa_ + x*x/(t_*t_))*(1-rho_*rho_)))
                /(2*sigma_*(1-rho_*rho_));
@@ -454,11 +454,11 @@ namespace QuantLib {
     : term_(term),
       fwd_(fwd),
       strike_(strike),
-      freq_(std::log(fwd/strike)),
+      freq_(log(fwd/strike)),
       cpxLog_(cpxLog),
       enginePtr_(enginePtr),
       alpha_(alpha),
-      s_alpha_(std::exp(alpha*freq_))
+      s_alpha_(exp(alpha*freq_))
       {
         QL_REQUIRE(enginePtr != nullptr, "pricing engine required");
 
@@ -470,33 +470,33 @@ namespace QuantLib {
 
         switch(cpxLog_) {
           case AndersenPiterbarg:
-              vAvg_ = (1-std::exp(-kappa*term))*(v0 - theta)
+              vAvg_ = (1-exp(-kappa*term))*(v0 - theta)
                         /(kappa*term) + theta;
             break;
           case AndersenPiterbargOptCV:
-              vAvg_ = -8.0*std::log(enginePtr->chF(
+              vAvg_ = -8.0*log(enginePtr->chF(
                          std::complex<Real>(0, alpha_), term).real())/term;
             break;
           case AsymptoticChF:
             phi_ = -(v0+term*kappa*theta)/sigma
-                * std::complex<Real>(std::sqrt(1-rho*rho), rho);
+                * std::complex<Real>(sqrt(1-rho*rho), rho);
 
             psi_ = std::complex<Real>(
                 (kappa- 0.5*rho*sigma)*(v0 + term*kappa*theta)
-                + kappa*theta*std::log(4*(1-rho*rho)),
-                - ((0.5*rho*rho*sigma - kappa*rho)/std::sqrt(1-rho*rho)
+                + kappa*theta*log(4*(1-rho*rho)),
+                - ((0.5*rho*rho*sigma - kappa*rho)/sqrt(1-rho*rho)
                         *(v0 + kappa*theta*term)
-                  - 2*kappa*theta*std::atan(rho/std::sqrt(1-rho*rho))))
+                  - 2*kappa*theta*atan(rho/sqrt(1-rho*rho))))
                           /(sigma*sigma);
             [[fallthrough]];
           case AngledContour:
-            vAvg_ = (1-std::exp(-kappa*term))*(v0 - theta)
+            vAvg_ = (1-exp(-kappa*term))*(v0 - theta)
                       /(kappa*term) + theta;
             [[fallthrough]];
           case AngledContourNoCV:
             {
               const Real r = rho - sigma*freq_ / (v0 + kappa*theta*term);
-              tanPhi_ = std::tan(
+              tanPhi_ = tan(
                      (r*freq_ < 0.0)? M_PI/12*boost::math::sign(freq_) : 0.0
                 );
             }
@@ -521,14 +521,14 @@ namespace QuantLib {
 
             std::complex<Real> phiBS(0.0);
             if (cpxLog_ == AngledContour)
-                phiBS = std::exp(
+                phiBS = exp(
                     -0.5*vAvg_*term_*(hPrime*hPrime +
                             std::complex<Real>(-hPrime.imag(), hPrime.real())));
             else if (cpxLog_ == AsymptoticChF)
-                phiBS = std::exp(u*std::complex<Real>(1, tanPhi_)*phi_ + psi_);
+                phiBS = exp(u*std::complex<Real>(1, tanPhi_)*phi_ + psi_);
 
-            return std::exp(-u*tanPhi_*freq_)
-                    *(std::exp(std::complex<Real>(0.0, u*freq_))
+            return exp(-u*tanPhi_*freq_)
+                    *(exp(std::complex<Real>(0.0, u*freq_))
                       *std::complex<Real>(1, tanPhi_)
                       *(phiBS - enginePtr_->chF(hPrime, term_))/(h_u*hPrime)
                       ).real()*s_alpha_;
@@ -536,12 +536,12 @@ namespace QuantLib {
         else if (cpxLog_ == AndersenPiterbarg || cpxLog_ == AndersenPiterbargOptCV) {
             const std::complex<Real> z(u, -alpha_);
             const std::complex<Real> zPrime(u, -alpha_-1);
-            const std::complex<Real> phiBS = std::exp(
+            const std::complex<Real> phiBS = exp(
                 -0.5*vAvg_*term_*(zPrime*zPrime +
                         std::complex<Real>(-zPrime.imag(), zPrime.real()))
             );
 
-            return (std::exp(std::complex<Real> (0.0, u*freq_))
+            return (exp(std::complex<Real> (0.0, u*freq_))
                 * (phiBS - enginePtr_->chF(zPrime, term_)) / (z*zPrime)
                 ).real()*s_alpha_;
         }
@@ -553,7 +553,7 @@ namespace QuantLib {
         if (   cpxLog_ == AngledContour
             || cpxLog_ == AndersenPiterbarg || cpxLog_ == AndersenPiterbargOptCV) {
               return BlackCalculator(
-                  Option::Call, strike_, fwd_, std::sqrt(vAvg_*term_))
+                  Option::Call, strike_, fwd_, sqrt(vAvg_*term_))
                       .value();
         }
         else if (cpxLog_ == AsymptoticChF) {
@@ -562,10 +562,10 @@ namespace QuantLib {
             const std::complex<Real> phiFreq(phi_.real(), phi_.imag() + freq_);
 
             using namespace ExponentialIntegral;
-            return fwd_ - std::sqrt(strike_*fwd_)/M_PI*
-                (std::exp(psi_)*(
-                      -2.0*Ci(-0.5*phiFreq)*std::sin(0.5*phiFreq)
-                       +std::cos(0.5*phiFreq)*(M_PI+2.0*Si(0.5*phiFreq)))).real();
+            return fwd_ - sqrt(strike_*fwd_)/M_PI*
+                (exp(psi_)*(
+                      -2.0*Ci(-0.5*phiFreq)*sin(0.5*phiFreq)
+                       +cos(0.5*phiFreq)*(M_PI+2.0*Si(0.5*phiFreq)))).real();
         }
         else if (cpxLog_ == AngledContourNoCV) {
             return     ((alpha_ <=  0.0)? fwd_ : 0.0)
@@ -580,7 +580,7 @@ namespace QuantLib {
     std::complex<Real> AnalyticHestonEngine::chF(
         const std::complex<Real>& z, Time t) const {
         if (model_->sigma() > 1e-6 || model_->kappa() < 1e-8) {
-            return std::exp(lnChF(z, t));
+            return exp(lnChF(z, t));
         }
         else {
             const Real kappa = model_->kappa();
@@ -592,22 +592,22 @@ namespace QuantLib {
             const Real sigma2 = sigma*sigma;
 
             const Real kt = kappa*t;
-            const Real ekt = std::exp(kt);
-            const Real e2kt = std::exp(2*kt);
+            const Real ekt = exp(kt);
+            const Real e2kt = exp(2*kt);
             const Real rho2 = rho*rho;
             const std::complex<Real> zpi = z + std::complex<Real>(0.0, 1.0);
 
-            return std::exp(-(((theta - v0 + ekt*((-1 + kt)*theta + v0))
+            return exp(-(((theta - v0 + ekt*((-1 + kt)*theta + v0))
                     *z*zpi)/ekt)/(2.*kappa))
 
-                + (std::exp(-(kt) - ((theta - v0 + ekt
+                + (exp(-(kt) - ((theta - v0 + ekt
                     *((-1 + kt)*theta + v0))*z*zpi)
                 /(2.*ekt*kappa))*rho*(2*theta + kt*theta -
                     v0 - kt*v0 + ekt*((-2 + kt)*theta + v0))
                 *(1.0 - std::complex<Real>(-z.imag(),z.real()))*z*z)
                     /(2.*kappa*kappa)*sigma
 
-                   + (std::exp(-2*kt - ((theta - v0 + ekt
+                   + (exp(-2*kt - ((theta - v0 + ekt
                 *((-1 + kt)*theta + v0))*z*zpi)/(2.*ekt*kappa))*z*z*zpi
                 *(-2*rho2*squared(2*theta + kt*theta - v0 -
                     kt*v0 + ekt*((-2 + kt)*theta + v0))
@@ -634,7 +634,7 @@ namespace QuantLib {
         const std::complex<Real> g
             = kappa + rho*sigma*std::complex<Real>(z.imag(), -z.real());
 
-        const std::complex<Real> D = std::sqrt(
+        const std::complex<Real> D = sqrt(
             g*g + (z*z + std::complex<Real>(-z.imag(), z.real()))*sigma2);
 
         // reduce cancelation errors, see. L. Andersen and M. Lake
@@ -710,9 +710,9 @@ namespace QuantLib {
         AnalyticHestonEngine::optimalControlVariate(
         Time t, Real v0, Real kappa, Real theta, Real sigma, Real rho) {
 
-        if (t > 0.15 && (v0+t*kappa*theta)/sigma*std::sqrt(1-rho*rho) < 0.15
+        if (t > 0.15 && (v0+t*kappa*theta)/sigma*sqrt(1-rho*rho) < 0.15
                 && ((kappa- 0.5*rho*sigma)*(v0 + t*kappa*theta)
-                    + kappa*theta*std::log(4*(1-rho*rho)))/(sigma*sigma) < 0.1) {
+                    + kappa*theta*log(4*(1-rho*rho)))/(sigma*sigma) < 0.1) {
             return AsymptoticChF;
         }
         else {
@@ -775,7 +775,7 @@ namespace QuantLib {
           case Gatheral:
           case BranchCorrection: {
             const Real c_inf = std::min(0.2, std::max(0.0001,
-                std::sqrt(1.0-rho*rho)/sigma))*(v0 + kappa*theta*maturity);
+                sqrt(1.0-rho*rho)/sigma))*(v0 + kappa*theta*maturity);
 
             const Real p1 = integration_->calculate(c_inf,
                 Fj_Helper(kappa, theta, sigma, v0, spot, rho, this,
@@ -809,10 +809,10 @@ namespace QuantLib {
           case AngledContourNoCV:
           case OptimalCV: {
             const Real c_inf =
-                std::sqrt(1.0-rho*rho)*(v0 + kappa*theta*maturity)/sigma;
+                sqrt(1.0-rho*rho)*(v0 + kappa*theta*maturity)/sigma;
 
             const Real epsilon = andersenPiterbargEpsilon_
-                *M_PI/(std::sqrt(strike*fwd)*dr);
+                *M_PI/(sqrt(strike*fwd)*dr);
 
             const std::function<Real()> uM = [&](){
                 return Integration::andersenPiterbargIntegrationLimit(
@@ -829,10 +829,10 @@ namespace QuantLib {
 
             const Real cvValue = cvHelper.controlVariateValue();
 
-            const Real vAvg = (1-std::exp(-kappa*maturity))*(v0-theta)/(kappa*maturity) + theta;
+            const Real vAvg = (1-exp(-kappa*maturity))*(v0-theta)/(kappa*maturity) + theta;
 
             const Real scalingFactor = (cpxLog_ != OptimalCV && cpxLog_ != AsymptoticChF)
-                ? std::max(0.25, std::min(1000.0, 0.25/std::sqrt(0.5*vAvg*maturity)))
+                ? std::max(0.25, std::min(1000.0, 0.25/sqrt(0.5*vAvg*maturity)))
                 : Real(1.0);
 
             const Real h_cv =
@@ -1048,14 +1048,14 @@ namespace QuantLib {
     Real AnalyticHestonEngine::Integration::andersenPiterbargIntegrationLimit(
         Real c_inf, Real epsilon, Real v0, Real t) {
 
-        const Real uMaxGuess = -std::log(epsilon)/c_inf;
+        const Real uMaxGuess = -log(epsilon)/c_inf;
         const Real uMaxStep = 0.1*uMaxGuess;
 
         const Real uMax = Brent().solve(u_Max(c_inf, epsilon),
             QL_EPSILON*uMaxGuess, uMaxGuess, uMaxStep);
 
         try {
-            const Real uHatMaxGuess = std::sqrt(-std::log(epsilon)/(0.5*v0*t));
+            const Real uHatMaxGuess = sqrt(-log(epsilon)/(0.5*v0*t));
             const Real uHatMax = Brent().solve(uHat_Max(0.5*v0*t, epsilon),
                 QL_EPSILON*uHatMaxGuess, uHatMaxGuess, 0.001*uHatMaxGuess);
 
@@ -1088,7 +1088,7 @@ namespace QuantLib {
           case Gatheral:
           case BranchCorrection: {
             const Real c_inf = std::min(0.2, std::max(0.0001,
-                std::sqrt(1.0-rho*rho)/sigma))*(v0 + kappa*theta*term);
+                sqrt(1.0-rho*rho)/sigma))*(v0 + kappa*theta*term);
 
             const Real p1 = integration.calculate(c_inf,
                 Fj_Helper(kappa, theta, sigma, v0, spotPrice, rho, enginePtr,
@@ -1120,12 +1120,12 @@ namespace QuantLib {
           case AsymptoticChF:
           case OptimalCV: {
             const Real c_inf =
-                std::sqrt(1.0-rho*rho)*(v0 + kappa*theta*term)/sigma;
+                sqrt(1.0-rho*rho)*(v0 + kappa*theta*term)/sigma;
 
             const Real fwdPrice = spotPrice / ratio;
 
             const Real epsilon = enginePtr->andersenPiterbargEpsilon_
-                *M_PI/(std::sqrt(strikePrice*fwdPrice)*riskFreeDiscount);
+                *M_PI/(sqrt(strikePrice*fwdPrice)*riskFreeDiscount);
 
             const std::function<Real()> uM = [&](){
                 return Integration::andersenPiterbargIntegrationLimit(c_inf, epsilon, v0, term);
@@ -1141,7 +1141,7 @@ namespace QuantLib {
             const Real cvValue = cvHelper.controlVariateValue();
 
             const Real h_cv = integration.calculate(c_inf, cvHelper, uM)
-                * std::sqrt(strikePrice * fwdPrice)/M_PI;
+                * sqrt(strikePrice * fwdPrice)/M_PI;
             evaluations += integration.numberOfEvaluations();
 
             switch (type.optionType())
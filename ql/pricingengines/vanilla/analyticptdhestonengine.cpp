@@ -56,8 +56,8 @@ namespace QuantLib {
       term_(term),
 
       v0_(model->v0()),
-      x_ (std::log(model->s0())),
-      sx_(std::log(strike)),
+      x_ (log(model->s0())),
+      sx_(log(strike)),
       r_(model->timeGrid().size()-1),
       q_(model->timeGrid().size()-1),
       model_(model),
@@ -99,23 +99,23 @@ namespace QuantLib {
                 const Real rpsig = rho*sigma*phi;
 
                 const std::complex<Real> t1 = t0+std::complex<Real>(0, -rpsig);
-                const std::complex<Real> d  = std::sqrt(t1*t1 - sigma2*phi
+                const std::complex<Real> d  = sqrt(t1*t1 - sigma2*phi
                                  *std::complex<Real>(-phi, (j_== 1)? 1 : -1));
                 const std::complex<Real> g = (t1-d)/(t1+d);
                 const std::complex<Real> gt 
                                        = (t1-d - D*sigma2)/(t1+d - D*sigma2);
                 
-                D = (t1+d)/sigma2*(g-gt*std::exp(-d*tau))
-                    /(1.0-gt*std::exp(-d*tau));
+                D = (t1+d)/sigma2*(g-gt*exp(-d*tau))
+                    /(1.0-gt*exp(-d*tau));
                 
                 const std::complex<Real> lng 
-                    = std::log((1.0 - gt*std::exp(-d*tau))/(1.0 - gt));
+                    = log((1.0 - gt*exp(-d*tau))/(1.0 - gt));
                 
                 C =(kappa*theta)/sigma2*((t1-d)*tau-2.0*lng)
                     + std::complex<Real>(0.0, phi*(r_[i-1]-q_[i-1])*tau) + C;
             }
         }
-        return std::exp(v0_*D+C+std::complex<Real>(0.0, phi*(x_ - sx_))).imag()
+        return exp(v0_*D+C+std::complex<Real>(0.0, phi*(x_ - sx_))).imag()
                 /phi; 
     }
 
@@ -126,9 +126,9 @@ namespace QuantLib {
                   const AnalyticPTDHestonEngine* const enginePtr)
         : term_(term),
           sigmaBS_(sigmaBS),
-          x_(std::log(s0)),
-          sx_(std::log(strike)),
-          dd_(x_-std::log(ratio)),
+          x_(log(s0)),
+          sx_(log(strike)),
+          dd_(x_-log(ratio)),
           enginePtr_(enginePtr) {
             QL_REQUIRE(enginePtr != nullptr, "pricing engine required");
         }
@@ -137,10 +137,10 @@ namespace QuantLib {
             const std::complex<Real> z(u, -0.5);
 
             const std::complex<Real> phiBS
-                = std::exp(-0.5*sigmaBS_*sigmaBS_*term_
+                = exp(-0.5*sigmaBS_*sigmaBS_*term_
                            *(z*z + std::complex<Real>(-z.imag(), z.real())));
 
-            return (std::exp(std::complex<Real>(0.0, u*(dd_-sx_)))
+            return (exp(std::complex<Real>(0.0, u*(dd_-sx_)))
                 * (phiBS - enginePtr_->chF(z, term_)) / (u*u + 0.25)).real();
         }
 
@@ -186,7 +186,7 @@ namespace QuantLib {
             const std::complex<Real> k
                 = kappa + rho*sigma*std::complex<Real>(z.imag(), -z.real());
 
-            const std::complex<Real> d = std::sqrt(
+            const std::complex<Real> d = sqrt(
                 k*k + (z*z + std::complex<Real>(-z.imag(), z.real()))*sigma2);
 
             const std::complex<Real> g = (k-d)/(k+d);
@@ -194,10 +194,10 @@ namespace QuantLib {
             const std::complex<Real> gt = (k-d-D*sigma2)/(k+d-D*sigma2);
 
             C += kappa*theta/sigma2*( (k-d)*tau
-                   - 2.0*std::log((1.0-gt*std::exp(-d*tau))/(1.0-gt)));
+                   - 2.0*log((1.0-gt*exp(-d*tau))/(1.0-gt)));
 
-            D = (k+d)/sigma2 * (g - gt*std::exp(-d*tau))
-                    /(1.0 - gt*std::exp(-d*tau));
+            D = (k+d)/sigma2 * (g - gt*exp(-d*tau))
+                    /(1.0 - gt*exp(-d*tau));
         }
 
         return D*v0 + C;
@@ -205,7 +205,7 @@ namespace QuantLib {
 
     std::complex<Real> AnalyticPTDHestonEngine::chF(
         const std::complex<Real>& z, Time T) const {
-        return std::exp(lnChF(z, T));
+        return exp(lnChF(z, T));
     }
 
     AnalyticPTDHestonEngine::AnalyticPTDHestonEngine(
@@ -300,7 +300,7 @@ namespace QuantLib {
         switch(cpxLog_) {
           case Gatheral: {
             const Real c_inf = std::min(0.2, std::max(0.0001,
-                std::sqrt(1.0-squared(rhoAvg))/sigmaAvg))
+                sqrt(1.0-squared(rhoAvg))/sigmaAvg))
                 *(v0 + kappaAvg*thetaAvg*term);
 
             const Real p1 = integration_->calculate(c_inf,
@@ -335,7 +335,7 @@ namespace QuantLib {
 
               const std::complex<Real> D_u_inf =
                   -std::complex<Real>(
-                      std::sqrt(1-squared(model_->rho(t05))),
+                      sqrt(1-squared(model_->rho(t05))),
                       model_->rho(t05)) / model_->sigma(t05);
 
               const Size lastI = std::distance(timeGrid.begin(),
@@ -354,7 +354,7 @@ namespace QuantLib {
                   const Real rho = model_->rho(t);
 
                   C_u_inf += -kappa*theta*tau / sigma
-                      *std::complex<Real>(std::sqrt(1-rho*rho), rho);
+                      *std::complex<Real>(sqrt(1-rho*rho), rho);
               }
 
               const Real ratio = riskFreeDiscount/dividendDiscount;
@@ -362,7 +362,7 @@ namespace QuantLib {
               const Real fwdPrice = spotPrice / ratio;
 
               const Real epsilon = andersenPiterbargEpsilon_
-                  *M_PI/(std::sqrt(strike*fwdPrice)*riskFreeDiscount);
+                  *M_PI/(sqrt(strike*fwdPrice)*riskFreeDiscount);
 
               const Real c_inf = -(C_u_inf + D_u_inf*v0).real();
 
@@ -371,18 +371,18 @@ namespace QuantLib {
               };
 
               const Real vAvg
-                  = (1-std::exp(-kappaAvg*term))*(v0-thetaAvg)
+                  = (1-exp(-kappaAvg*term))*(v0-thetaAvg)
                     /(kappaAvg*term) + thetaAvg;
 
               const Real bsPrice
                   = BlackCalculator(Option::Call, strike,
-                                    fwdPrice, std::sqrt(vAvg*term),
+                                    fwdPrice, sqrt(vAvg*term),
                                     riskFreeDiscount).value();
 
               const Real h_cv = integration_->calculate(c_inf,
                       AP_Helper(term, spotPrice, strike,
-                                ratio, std::sqrt(vAvg), this),uM)
-                  * std::sqrt(strike * fwdPrice)*riskFreeDiscount/M_PI;
+                                ratio, sqrt(vAvg), this),uM)
+                  * sqrt(strike * fwdPrice)*riskFreeDiscount/M_PI;
               evaluations_ += integration_->numberOfEvaluations();
 
               switch (payoff->optionType())
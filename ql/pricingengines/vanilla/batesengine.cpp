@@ -49,8 +49,8 @@ namespace QuantLib {
         const std::complex<Real> g(i, phi);
 
         //it can throw: to be fixed
-        return t*lambda_*(std::exp(nu_*g + delta2_*g*g) - 1.0
-                          -g*(std::exp(nu_+delta2_) - 1.0));
+        return t*lambda_*(exp(nu_*g + delta2_*g*g) - 1.0
+                          -g*(exp(nu_+delta2_) - 1.0));
     }
 
 
@@ -77,9 +77,9 @@ namespace QuantLib {
         const Real kappaLambda = batesDetJumpModel->kappaLambda();
         const Real thetaLambda = batesDetJumpModel->thetaLambda();
 
-        return (kappaLambda*t - 1.0 + std::exp(-kappaLambda*t))
+        return (kappaLambda*t - 1.0 + exp(-kappaLambda*t))
             * thetaLambda*l/(kappaLambda*t*lambda)
-            + (1.0 - std::exp(-kappaLambda*t))*l/(kappaLambda*t);
+            + (1.0 - exp(-kappaLambda*t))*l/(kappaLambda*t);
     }
 
 
@@ -137,9 +137,9 @@ namespace QuantLib {
         const Real kappaLambda = doubleExpDetJumpModel->kappaLambda();
         const Real thetaLambda = doubleExpDetJumpModel->thetaLambda();
 
-        return (kappaLambda*t - 1.0 + std::exp(-kappaLambda*t))
+        return (kappaLambda*t - 1.0 + exp(-kappaLambda*t))
             * thetaLambda*l/(kappaLambda*t*lambda)
-            + (1.0 - std::exp(-kappaLambda*t))*l/(kappaLambda*t);
+            + (1.0 - exp(-kappaLambda*t))*l/(kappaLambda*t);
     }
 
 }
@@ -39,74 +39,74 @@ namespace QuantLib {
 
             Real lambda = (-rT + gamma * bT + 0.5 * gamma * (gamma - 1.0)
                 * variance);
-            Real d = -(std::log(S / H) + (bT + (gamma - 0.5) * variance) )
-                / std::sqrt(variance);
+            Real d = -(log(S / H) + (bT + (gamma - 0.5) * variance) )
+                / sqrt(variance);
             Real kappa = 2.0 * bT / variance + (2.0 * gamma - 1.0);
-            return std::exp(lambda) * (cumNormalDist(d)
-                - std::pow((I / S), kappa) *
-                cumNormalDist(d - 2.0 * std::log(I/S) / std::sqrt(variance)));
+            return exp(lambda) * (cumNormalDist(d)
+                - pow((I / S), kappa) *
+                cumNormalDist(d - 2.0 * log(I/S) / sqrt(variance)));
         }
 
         Real phi_S(Real S, Real gamma, Real H, Real I, Real rT, Real bT, Real v) {
-            const Real lsh = std::log(S/H);
-            const Real lis = std::log(I/S);
-            const Real sv = std::sqrt(v);
+            const Real lsh = log(S/H);
+            const Real lis = log(I/S);
+            const Real sv = sqrt(v);
 
-            return std::exp(bT*gamma - rT + ((-1 +gamma)*gamma*v)/2.)*((-(std::pow(I/S,2*(gamma + bT/v))/(std::exp(squared(2*bT - v + 2*gamma*v + 4*lis + 2*lsh)/(8.*v))*I))- 1/(std::exp(squared(2*bT - v + 2*gamma*v + 2*lsh)/(8.*v))*S))/(M_SQRT2*M_SQRTPI*sv) +(std::pow(I/S,2*(gamma + bT/v))*(2*bT + (-1 + 2*gamma)*v)*std::erfc((2*bT- v + 2*gamma*v + 4*lis + 2*lsh)/(2.*M_SQRT2*sv)))/(2.*I*v));
+            return exp(bT*gamma - rT + ((-1 +gamma)*gamma*v)/2.)*((-(pow(I/S,2*(gamma + bT/v))/(exp(squared(2*bT - v + 2*gamma*v + 4*lis + 2*lsh)/(8.*v))*I))- 1/(exp(squared(2*bT - v + 2*gamma*v + 2*lsh)/(8.*v))*S))/(M_SQRT2*M_SQRTPI*sv) +(pow(I/S,2*(gamma + bT/v))*(2*bT + (-1 + 2*gamma)*v)*erfc((2*bT- v + 2*gamma*v + 4*lis + 2*lsh)/(2.*M_SQRT2*sv)))/(2.*I*v));
         }
 
         Real phi_SS(Real S, Real gamma, Real H, Real I, Real rT, Real bT, Real v) {
-            const Real lsh = std::log(S/H);
-            const Real lis = std::log(I/S);
-            const Real sv = std::sqrt(v);
-            const Real ex = std::exp(squared(2*bT - v + 2*gamma*v + 4*lis + 2*lsh)/(8.*v));
-            const Real ey = std::exp(squared(2*bT + (-1 + 2*gamma)*v + 2*lsh)/(8.*v));
+            const Real lsh = log(S/H);
+            const Real lis = log(I/S);
+            const Real sv = sqrt(v);
+            const Real ex = exp(squared(2*bT - v + 2*gamma*v + 4*lis + 2*lsh)/(8.*v));
+            const Real ey = exp(squared(2*bT + (-1 + 2*gamma)*v + 2*lsh)/(8.*v));
 
-            return (std::exp(bT*gamma - rT + ((-1 +gamma)*gamma*v)/2.)*((M_SQRT2*I*v*sv)/ey +(2*M_SQRT2*std::pow(I/S,2*(gamma + bT/v))*S*sv*(2*bT +(-1 + 2*gamma)*v))/ex -2*std::sqrt(M_PI)*std::pow(I/S,2*(gamma + bT/v))*S*(bT +gamma*v)*(2*bT + (-1 + 2*gamma)*v)*std::erfc((2*bT - v + 2*gamma*v +4*lis + 2*lsh)/(2.*M_SQRT2*sv)) +(M_SQRT2*I*sv*(bT + (-0.5 + gamma)*v +lsh))/ey - (std::pow(I/S,2*(gamma + bT/v))*S*sv*(2*bT - 3*v + 2*gamma*v + 4*lis +2*lsh))/(M_SQRT2*ex)))/(2.*I*M_SQRTPI*squared(S*v));
+            return (exp(bT*gamma - rT + ((-1 +gamma)*gamma*v)/2.)*((M_SQRT2*I*v*sv)/ey +(2*M_SQRT2*pow(I/S,2*(gamma + bT/v))*S*sv*(2*bT +(-1 + 2*gamma)*v))/ex -2*sqrt(M_PI)*pow(I/S,2*(gamma + bT/v))*S*(bT +gamma*v)*(2*bT + (-1 + 2*gamma)*v)*erfc((2*bT - v + 2*gamma*v +4*lis + 2*lsh)/(2.*M_SQRT2*sv)) +(M_SQRT2*I*sv*(bT + (-0.5 + gamma)*v +lsh))/ey - (pow(I/S,2*(gamma + bT/v))*S*sv*(2*bT - 3*v + 2*gamma*v + 4*lis +2*lsh))/(M_SQRT2*ex)))/(2.*I*M_SQRTPI*squared(S*v));
         }
 
         Real phi_gamma(Real S, Real gamma, Real H, Real I, Real rT, Real bT, Real v) {
-            const Real lsh = std::log(S/H);
-            const Real lis = std::log(I/S);
-            const Real sv = std::sqrt(v);
+            const Real lsh = log(S/H);
+            const Real lis = log(I/S);
+            const Real sv = sqrt(v);
 
-            return std::exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2)*(((-std::exp(-squared(2*bT - v + 2*gamma*v +2*lsh)/(8*v)) + std::pow(I/S,-1 + 2*gamma +(2*bT)/v)/std::exp(squared(2*bT - v + 2*gamma*v + 4*lis +2*lsh)/(8*v)))*sv)/(M_SQRT2*M_SQRTPI) + ((2*bT+ (-1 + 2*gamma)*v)*std::erfc((2*bT + (-1 + 2*gamma)*v +2*lsh)/(2.*M_SQRT2*sv)))/4. -(std::pow(I/S,-1 + 2*gamma + (2*bT)/v)*std::erfc((2*bT - v + 2*gamma*v + 4*lis +2*lsh)/(2.*M_SQRT2*sv))*(2*bT + (-1 + 2*gamma)*v + 4*lis))/4.);
+            return exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2)*(((-exp(-squared(2*bT - v + 2*gamma*v +2*lsh)/(8*v)) + pow(I/S,-1 + 2*gamma +(2*bT)/v)/exp(squared(2*bT - v + 2*gamma*v + 4*lis +2*lsh)/(8*v)))*sv)/(M_SQRT2*M_SQRTPI) + ((2*bT+ (-1 + 2*gamma)*v)*erfc((2*bT + (-1 + 2*gamma)*v +2*lsh)/(2.*M_SQRT2*sv)))/4. -(pow(I/S,-1 + 2*gamma + (2*bT)/v)*erfc((2*bT - v + 2*gamma*v + 4*lis +2*lsh)/(2.*M_SQRT2*sv))*(2*bT + (-1 + 2*gamma)*v + 4*lis))/4.);
         }
 
         Real phi_H(Real S, Real gamma, Real H, Real I, Real rT, Real bT, Real v) {
-            const Real lsh = std::log(S/H);
+            const Real lsh = log(S/H);
 
-            return (std::exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2.)*(I/std::exp(squared(2*bT - v + 2*gamma*v + 2*lsh)/(8.*v))- (std::pow(I/S,2*(gamma + bT/v))*S)/std::exp(squared(2*bT - v + 2*gamma*v + 4*std::log(I/S) + 2*lsh)/(8.*v))))/(H*I*std::sqrt(2*M_PI)*std::sqrt(v));
+            return (exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2.)*(I/exp(squared(2*bT - v + 2*gamma*v + 2*lsh)/(8.*v))- (pow(I/S,2*(gamma + bT/v))*S)/exp(squared(2*bT - v + 2*gamma*v + 4*log(I/S) + 2*lsh)/(8.*v))))/(H*I*sqrt(2*M_PI)*sqrt(v));
         }
 
         Real phi_I(Real S, Real gamma, Real H, Real I, Real rT, Real bT, Real v) {
-            const Real lsh = std::log(S/H);
-            const Real lis = std::log(I/S);
-            const Real sv = std::sqrt(v);
+            const Real lsh = log(S/H);
+            const Real lis = log(I/S);
+            const Real sv = sqrt(v);
 
-            return (std::exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2.)*std::pow(I/S,2*(gamma + bT/v))*S*((2*std::sqrt(2/M_PI))/(std::exp(squared(2*bT - v + 2*gamma*v + 4*lis + 2*lsh)/(8.*v))*sv) + (1 - 2*gamma - (2*bT)/v)*std::erfc((2*bT - v + 2*gamma*v + 4*lis +2*lsh)/(2.*M_SQRT2*sv))))/(2.*I*I);
+            return (exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2.)*pow(I/S,2*(gamma + bT/v))*S*((2*sqrt(2/M_PI))/(exp(squared(2*bT - v + 2*gamma*v + 4*lis + 2*lsh)/(8.*v))*sv) + (1 - 2*gamma - (2*bT)/v)*erfc((2*bT - v + 2*gamma*v + 4*lis +2*lsh)/(2.*M_SQRT2*sv))))/(2.*I*I);
         }
 
         Real phi_rt(Real S, Real gamma, Real H, Real I, Real rT, Real bT, Real v) {
-            const Real lsh = std::log(S/H);
-            return (std::exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2.)*(-(I*std::erfc((2*bT- v + 2*gamma*v + 2*lsh)/(2.*std::sqrt(2*v)))) +std::pow(I/S,2*(gamma + bT/v))*S*std::erfc((2*bT - v + 2*gamma*v + 4*std::log(I/S) +2*lsh)/(2.*std::sqrt(2*v)))))/(2.*I);
+            const Real lsh = log(S/H);
+            return (exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2.)*(-(I*erfc((2*bT- v + 2*gamma*v + 2*lsh)/(2.*sqrt(2*v)))) +pow(I/S,2*(gamma + bT/v))*S*erfc((2*bT - v + 2*gamma*v + 4*log(I/S) +2*lsh)/(2.*sqrt(2*v)))))/(2.*I);
         }
 
         Real phi_bt(Real S, Real gamma, Real H, Real I, Real rT, Real bT, Real v) {
-            const Real lsh = std::log(S/H);
-            const Real lis = std::log(I/S);
-            const Real sv = std::sqrt(v);
+            const Real lsh = log(S/H);
+            const Real lis = log(I/S);
+            const Real sv = sqrt(v);
 
-            return (std::exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2.)*(M_SQRT2*(-(I/std::exp(squared(2*bT - v +2*gamma*v + 2*lsh)/(8.*v))) + (std::pow(I/S,2*(gamma +bT/v))*S)/std::exp(squared(2*bT - v + 2*gamma*v + 4*lis +2*lsh)/(8.*v)))*sv + gamma*I*std::sqrt(M_PI)*v*std::erfc((2*bT - v + 2*gamma*v +2*lsh)/(2.*M_SQRT2*sv)) - M_SQRTPI*std::pow(I/S,2*(gamma + bT/v))*S*std::erfc((2*bT - v +2*gamma*v + 4*lis + 2*lsh)/(2.*M_SQRT2*sv))*(gamma*v +2*lis)))/(2.*I*std::sqrt(M_PI)*v);
+            return (exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2.)*(M_SQRT2*(-(I/exp(squared(2*bT - v +2*gamma*v + 2*lsh)/(8.*v))) + (pow(I/S,2*(gamma +bT/v))*S)/exp(squared(2*bT - v + 2*gamma*v + 4*lis +2*lsh)/(8.*v)))*sv + gamma*I*sqrt(M_PI)*v*erfc((2*bT - v + 2*gamma*v +2*lsh)/(2.*M_SQRT2*sv)) - M_SQRTPI*pow(I/S,2*(gamma + bT/v))*S*erfc((2*bT - v +2*gamma*v + 4*lis + 2*lsh)/(2.*M_SQRT2*sv))*(gamma*v +2*lis)))/(2.*I*sqrt(M_PI)*v);
         }
 
         Real phi_v(Real S, Real gamma, Real H, Real I, Real rT, Real bT, Real v) {
-            const Real lsh = std::log(S/H);
-            const Real lis = std::log(I/S);
-            const Real sv = std::sqrt(v);
-            const Real er = std::erfc((2*bT - v + 2*gamma*v + 4*lis + 2*lsh)/(2.*M_SQRT2*sv));
+            const Real lsh = log(S/H);
+            const Real lis = log(I/S);
+            const Real sv = sqrt(v);
+            const Real er = erfc((2*bT - v + 2*gamma*v + 4*lis + 2*lsh)/(2.*M_SQRT2*sv));
 
-            return (std::exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2.)*(((-1 +gamma)*gamma*(I*std::erfc((2*bT - v + 2*gamma*v + 2*lsh)/(2.*M_SQRT2*sv)) -std::pow(I/S,2*(gamma + bT/v))*S*er))/(2.*I) +(2*bT*std::pow(I/S,-1 + 2*gamma + (2*bT)/v)*er*lis)/(v*v)+ (2*bT + v - 2*gamma*v + 2*lsh)/(2.*std::exp(std::pow(2*bT + (-1 + 2*gamma)*v +2*lsh,2)/(8.*v))*M_SQRT2*M_SQRTPI*v*sv) -(std::pow(I/S,-1 + 2*gamma + (2*bT)/v)*(2*bT + v - 2*gamma*v +4*lis + 2*lsh))/(2.*std::exp(squared(2*bT - v + 2*gamma*v + 4*lis + 2*lsh)/(8.*v))*M_SQRT2*M_SQRTPI*v*sv)))/2.;
+            return (exp(bT*gamma - rT + ((-1 + gamma)*gamma*v)/2.)*(((-1 +gamma)*gamma*(I*erfc((2*bT - v + 2*gamma*v + 2*lsh)/(2.*M_SQRT2*sv)) -pow(I/S,2*(gamma + bT/v))*S*er))/(2.*I) +(2*bT*pow(I/S,-1 + 2*gamma + (2*bT)/v)*er*lis)/(v*v)+ (2*bT + v - 2*gamma*v + 2*lsh)/(2.*exp(pow(2*bT + (-1 + 2*gamma)*v +2*lsh,2)/(8.*v))*M_SQRT2*M_SQRTPI*v*sv) -(pow(I/S,-1 + 2*gamma + (2*bT)/v)*(2*bT + v - 2*gamma*v +4*lis + 2*lsh))/(2.*exp(squared(2*bT - v + 2*gamma*v + 4*lis + 2*lsh)/(8.*v))*M_SQRT2*M_SQRTPI*v*sv)))/2.;
         }
     }
 
@@ -124,7 +124,7 @@ namespace QuantLib {
 
         const Real forwardPrice = S * dD/rfD;
         const BlackCalculator black(
-            Option::Call, X, forwardPrice, std::sqrt(variance), rfD);
+            Option::Call, X, forwardPrice, sqrt(variance), rfD);
 
         results.value        = black.value();
         results.delta        = black.delta(S);
@@ -183,20 +183,20 @@ namespace QuantLib {
 
         OneAssetOption::results results;
 
-        const Real bT = std::log(dD/rfD);
-        const Real rT = std::log(1.0/rfD);
+        const Real bT = log(dD/rfD);
+        const Real rT = log(1.0/rfD);
 
         const Real beta = (0.5 - bT/variance) +
-            std::sqrt(squared(bT/variance - 0.5) + 2.0 * rT/variance);
+            sqrt(squared(bT/variance - 0.5) + 2.0 * rT/variance);
 
         const Real BInfinity = beta / (beta - 1.0) * X;
         const Real B0 = (bT == rT) ? X : std::max(X, rT / (rT - bT) * X);
-        const Real ht = -(bT + 2.0*std::sqrt(variance)) * B0 / (BInfinity - B0);
+        const Real ht = -(bT + 2.0*sqrt(variance)) * B0 / (BInfinity - B0);
 
-        const Real I = B0 + (BInfinity - B0) * (1 - std::exp(ht));
+        const Real I = B0 + (BInfinity - B0) * (1 - exp(ht));
 
         const Real fwd = S * dD/rfD;
-        const Real q = std::log(I/fwd)/std::sqrt(variance);
+        const Real q = log(I/fwd)/sqrt(variance);
 
         if (S >= I) {
             results = immediateExercise(S, X);
@@ -213,7 +213,7 @@ namespace QuantLib {
                 = phi(S,  1.0, I, I, rT, bT, variance);
             const Real phi_S_1_X_I_rT_bT_V
                 = phi(S, 1.0, X, I, rT, bT, variance);
-            results.value = (I - X) * std::pow(S/I, beta)
+            results.value = (I - X) * pow(S/I, beta)
                     *(1 - phi_S_beta_I_I_rT_bT_v)
                 +    S * phi_S_1_I_I_rT_bT_v
                 -    S * phi_S_1_X_I_rT_bT_V
@@ -226,9 +226,9 @@ namespace QuantLib {
                 = phi_S(S, 1.0, I, I, rT, bT, variance);
             const Real phi_S_S_1_X_I_rT_bT_v
                 = phi_S(S, 1.0, X, I, rT, bT, variance);
-            results.delta = (I - X) * std::pow(S/I, beta-1)*beta/I
+            results.delta = (I - X) * pow(S/I, beta-1)*beta/I
                     * (1 - phi_S_beta_I_I_rT_bT_v)
-                - (I - X) * std::pow(S/I, beta)
+                - (I - X) * pow(S/I, beta)
                     * phi_S_S_beta_I_I_rT_bT_v
                 +   phi_S_1_I_I_rT_bT_v
                 + S*phi_S_S_1_I_I_rT_bT_v
@@ -243,18 +243,18 @@ namespace QuantLib {
             const Time tq = qdc.yearFraction(refDate, exerciseDate);
 
             const Real betaDq = tq*(1/variance
-                - 1/(2*std::sqrt(squared(bT/variance - 0.5) + 2.0 * rT/variance))
+                - 1/(2*sqrt(squared(bT/variance - 0.5) + 2.0 * rT/variance))
                   * 2*(bT/variance-0.5)/variance);
             const Real BInfinityDq = -X/squared(beta-1.0)*betaDq;
             const Real B0Dq = (dD <= rfD) ? Real(0.0)
-                : Real(X*std::log(rfD)/squared(std::log(dD))*tq);
+                : Real(X*log(rfD)/squared(log(dD))*tq);
 
             const Real htDq = tq * B0 / (BInfinity - B0)
-                - (bT + 2.0*std::sqrt(variance))
+                - (bT + 2.0*sqrt(variance))
                     *(B0Dq*(BInfinity - B0) - B0*(BInfinityDq - B0Dq))
                         /squared(BInfinity - B0);
-            const Real IDq = B0Dq + (BInfinityDq - B0Dq) * (1 - std::exp(ht))
-                - (BInfinity - B0) * std::exp(ht)*htDq;
+            const Real IDq = B0Dq + (BInfinityDq - B0Dq) * (1 - exp(ht))
+                - (BInfinity - B0) * exp(ht)*htDq;
 
             const Real phi_H_S_beta_I_I_rT_bT_v
                 = phi_H(S, beta, I, I, rT, bT, variance);
@@ -286,10 +286,10 @@ namespace QuantLib {
                 = phi_bt(S, 0.0, X, I, rT, bT, variance);
 
             results.dividendRho =
-                (IDq*std::pow(S/I, beta)
-                 + (I-X)*std::pow(S/I, beta)*(betaDq*std::log(S/I) - beta*1/I*IDq))
+                (IDq*pow(S/I, beta)
+                 + (I-X)*pow(S/I, beta)*(betaDq*log(S/I) - beta*1/I*IDq))
                  * (1 - phi_S_beta_I_I_rT_bT_v)
-                - (I - X) * std::pow(S/I, beta)
+                - (I - X) * pow(S/I, beta)
                  *( phi_H_S_beta_I_I_rT_bT_v*IDq
                    +phi_I_S_beta_I_I_rT_bT_v*IDq
                    +phi_gamma_S_beta_I_I_rT_bT_v*betaDq
@@ -309,22 +309,22 @@ namespace QuantLib {
             const Time tr = rdc.yearFraction(refDate, exerciseDate);
 
             const Real betaDr = tr*(-1/variance
-                + 1/(2*std::sqrt(squared(bT/variance - 0.5) + 2.0 * rT/variance))
+                + 1/(2*sqrt(squared(bT/variance - 0.5) + 2.0 * rT/variance))
                   * 2*((bT/variance-0.5)/variance + 1/variance));
             const Real BInfinityDr = -X/squared(beta-1.0)*betaDr;
-            const Real B0Dr = (dD <= rfD) ? Real(0) : Real(-X*tr/std::log(dD));
+            const Real B0Dr = (dD <= rfD) ? Real(0) : Real(-X*tr/log(dD));
             const Real htDr = -tr * B0 / (BInfinity - B0)
-                - (bT + 2.0*std::sqrt(variance))
+                - (bT + 2.0*sqrt(variance))
                     *(B0Dr*(BInfinity - B0) - B0*(BInfinityDr - B0Dr))
                         /squared(BInfinity - B0);
-            const Real IDr = B0Dr + (BInfinityDr - B0Dr) * (1 - std::exp(ht))
-                - (BInfinity - B0) * std::exp(ht)*htDr;
+            const Real IDr = B0Dr + (BInfinityDr - B0Dr) * (1 - exp(ht))
+                - (BInfinity - B0) * exp(ht)*htDr;
 
             results.rho =
-                (IDr*std::pow(S/I, beta)
-                 + (I-X)*std::pow(S/I, beta)*(betaDr*std::log(S/I) - beta/I*IDr))
+                (IDr*pow(S/I, beta)
+                 + (I-X)*pow(S/I, beta)*(betaDr*log(S/I) - beta/I*IDr))
                  * (1 - phi_S_beta_I_I_rT_bT_v)
-                - (I - X) * std::pow(S/I, beta)
+                - (I - X) * pow(S/I, beta)
                  *(  phi_H_S_beta_I_I_rT_bT_v*IDr
                    + phi_I_S_beta_I_I_rT_bT_v*IDr
                    + phi_gamma_S_beta_I_I_rT_bT_v*betaDr
@@ -346,28 +346,28 @@ namespace QuantLib {
                      + phi_bt_S_0_X_I_rT_bT_v*tr);
 
             const Real beta = (0.5 - bT/variance) +
-                std::sqrt(squared(bT/variance - 0.5) + 2.0 * rT/variance);
+                sqrt(squared(bT/variance - 0.5) + 2.0 * rT/variance);
 
             const DayCounter vdc = process_->blackVolatility()->dayCounter();
             const Time tv = vdc.yearFraction(refDate, exerciseDate);
-            const Real varianceDv = 2*std::sqrt(variance*tv);
+            const Real varianceDv = 2*sqrt(variance*tv);
 
             const Real betaDv = bT/squared(variance)*varianceDv +
-                - 1/(2*std::sqrt(squared(bT/variance - 0.5) + 2.0 * rT/variance))
+                - 1/(2*sqrt(squared(bT/variance - 0.5) + 2.0 * rT/variance))
                   *( 2*(bT/variance - 0.5)*bT*varianceDv/squared(variance)
                     +2*rT/squared(variance)*varianceDv );
             const Real BInfinityDv = -X/squared(beta-1.0)*betaDv;
-            const Real htDv = -1/std::sqrt(variance)*varianceDv*B0/(BInfinity-B0)
-                    + (bT + 2*std::sqrt(variance))*B0/squared(BInfinity-B0)*BInfinityDv;
+            const Real htDv = -1/sqrt(variance)*varianceDv*B0/(BInfinity-B0)
+                    + (bT + 2*sqrt(variance))*B0/squared(BInfinity-B0)*BInfinityDv;
 
-            const Real IDv = BInfinityDv*(1-std::exp(ht))
-                - (BInfinity-B0)*std::exp(ht)*htDv;
+            const Real IDv = BInfinityDv*(1-exp(ht))
+                - (BInfinity-B0)*exp(ht)*htDv;
 
             results.vega =
-                (IDv*std::pow(S/I, beta)
-                 + (I-X)*std::pow(S/I, beta)*(betaDv*std::log(S/I) - beta/I*IDv))
+                (IDv*pow(S/I, beta)
+                 + (I-X)*pow(S/I, beta)*(betaDv*log(S/I) - beta/I*IDv))
                  * (1 - phi_S_beta_I_I_rT_bT_v)
-                - (I - X) * std::pow(S/I, beta)
+                - (I - X) * pow(S/I, beta)
                 *(  phi_H_S_beta_I_I_rT_bT_v*IDv
                   + phi_I_S_beta_I_I_rT_bT_v*IDv
                   + phi_gamma_S_beta_I_I_rT_bT_v*betaDv
@@ -384,11 +384,11 @@ namespace QuantLib {
                     + phi_v(S, 0.0, X, I, rT, bT, variance)*varianceDv);
 
             results.gamma =
-                  (I - X) * std::pow(S/I, beta-2)*beta*(beta-1)/squared(I)
+                  (I - X) * pow(S/I, beta-2)*beta*(beta-1)/squared(I)
                   * (1 - phi_S_beta_I_I_rT_bT_v)
-                - 2*(I - X) * std::pow(S/I, beta-1)*beta/I
+                - 2*(I - X) * pow(S/I, beta-1)*beta/I
                   *phi_S_S_beta_I_I_rT_bT_v
-                - (I - X) * std::pow(S/I, beta)
+                - (I - X) * pow(S/I, beta)
                   * phi_SS(S, beta, I, I, rT, bT, variance)
 
                 + 2*phi_S_S_1_I_I_rT_bT_v
@@ -400,7 +400,7 @@ namespace QuantLib {
                 - X*phi_SS(S, 0.0, I, I, rT, bT, variance)
                 + X*phi_SS(S, 0.0, X, I, rT, bT, variance);
 
-            const Volatility vol = std::sqrt(variance/tv);
+            const Volatility vol = sqrt(variance/tv);
 
             const Date tomorrow = refDate + Period(1, Days);
             const Time dtq = qdc.yearFraction(refDate, exerciseDate)
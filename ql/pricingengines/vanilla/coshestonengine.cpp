@@ -66,7 +66,7 @@ namespace QuantLib {
         const Time maturity = process->time(maturityDate);
 
         const Real cum1 = c1(maturity);
-        const Real w = std::sqrt(std::fabs(c2(maturity))
+        const Real w = sqrt(fabs(c2(maturity))
             // the 4th order doesn't necessarily improve the precision
             // + std::sqrt(std::fabs(c4(maturity)))
         );
@@ -80,7 +80,7 @@ namespace QuantLib {
         const DiscountFactor qf
             = process->dividendYield()->discount(maturityDate);
         const Real fwd = spot*qf/df;
-        const Real x = std::log(fwd/k);
+        const Real x = log(fwd/k);
 
         const Real a = x + cum1 - L_*w;
         const Real b = x + cum1 + L_*w;
@@ -101,16 +101,16 @@ namespace QuantLib {
 
         const Real d = 1.0/(b-a);
 
-        const Real expA = std::exp(a);
+        const Real expA = exp(a);
         Real s = chF(0, maturity).real()*(expA-1-a)*d;
 
         for (Size n=1; n < N_; ++n) {
             const Real r = n*M_PI*d;
             const Real U_n = 2.0*d*( 1.0/(1.0 + r*r)
-                *(expA + r*std::sin(r*a) - std::cos(r*a)) - 1.0/r*std::sin(r*a));
+                *(expA + r*sin(r*a) - cos(r*a)) - 1.0/r*sin(r*a));
 
             s += U_n*(chF(r, maturity)
-                     *std::exp(std::complex<Real>(0, r*(x-a)))).real();
+                     *exp(std::complex<Real>(0, r*(x-a)))).real();
         }
 
         if (payoff->optionType() == Option::Put)
@@ -125,7 +125,7 @@ namespace QuantLib {
     }
 
     Real COSHestonEngine::muT(Time t) const {
-        return std::log(  model_->process()->dividendYield()->discount(t)
+        return log(  model_->process()->dividendYield()->discount(t)
                         / model_->process()->riskFreeRate()->discount(t));
     }
 
@@ -133,7 +133,7 @@ namespace QuantLib {
     const {
         const Real sigma2 = sigma_*sigma_;
 
-        const std::complex<Real> D = std::sqrt(
+        const std::complex<Real> D = sqrt(
             squared(std::complex<Real>(kappa_, -rho_*sigma_*u))
             + std::complex<Real>(u*u, u)*sigma2);
 
@@ -141,10 +141,10 @@ namespace QuantLib {
 
         const std::complex<Real> G = (g-D)/(g+D);
 
-        return std::exp(
-              v0_/(sigma2)*(1.0-std::exp(-D*t))/(1.0-G*std::exp(-D*t))
+        return exp(
+              v0_/(sigma2)*(1.0-exp(-D*t))/(1.0-G*exp(-D*t))
              *(g-D) + kappa_*theta_/sigma2*((g-D)*t
-                -2.0*std::log((1.0-G*std::exp(-D*t))/(1.0-G)))
+                -2.0*log((1.0-G*exp(-D*t))/(1.0-G)))
             );
    }
 
@@ -175,9 +175,9 @@ namespace QuantLib {
     */
 
    Real COSHestonEngine::c1(Time t) const {
-       return (-theta_ + std::exp(kappa_*t)
+       return (-theta_ + exp(kappa_*t)
            *( theta_ - kappa_*t*theta_ -
-               v0_) + v0_)/(2*std::exp(kappa_*t)*kappa_);
+               v0_) + v0_)/(2*exp(kappa_*t)*kappa_);
    }
 
    Real COSHestonEngine::c2(Time t) const {
@@ -186,14 +186,14 @@ namespace QuantLib {
        const Real kappa3 = kappa2*kappa_;
 
        return (sigma2*(theta_ - 2*v0_) +
-           std::exp(2*kappa_*t)*(8*kappa3*t*theta_ -
+           exp(2*kappa_*t)*(8*kappa3*t*theta_ -
            8*kappa2*(theta_ + rho_*sigma_*t*theta_ - v0_) +
            sigma2*(-5*theta_ + 2*v0_) + 2*kappa_*sigma_*(8*rho_*theta_ +
            sigma_*t*theta_ - 4*rho_*v0_)) +
-           4*std::exp(kappa_*t)*(sigma2*theta_ -
+           4*exp(kappa_*t)*(sigma2*theta_ -
            2*kappa2*(-1 + rho_*sigma_*t)*(theta_ - v0_) +
            kappa_*sigma_*(sigma_*t*(theta_ - v0_) + 2*rho_*(-2*theta_ +
-           v0_))))/(8.*std::exp(2*kappa_*t)*kappa3);
+           v0_))))/(8.*exp(2*kappa_*t)*kappa3);
    }
 
    Real COSHestonEngine::c3(Time t) const {
@@ -206,22 +206,22 @@ namespace QuantLib {
 
        return
          -(sigma_*(sigma3*(theta_ - 3*v0_) +
-           std::exp(3*kappa_*t)*(2*(-11*sigma3 -
+           exp(3*kappa_*t)*(2*(-11*sigma3 -
            24*kappa4*rho_*t + 3*kappa_*sigma2*(20*rho_ +
            sigma_*t) - 6*kappa2*sigma_*(5 + 3*rho_*(4*rho_ + sigma_*t)) +
            12*kappa3*(sigma_*t + 2*rho_*(2 + rho_*sigma_*t)))*theta_ -
            6*(2*kappa_*rho_ - sigma_)*(4*kappa2 - 4*kappa_*rho_*sigma_ +
-           sigma2)*v0_) + 6*std::exp(kappa_*t)*sigma_*(-2*kappa2*(-1 +
+           sigma2)*v0_) + 6*exp(kappa_*t)*sigma_*(-2*kappa2*(-1 +
            rho_*sigma_*t)*(theta_ - 2*v0_) + sigma2*(theta_ - v0_) +
            kappa_*sigma_*(-4*rho_*theta_ + sigma_*t*theta_ + 6*rho_*v0_ - 2*sigma_*t*v0_)) +
-           3*std::exp(2*kappa_*t)*(2*kappa_*sigma2*(-16*rho_*theta_ +
+           3*exp(2*kappa_*t)*(2*kappa_*sigma2*(-16*rho_*theta_ +
            sigma_*t*(3*theta_ - v0_)) + 8*kappa4*rho_*t*(-2 +
            rho_*sigma_*t)*(theta_ - v0_) + sigma3*(5*theta_ + v0_) +
            8*kappa3*(-(rho_*(4 + sigma2*t*t)*theta_) + 2*sigma_*t*(theta_ - v0_) +
            2*rho2*sigma_*t*(2*theta_ - v0_) + rho_*(2 +
            sigma2*t*t)*v0_) + 2*kappa2*sigma_*((8
            + 24*rho2 - 16*rho_*sigma_*t + sigma2*t*t)*theta_ - (8*rho2 -
-           8*rho_*sigma_*t + sigma2*t*t)*v0_))))/(16.*std::exp(3*kappa_*t)*
+           8*rho_*sigma_*t + sigma2*t*t)*v0_))))/(16.*exp(3*kappa_*t)*
            kappa_*kappa4);
    }
 
@@ -242,7 +242,7 @@ namespace QuantLib {
 
        return
            (sigma2*(3*sigma4*(theta_ - 4*v0_) +
-           3*std::exp(4*kappa_*t)*((-93*sigma4 +
+           3*exp(4*kappa_*t)*((-93*sigma4 +
            64*kappa5*(t + 4*rho2*t) +
            4*kappa_*sigma3*(176*rho_ + 5*sigma_*t) -
            32*kappa2*sigma2*(11 + 50*rho2 +
@@ -252,10 +252,10 @@ namespace QuantLib {
            4*(4*kappa2 - 4*kappa_*rho_*sigma_ +
            sigma2)*(4*kappa2*(1 + 4*rho2) -
            20*kappa_*rho_*sigma_ + 5*sigma2)*v0_) +
-           24*std::exp(kappa_*t)*sigma2*(-2*kappa2*(-1 +
+           24*exp(kappa_*t)*sigma2*(-2*kappa2*(-1 +
            rho_*sigma_*t)*(theta_ - 3*v0_) + sigma2*(theta_ - 2*v0_) +
            kappa_*sigma_*(-4*rho_*theta_ + sigma_*t*theta_ + 10*rho_*v0_ -
-           3*sigma_*t*v0_)) + 12*std::exp(2*kappa_*t)*(sigma4*(7*theta_ -
+           3*sigma_*t*v0_)) + 12*exp(2*kappa_*t)*(sigma4*(7*theta_ -
            4*v0_) + 8*kappa4*(1 + 2*rho_*sigma_*t*(-2 +
            rho_*sigma_*t))*(theta_ - 2*v0_) +
            2*kappa_*sigma3*(-24*rho_*theta_ + 5*sigma_*t*theta_ +
@@ -266,7 +266,7 @@ namespace QuantLib {
            8*kappa3*sigma_*((3*sigma_*t + 2*rho_*(-4 + sigma_*t*(4*rho_ -
            sigma_*t)))*theta_ + 2*(-3*sigma_*t + 2*rho_*(3 + sigma_*t*(-3*rho_ +
            sigma_*t)))*v0_)) -
-           8*std::exp(3*kappa_*t)*(16*kappa6*rho2*t2*(-3 + rho_*sigma_*t)*(theta_ - v0_) - 3*sigma4*(7*theta_ +
+           8*exp(3*kappa_*t)*(16*kappa6*rho2*t2*(-3 + rho_*sigma_*t)*(theta_ - v0_) - 3*sigma4*(7*theta_ +
            2*v0_) + 2*kappa3*sigma_*((192*(rho_ + rho3) -
            6*(9 + 40*rho2)*sigma_*t + 42*rho_*sigma2*t2 -
            sigma3*t3)*theta_ + (-48*rho3 + 18*(1
@@ -282,7 +282,7 @@ namespace QuantLib {
            rho_*(4*sigma_*t + rho_*(-8 + sigma_*t*(4*rho_ - sigma_*t))))*theta_ + (2 +
            rho_*(-4*sigma_*t + rho_*(4 + sigma_*t*(-2*rho_ + sigma_*t))))*v0_) +
            3*kappa_*sigma3*(sigma_*t*(-9*theta_ + v0_) + 10*rho_*(6*theta_
-           + v0_)))))/(64.*std::exp(4*kappa_*t)*kappa7);
+           + v0_)))))/(64.*exp(4*kappa_*t)*kappa7);
    }
 
    Real COSHestonEngine::mu(Time t) const {
@@ -292,7 +292,7 @@ namespace QuantLib {
        return c2(t);
    }
    Real COSHestonEngine::skew(Time t) const {
-       return c3(t)/std::pow(c2(t), 1.5);
+       return c3(t)/pow(c2(t), 1.5);
    }
    Real COSHestonEngine::kurtosis(Time t) const {
        return c4(t)/squared(c2(t));
@@ -228,7 +228,7 @@ namespace QuantLib {
         const Real spot = process->s0()->value();
         QL_REQUIRE(spot > 0.0, "negative or null underlying given");
 
-        const Real freq = std::log(spot) - std::log(rd/dd) - std::log(strike);
+        const Real freq = log(spot) - log(rd/dd) - log(strike);
 
         const Real fwd = spot * dd / rd;
 
@@ -249,35 +249,35 @@ namespace QuantLib {
         const AnalyticHestonEngine::AP_Helper helper(
             t, fwd, strike, analyticCV, analyticEngine_.get(), alpha_);
 
-        const Real vAvg = (1-std::exp(-kappa*t))*(v0-theta)/(kappa*t) + theta;
+        const Real vAvg = (1-exp(-kappa*t))*(v0-theta)/(kappa*t) + theta;
 
         const Real scalingFactor = (scaling_ == Null<Real>())
             ? (analyticCV != AnalyticHestonEngine::AsymptoticChF)
-                    ? std::max(0.25, std::min(1000.0, 0.25/std::sqrt(0.5*vAvg*t)))
+                    ? std::max(0.25, std::min(1000.0, 0.25/sqrt(0.5*vAvg*t)))
                     : Real(1.0)
             : scaling_;
 
         Size n;
         Real u;
-        if (std::fabs(freq) < 0.1) {
+        if (fabs(freq) < 0.1) {
             n = 0;
             u = scalingFactor;
         }
         else {
-            const Real lookup = std::fabs(scalingFactor*freq);
+            const Real lookup = fabs(scalingFactor*freq);
             n = std::min(Size(moneyness_.size() - 1),
                     Size(std::distance(moneyness_.begin(),
                         std::lower_bound(
                             moneyness_.begin(),
                             moneyness_.end(), lookup))));
 
-            if (n > 0 && std::fabs(lookup - moneyness_[n])
-                            > std::fabs(lookup - moneyness_[n-1])) {
+            if (n > 0 && fabs(lookup - moneyness_[n])
+                            > fabs(lookup - moneyness_[n-1])) {
                 --n;
             }
 
             const Real omega = moneyness_[n];
-            u = std::fabs(omega / freq);
+            u = fabs(omega / freq);
         }
         const Size order = (sizeof(values4[0]) / sizeof(values4[0][0]) - 1) / 2;
 
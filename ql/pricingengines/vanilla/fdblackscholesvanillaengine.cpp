@@ -20,9 +20,11 @@
 */
 
 #include <exercise.hpp>
+#include <math/interpolations/cubicinterpolation.hpp>
 #include <methods/finitedifferences/meshers/fdmblackscholesmesher.hpp>
 #include <methods/finitedifferences/utilities/escroweddividendadjustment.hpp>
 #include <methods/finitedifferences/meshers/fdmmeshercomposite.hpp>
+#include <methods/finitedifferences/operators/fdmblackscholesop.hpp>
 #include <methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <methods/finitedifferences/solvers/fdmblackscholessolver.hpp>
 #include <methods/finitedifferences/stepconditions/fdmstepconditioncomposite.hpp>
@@ -31,6 +33,7 @@
 #include <methods/finitedifferences/utilities/fdmquantohelper.hpp>
 #include <pricingengines/vanilla/fdblackscholesvanillaengine.hpp>
 #include <processes/blackscholesprocess.hpp>
+#include <algorithm>
 
 namespace QuantLib {
 
@@ -42,10 +45,12 @@ namespace QuantLib {
         const FdmSchemeDesc& schemeDesc,
         bool localVol,
         Real illegalLocalVolOverwrite,
-        CashDividendModel cashDividendModel)
+        CashDividendModel cashDividendModel,
+        bool calculateVega)
     : process_(std::move(process)), tGrid_(tGrid), xGrid_(xGrid),
       dampingSteps_(dampingSteps), schemeDesc_(schemeDesc), localVol_(localVol),
-      illegalLocalVolOverwrite_(illegalLocalVolOverwrite), cashDividendModel_(cashDividendModel) {
+      illegalLocalVolOverwrite_(illegalLocalVolOverwrite), cashDividendModel_(cashDividendModel),
+      calculateVega_(calculateVega) {
         registerWith(process_);
     }
 
@@ -58,11 +63,13 @@ namespace QuantLib {
         const FdmSchemeDesc& schemeDesc,
         bool localVol,
         Real illegalLocalVolOverwrite,
-        CashDividendModel cashDividendModel)
+        CashDividendModel cashDividendModel,
+        bool calculateVega)
     : process_(std::move(process)), dividends_(std::move(dividends)),
       tGrid_(tGrid), xGrid_(xGrid), dampingSteps_(dampingSteps), schemeDesc_(schemeDesc),
       localVol_(localVol), illegalLocalVolOverwrite_(illegalLocalVolOverwrite),
-      cashDividendModel_(cashDividendModel) {
+      cashDividendModel_(cashDividendModel),
+      calculateVega_(calculateVega) {
         registerWith(process_);
     }
 
@@ -75,12 +82,14 @@ namespace QuantLib {
         const FdmSchemeDesc& schemeDesc,
         bool localVol,
         Real illegalLocalVolOverwrite,
-        CashDividendModel cashDividendModel)
+        CashDividendModel cashDividendModel,
+        bool calculateVega)
     : process_(std::move(process)),
       tGrid_(tGrid), xGrid_(xGrid), dampingSteps_(dampingSteps),
       schemeDesc_(schemeDesc), localVol_(localVol),
       illegalLocalVolOverwrite_(illegalLocalVolOverwrite), quantoHelper_(std::move(quantoHelper)),
-      cashDividendModel_(cashDividendModel) {
+      cashDividendModel_(cashDividendModel),
+      calculateVega_(calculateVega) {
         registerWith(process_);
         registerWith(quantoHelper_);
     }
@@ -95,12 +104,14 @@ namespace QuantLib {
         const FdmSchemeDesc& schemeDesc,
         bool localVol,
         Real illegalLocalVolOverwrite,
-        CashDividendModel cashDividendModel)
+        CashDividendModel cashDividendModel,
+        bool calculateVega)
     : process_(std::move(process)), dividends_(std::move(dividends)),
       tGrid_(tGrid), xGrid_(xGrid), dampingSteps_(dampingSteps),
       schemeDesc_(schemeDesc), localVol_(localVol),
       illegalLocalVolOverwrite_(illegalLocalVolOverwrite), quantoHelper_(std::move(quantoHelper)),
-      cashDividendModel_(cashDividendModel) {
+      cashDividendModel_(cashDividendModel),
+      calculateVega_(calculateVega) {
         registerWith(process_);
         registerWith(quantoHelper_);
     }
@@ -151,21 +162,39 @@ namespace QuantLib {
               QL_FAIL("unknwon cash dividend model");
         }
 
-        // 1. Mesher
+        // 1. Mesher and operator, reused as long as the market data
+        //    and the mesher parameters are unchanged. The dividend
+        //    schedule only depends on the exercise type beyond the
+        //    engine's own data, hence its size identifies it.
         const ext::shared_ptr<StrikedTypePayoff> payoff =
             ext::dynamic_pointer_cast<StrikedTypePayoff>(arguments_.payoff);
 
-        const ext::shared_ptr<Fdm1dMesher> equityMesher =
-            ext::make_shared<FdmBlackScholesMesher>(
-                    xGrid_, process_, maturity, payoff->strike(), 
-                    Null<Real>(), Null<Real>(), 0.0001, 1.5, 
-                    std::pair<Real, Real>(payoff->strike(), 0.1),
-                    dividendSchedule, quantoHelper_,
-                    spotAdjustment);
-        
-        const ext::shared_ptr<FdmMesher> mesher =
-            ext::make_shared<FdmMesherComposite>(equityMesher);
-        
+        if (cachedMesher_ == nullptr
+            || cachedMaturity_ != maturity
+            || cachedStrike_ != payoff->strike()
+            || cachedDividendDates_ != dividendSchedule.size()) {
+
+            const ext::shared_ptr<Fdm1dMesher> equityMesher =
+                ext::make_shared<FdmBlackScholesMesher>(
+                        xGrid_, process_, maturity, payoff->strike(),
+                        Null<Real>(), Null<Real>(), 0.0001, 1.5,
+                        std::pair<Real, Real>(payoff->strike(), 0.1),
+                        dividendSchedule, quantoHelper_,
+                        spotAdjustment);
+
+            cachedMesher_ = ext::make_shared<FdmMesherComposite>(equityMesher);
+
+            cachedOp_ = ext::make_shared<FdmBlackScholesOp>(
+                cachedMesher_, process_, payoff->strike(),
+                localVol_, illegalLocalVolOverwrite_, 0, quantoHelper_);
+
+            cachedMaturity_ = maturity;
+            cachedStrike_ = payoff->strike();
+            cachedDividendDates_ = dividendSchedule.size();
+        }
+
+        const ext::shared_ptr<FdmMesher> mesher = cachedMesher_;
+
         // 2. Calculator
         ext::shared_ptr<FdmInnerValueCalculator> calculator;
         switch (cashDividendModel_) {
@@ -197,10 +226,8 @@ namespace QuantLib {
 
         const ext::shared_ptr<FdmBlackScholesSolver> solver(
             ext::make_shared<FdmBlackScholesSolver>(
-                Handle<GeneralizedBlackScholesProcess>(process_),
-                payoff->strike(), solverDesc, schemeDesc_,
-                localVol_, illegalLocalVolOverwrite_,
-                Handle<FdmQuantoHelper>(quantoHelper_)));
+                solverDesc, schemeDesc_, cachedOp_,
+                calculateVega_ && !localVol_ && quantoHelper_ == nullptr));
 
         const Real spot = process_->x0() + spotAdjustment;
 
@@ -208,6 +235,86 @@ namespace QuantLib {
         results_.delta = solver->deltaAt(spot);
         results_.gamma = solver->gammaAt(spot);
         results_.theta = solver->thetaAt(spot);
+        results_.vega = solver->vegaAt(spot);
+    }
+
+    std::vector<Real> FdBlackScholesVanillaEngine::strikeLadder(
+        Option::Type type,
+        const std::vector<Real>& strikes,
+        const ext::shared_ptr<Exercise>& exercise) const {
+
+        QL_REQUIRE(!strikes.empty(), "no strikes given");
+        QL_REQUIRE(cashDividendModel_ == Spot,
+                   "strike ladders are only supported for the Spot cash dividend model");
+
+        const Time maturity = process_->time(exercise->lastDate());
+
+        // the ladder is not required to be sorted
+        std::vector<Real> sortedStrikes(strikes);
+        std::sort(sortedStrikes.begin(), sortedStrikes.end());
+        const Real strike = sortedStrikes[sortedStrikes.size()/2];
+
+        // 1. Mesher and operator, shared by the whole ladder
+        const ext::shared_ptr<FdmMesher> mesher =
+            ext::make_shared<FdmMesherComposite>(
+                ext::make_shared<FdmBlackScholesMesher>(
+                    xGrid_, process_, maturity, strike,
+                    Null<Real>(), Null<Real>(), 0.0001, 1.5,
+                    std::pair<Real, Real>(strike, 0.1),
+                    dividends_, quantoHelper_));
+
+        const ext::shared_ptr<FdmLinearOpComposite> op =
+            ext::make_shared<FdmBlackScholesOp>(
+                mesher, process_, strike,
+                localVol_, illegalLocalVolOverwrite_, 0, quantoHelper_);
+
+        // 2. Payoffs and step conditions of the single options
+        std::vector<Array> values;
+        std::vector<ext::shared_ptr<FdmStepConditionComposite> > conditions;
+        for (Real k : strikes) {
+            const ext::shared_ptr<FdmInnerValueCalculator> calculator =
+                ext::make_shared<FdmLogInnerValue>(
+                    ext::make_shared<PlainVanillaPayoff>(type, k), mesher, 0);
+
+            Array payoff(mesher->layout()->size());
+            for (const auto& iter : *mesher->layout())
+                payoff[iter.index()] = calculator->avgInnerValue(iter, maturity);
+            values.push_back(payoff);
+
+            conditions.push_back(
+                FdmStepConditionComposite::vanillaComposite(
+                    dividends_, exercise, mesher, calculator,
+                    process_->riskFreeRate()->referenceDate(),
+                    process_->riskFreeRate()->dayCounter()));
+        }
+
+        // 3. Batched rollback
+        FdmBackwardSolver(op, FdmBoundaryConditionSet(),
+                          ext::make_shared<FdmStepConditionComposite>(
+                              std::list<std::vector<Time> >(),
+                              FdmStepConditionComposite::Conditions()),
+                          schemeDesc_)
+            .rollback(values, maturity, 0.0, tGrid_, dampingSteps_, conditions);
+
+        // 4. Values at the spot
+        Array x(mesher->layout()->size());
+        for (const auto& iter : *mesher->layout())
+            x[iter.index()] = mesher->location(iter, 0);
+
+        const Real logSpot = log(process_->x0());
+        std::vector<Real> results;
+        results.reserve(strikes.size());
+        for (const auto& v : values)
+            results.push_back(
+                MonotonicCubicNaturalSpline(x.begin(), x.end(), v.begin())(logSpot));
+
+        return results;
+    }
+
+    void FdBlackScholesVanillaEngine::update() {
+        cachedMesher_.reset();
+        cachedOp_.reset();
+        VanillaOption::engine::update();
     }
 
     MakeFdBlackScholesVanillaEngine::MakeFdBlackScholesVanillaEngine(
@@ -276,6 +383,12 @@ namespace QuantLib {
         return *this;
     }
 
+    MakeFdBlackScholesVanillaEngine&
+    MakeFdBlackScholesVanillaEngine::withVega(bool calculateVega) {
+        calculateVega_ = calculateVega;
+        return *this;
+    }
+
     MakeFdBlackScholesVanillaEngine::operator
     ext::shared_ptr<PricingEngine>() const {
         return ext::make_shared<FdBlackScholesVanillaEngine>(
@@ -286,7 +399,8 @@ namespace QuantLib {
                 *schemeDesc_,
                 localVol_,
                 illegalLocalVolOverwrite_,
-                cashDividendModel_);
+                cashDividendModel_,
+                calculateVega_);
     }
 
 }
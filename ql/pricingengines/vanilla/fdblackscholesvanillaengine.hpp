@@ -32,6 +32,8 @@
 
 namespace QuantLib {
 
+    class FdmLinearOpComposite;
+    class FdmMesher;
     class FdmQuantoHelper;
     class GeneralizedBlackScholesProcess;
 
@@ -41,6 +43,17 @@ namespace QuantLib {
         \test the correctness of the returned value is tested by
               reproducing results available in web/literature
               and comparison with Black pricing.
+
+        The mesher and the Black-Scholes operator are kept between
+        calculations and reused for options with the same maturity and
+        strike, e.g., puts and calls or different exercise styles priced
+        off the same market data. They are discarded whenever the process
+        or the quanto helper notify a change.
+
+        If requested, vega is computed in the same rollback by
+        FdmTangentSensitivityCondition; it is not provided for local
+        volatility, quanto adjustments or schemes the condition doesn't
+        support, such as adaptive time stepping.
     */
     class FdBlackScholesVanillaEngine : public VanillaOption::engine {
       public:
@@ -54,7 +67,8 @@ namespace QuantLib {
             const FdmSchemeDesc& schemeDesc = FdmSchemeDesc::Douglas(),
             bool localVol = false,
             Real illegalLocalVolOverwrite = -Null<Real>(),
-            CashDividendModel cashDividendModel = Spot);
+            CashDividendModel cashDividendModel = Spot,
+            bool calculateVega = false);
 
         FdBlackScholesVanillaEngine(
             ext::shared_ptr<GeneralizedBlackScholesProcess>,
@@ -65,7 +79,8 @@ namespace QuantLib {
             const FdmSchemeDesc& schemeDesc = FdmSchemeDesc::Douglas(),
             bool localVol = false,
             Real illegalLocalVolOverwrite = -Null<Real>(),
-            CashDividendModel cashDividendModel = Spot);
+            CashDividendModel cashDividendModel = Spot,
+            bool calculateVega = false);
 
         FdBlackScholesVanillaEngine(
             ext::shared_ptr<GeneralizedBlackScholesProcess>,
@@ -76,7 +91,8 @@ namespace QuantLib {
             const FdmSchemeDesc& schemeDesc = FdmSchemeDesc::Douglas(),
             bool localVol = false,
             Real illegalLocalVolOverwrite = -Null<Real>(),
-            CashDividendModel cashDividendModel = Spot);
+            CashDividendModel cashDividendModel = Spot,
+            bool calculateVega = false);
 
         FdBlackScholesVanillaEngine(
             ext::shared_ptr<GeneralizedBlackScholesProcess>,
@@ -88,9 +104,29 @@ namespace QuantLib {
             const FdmSchemeDesc& schemeDesc = FdmSchemeDesc::Douglas(),
             bool localVol = false,
             Real illegalLocalVolOverwrite = -Null<Real>(),
-            CashDividendModel cashDividendModel = Spot);
+            CashDividendModel cashDividendModel = Spot,
+            bool calculateVega = false);
 
         void calculate() const override;
+        void update() override;
+
+        //! values of a strike ladder from a single backward solve
+        /*! returns the values at the current spot of the options with
+            the given type, exercise and strikes.  The options share
+            mesher and operator, which are set up for the median strike
+            of the ladder and are rolled back together; each implicit
+            step eliminates the operator once for the whole ladder.
+            Only the Spot cash-dividend model is supported.
+
+            \warning unless local volatility is used, the Black
+                     volatility surface is evaluated at the median
+                     strike only; with a smile, the values of the
+                     other strikes differ from those of the
+                     corresponding single-option calculations.
+        */
+        std::vector<Real> strikeLadder(Option::Type type,
+                                       const std::vector<Real>& strikes,
+                                       const ext::shared_ptr<Exercise>& exercise) const;
 
       private:
         ext::shared_ptr<GeneralizedBlackScholesProcess> process_;
@@ -101,6 +137,13 @@ namespace QuantLib {
         Real illegalLocalVolOverwrite_;
         ext::shared_ptr<FdmQuantoHelper> quantoHelper_;
         CashDividendModel cashDividendModel_;
+        bool calculateVega_;
+
+        mutable Time cachedMaturity_ = Null<Time>();
+        mutable Real cachedStrike_ = Null<Real>();
+        mutable Size cachedDividendDates_ = 0;
+        mutable ext::shared_ptr<FdmMesher> cachedMesher_;
+        mutable ext::shared_ptr<FdmLinearOpComposite> cachedOp_;
     };
 
 
@@ -131,6 +174,8 @@ namespace QuantLib {
         MakeFdBlackScholesVanillaEngine& withCashDividendModel(
             FdBlackScholesVanillaEngine::CashDividendModel cashDividendModel);
 
+        MakeFdBlackScholesVanillaEngine& withVega(bool calculateVega = true);
+
         operator ext::shared_ptr<PricingEngine>() const;
       private:
         ext::shared_ptr<GeneralizedBlackScholesProcess> process_;
@@ -141,6 +186,7 @@ namespace QuantLib {
         Real illegalLocalVolOverwrite_;
         ext::shared_ptr<FdmQuantoHelper> quantoHelper_;
         FdBlackScholesVanillaEngine::CashDividendModel cashDividendModel_ = FdBlackScholesVanillaEngine::Spot;
+        bool calculateVega_ = false;
     };
 
 }
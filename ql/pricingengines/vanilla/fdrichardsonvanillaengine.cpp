@@ -0,0 +1,90 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+
+#include <math/richardsonextrapolation.hpp>
+#include <pricingengines/vanilla/fdrichardsonvanillaengine.hpp>
+
+namespace QuantLib {
+
+    namespace {
+
+        const VanillaOption::results& calculateWith(
+            const ext::shared_ptr<PricingEngine>& engine,
+            const VanillaOption::arguments& arguments) {
+
+            auto* engineArguments =
+                dynamic_cast<VanillaOption::arguments*>(engine->getArguments());
+            QL_REQUIRE(engineArguments, "wrong engine type");
+
+            engine->reset();
+            *engineArguments = arguments;
+            engineArguments->validate();
+            engine->calculate();
+
+            const auto* results =
+                dynamic_cast<const VanillaOption::results*>(engine->getResults());
+            QL_REQUIRE(results, "wrong engine type");
+
+            return *results;
+        }
+    }
+
+    FdRichardsonVanillaEngine::FdRichardsonVanillaEngine(
+        const EngineFactory& engineFactory, Real scalingFactor, Real order)
+    : scalingFactor_(scalingFactor), order_(order),
+      coarseEngine_(engineFactory(1.0)),
+      fineEngine_(engineFactory(scalingFactor)) {
+
+        QL_REQUIRE(scalingFactor_ > 1.0,
+                   "scaling factor (" << scalingFactor_
+                   << ") must be greater than one");
+        QL_REQUIRE(order_ > 0.0,
+                   "order of convergence (" << order_
+                   << ") must be positive");
+        QL_REQUIRE(coarseEngine_ && fineEngine_, "null engine given");
+
+        registerWith(coarseEngine_);
+        registerWith(fineEngine_);
+    }
+
+    void FdRichardsonVanillaEngine::calculate() const {
+        const VanillaOption::results coarse =
+            calculateWith(coarseEngine_, arguments_);
+        const VanillaOption::results& fine =
+            calculateWith(fineEngine_, arguments_);
+
+        const auto extrapolate = [this](Real coarseValue, Real fineValue) -> Real {
+            if (coarseValue == Null<Real>() || fineValue == Null<Real>())
+                return Null<Real>();
+
+            // the step size of the coarse grid is normalized to one
+            return RichardsonExtrapolation(
+                [=](Real h) { return (h < 1.0) ? fineValue : coarseValue; },
+                1.0, order_)(scalingFactor_);
+        };
+
+        results_.value = extrapolate(coarse.value, fine.value);
+        results_.delta = extrapolate(coarse.delta, fine.delta);
+        results_.gamma = extrapolate(coarse.gamma, fine.gamma);
+        results_.theta = extrapolate(coarse.theta, fine.theta);
+        results_.vega = extrapolate(coarse.vega, fine.vega);
+
+        results_.additionalResults["coarseValue"] = coarse.value;
+        results_.additionalResults["fineValue"] = fine.value;
+    }
+}
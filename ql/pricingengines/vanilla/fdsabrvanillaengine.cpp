@@ -75,7 +75,7 @@ namespace QuantLib {
         const Time maturityTime = dc.yearFraction(referenceDate, maturityDate);
 
         const Real upperAlpha = alpha_*
-            std::exp(nu_*std::sqrt(maturityTime)*InverseCumulativeNormal()(0.75));
+            exp(nu_*sqrt(maturityTime)*InverseCumulativeNormal()(0.75));
 
         const ext::shared_ptr<Fdm1dMesher> cevMesher =
             ext::make_shared<FdmCEV1dMesher>(
@@ -86,14 +86,14 @@ namespace QuantLib {
         const Real normInvEps = InverseCumulativeNormal()(1-eps_);
         const Real logDrift = -0.5*nu_*nu_*maturityTime;
         const Real volRange =
-            nu_*std::sqrt(maturityTime)*normInvEps*scalingFactor_;
+            nu_*sqrt(maturityTime)*normInvEps*scalingFactor_;
 
-        const Real xMin = std::log(alpha_) + logDrift - volRange;
-        const Real xMax = std::log(alpha_) + logDrift + volRange;
+        const Real xMin = log(alpha_) + logDrift - volRange;
+        const Real xMax = log(alpha_) + logDrift + volRange;
 
         const ext::shared_ptr<Fdm1dMesher> xMesher =
             ext::make_shared<Concentrating1dMesher>(
-                xMin, xMax, xGrid_, std::make_pair(std::log(alpha_), 0.1));
+                xMin, xMax, xGrid_, std::make_pair(log(alpha_), 0.1));
 
         const ext::shared_ptr<FdmMesher> mesher =
            ext::make_shared<FdmMesherComposite>(cevMesher, xMesher);
@@ -140,7 +140,7 @@ namespace QuantLib {
         const ext::shared_ptr<Fdm2DimSolver> solver =
             ext::make_shared<Fdm2DimSolver>(solverDesc, schemeDesc_, op);
 
-        results_.value = solver->interpolateAt(f0_, std::log(alpha_));
+        results_.value = solver->interpolateAt(f0_, log(alpha_));
     }
 }
 
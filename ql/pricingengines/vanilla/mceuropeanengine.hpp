@@ -60,7 +60,8 @@ namespace QuantLib {
              Size requiredSamples,
              Real requiredTolerance,
              Size maxSamples,
-             BigNatural seed);
+             BigNatural seed,
+             Size streams = 1);
       protected:
         ext::shared_ptr<path_pricer_type> pathPricer() const override;
     };
@@ -79,6 +80,7 @@ namespace QuantLib {
         MakeMCEuropeanEngine& withMaxSamples(Size samples);
         MakeMCEuropeanEngine& withSeed(BigNatural seed);
         MakeMCEuropeanEngine& withAntitheticVariate(bool b = true);
+        MakeMCEuropeanEngine& withStreams(Size streams);
         // conversion to pricing engine
         operator ext::shared_ptr<PricingEngine>() const;
       private:
@@ -88,6 +90,7 @@ namespace QuantLib {
         Real tolerance_;
         bool brownianBridge_ = false;
         BigNatural seed_ = 0;
+        Size streams_ = 1;
     };
 
     class EuropeanPathPricer : public PathPricer<Path> {
@@ -116,7 +119,8 @@ namespace QuantLib {
              Size requiredSamples,
              Real requiredTolerance,
              Size maxSamples,
-             BigNatural seed)
+             BigNatural seed,
+             Size streams)
     : MCVanillaEngine<SingleVariate,RNG,S>(process,
                                            timeSteps,
                                            timeStepsPerYear,
@@ -126,7 +130,8 @@ namespace QuantLib {
                                            requiredSamples,
                                            requiredTolerance,
                                            maxSamples,
-                                           seed) {}
+                                           seed,
+                                           streams) {}
 
 
     template <class RNG, class S>
@@ -222,6 +227,13 @@ namespace QuantLib {
         return *this;
     }
 
+    template <class RNG, class S>
+    inline MakeMCEuropeanEngine<RNG,S>&
+    MakeMCEuropeanEngine<RNG,S>::withStreams(Size streams) {
+        streams_ = streams;
+        return *this;
+    }
+
     template <class RNG, class S>
     inline
     MakeMCEuropeanEngine<RNG,S>::operator ext::shared_ptr<PricingEngine>()
@@ -238,7 +250,8 @@ namespace QuantLib {
                                     antithetic_,
                                     samples_, tolerance_,
                                     maxSamples_,
-                                    seed_));
+                                    seed_,
+                                    streams_));
     }
 
 
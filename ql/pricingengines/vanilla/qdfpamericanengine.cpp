@@ -140,8 +140,8 @@ namespace QuantLib {
 
       protected:
         std::pair<Real, Real> d(Time t, Real z) const {
-            const Real v = vol * std::sqrt(t);
-            const Real m = (std::log(z) + (r-q)*t)/v + 0.5*v;
+            const Real v = vol * sqrt(t);
+            const Real m = (log(z) + (r-q)*t)/v + 0.5*v;
 
             return std::make_pair(m, m-v);
         }
@@ -198,7 +198,7 @@ namespace QuantLib {
     : DqFpEquation(_r, _q, _vol, std::move(B), std::move(_integrator)), K(K) {}
 
     std::tuple<Real, Real, Real> DqFpEquation_A::f(Real tau, Real b) const {
-        const Real v = vol * std::sqrt(tau);
+        const Real v = vol * sqrt(tau);
 
         Real N, D;
         if (tau < squared(QL_EPSILON)) {
@@ -212,7 +212,7 @@ namespace QuantLib {
             }
         }
         else {
-            const Real stv = std::sqrt(tau)/vol;
+            const Real stv = sqrt(tau)/vol;
 
             Real K12, K3;
             if (!x_i.empty()) {
@@ -223,14 +223,14 @@ namespace QuantLib {
                     const Real m = 0.25*tau*squared(1+y);
                     const std::pair<Real, Real> dpm = d(m, b/B(tau-m));
 
-                    K12 += w_i[i] * std::exp(q*tau - q*m)
+                    K12 += w_i[i] * exp(q*tau - q*m)
                         *(0.5*tau*(y+1)*Phi(dpm.first) + stv*phi(dpm.first));
-                    K3 += w_i[i] * stv*std::exp(r*tau-r*m)*phi(dpm.second);
+                    K3 += w_i[i] * stv*exp(r*tau-r*m)*phi(dpm.second);
                 }
             } else {
                 K12 = (*integrator)([&, this](Real y) -> Real {
                     const Real m = 0.25*tau*squared(1+y);
-                    const Real df = std::exp(q*tau - q*m);
+                    const Real df = exp(q*tau - q*m);
 
                     if (y <= 5*QL_EPSILON - 1) {
                         if (close_enough(b, B(tau-m)))
@@ -246,7 +246,7 @@ namespace QuantLib {
 
                 K3 = (*integrator)([&, this](Real y) -> Real {
                     const Real m = 0.25*tau*squared(1+y);
-                    const Real df = std::exp(r*tau-r*m);
+                    const Real df = exp(r*tau-r*m);
 
                     if (y <= 5*QL_EPSILON - 1) {
                         if (close_enough(b, B(tau-m)))
@@ -263,7 +263,7 @@ namespace QuantLib {
             D = phi(dpm.first)/v + Phi(dpm.first) + q*K12;
         }
 
-        const Real alpha = K*std::exp(-(r-q)*tau);
+        const Real alpha = K*exp(-(r-q)*tau);
         Real fv;
         if (tau < squared(QL_EPSILON)) {
             if (close_enough(b, K))
@@ -288,7 +288,7 @@ namespace QuantLib {
 
         if (tau < squared(QL_EPSILON)) {
             if (close_enough(b, K)) {
-                const Real sqTau = std::sqrt(tau);
+                const Real sqTau = sqrt(tau);
                 const Real vol2 = vol*vol;
                 Dd = M_1_SQRTPI*M_SQRT_2*(
                     -(0.5*vol2 + r-q) / (b*vol*vol2*sqTau) + 1 / (b*vol*sqTau));
@@ -301,7 +301,7 @@ namespace QuantLib {
             const std::pair<Real, Real> dpm = d(tau, b/K);
 
             Dd = -phi(dpm.first) * dpm.first / (b*vol*vol*tau) +
-                    phi(dpm.first) / (b*vol * std::sqrt(tau));
+                    phi(dpm.first) / (b*vol * sqrt(tau));
             Nd = -phi(dpm.second) * dpm.second / (b*vol*vol*tau);
         }
 
@@ -337,14 +337,14 @@ namespace QuantLib {
                 for (Integer i = x_i.size()-1; i >= 0; --i) {
                     const Real u = c*x_i[i] + c;
                     const std::pair<Real, Real> dpm = d(tau - u, b/B(u));
-                    ni += w_i[i] * std::exp(r*u)*Phi(dpm.second);
-                    di += w_i[i] * std::exp(q*u)*Phi(dpm.first);
+                    ni += w_i[i] * exp(r*u)*Phi(dpm.second);
+                    di += w_i[i] * exp(q*u)*Phi(dpm.first);
                 }
                 ni *= c;
                 di *= c;
             } else {
                 ni = (*integrator)([&, this](Real u) -> Real {
-                	const Real df = std::exp(r*u);
+                	const Real df = exp(r*u);
                     if (u >= tau*(1 - 5*QL_EPSILON)) {
                         if (close_enough(b, B(u)))
                             return 0.5*df;
@@ -355,7 +355,7 @@ namespace QuantLib {
                         return df*Phi(d(tau - u, b/B(u)).second);
                 }, 0, tau);
                 di = (*integrator)([&, this](Real u) -> Real {
-                	const Real df = std::exp(q*u);
+                	const Real df = exp(q*u);
                     if (u >= tau*(1 - 5*QL_EPSILON)) {
                         if (close_enough(b, B(u)))
                             return 0.5*df;
@@ -374,7 +374,7 @@ namespace QuantLib {
         }
 
         Real fv;
-        const Real alpha = K*std::exp(-(r-q)*tau);
+        const Real alpha = K*exp(-(r-q)*tau);
         if (tau < squared(QL_EPSILON)) {
             if (close_enough(b, K) || b > K)
                 fv = alpha;
@@ -394,8 +394,8 @@ namespace QuantLib {
     std::pair<Real, Real> DqFpEquation_B::NDd(Real tau, Real b) const {
         const std::pair<Real, Real> dpm = d(tau, b/K);
         return std::make_pair(
-            phi(dpm.second) / (b*vol*std::sqrt(tau)),
-            phi(dpm.first)  / (b*vol*std::sqrt(tau))
+            phi(dpm.second) / (b*vol*sqrt(tau)),
+            phi(dpm.first)  / (b*vol*sqrt(tau))
         );
     }
 
@@ -441,20 +441,20 @@ namespace QuantLib {
                 .getPutExerciseBoundary(S, K, r, q, vol, T);
 
         const Array z = interp->nodes();
-        const Array x = 0.5*std::sqrt(T)*(1.0+z);
+        const Array x = 0.5*sqrt(T)*(1.0+z);
 
         const auto B = [xmax, T, &interp](Real tau) -> Real {
-            const Real z = 2*std::sqrt(std::abs(tau)/T)-1;
-            return xmax*std::exp(-std::sqrt(std::max(Real(0), (*interp)(z, true))));
+            const Real z = 2*sqrt(abs(tau)/T)-1;
+            return xmax*exp(-sqrt(std::max(Real(0), (*interp)(z, true))));
         };
 
         const auto h = [=](Real fv) -> Real {
-            return squared(std::log(fv/xmax));
+            return squared(log(fv/xmax));
         };
 
         const ext::shared_ptr<DqFpEquation> eqn
             = (fpEquation_ == FP_A
-               || (fpEquation_ == Auto && std::abs(r-q) < 0.001))?
+               || (fpEquation_ == Auto && abs(r-q) < 0.001))?
               ext::shared_ptr<DqFpEquation>(new DqFpEquation_A(
                   K, r, q, vol, B,
                   iterationScheme_->getFixedPointIntegrator()))
@@ -484,7 +484,7 @@ namespace QuantLib {
                     const Real Nd = std::get<0>(ndd);
                     const Real Dd = std::get<1>(ndd);
 
-                    const Real fd = K*std::exp(-(r-q)*tau) * (Nd/D - Dd*N/(D*D));
+                    const Real fd = K*exp(-(r-q)*tau) * (Nd/D - Dd*N/(D*D));
 
                     y[i] = h(b - (fv - b)/ (fd-1));
                 }
@@ -506,11 +506,11 @@ namespace QuantLib {
         const detail::QdPlusAddOnValue aov(T, S, K, r, q, vol, xmax, interp);
         const Real addOn =
            (*iterationScheme_->getExerciseBoundaryToPriceIntegrator())(
-               aov, 0.0, std::sqrt(T));
+               aov, 0.0, sqrt(T));
 
         const Real europeanValue = BlackCalculator(
-            Option::Put, K, S*std::exp((r-q)*T),
-            vol*std::sqrt(T), std::exp(-r*T)).value();
+            Option::Put, K, S*exp((r-q)*T),
+            vol*sqrt(T), exp(-r*T)).value();
 
         return std::max(europeanValue, 0.0) + std::max(0.0, addOn);
     }
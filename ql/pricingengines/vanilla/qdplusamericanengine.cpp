@@ -41,14 +41,14 @@ namespace QuantLib {
       public:
         QdPlusBoundaryEvaluator(
             Real S, Real strike, Rate rf, Rate dy, Volatility vol, Time t, Time T)
-        : tau(t), K(strike), sigma(vol), sigma2(sigma * sigma), v(sigma * std::sqrt(tau)), r(rf),
-          q(dy), dr(std::exp(-r * tau)), dq(std::exp(-q * tau)),
-          ddr((std::abs(r*tau) > 1e-5)? Real(r/(1-dr)) : Real(1/(tau*(1-0.5*r*tau*(1-r*tau/3))))),
+        : tau(t), K(strike), sigma(vol), sigma2(sigma * sigma), v(sigma * sqrt(tau)), r(rf),
+          q(dy), dr(exp(-r * tau)), dq(exp(-q * tau)),
+          ddr((abs(r*tau) > 1e-5)? Real(r/(1-dr)) : Real(1/(tau*(1-0.5*r*tau*(1-r*tau/3))))),
           omega(2 * (r - q) / sigma2),
           lambda(0.5 *
-                 (-(omega - 1) - std::sqrt(squared(omega - 1) + 8 * ddr / sigma2))),
+                 (-(omega - 1) - sqrt(squared(omega - 1) + 8 * ddr / sigma2))),
           lambdaPrime(2 * ddr*ddr /
-                      (sigma2 * std::sqrt(squared(omega - 1) + 8 * ddr / sigma2))),
+                      (sigma2 * sqrt(squared(omega - 1) + 8 * ddr / sigma2))),
           alpha(2 * dr / (sigma2 * (2 * lambda + omega - 1))),
           beta(alpha * (ddr + lambdaPrime / (2 * lambda + omega - 1)) - lambda),
           xMax(QdPlusAmericanEngine::xMax(strike, r, q)),
@@ -96,7 +96,7 @@ namespace QuantLib {
         void preCalculate(Real S) const {
             S = std::max(QL_EPSILON, S);
             sc = S;
-            dp = std::log(S*dq/(K*dr))/v + 0.5*v;
+            dp = log(S*dq/(K*dr))/v + 0.5*v;
             dm = dp - v;
             Phi_dp = Phi(-dp);
             Phi_dm = Phi(-dm);
@@ -130,17 +130,17 @@ namespace QuantLib {
 
     Real detail::QdPlusAddOnValue::operator()(Real z) const {
         const Real t = z*z;
-        const Real q = (*q_z_)(2*std::sqrt(std::max(0.0, T_-t)/T_) - 1, true);
-        const Real b_t = xmax_*std::exp(-std::sqrt(std::max(0.0, q)));
+        const Real q = (*q_z_)(2*sqrt(std::max(0.0, T_-t)/T_) - 1, true);
+        const Real b_t = xmax_*exp(-sqrt(std::max(0.0, q)));
 
-        const Real dr = std::exp(-r_*t);
-        const Real dq = std::exp(-q_*t);
-        const Real v = vol_*std::sqrt(t);
+        const Real dr = exp(-r_*t);
+        const Real dq = exp(-q_*t);
+        const Real v = vol_*sqrt(t);
 
         Real r;
         if (v >= QL_EPSILON) {
             if (b_t > QL_EPSILON) {
-                const Real dp = std::log(S_*dq/(b_t*dr))/v + 0.5*v;
+                const Real dp = log(S_*dq/(b_t*dr))/v + 0.5*v;
                 r = 2*z*(r_*K_*dr*Phi_(-dp+v) - q_*S_*dq*Phi_(-dp));
             }
             else
@@ -178,8 +178,8 @@ namespace QuantLib {
         const Time T = process_->time(maturity);
         const Real S = process_->x0();
         const Real K = payoff->strike();
-        const Rate r = -std::log(process_->riskFreeRate()->discount(maturity))/T;
-        const Rate q = -std::log(process_->dividendYield()->discount(maturity))/T;
+        const Rate r = -log(process_->riskFreeRate()->discount(maturity))/T;
+        const Rate q = -log(process_->dividendYield()->discount(maturity))/T;
         const Volatility vol = process_->blackVolatility()->blackVol(T, K);
 
         QL_REQUIRE(S >= 0, "zero or positive underlying value is required");
@@ -201,21 +201,21 @@ namespace QuantLib {
             return 0.0;
 
         if (close(S, 0.0))
-            return std::max(K, K*std::exp(-r*T));
+            return std::max(K, K*exp(-r*T));
 
         if (r <= 0.0 && r <= q)
             return std::max(0.0,
-                BlackCalculator(Option::Put, K, S*std::exp((r-q)*T),
-                                vol*std::sqrt(T), std::exp(-r*T)).value());
+                BlackCalculator(Option::Put, K, S*exp((r-q)*T),
+                                vol*sqrt(T), exp(-r*T)).value());
 
         if (close(vol, 0.0)) {
             const auto intrinsic = [&](Real t)  -> Real {
-                return std::max(0.0, K*std::exp(-r*t)-S*std::exp(-q*t));
+                return std::max(0.0, K*exp(-r*t)-S*exp(-q*t));
             };
             const Real npv0 = intrinsic(0.0);
             const Real npvT = intrinsic(T);
             const Real extremT
-                = close_enough(r, q)? QL_MAX_REAL : Real(std::log(r*K/(q*S))/(r-q));
+                = close_enough(r, q)? QL_MAX_REAL : Real(log(r*K/(q*S))/(r-q));
 
             if (extremT > 0.0 && extremT < T)
                 return std::max(npv0, std::max(npvT, intrinsic(extremT)));
@@ -326,11 +326,11 @@ namespace QuantLib {
                         : Real((1 + 0.5*lf/(1-lf))*fx/fPrime);
 
                     x = std::max(xmin, x - step);
-                    resultCloseEnough = std::fabs(x-xOld) < 0.5*eps_;
+                    resultCloseEnough = fabs(x-xOld) < 0.5*eps_;
                 }
                 while (!resultCloseEnough && eval.evaluations() < maxIter_);
 
-                if (!resultCloseEnough && !close(std::fabs(fx), 0.0)) {
+                if (!resultCloseEnough && !close(fabs(fx), 0.0)) {
                     x = buildInSolver(eval, QuantLib::Brent(), S, K, 10*maxIter_, x);
                 }
             }
@@ -352,7 +352,7 @@ namespace QuantLib {
             interpolationPoints_,
             [&, this](Real z) {
                 const Real x_sq = 0.25*T*squared(1+z);
-                return squared(std::log(
+                return squared(log(
                     this->putExerciseBoundaryAtTau(S, K, r, q, vol, T, x_sq)
                         .second/xmax));
             },
@@ -373,10 +373,10 @@ namespace QuantLib {
         const detail::QdPlusAddOnValue aov(T, S, K, r, q, vol, xmax, q_z);
 
 #ifdef QL_BOOST_HAS_TANH_SINH
-        const Real addOn = TanhSinhIntegral(eps_)(aov, 0.0, std::sqrt(T));
+        const Real addOn = TanhSinhIntegral(eps_)(aov, 0.0, sqrt(T));
 #else
         const Real addOn = GaussLobattoIntegral(100000, QL_MAX_REAL, 0.1*eps_)
-                (aov, 0.0, std::sqrt(T));
+                (aov, 0.0, sqrt(T));
 #endif
 
         QL_REQUIRE(addOn > -10*eps_,
@@ -386,8 +386,8 @@ namespace QuantLib {
             0.0,
             BlackCalculator(
                 Option::Put, K,
-                S*std::exp((r-q)*T),
-                vol*std::sqrt(T), std::exp(-r*T)).value()
+                S*exp((r-q)*T),
+                vol*sqrt(T), exp(-r*T)).value()
         );
 
         return europeanValue + std::max(0.0, addOn);
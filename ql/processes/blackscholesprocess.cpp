@@ -86,7 +86,7 @@ namespace QuantLib {
     }
 
     Real GeneralizedBlackScholesProcess::apply(Real x0, Real dx) const {
-        return x0 * std::exp(dx);
+        return x0 * exp(dx);
     }
 
     Real GeneralizedBlackScholesProcess::expectation(Time t0,
@@ -96,7 +96,7 @@ namespace QuantLib {
         if(isStrikeIndependent_ && !forceDiscretization_) {
             // exact value for curves
             return x0 *
-                std::exp(dt * (riskFreeRate_->forwardRate(t0, t0 + dt, Continuous,
+                exp(dt * (riskFreeRate_->forwardRate(t0, t0 + dt, Continuous,
                                                           NoFrequency, true).rate() -
                              dividendYield_->forwardRate(
                                  t0, t0 + dt, Continuous, NoFrequency, true).rate()));
@@ -109,7 +109,7 @@ namespace QuantLib {
         localVolatility(); // trigger update
         if(isStrikeIndependent_ && !forceDiscretization_) {
             // exact value for curves
-            return std::sqrt(variance(t0,x0,dt));
+            return sqrt(variance(t0,x0,dt));
         }
         else{
             return discretization_->diffusion(*this,t0,x0,dt);
@@ -140,12 +140,34 @@ namespace QuantLib {
                                                       NoFrequency, true).rate()) *
                              dt -
                          0.5 * var;
-            return apply(x0, std::sqrt(var) * dw + drift);
+            return apply(x0, sqrt(var) * dw + drift);
         } else
             return apply(x0, discretization_->drift(*this, t0, x0, dt) +
                                  stdDeviation(t0, x0, dt) * dw);
     }
 
+    void GeneralizedBlackScholesProcess::evolveBatch(Time t0, const Real* x0,
+                                                     Time dt, const Real* dw,
+                                                     Real* x, Size n) const {
+        localVolatility(); // trigger update
+        if (isStrikeIndependent_ && !forceDiscretization_) {
+            // the exact step doesn't depend on the state, so that
+            // the term structures are only queried once per batch
+            Real var = variance(t0, x0_->value(), dt);
+            Real drift = (riskFreeRate_->forwardRate(t0, t0 + dt, Continuous,
+                                                     NoFrequency, true).rate() -
+                          dividendYield_->forwardRate(t0, t0 + dt, Continuous,
+                                                      NoFrequency, true).rate()) *
+                             dt -
+                         0.5 * var;
+            Real stdDev = sqrt(var);
+            for (Size p=0; p<n; ++p)
+                x[p] = x0[p] * exp(stdDev * dw[p] + drift);
+        } else {
+            StochasticProcess1D::evolveBatch(t0, x0, dt, dw, x, n);
+        }
+    }
+
     Time GeneralizedBlackScholesProcess::time(const Date& d) const {
         return riskFreeRate_->dayCounter().yearFraction(
                                            riskFreeRate_->referenceDate(), d);
@@ -83,6 +83,12 @@ namespace QuantLib {
         Real stdDeviation(Time t0, Real x0, Time dt) const override;
         Real variance(Time t0, Real x0, Time dt) const override;
         Real evolve(Time t0, Real x0, Time dt, Real dw) const override;
+        void evolveBatch(Time t0,
+                         const Real* x0,
+                         Time dt,
+                         const Real* dw,
+                         Real* x,
+                         Size n) const override;
         //@}
         Time time(const Date&) const override;
         //! \name Observer interface
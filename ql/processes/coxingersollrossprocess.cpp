@@ -30,8 +30,8 @@ namespace QuantLib {
     }
 
     Real CoxIngersollRossProcess::variance(Time, Real, Time dt) const {
-        Real exponent1 = std::exp(-speed_ * dt);
-        Real exponent2 = std::exp(-2 * speed_ * dt);
+        Real exponent1 = exp(-speed_ * dt);
+        Real exponent2 = exp(-2 * speed_ * dt);
         Real fraction = (volatility_ * volatility_) / speed_;
 
         return x0_ * fraction * (exponent1 - exponent2) + level_ * fraction * (1 - exponent1) * (1 - exponent1);
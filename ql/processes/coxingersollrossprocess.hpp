@@ -97,12 +97,12 @@ namespace QuantLib {
 
     inline Real CoxIngersollRossProcess::expectation(Time, Real x0,
                                                Time dt) const {
-        return level_ + (x0 - level_) * std::exp(-speed_*dt);
+        return level_ + (x0 - level_) * exp(-speed_*dt);
     }
 
     inline Real CoxIngersollRossProcess::stdDeviation(Time t, Real x0,
                                                 Time dt) const {
-        return std::sqrt(variance(t,x0,dt));
+        return sqrt(variance(t,x0,dt));
     }
 
     inline Real CoxIngersollRossProcess::evolve (Time t0,
@@ -111,7 +111,7 @@ namespace QuantLib {
                                     Real dw) const {
         Real result;
 
-        const Real ex = std::exp(-speed_*dt);
+        const Real ex = exp(-speed_*dt);
 
         const Real m  =  level_+(x0-level_)*ex;
         const Real s2 =  x0*volatility_*volatility_*ex/speed_*(1-ex)
@@ -119,8 +119,8 @@ namespace QuantLib {
         const Real psi = s2/(m*m);
 
         if (psi <= 1.5) {
-            const Real b2 = 2/psi-1+std::sqrt(2/psi*(2/psi-1));
-            const Real b  = std::sqrt(b2);
+            const Real b2 = 2/psi-1+sqrt(2/psi*(2/psi-1));
+            const Real b  = sqrt(b2);
             const Real a  = m/(1+b2);
 
             result = a*(b+dw)*(b+dw);
@@ -131,7 +131,7 @@ namespace QuantLib {
 
             const Real u = CumulativeNormalDistribution()(dw);
 
-            result = ((u <= p) ? 0.0 : Real(std::log((1-p)/(1-u))/beta));
+            result = ((u <= p) ? 0.0 : Real(log((1-p)/(1-u))/beta));
         }
 
         return result;
@@ -36,12 +36,12 @@ namespace QuantLib {
                                           Time t0,
                                           const Array& x0,
                                           Time dt) const {
-        return process.diffusion(t0, x0) * std::sqrt(dt);
+        return process.diffusion(t0, x0) * sqrt(dt);
     }
 
     Real EulerDiscretization::diffusion(const StochasticProcess1D& process,
                                         Time t0, Real x0, Time dt) const {
-        return process.diffusion(t0, x0) * std::sqrt(dt);
+        return process.diffusion(t0, x0) * sqrt(dt);
     }
 
     Matrix EulerDiscretization::covariance(const StochasticProcess& process,
@@ -54,7 +54,7 @@ namespace QuantLib {
         Real sigma1 = sigma_;
         Real sigma2 = eta_;
         tmp[0][0] = sigma1;       tmp[0][1] = 0.0;
-        tmp[1][0] = rho_*sigma1;  tmp[1][1] = std::sqrt(1.0-rho_*rho_)*sigma2;
+        tmp[1][0] = rho_*sigma1;  tmp[1][1] = sqrt(1.0-rho_*rho_)*sigma2;
         return tmp;
     }
 
@@ -77,15 +77,15 @@ namespace QuantLib {
         Matrix tmp(2,2);
         Real sigma1 = xProcess_->stdDeviation(t0, x0[0], dt);
         Real sigma2 = yProcess_->stdDeviation(t0, x0[1], dt);
-        Real expa = std::exp(-a_*dt), expb = std::exp(-b_*dt);
+        Real expa = exp(-a_*dt), expb = exp(-b_*dt);
         Real H = (rho_*sigma_*eta_)/(a_+b_)*(1-expa*expb);
         Real den =
-            (0.5*sigma_*eta_)*std::sqrt((1-expa*expa)*(1-expb*expb)/(a_*b_));
+            (0.5*sigma_*eta_)*sqrt((1-expa*expa)*(1-expb*expb)/(a_*b_));
         Real newRho = H/den;
         tmp[0][0] = sigma1;
         tmp[0][1] = 0.0;
         tmp[1][0] = newRho*sigma2;
-        tmp[1][1] = std::sqrt(1.0-newRho*newRho)*sigma2;
+        tmp[1][1] = sqrt(1.0-newRho*newRho)*sigma2;
         return tmp;
     }
 
@@ -149,7 +149,7 @@ namespace QuantLib {
         Real sigma1 = sigma_;
         Real sigma2 = eta_;
         tmp[0][0] = sigma1;       tmp[0][1] = 0.0;
-        tmp[1][0] = rho_*sigma1;  tmp[1][1] = std::sqrt(1.0-rho_*rho_)*sigma2;
+        tmp[1][0] = rho_*sigma1;  tmp[1][1] = sqrt(1.0-rho_*rho_)*sigma2;
         return tmp;
     }
 
@@ -165,15 +165,15 @@ namespace QuantLib {
         Matrix tmp(2,2);
         Real sigma1 = xProcess_->stdDeviation(t0, x0[0], dt);
         Real sigma2 = yProcess_->stdDeviation(t0, x0[1], dt);
-        Real expa = std::exp(-a_*dt), expb = std::exp(-b_*dt);
+        Real expa = exp(-a_*dt), expb = exp(-b_*dt);
         Real H = (rho_*sigma_*eta_)/(a_+b_)*(1-expa*expb);
         Real den =
-            (0.5*sigma_*eta_)*std::sqrt((1-expa*expa)*(1-expb*expb)/(a_*b_));
+            (0.5*sigma_*eta_)*sqrt((1-expa*expa)*(1-expb*expb)/(a_*b_));
         Real newRho = H/den;
         tmp[0][0] = sigma1;
         tmp[0][1] = 0.0;
         tmp[1][0] = newRho*sigma2;
-        tmp[1][1] = std::sqrt(1.0-newRho*newRho)*sigma2;
+        tmp[1][1] = sqrt(1.0-newRho*newRho)*sigma2;
         return tmp;
     }
 
@@ -184,16 +184,16 @@ namespace QuantLib {
     }
 
     Real G2ForwardProcess::xForwardDrift(Time t, Time T) const {
-        Real expatT = std::exp(-a_*(T-t));
-        Real expbtT = std::exp(-b_*(T-t));
+        Real expatT = exp(-a_*(T-t));
+        Real expbtT = exp(-b_*(T-t));
 
         return -(sigma_*sigma_/a_) * (1-expatT)
               - (rho_*sigma_*eta_/b_) * (1-expbtT);
     }
 
     Real G2ForwardProcess::yForwardDrift(Time t, Time T) const {
-        Real expatT = std::exp(-a_*(T-t));
-        Real expbtT = std::exp(-b_*(T-t));
+        Real expatT = exp(-a_*(T-t));
+        Real expbtT = exp(-b_*(T-t));
 
         return -(eta_*eta_/b_) * (1-expbtT)
               - (rho_*sigma_*eta_/a_) * (1-expatT);
@@ -202,22 +202,22 @@ namespace QuantLib {
     Real G2ForwardProcess::Mx_T(Real s, Real t, Real T) const {
         Real M;
         M = ( (sigma_*sigma_)/(a_*a_) + (rho_*sigma_*eta_)/(a_*b_) )
-          * (1-std::exp(-a_*(t-s)));
+          * (1-exp(-a_*(t-s)));
         M += -(sigma_*sigma_)/(2*a_*a_) *
-              (std::exp(-a_*(T-t))-std::exp(-a_*(T+t-2*s)));
+              (exp(-a_*(T-t))-exp(-a_*(T+t-2*s)));
         M += -(rho_*sigma_*eta_)/(b_*(a_+b_))
-            * (std::exp(-b_*(T-t)) -std::exp(-b_*T-a_*t+(a_+b_)*s));
+            * (exp(-b_*(T-t)) -exp(-b_*T-a_*t+(a_+b_)*s));
         return M;
     }
 
     Real G2ForwardProcess::My_T(Real s, Real t, Real T) const {
         Real M;
         M = ( (eta_*eta_)/(b_*b_) + (rho_*sigma_*eta_)/(a_*b_) )
-          * (1-std::exp(-b_*(t-s)));
+          * (1-exp(-b_*(t-s)));
         M += -(eta_*eta_)/(2*b_*b_) *
-              (std::exp(-b_*(T-t))-std::exp(-b_*(T+t-2*s)));
+              (exp(-b_*(T-t))-exp(-b_*(T+t-2*s)));
         M += -(rho_*sigma_*eta_)/(a_*(a_+b_))
-            * (std::exp(-a_*(T-t))-std::exp(-a_*T-b_*t+(a_+b_)*s));
+            * (exp(-a_*(T-t))-exp(-a_*T-b_*t+(a_+b_)*s));
         return M;
     }
 
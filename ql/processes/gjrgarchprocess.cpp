@@ -56,11 +56,11 @@ namespace QuantLib {
 
     Array GJRGARCHProcess::drift(Time t, const Array& x) const {
         const Real N = CumulativeNormalDistribution()(lambda_);
-        const Real n = std::exp(-lambda_*lambda_/2.0)/std::sqrt(2*M_PI);
+        const Real n = exp(-lambda_*lambda_/2.0)/sqrt(2*M_PI);
         const Real q2 = 1.0 + lambda_*lambda_;
         const Real q3 = lambda_*n + N + lambda_*lambda_*N;
-        const Real vol = (x[1] > 0.0) ? std::sqrt(x[1])
-                         : (discretization_ == Reflection) ? Real(-std::sqrt(-x[1]))
+        const Real vol = (x[1] > 0.0) ? sqrt(x[1])
+                         : (discretization_ == Reflection) ? Real(-sqrt(-x[1]))
                          : 0.0;
 
         return {
@@ -83,7 +83,7 @@ namespace QuantLib {
         */
         Matrix tmp(2,2);
         const Real N = CumulativeNormalDistribution()(lambda_);
-        const Real n = std::exp(-lambda_*lambda_/2.0)/std::sqrt(2*M_PI);
+        const Real n = exp(-lambda_*lambda_/2.0)/sqrt(2*M_PI);
         const Real sigma2 = 2.0 + 4.0*lambda_*lambda_;
         const Real q3 = lambda_*n + N + lambda_*lambda_*N;
         const Real Eml_e4 = lambda_*lambda_*lambda_*n + 5.0*lambda_*n 
@@ -93,14 +93,14 @@ namespace QuantLib {
         const Real sigma12 = -2.0*lambda_;
         const Real sigma13 = -2.0*n - 2*lambda_*N;
         const Real sigma23 = 2.0*N + sigma12*sigma13;
-        const Real vol = (x[1] > 0.0) ? std::sqrt(x[1])
-                         : (discretization_ == Reflection) ? Real(- std::sqrt(-x[1]))
+        const Real vol = (x[1] > 0.0) ? sqrt(x[1])
+                         : (discretization_ == Reflection) ? Real(- sqrt(-x[1]))
                          : 1e-8; // set vol to (almost) zero but still
                                  // expose some correlation information
-        const Real rho1 = std::sqrt(daysPerYear_)*(alpha_*sigma12 
+        const Real rho1 = sqrt(daysPerYear_)*(alpha_*sigma12 
                                             + gamma_*sigma13) * vol * vol;
-        const Real rho2 = vol*vol*std::sqrt(daysPerYear_)
-            *std::sqrt(alpha_*alpha_*(sigma2 - sigma12*sigma12) 
+        const Real rho2 = vol*vol*sqrt(daysPerYear_)
+            *sqrt(alpha_*alpha_*(sigma2 - sigma12*sigma12) 
                        + gamma_*gamma_*(sigma3 - sigma13*sigma13) 
                        + 2.0*alpha_*gamma_*(sigma23 - sigma12*sigma13)); 
 
@@ -113,7 +113,7 @@ namespace QuantLib {
 
     Array GJRGARCHProcess::apply(const Array& x0,
                                  const Array& dx) const {
-        return { x0[0] * std::exp(dx[0]), x0[1] + dx[1] };
+        return { x0[0] * exp(dx[0]), x0[1] + dx[1] };
     }
 
     Array GJRGARCHProcess::evolve(Time t0, const Array& x0,
@@ -121,9 +121,9 @@ namespace QuantLib {
         Array retVal(2);
         Real vol, mu, nu;
 
-        const Real sdt = std::sqrt(dt);
+        const Real sdt = sqrt(dt);
         const Real N = CumulativeNormalDistribution()(lambda_);
-        const Real n = std::exp(-lambda_*lambda_/2.0)/std::sqrt(2*M_PI);
+        const Real n = exp(-lambda_*lambda_/2.0)/sqrt(2*M_PI);
         const Real sigma2 = 2.0 + 4.0*lambda_*lambda_;
         const Real q2 = 1.0 + lambda_*lambda_;
         const Real q3 = lambda_*n + N + lambda_*lambda_*N;
@@ -134,9 +134,9 @@ namespace QuantLib {
         const Real sigma12 = -2.0*lambda_;
         const Real sigma13 = -2.0*n - 2*lambda_*N;
         const Real sigma23 = 2.0*N + sigma12*sigma13;
-        const Real rho1 = std::sqrt(daysPerYear_)*(alpha_*sigma12 + gamma_*sigma13);
-        const Real rho2 = std::sqrt(daysPerYear_)
-            *std::sqrt(alpha_*alpha_*(sigma2 - sigma12*sigma12) 
+        const Real rho1 = sqrt(daysPerYear_)*(alpha_*sigma12 + gamma_*sigma13);
+        const Real rho2 = sqrt(daysPerYear_)
+            *sqrt(alpha_*alpha_*(sigma2 - sigma12*sigma12) 
                        + gamma_*gamma_*(sigma3 - sigma13*sigma13) 
                        + 2.0*alpha_*gamma_*(sigma23 - sigma12*sigma13));
 
@@ -147,36 +147,36 @@ namespace QuantLib {
           //  stochastic volatility models",
           // Working Paper, Tinbergen Institute
           case PartialTruncation:
-            vol = (x0[1] > 0.0) ? Real(std::sqrt(x0[1])) : 0.0;
+            vol = (x0[1] > 0.0) ? Real(sqrt(x0[1])) : 0.0;
             mu =    riskFreeRate_->forwardRate(t0, t0+dt, Continuous).rate()
                   - dividendYield_->forwardRate(t0, t0+dt, Continuous).rate()
                     - 0.5 * vol * vol;
             nu = daysPerYear_*daysPerYear_*omega_ 
                 + daysPerYear_*(beta_ + alpha_*q2 + gamma_*q3 - 1.0) * x0[1];
 
-            retVal[0] = x0[0] * std::exp(mu*dt+vol*dw[0]*sdt);
+            retVal[0] = x0[0] * exp(mu*dt+vol*dw[0]*sdt);
             retVal[1] = x0[1] + nu*dt + sdt*vol*vol*(rho1*dw[0] + rho2*dw[1]);
             break;
           case FullTruncation:
-            vol = (x0[1] > 0.0) ? Real(std::sqrt(x0[1])) : 0.0;
+            vol = (x0[1] > 0.0) ? Real(sqrt(x0[1])) : 0.0;
             mu =    riskFreeRate_->forwardRate(t0, t0+dt, Continuous).rate()
                   - dividendYield_->forwardRate(t0, t0+dt, Continuous).rate()
                     - 0.5 * vol * vol;
             nu = daysPerYear_*daysPerYear_*omega_ 
                 + daysPerYear_*(beta_ + alpha_*q2 + gamma_*q3 - 1.0) * vol *vol;
 
-            retVal[0] = x0[0] * std::exp(mu*dt+vol*dw[0]*sdt);
+            retVal[0] = x0[0] * exp(mu*dt+vol*dw[0]*sdt);
             retVal[1] = x0[1] + nu*dt + sdt*vol*vol*(rho1*dw[0] + rho2*dw[1]);
             break;
           case Reflection:
-            vol = std::sqrt(std::fabs(x0[1]));
+            vol = sqrt(fabs(x0[1]));
             mu =    riskFreeRate_->forwardRate(t0, t0+dt, Continuous).rate()
                   - dividendYield_->forwardRate(t0, t0+dt, Continuous).rate()
                     - 0.5 * vol*vol;
             nu = daysPerYear_*daysPerYear_*omega_ 
                 + daysPerYear_*(beta_ + alpha_*q2 + gamma_*q3 - 1.0) * vol * vol;
 
-            retVal[0] = x0[0]*std::exp(mu*dt+vol*dw[0]*sdt);
+            retVal[0] = x0[0]*exp(mu*dt+vol*dw[0]*sdt);
             retVal[1] = vol*vol
                         +nu*dt + sdt*vol*vol*(rho1*dw[0] + rho2*dw[1]);
             break;
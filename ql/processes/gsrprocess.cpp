@@ -71,7 +71,7 @@ namespace QuantLib {
 
 
     Real GsrProcess::stdDeviation(Time t0, Real x0, Time dt) const {
-        return std::sqrt(variance(t0, x0, dt));
+        return sqrt(variance(t0, x0, dt));
     }
 
     Real GsrProcess::variance(Time w, Real, Time dt) const {
@@ -51,7 +51,7 @@ void GsrProcessCore::flushCache() const {
     for (int i = 0; i < (int)reversions_.size(); i++)
         // small reversions cause numerical problems, so we keep them
         // away from zero
-        if (std::fabs(reversions_[i]) < 1E-4)
+        if (fabs(reversions_[i]) < 1E-4)
             revZero_[i] = true;
         else
             revZero_[i] = false;
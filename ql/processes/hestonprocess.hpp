@@ -73,6 +73,17 @@ namespace QuantLib {
         Matrix diffusion(Time t, const Array& x) const override;
         Array apply(const Array& x0, const Array& dx) const override;
         Array evolve(Time t0, const Array& x0, Time dt, const Array& dw) const override;
+        /*! The term structures are queried once per batch; the
+            truncation, reflection and quadratic-exponential schemes
+            are then applied in a loop over the states, while the
+            other schemes fall back to evolve().
+        */
+        void evolveBatch(Time t0,
+                         const Real* x0,
+                         Time dt,
+                         const Real* dw,
+                         Real* x,
+                         Size n) const override;
 
         Real v0()    const { return v0_; }
         Real rho()   const { return rho_; }
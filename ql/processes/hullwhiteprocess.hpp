@@ -45,6 +45,12 @@ namespace QuantLib {
         Real expectation(Time t0, Real x0, Time dt) const override;
         Real stdDeviation(Time t0, Real x0, Time dt) const override;
         Real variance(Time t0, Real x0, Time dt) const override;
+        void evolveBatch(Time t0,
+                         const Real* x0,
+                         Time dt,
+                         const Real* dw,
+                         Real* x,
+                         Size n) const override;
 
         Real a() const;
         Real sigma() const;
@@ -54,7 +54,7 @@ namespace QuantLib {
     }
 
     Real MfStateProcess::stdDeviation(Time t, Real x0, Time dt) const {
-        return std::sqrt(variance(t, x0, dt));
+        return sqrt(variance(t, x0, dt));
     }
 
     Real MfStateProcess::variance(Time t, Real, Time dt) const {
@@ -64,8 +64,8 @@ namespace QuantLib {
         if (times_.empty())
             return reversionZero_ ? dt
                                   : 1.0 / (2.0 * reversion_) *
-                                        (std::exp(2.0 * reversion_ * (t + dt)) -
-                                         std::exp(2.0 * reversion_ * t));
+                                        (exp(2.0 * reversion_ * (t + dt)) -
+                                         exp(2.0 * reversion_ * t));
 
         Size i =
             std::upper_bound(times_.begin(), times_.end(), t) - times_.begin();
@@ -80,8 +80,8 @@ namespace QuantLib {
                      (times_[k] - std::max(k > 0 ? times_[k - 1] : 0.0, t));
             else
                 v += 1.0 / (2.0 * reversion_) * vols_[k] * vols_[k] *
-                     (std::exp(2.0 * reversion_ * times_[k]) -
-                      std::exp(2.0 * reversion_ *
+                     (exp(2.0 * reversion_ * times_[k]) -
+                      exp(2.0 * reversion_ *
                                std::max(k > 0 ? times_[k - 1] : 0.0, t)));
         }
 
@@ -90,8 +90,8 @@ namespace QuantLib {
                  (t + dt - std::max(j > 0 ? times_[j - 1] : 0.0, t));
         else
             v += 1.0 / (2.0 * reversion_) * vols_[j] * vols_[j] *
-                 (std::exp(2.0 * reversion_ * (t + dt)) -
-                  std::exp(2.0 * reversion_ *
+                 (exp(2.0 * reversion_ * (t + dt)) -
+                  exp(2.0 * reversion_ *
                            (std::max(j > 0 ? times_[j - 1] : 0.0, t))));
 
         return v;
@@ -32,12 +32,12 @@ namespace QuantLib {
     }
 
     Real OrnsteinUhlenbeckProcess::variance(Time, Real, Time dt) const {
-        if (std::fabs(speed_) < std::sqrt(QL_EPSILON)) {
+        if (fabs(speed_) < sqrt(QL_EPSILON)) {
              // algebraic limit for small speed
             return volatility_*volatility_*dt;
         } else {
             return 0.5*volatility_*volatility_/speed_*
-                (1.0 - std::exp(-2.0*speed_*dt));
+                (1.0 - exp(-2.0*speed_*dt));
         }
     }
 
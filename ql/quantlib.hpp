@@ -30,6 +30,7 @@
 #include <payoff.hpp>
 #include <position.hpp>
 #include <prices.hpp>
+#include <pricingcontext.hpp>
 #include <pricingengine.hpp>
 #include <quote.hpp>
 #include <rebatedexercise.hpp>
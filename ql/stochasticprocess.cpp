@@ -56,6 +56,22 @@ namespace QuantLib {
         return apply(expectation(t0,x0,dt), stdDeviation(t0,x0,dt)*dw);
     }
 
+    void StochasticProcess::evolveBatch(Time t0, const Real* x0, Time dt,
+                                        const Real* dw, Real* x,
+                                        Size n) const {
+        const Size m = size(), k = factors();
+        Array state(m), increment(k);
+        for (Size p=0; p<n; ++p) {
+            for (Size i=0; i<m; ++i)
+                state[i] = x0[i*n+p];
+            for (Size j=0; j<k; ++j)
+                increment[j] = dw[j*n+p];
+            const Array next = evolve(t0, state, dt, increment);
+            for (Size i=0; i<m; ++i)
+                x[i*n+p] = next[i];
+        }
+    }
+
     Array StochasticProcess::apply(const Array& x0,
                                    const Array& dx) const {
         return x0 + dx;
@@ -92,6 +108,13 @@ namespace QuantLib {
         return apply(expectation(t0,x0,dt), stdDeviation(t0,x0,dt)*dw);
     }
 
+    void StochasticProcess1D::evolveBatch(Time t0, const Real* x0, Time dt,
+                                          const Real* dw, Real* x,
+                                          Size n) const {
+        for (Size p=0; p<n; ++p)
+            x[p] = evolve(t0, x0[p], dt, dw[p]);
+    }
+
     Real StochasticProcess1D::apply(Real x0, Real dx) const {
         return x0 + dx;
     }
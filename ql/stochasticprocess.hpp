@@ -124,6 +124,21 @@ namespace QuantLib {
                              const Array& x0,
                              Time dt,
                              const Array& dw) const;
+        /*! evolves a batch of \f$ n \f$ states over the same time
+            interval.  The values are stored by variable, so that
+            the i-th state variable of the p-th path is found at
+            <tt>x0[i*n+p]</tt> (resp. <tt>x[i*n+p]</tt>) and the j-th
+            random increment at <tt>dw[j*n+p]</tt>.  By default, it
+            calls evolve() for each state; derived classes can
+            override it to calculate state-independent quantities
+            once for the whole batch.
+        */
+        virtual void evolveBatch(Time t0,
+                                 const Real* x0,
+                                 Time dt,
+                                 const Real* dw,
+                                 Real* x,
+                                 Size n) const;
         /*! applies a change to the asset value. By default, it
             returns \f$ \mathrm{x} + \Delta \mathrm{x} \f$.
         */
@@ -217,6 +232,15 @@ namespace QuantLib {
             standard deviation.
         */
         virtual Real evolve(Time t0, Real x0, Time dt, Real dw) const;
+        /*! evolves a batch of \f$ n \f$ states over the same time
+            interval.  By default, it calls evolve() for each state.
+        */
+        void evolveBatch(Time t0,
+                         const Real* x0,
+                         Time dt,
+                         const Real* dw,
+                         Real* x,
+                         Size n) const override;
         /*! applies a change to the asset value. By default, it
             returns \f$ x + \Delta x \f$.
         */
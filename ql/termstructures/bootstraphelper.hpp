@@ -34,6 +34,7 @@
 #include <settings.hpp>
 #include <time/date.hpp>
 #include <utility>
+#include <vector>
 
 namespace QuantLib {
 
@@ -69,6 +70,20 @@ namespace QuantLib {
         const Handle<Quote>& quote() const { return quote_; }
         virtual Real impliedQuote() const = 0;
         Real quoteError() const { return quote_->value() - impliedQuote(); }
+        //! derivatives of the implied quote (optional)
+        /*! Helpers that can calculate analytically the derivatives
+            of their implied quote with respect to the values of the
+            term structure (i.e., the discount factors for yield term
+            structures) can override this method, which must store
+            the relevant times in \p times and the corresponding
+            derivatives in \p derivatives.  The default
+            implementation returns false, i.e., no derivatives are
+            available.
+        */
+        virtual bool impliedQuoteDerivatives(std::vector<Time>& /*times*/,
+                                             std::vector<Real>& /*derivatives*/) const {
+            return false;
+        }
         //! sets the term structure to be used for pricing
         /*! \warning Being a pointer and not a shared_ptr, the term
                      structure is not guaranteed to remain allocated
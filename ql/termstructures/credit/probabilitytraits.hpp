@@ -87,7 +87,7 @@ namespace QuantLib {
                 return c->data().back()/2.0;
             }
             Time dt = c->times()[i] - c->times()[i-1];
-            return c->data()[i-1] * std::exp(- detail::maxHazardRate * dt);
+            return c->data()[i-1] * exp(- detail::maxHazardRate * dt);
         }
         template <class C>
         static Real maxValueAfter(Size i,
@@ -26,16 +26,52 @@
 
 #include <functional.hpp>
 #include <math/interpolations/linearinterpolation.hpp>
+#include <math/matrixutilities/qrdecomposition.hpp>
 #include <math/optimization/levenbergmarquardt.hpp>
 #include <termstructures/bootstraperror.hpp>
 #include <termstructures/bootstraphelper.hpp>
 #include <utilities/dataformatters.hpp>
 #include <algorithm>
+#include <type_traits>
 #include <utility>
 
 namespace QuantLib {
 
+namespace detail {
+
+    // whether the traits provide the derivatives used for the analytic Jacobian
+    template <class Traits, class Curve, class = void>
+    struct HasDiscountDerivatives : std::false_type {};
+
+    template <class Traits, class Curve>
+    struct HasDiscountDerivatives<
+        Traits, Curve,
+        std::void_t<decltype(Traits::discountDerivative(Time(), Real())),
+                    decltype(Traits::transformDirectDerivative(Real(), Size(),
+                                                               (const Curve*)nullptr))> >
+    : std::true_type {};
+
+}
+
 //! Global boostrapper, with additional restrictions
+/*! Unless an optimizer is passed, the error terms are minimized by
+    Levenberg-Marquardt with a Jacobian provided by the bootstrapper.
+    When all the alive helpers provide the derivatives of their
+    implied quotes (see BootstrapHelper::impliedQuoteDerivatives),
+    the traits provide the derivatives of the discount factors with
+    respect to the curve values (as Discount and ZeroYield do), and
+    the interpolation provides the derivatives of its values with
+    respect to the data (see Interpolation::yDerivatives), the
+    Jacobian is obtained analytically by chaining them; the helpers
+    are not repriced for each perturbed pillar.  Otherwise, or for
+    times after the last pillar, it falls back to finite differences
+    of the error terms.  The additional error terms, if any, are
+    always differentiated numerically.
+
+    The last Jacobian is kept and used for a few Newton steps when
+    the curve is recalculated, e.g., after a small market move; the
+    optimizer only runs if these don't reach the required accuracy.
+*/
 template <class Curve> class GlobalBootstrap {
     typedef typename Curve::traits_type Traits;             // ZeroYield, Discount, ForwardRate
     typedef typename Curve::interpolator_type Interpolator; // Linear, LogLinear, ...
@@ -70,7 +106,23 @@ template <class Curve> class GlobalBootstrap {
     void calculate() const;
 
   private:
+    class ErrorFunction : public CostFunction {
+      public:
+        explicit ErrorFunction(const GlobalBootstrap* bootstrap) : bootstrap_(bootstrap) {}
+        Array values(const Array& x) const override { return bootstrap_->errors(x); }
+        void jacobian(Matrix& jac, const Array& x) const override {
+            bootstrap_->jacobian(jac, x);
+        }
+      private:
+        const GlobalBootstrap* bootstrap_;
+    };
     void initialize() const;
+    void setCurve(const Array& x) const;
+    Array errors(const Array& x) const;
+    void jacobian(Matrix& jac, const Array& x) const;
+    bool analyticJacobian(Matrix& jac, const Array& x) const;
+    void numericalJacobian(Matrix& jac, const Array& x, Size firstRow) const;
+    bool newtonSteps(Array& x, Real accuracy) const;
     Curve *ts_;
     Real accuracy_;
     ext::shared_ptr<OptimizationMethod> optimizer_;
@@ -81,6 +133,7 @@ template <class Curve> class GlobalBootstrap {
     mutable bool initialized_ = false, validCurve_ = false;
     mutable Size firstHelper_, numberHelpers_;
     mutable Size firstAdditionalHelper_, numberAdditionalHelpers_;
+    mutable Matrix jacobian_;
 };
 
 // template definitions
@@ -115,7 +168,8 @@ template <class Curve> void GlobalBootstrap<Curve>::setup(Curve *ts) {
     // setup optimizer and EndCriteria
     Real accuracy = accuracy_ != Null<Real>() ? accuracy_ : ts_->accuracy_;
     if (!optimizer_) {
-        optimizer_ = ext::make_shared<LevenbergMarquardt>(accuracy, accuracy, accuracy);
+        // use the Jacobian provided by the error function, see below
+        optimizer_ = ext::make_shared<LevenbergMarquardt>(accuracy, accuracy, accuracy, true);
     }
     if (!endCriteria_) {
         endCriteria_ = ext::make_shared<EndCriteria>(1000, 10, accuracy, accuracy, accuracy);
@@ -205,6 +259,142 @@ template <class Curve> void GlobalBootstrap<Curve>::initialize() const {
     initialized_ = true;
 }
 
+template <class Curve> void GlobalBootstrap<Curve>::setCurve(const Array& x) const {
+    for (Size i = 0; i < x.size(); ++i) {
+        Traits::updateGuess(ts_->data_, Traits::transformDirect(x[i], i + 1, ts_), i + 1);
+    }
+    ts_->interpolation_.update();
+}
+
+template <class Curve> Array GlobalBootstrap<Curve>::errors(const Array& x) const {
+    setCurve(x);
+    std::vector<Real> result(numberHelpers_);
+    for (Size i = 0; i < numberHelpers_; ++i) {
+        result[i] = ts_->instruments_[firstHelper_ + i]->quote()->value() -
+                    ts_->instruments_[firstHelper_ + i]->impliedQuote();
+    }
+    if (additionalErrors_) {
+        Array tmp = additionalErrors_();
+        result.resize(numberHelpers_ + tmp.size());
+        for (Size i = 0; i < tmp.size(); ++i) {
+            result[numberHelpers_ + i] = tmp[i];
+        }
+    }
+    return Array(result.begin(), result.end());
+}
+
+template <class Curve>
+void GlobalBootstrap<Curve>::jacobian(Matrix& jac, const Array& x) const {
+    if (!analyticJacobian(jac, x))
+        numericalJacobian(jac, x, 0);
+    // kept for the Newton steps on recalculation
+    jacobian_ = jac;
+}
+
+template <class Curve>
+bool GlobalBootstrap<Curve>::analyticJacobian(Matrix& jac, const Array& x) const {
+    if constexpr (!detail::HasDiscountDerivatives<Traits, Curve>::value) {
+        return false;
+    } else {
+        setCurve(x);
+        // jumps are not accounted for below
+        if (!ts_->jumpTimes().empty())
+            return false;
+
+        // Traits::updateGuess might set the value at the reference
+        // date together with the first pillar (as ZeroYield does)
+        std::vector<Real> probe(2, 0.0);
+        Traits::updateGuess(probe, 1.0, 1);
+        const bool firstValueMoves = (probe[0] == 1.0);
+
+        Array transformDerivatives(x.size());
+        for (Size j = 0; j < x.size(); ++j)
+            transformDerivatives[j] = Traits::transformDirectDerivative(x[j], j + 1, ts_);
+
+        // chain the derivatives of the implied quotes with respect to
+        // the discount factors with those of the discount factors with
+        // respect to the curve values and of the latter with respect to x
+        const Time maxTime = ts_->times_.back();
+        std::vector<Time> times;
+        std::vector<Real> derivatives, weights;
+        for (Size i = 0; i < numberHelpers_; ++i) {
+            if (!ts_->instruments_[firstHelper_ + i]->impliedQuoteDerivatives(times, derivatives))
+                return false;
+            std::fill(jac.row_begin(i), jac.row_end(i), 0.0);
+            for (Size k = 0; k < times.size(); ++k) {
+                // the extrapolation doesn't use the interpolation only
+                if (times[k] > maxTime ||
+                    !ts_->interpolation_.yDerivatives(times[k], weights, true))
+                    return false;
+                // the error terms are market quote minus implied quote
+                Real f = -derivatives[k] *
+                         Traits::discountDerivative(times[k], ts_->interpolation_(times[k], true));
+                for (Size j = 0; j < x.size(); ++j)
+                    jac[i][j] += f * weights[j + 1] * transformDerivatives[j];
+                if (firstValueMoves)
+                    jac[i][0] += f * weights[0] * transformDerivatives[0];
+            }
+        }
+
+        if (additionalErrors_)
+            numericalJacobian(jac, x, numberHelpers_);
+        return true;
+    }
+}
+
+template <class Curve>
+void GlobalBootstrap<Curve>::numericalJacobian(Matrix& jac, const Array& x, Size firstRow) const {
+    // forward differences, with the same steps as the MINPACK
+    // implementation of Levenberg-Marquardt.  When only the rows
+    // of the additional errors are required, the helpers are not
+    // repriced.
+    Real accuracy = accuracy_ != Null<Real>() ? accuracy_ : ts_->accuracy_;
+    const Real eps = sqrt(std::max(accuracy, QL_EPSILON));
+    auto values = [&](const Array& y) {
+        if (firstRow == 0)
+            return errors(y);
+        setCurve(y);
+        return additionalErrors_();
+    };
+    Array e = values(x), xx(x);
+    for (Size j = 0; j < x.size(); ++j) {
+        Real h = x[j] == 0.0 ? eps : Real(eps * fabs(x[j]));
+        xx[j] = x[j] + h;
+        Array ep = values(xx);
+        xx[j] = x[j];
+        for (Size i = 0; i < ep.size(); ++i)
+            jac[firstRow + i][j] = (ep[i] - e[i]) / h;
+    }
+    setCurve(x);
+}
+
+template <class Curve>
+bool GlobalBootstrap<Curve>::newtonSteps(Array& x, Real accuracy) const {
+    // chord method: the Jacobian is not updated, which is good
+    // enough if the market didn't move much since it was calculated
+    const Size maxSteps = 5;
+    Array y = x, e = errors(y);
+    if (e.size() != jacobian_.rows())
+        return false;
+    Real error = sqrt(DotProduct(e, e));
+    for (Size k = 0; k < maxSteps; ++k) {
+        if (std::all_of(e.begin(), e.end(),
+                        [=](Real ei) { return fabs(ei) <= accuracy; })) {
+            x = y;
+            return true;
+        }
+        y -= qrSolve(jacobian_, e);
+        e = errors(y);
+        Real newError = sqrt(DotProduct(e, e));
+        if (!(newError < error))
+            break;
+        error = newError;
+    }
+    // the optimizer will start from the passed point
+    setCurve(x);
+    return false;
+}
+
 template <class Curve> void GlobalBootstrap<Curve>::calculate() const {
 
     // we might have to call initialize even if the curve is initialized
@@ -244,25 +434,7 @@ template <class Curve> void GlobalBootstrap<Curve>::calculate() const {
     }
 
     // setup cost function
-    SimpleCostFunction cost([&](const Array& x) {
-        for (Size i = 0; i < x.size(); ++i) {
-            Traits::updateGuess(ts_->data_, Traits::transformDirect(x[i], i + 1, ts_), i + 1);
-        }
-        ts_->interpolation_.update();
-        std::vector<Real> result(numberHelpers_);
-        for (Size i = 0; i < numberHelpers_; ++i) {
-            result[i] = ts_->instruments_[firstHelper_ + i]->quote()->value() -
-                        ts_->instruments_[firstHelper_ + i]->impliedQuote();
-        }
-        if (additionalErrors_) {
-            Array tmp = additionalErrors_();
-            result.resize(numberHelpers_ + tmp.size());
-            for (Size i = 0; i < tmp.size(); ++i) {
-                result[numberHelpers_ + i] = tmp[i];
-            }
-        }
-        return Array(result.begin(), result.end());
-    });
+    ErrorFunction cost(this);
 
     // setup guess
     const Size numberBounds = ts_->times_.size() - 1;
@@ -274,11 +446,19 @@ template <class Curve> void GlobalBootstrap<Curve>::calculate() const {
         guess[i] = Traits::transformInverse(ts_->data_[i + 1], i + 1, ts_);
     }
 
+    // try reusing the last Jacobian first
+    if (validCurve_ && jacobian_.columns() == numberBounds) {
+        Real accuracy = accuracy_ != Null<Real>() ? accuracy_ : ts_->accuracy_;
+        if (newtonSteps(guess, accuracy))
+            return;
+    }
+
     // setup problem
     NoConstraint noConstraint;
     Problem problem(cost, noConstraint, guess);
 
     // run optimization
+    setCurve(guess);
     EndCriteria::Type endType = optimizer_->minimize(problem, *endCriteria_);
 
     // check the end criteria
@@ -39,11 +39,11 @@ namespace QuantLib {
 
     Real SimpleQuoteVariables::transformDirect(Real x, Size i) const {
         const Real lb = detail::get(lowerBounds_, i, Null<Real>());
-        return lb == Null<Real>() ? x : std::exp(x) + lb;
+        return lb == Null<Real>() ? x : exp(x) + lb;
     }
 
     Real SimpleQuoteVariables::transformInverse(Real x, Size i) const {
         const Real lb = detail::get(lowerBounds_, i, Null<Real>());
-        return lb == Null<Real>() ? x : std::log(x - lb);
+        return lb == Null<Real>() ? x : log(x - lb);
     }
 }
@@ -79,7 +79,7 @@ namespace QuantLib {
         Real eps = 0.00001;
         for (Size i = 1; i < nTest; i++) {
             Real factorAt = this->seasonalityFactor(curveBaseDate+Period(i,Years));
-            QL_REQUIRE(std::fabs(factorAt-factorBase)<eps,"seasonality is inconsistent with inflation term structure, factors "
+            QL_REQUIRE(fabs(factorAt-factorBase)<eps,"seasonality is inconsistent with inflation term structure, factors "
                        << factorBase << " and later factor " << factorAt << ", " << i << " years later from inflation curve "
                        <<" with base date at " << curveBaseDate);
         }
@@ -153,7 +153,7 @@ namespace QuantLib {
             which = 0;
         } else {
             // days, weeks, months, years are the only time unit possibilities
-            Integer diffDays = std::abs(to - from);  // in days
+            Integer diffDays = abs(to - from);  // in days
             Integer dir = 1;
             if(from > to)dir = -1;
             Integer diff;
@@ -206,7 +206,7 @@ namespace QuantLib {
             Real seasonalityAt = factorAt / factorBase;
             std::pair<Date,Date> p = inflationPeriod(atDate,frequency());
             Time timeFromCurveBase = dc.yearFraction(curveBaseDate, p.first);
-            f = std::pow(seasonalityAt, 1/timeFromCurveBase);
+            f = pow(seasonalityAt, 1/timeFromCurveBase);
         }
         else {
             Rate factor1Ybefore = this->seasonalityFactor(atDate - Period(1,Years));
@@ -267,7 +267,7 @@ namespace QuantLib {
         if (isZeroRate) {
             std::pair<Date,Date> lim = inflationPeriod(curveBaseDate, Monthly);
             Time timeFromCurveBase = dc.yearFraction(lim.first, atDate);
-            f = std::pow(indexFactor, 1/timeFromCurveBase);
+            f = pow(indexFactor, 1/timeFromCurveBase);
         }
         else {
             QL_FAIL("Seasonal Kerkhof model is not defined on YoY rates");
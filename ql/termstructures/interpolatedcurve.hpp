@@ -42,6 +42,16 @@ namespace QuantLib {
       public:
         ~InterpolatedCurve() = default;
 
+        //! speeds up the search of the interval containing a given time
+        /*! See Interpolation::enableLocateIndex.  The setting is kept
+            when the interpolation is rebuilt, e.g., by a bootstrap.
+        */
+        void enableLocateIndex(bool b = true) {
+            locateIndex_ = b;
+            if (!interpolation_.empty())
+                interpolation_.enableLocateIndex(b);
+        }
+
       protected:
         //! \name Building
         //@{
@@ -65,7 +75,8 @@ namespace QuantLib {
         //! \name Copying
         //@{
         InterpolatedCurve(const InterpolatedCurve& c)
-        : times_(c.times_), data_(c.data_), interpolator_(c.interpolator_) {
+        : times_(c.times_), data_(c.data_), interpolator_(c.interpolator_),
+          locateIndex_(c.locateIndex_) {
             setupInterpolation();
         }
 
@@ -73,6 +84,7 @@ namespace QuantLib {
             times_ = c.times_;
             data_ = c.data_;
             interpolator_ = c.interpolator_;
+            locateIndex_ = c.locateIndex_;
             setupInterpolation();
             return *this;
         }
@@ -81,7 +93,8 @@ namespace QuantLib {
         //! \name Moving
         //@{
         InterpolatedCurve(InterpolatedCurve&& c) noexcept
-        : times_(std::move(c.times_)), data_(std::move(c.data_)), interpolator_(std::move(c.interpolator_)) {
+        : times_(std::move(c.times_)), data_(std::move(c.data_)), interpolator_(std::move(c.interpolator_)),
+          locateIndex_(c.locateIndex_) {
             setupInterpolation();
         }
 
@@ -89,6 +102,7 @@ namespace QuantLib {
             times_ = std::move(c.times_);
             data_ = std::move(c.data_);
             interpolator_ = std::move(c.interpolator_);
+            locateIndex_ = c.locateIndex_;
             setupInterpolation();
             return *this;
         }
@@ -117,6 +131,8 @@ namespace QuantLib {
             interpolation_ = interpolator_.interpolate(times_.begin(),
                                                        times_.end(),
                                                        data_.begin());
+            if (locateIndex_)
+                interpolation_.enableLocateIndex();
         }
         //@}
 
@@ -124,6 +140,7 @@ namespace QuantLib {
         mutable std::vector<Real> data_;
         mutable Interpolation interpolation_;
         Interpolator interpolator_;
+        bool locateIndex_ = false;
         // Usually, the maximum date is the one corresponding to the
         // last node. However, it might happen that a bit of
         // extrapolation is used by construction; for instance, when a
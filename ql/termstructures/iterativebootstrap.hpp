@@ -33,6 +33,7 @@
 #include <math/solvers1d/finitedifferencenewtonsafe.hpp>
 #include <math/solvers1d/brent.hpp>
 #include <utilities/dataformatters.hpp>
+#include <utility>
 
 namespace QuantLib {
 
@@ -50,7 +51,7 @@ namespace detail {
 
         // Set the initial value of the result to xMin and store the absolute bootstrap error at xMin
         Real result = xMin;
-        Real absError = std::abs(error(xMin));
+        Real absError = abs(error(xMin));
         Real minError = absError;
 
         // Step out to xMax
@@ -59,7 +60,7 @@ namespace detail {
 
             // Get absolute bootstrap error at updated x value
             xMin += stepSize;
-            absError = std::abs(error(xMin));
+            absError = abs(error(xMin));
 
             // If this absolute bootstrap error is less than the minimum, update result and minError
             if (absError < minError) {
@@ -91,6 +92,17 @@ namespace detail {
                                   result.
             \param dontThrowSteps If \p dontThrow is \c true, this gives the number of steps to use when searching
                                   for a fallback curve pillar value that gives the minimum bootstrap helper error.
+            \param maxEvaluations Maximum number of function evaluations for each root search.
+            \param incremental    If set to \c true, a recalculation only bootstraps the pillars starting from
+                                  the first one whose helper notified a change, using the previous values as
+                                  guesses.  This is only done when the interpolation is local and the pillars
+                                  are the latest relevant dates of the helpers, so that the curve before the
+                                  changed helper is not affected.  Curves moving with the evaluation date are
+                                  initialized, and thus fully bootstrapped, on each recalculation; the mode is
+                                  useful for curves with a fixed reference date.
+
+            \warning In incremental mode, the curve is assumed to change only when its helpers do; changes in
+                     other observables of the curve (e.g., its jumps) are not detected.
         */
         IterativeBootstrap(Real accuracy = Null<Real>(),
                            Real minValue = Null<Real>(),
@@ -100,11 +112,22 @@ namespace detail {
                            Real minFactor = 2.0,
                            bool dontThrow = false,
                            Size dontThrowSteps = 10,
-                           Size maxEvaluations = MAX_FUNCTION_EVALUATIONS);
+                           Size maxEvaluations = MAX_FUNCTION_EVALUATIONS,
+                           bool incremental = false);
         void setup(Curve* ts);
         void calculate() const;
       private:
+        struct HelperObserver : public Observer {
+            explicit HelperObserver(ext::shared_ptr<typename Traits::helper> helper)
+            : helper_(std::move(helper)) {
+                registerWith(helper_);
+            }
+            void update() override { changed_ = true; }
+            ext::shared_ptr<typename Traits::helper> helper_;
+            bool changed_ = true;
+        };
         void initialize() const;
+        Size firstChangedPillar() const;
         Real accuracy_;
         Real minValue_, maxValue_;
         Size maxAttempts_;
@@ -112,6 +135,7 @@ namespace detail {
         Real minFactor_;
         bool dontThrow_;
         Size dontThrowSteps_;
+        bool incremental_;
         Curve* ts_;
         Size n_ = 0;
         Brent firstSolver_;
@@ -120,6 +144,7 @@ namespace detail {
         mutable Size firstAliveHelper_ = 0, alive_ = 0;
         mutable std::vector<Real> previousData_;
         mutable std::vector<ext::shared_ptr<BootstrapError<Curve> > > errors_;
+        mutable std::vector<ext::shared_ptr<HelperObserver> > observers_;
     };
 
 
@@ -134,10 +159,12 @@ namespace detail {
                                                   Real minFactor,
                                                   bool dontThrow,
                                                   Size dontThrowSteps,
-                                                  Size maxEvaluations)
+                                                  Size maxEvaluations,
+                                                  bool incremental)
     : accuracy_(accuracy), minValue_(minValue), maxValue_(maxValue), maxAttempts_(maxAttempts),
       maxFactor_(maxFactor), minFactor_(minFactor), dontThrow_(dontThrow),
-      dontThrowSteps_(dontThrowSteps), ts_(nullptr), loopRequired_(Interpolator::global) {
+      dontThrowSteps_(dontThrowSteps), incremental_(incremental), ts_(nullptr),
+      loopRequired_(Interpolator::global) {
         QL_REQUIRE(maxFactor_ >= 1.0, "Expected that maxFactor would be at least 1.0 but got " << maxFactor_);
         QL_REQUIRE(minFactor_ >= 1.0, "Expected that minFactor would be at least 1.0 but got " << minFactor_);
         firstSolver_.setMaxEvaluations(maxEvaluations);
@@ -152,6 +179,13 @@ namespace detail {
         for (Size j=0; j<n_; ++j)
             ts_->registerWithObservables(ts_->instruments_[j]);
 
+        if (incremental_) {
+            observers_.clear();
+            for (Size j=0; j<n_; ++j)
+                observers_.push_back(
+                    ext::make_shared<HelperObserver>(ts_->instruments_[j]));
+        }
+
         // do not initialize yet: instruments could be invalid here
         // but valid later when bootstrapping is actually required
     }
@@ -161,6 +195,12 @@ namespace detail {
         // ensure helpers are sorted
         std::sort(ts_->instruments_.begin(), ts_->instruments_.end(),
                   detail::BootstrapHelperSorter());
+        // keep the observers in the same order
+        std::sort(observers_.begin(), observers_.end(),
+                  [](const ext::shared_ptr<HelperObserver>& o1,
+                     const ext::shared_ptr<HelperObserver>& o2) {
+                      return detail::BootstrapHelperSorter()(o1->helper_, o2->helper_);
+                  });
         // skip expired helpers
         Date firstDate = Traits::initialDate(ts_);
         QL_REQUIRE(ts_->instruments_[n_-1]->pillarDate()>firstDate,
@@ -229,6 +269,20 @@ namespace detail {
         initialized_ = true;
     }
 
+    template <class Curve>
+    Size IterativeBootstrap<Curve>::firstChangedPillar() const {
+        // the helper of pillar i only depends on the values up to i,
+        // unless the convergence loop is needed
+        if (!incremental_ || !validCurve_ || loopRequired_)
+            return 1;
+        for (Size i=1; i<=alive_; ++i) {
+            if (observers_[firstAliveHelper_+i-1]->changed_)
+                return i;
+        }
+        // something else changed; play it safe
+        return 1;
+    }
+
     template <class Curve>
     void IterativeBootstrap<Curve>::calculate() const {
 
@@ -237,9 +291,15 @@ namespace detail {
         // with evaluation date change.
         // anyway it makes little sense to use date relative helpers with a
         // non-moving curve if the evaluation date changes
-        if (!initialized_ || ts_->moving_)
+        bool reinitialized = !initialized_ || ts_->moving_;
+        if (reinitialized)
             initialize();
 
+        // in incremental mode, the pillars before the first changed
+        // helper are kept; not after a new initialization, though,
+        // since their dates and times might have moved
+        Size firstPillar = reinitialized ? 1 : firstChangedPillar();
+
         // setup helpers
         for (Size j=firstAliveHelper_; j<n_; ++j) {
             const ext::shared_ptr<typename Traits::helper>& helper =
@@ -272,7 +332,7 @@ namespace detail {
             std::vector<Real> maxValues(alive_+1, Null<Real>());
             std::vector<Size> attempts(alive_+1, 1);
 
-            for (Size i=1; i<=alive_; ++i) { // pillar loop
+            for (Size i=firstPillar; i<=alive_; ++i) { // pillar loop
 
                 // shorter aliases for readability and to avoid duplication
                 Real& min = minValues[i];
@@ -367,9 +427,9 @@ namespace detail {
                  break;
 
             // exit condition
-            Real change = std::fabs(data[1]-previousData_[1]);
+            Real change = fabs(data[1]-previousData_[1]);
             for (Size i=2; i<=alive_; ++i)
-                change = std::max(change, std::fabs(data[i]-previousData_[i]));
+                change = std::max(change, fabs(data[i]-previousData_[i]));
             if (change<=accuracy)  // convergence reached
                 break;
 
@@ -387,6 +447,8 @@ namespace detail {
             validData = true;
         }
         validCurve_ = true;
+        for (auto& observer : observers_)
+            observer->changed_ = false;
     }
 
 }
@@ -33,7 +33,7 @@ namespace QuantLib {
         if (tMax==tMin)
             return instantaneousVolatility(tMax, T);
         QL_REQUIRE(tMax>tMin, "tMax must be > tMin");
-        return std::sqrt(variance(tMin, tMax, T)/(tMax-tMin));
+        return sqrt(variance(tMin, tMax, T)/(tMax-tMin));
     }
 
     Real AbcdFunction::variance(Time tMin, Time tMax, Time T) const {
@@ -59,7 +59,7 @@ namespace QuantLib {
 
     // INSTANTANEOUS
     Real AbcdFunction::instantaneousVolatility(Time u, Time T) const {
-        return std::sqrt(instantaneousVariance(u, T));
+        return sqrt(instantaneousVariance(u, T));
     }
 
     Real AbcdFunction::instantaneousVariance(Time u, Time T) const {
@@ -78,7 +78,7 @@ namespace QuantLib {
             return t*(v*v+v*b_*S+v*b_*T-v*b_*t+b_*b_*S*T-0.5*b_*b_*t*(S+T)+b_*b_*t*t/3.0);
         }
 
-        Real k1=std::exp(c_*t), k2=std::exp(c_*S), k3=std::exp(c_*T);
+        Real k1=exp(c_*t), k2=exp(c_*S), k3=exp(c_*T);
 
         return (b_*b_*(-1 - 2*c_*c_*S*T - c_*(S + T)
                      + k1*k1*(1 + c_*(S + T - 2*t) + 2*c_*c_*(S - t)*(T - t)))
@@ -314,7 +314,7 @@ namespace QuantLib {
             if (idx != null) {
 
                 const Volatility vol = calibrationSet_[idx].second->value();
-                const Real stdDev = vol*std::sqrt(expiryTime);
+                const Real stdDev = vol*sqrt(expiryTime);
 
                 const BlackCalculator calculator(
                     optionType, strikes_[j], fwd, stdDev, discount);
@@ -324,7 +324,7 @@ namespace QuantLib {
 
                 marketNPVs[k] = npv/(discount*fwd);
                 marketVegas[k] = vega/(discount*fwd);
-                lnMarketStrikes[k++] = std::log(strikes_[j]/fwd);
+                lnMarketStrikes[k++] = log(strikes_[j]/fwd);
             }
         }
 
@@ -353,8 +353,8 @@ namespace QuantLib {
         mesher_ =
             ext::make_shared<FdmMesherComposite>(
                 ext::make_shared<Concentrating1dMesher>(
-                    std::log(minStrike()/spot_->value()),
-                    std::log(maxStrike()/spot_->value()),
+                    log(minStrike()/spot_->value()),
+                    log(maxStrike()/spot_->value()),
                     nGridPoints_,
                     std::pair<Real, Real>(0.0, 0.025)));
 
@@ -374,7 +374,7 @@ namespace QuantLib {
         Array npvCalls(nGridPoints_);
 
         for (Size i=0; i < nGridPoints_; ++i) {
-            const Real strike = std::exp(gridPoints_[i]);
+            const Real strike = exp(gridPoints_[i]);
             npvPuts[i] = PlainVanillaPayoff(Option::Put, strike)(1.0);
             npvCalls[i]= PlainVanillaPayoff(Option::Call, strike)(1.0);
         }
@@ -414,7 +414,7 @@ namespace QuantLib {
                     qTS_->discount(expiryTimes_[i])/rTS_->discount(expiryTimes_[i]);
 
                 for (Size j=0; j < vegaDiffs.size(); ++j)
-                    vegaDiffs[j] = std::fabs(
+                    vegaDiffs[j] = fabs(
                         (fwd > gridInFwd_[j])? vegaPutDiffs[j] : vegaCallDiffs[j]);
               }
               break;
@@ -485,7 +485,7 @@ namespace QuantLib {
         Real strike, const TimeValueCacheType::const_iterator& f) const {
 
         const Real fwd = std::get<0>(f->second);
-        const Real k = std::log(strike / fwd);
+        const Real k = log(strike / fwd);
 
         const Real s = std::max(gridPoints_[1],
             std::min(*(gridPoints_.end()-2), k));
@@ -582,7 +582,7 @@ namespace QuantLib {
         Array localVol = Sqrt(2*dCdT/d2CdK2);
 
         for (Size i=1; i < localVol.size()-1; ++i)
-            if (!std::isfinite(localVol[i]) || localVol[i] < 0.0)
+            if (!isfinite(localVol[i]) || localVol[i] < 0.0)
                 localVol[i] = 0.25;
 
         return localVol;
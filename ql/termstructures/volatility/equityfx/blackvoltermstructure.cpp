@@ -64,21 +64,21 @@ namespace QuantLib {
             if (time1==0.0) {
                 Time epsilon = 1.0e-5;
                 Real var = blackVarianceImpl(epsilon, strike);
-                return std::sqrt(var/epsilon);
+                return sqrt(var/epsilon);
             } else {
                 Time epsilon = std::min<Time>(1.0e-5, time1);
                 Real var1 = blackVarianceImpl(time1-epsilon, strike);
                 Real var2 = blackVarianceImpl(time1+epsilon, strike);
                 QL_ENSURE(var2>=var1,
                           "variances must be non-decreasing");
-                return std::sqrt((var2-var1)/(2*epsilon));
+                return sqrt((var2-var1)/(2*epsilon));
             }
         } else {
             Real var1 = blackVarianceImpl(time1, strike);
             Real var2 = blackVarianceImpl(time2, strike);
             QL_ENSURE(var2 >= var1,
                       "variances must be non-decreasing");
-            return std::sqrt((var2-var1)/(time2-time1));
+            return sqrt((var2-var1)/(time2-time1));
         }
     }
 
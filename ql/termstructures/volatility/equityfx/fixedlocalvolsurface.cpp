@@ -113,6 +113,13 @@ namespace QuantLib {
             }
     }
 
+    void FixedLocalVolSurface::updateInterpolation(Size timeIndex) {
+        QL_REQUIRE(timeIndex < times_.size(),
+                   "time index " << timeIndex << " out of range");
+        localVolInterpol_[timeIndex].update();
+        notifyObservers();
+    }
+
     Date FixedLocalVolSurface::maxDate() const {
         return maxDate_;
     }
@@ -77,6 +77,13 @@ namespace QuantLib {
             notifyObservers();
         }
 
+        //! recalculates the interpolation of the given time slice
+        /*! to be called after the local volatilities or strikes of
+            this slice have been modified in place.  This is cheaper
+            than setInterpolation(), which rebuilds all time slices.
+        */
+        void updateInterpolation(Size timeIndex);
+
       protected:
         Volatility localVolImpl(Time t, Real strike) const override;
 
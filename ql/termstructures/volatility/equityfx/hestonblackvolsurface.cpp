@@ -38,7 +38,7 @@ namespace QuantLib {
                         Volatility vol, Real discount, Real npv) {
 
             return blackFormula(optionType, strike, forward,
-                                std::max(0.0, vol)*std::sqrt(maturity),
+                                std::max(0.0, vol)*sqrt(maturity),
                                 discount)-npv;
         }
     }
@@ -91,11 +91,11 @@ namespace QuantLib {
         const Real npv = hestonEngine.priceVanillaPayoff(payoff, t);
 
         const Real theta = hestonModel_->theta();
-        if (npv <= 0.0) return std::sqrt(theta);
+        if (npv <= 0.0) return sqrt(theta);
 
         Brent solver;
         solver.setMaxEvaluations(10000);
-        const Volatility guess = std::sqrt(theta);
+        const Volatility guess = sqrt(theta);
         constexpr double accuracy = std::numeric_limits<double>::epsilon();
 
         return solver.solve(
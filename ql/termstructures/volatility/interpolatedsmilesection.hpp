@@ -104,7 +104,7 @@ namespace QuantLib {
         const VolatilityType type,
         const Real shift)
     : SmileSection(timeToExpiry, dc, type, shift),
-      exerciseTimeSquareRoot_(std::sqrt(exerciseTime())), strikes_(std::move(strikes)),
+      exerciseTimeSquareRoot_(sqrt(exerciseTime())), strikes_(std::move(strikes)),
       stdDevHandles_(stdDevHandles), atmLevel_(std::move(atmLevel)), vols_(stdDevHandles.size()) {
         for (auto& stdDevHandle : stdDevHandles_)
             LazyObject::registerWith(stdDevHandle);
@@ -126,7 +126,7 @@ namespace QuantLib {
         const VolatilityType type,
         const Real shift)
     : SmileSection(timeToExpiry, dc, type, shift),
-      exerciseTimeSquareRoot_(std::sqrt(exerciseTime())), strikes_(std::move(strikes)),
+      exerciseTimeSquareRoot_(sqrt(exerciseTime())), strikes_(std::move(strikes)),
       stdDevHandles_(stdDevs.size()), vols_(stdDevs.size()) {
         // fill dummy handles to allow generic handle-based
         // computations later on
@@ -153,7 +153,7 @@ namespace QuantLib {
         const VolatilityType type,
         const Real shift)
     : SmileSection(d, dc, referenceDate, type, shift),
-      exerciseTimeSquareRoot_(std::sqrt(exerciseTime())), strikes_(std::move(strikes)),
+      exerciseTimeSquareRoot_(sqrt(exerciseTime())), strikes_(std::move(strikes)),
       stdDevHandles_(stdDevHandles), atmLevel_(std::move(atmLevel)), vols_(stdDevHandles.size()) {
         for (auto& stdDevHandle : stdDevHandles_)
             LazyObject::registerWith(stdDevHandle);
@@ -176,7 +176,7 @@ namespace QuantLib {
         const VolatilityType type,
         const Real shift)
     : SmileSection(d, dc, referenceDate, type, shift),
-      exerciseTimeSquareRoot_(std::sqrt(exerciseTime())), strikes_(std::move(strikes)),
+      exerciseTimeSquareRoot_(sqrt(exerciseTime())), strikes_(std::move(strikes)),
       stdDevHandles_(stdDevs.size()), vols_(stdDevs.size()) {
         //fill dummy handles to allow generic handle-based
         // computations later on
@@ -194,7 +194,7 @@ namespace QuantLib {
                     QL_REQUIRE(-cp0 / c0 > 0.0, "dummy"); // this is caught
                                                           // below
                     cFct = ext::make_shared<cFunction>(
-                        -cp0 / c0, std::log(c0) - cp0 / c0 * k0);
+                        -cp0 / c0, log(c0) - cp0 / c0 * k0);
                 } else {
                     sHelper sh(k0, c0, cp0);
                     Real s;
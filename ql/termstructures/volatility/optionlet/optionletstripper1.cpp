@@ -147,7 +147,7 @@ namespace QuantLib {
                         optionletStDevs_[i][j], accuracy_, maxIter_);
                   } else if (volatilityType_ == Normal) {
                     optionletStDevs_[i][j] =
-                        std::sqrt(optionletTimes_[i]) *
+                        sqrt(optionletTimes_[i]) *
                         bachelierBlackFormulaImpliedVol(
                             optionletType, strikes[j], atmOptionletRate_[i],
                             optionletTimes_[i], optionletPrices_[i][j],
@@ -170,7 +170,7 @@ namespace QuantLib {
                             "\n error:   " << e.what());
                 }
                 optionletVolatilities_[i][j] = optionletStDevs_[i][j] /
-                                                std::sqrt(optionletTimes_[i]);
+                                                sqrt(optionletTimes_[i]);
             }
         }
 
@@ -49,7 +49,7 @@ namespace QuantLib {
         std::vector< Real > stddevs;
         stddevs.reserve(optionletStrikes.size());
         for (Real optionletStrike : optionletStrikes) {
-            stddevs.push_back(volatilityImpl(t, optionletStrike) * std::sqrt(t));
+            stddevs.push_back(volatilityImpl(t, optionletStrike) * sqrt(t));
         }
         // Extrapolation may be a problem with splines, but since minStrike()
         // and maxStrike() are set, we assume that no one will use stddevs for
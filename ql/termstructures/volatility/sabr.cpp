@@ -30,6 +30,77 @@
 
 namespace QuantLib {
 
+    namespace {
+        // Hagan et al. expansions with the strike-independent terms
+        // computed once, so that whole strike grids can be evaluated
+        // without repeating them
+        class SabrVolatilityKernel {
+          public:
+            SabrVolatilityKernel(Rate forward,
+                                 Time expiryTime,
+                                 Real alpha,
+                                 Real beta,
+                                 Real nu,
+                                 Real rho,
+                                 bool normal)
+            : forward_(forward), expiryTime_(expiryTime), alpha_(alpha),
+              rho_(rho), halfBeta_(beta / 2.0), oneMinusBeta_(1.0 - beta),
+              oneMinusBeta2_(oneMinusBeta_ * oneMinusBeta_), nuOverAlpha_(nu / alpha),
+              alpha2Term_(normal ? -1.0 * beta * (2 - beta) * alpha * alpha
+                                 : oneMinusBeta2_ * alpha * alpha),
+              rhoTerm_(0.25 * rho * beta * nu * alpha),
+              nuTerm_((2.0 - 3.0 * rho * rho) * (nu * nu / 24.0)),
+              halfRho_(0.5 * rho), rho2Term_(3.0 * rho * rho - 2.0),
+              normal_(normal) {}
+
+            Real operator()(Rate strike) const {
+                const Real A = pow(forward_ * strike, oneMinusBeta_);
+                const Real sqrtA = sqrt(A);
+                Real logM;
+                if (!close(forward_, strike))
+                    logM = log(forward_ / strike);
+                else {
+                    const Real epsilon = (forward_ - strike) / strike;
+                    logM = epsilon - .5 * epsilon * epsilon;
+                }
+                const Real z = nuOverAlpha_ * sqrtA * logM;
+                const Real B = 1.0 - 2.0 * rho_ * z + z * z;
+                const Real C = oneMinusBeta2_ * logM * logM;
+                const Real tmp = (sqrt(B) + z - rho_) / (1.0 - rho_);
+                const Real xx = log(tmp);
+                const Real E_2 = 1.0 + C / 24.0 + C * C / 1920.0;
+                const Real d = 1.0 + expiryTime_ *
+                    (alpha2Term_ / (24.0 * A) + rhoTerm_ / sqrtA + nuTerm_);
+
+                Real multiplier;
+                // computations become precise enough if the square of z worth
+                // slightly more than the precision machine (hence the m)
+                static const Real m = 10;
+                if (fabs(z * z) > QL_EPSILON * m)
+                    multiplier = z / xx;
+                else {
+                    multiplier = 1.0 - halfRho_ * z - rho2Term_ * z * z / 12.0;
+                }
+
+                if (normal_) {
+                    const Real D = logM * logM;
+                    const Real E_1 = (1.0 + D / 24.0 + D * D / 1920.0);
+                    const Real E = E_1 / E_2;
+                    const Real F = alpha_ * pow(forward_ * strike, halfBeta_);
+                    return F * E * multiplier * d;
+                } else {
+                    return (alpha_ / (sqrtA * E_2)) * multiplier * d;
+                }
+            }
+
+          private:
+            Real forward_, expiryTime_, alpha_, rho_, halfBeta_;
+            Real oneMinusBeta_, oneMinusBeta2_, nuOverAlpha_;
+            Real alpha2Term_, rhoTerm_, nuTerm_, halfRho_, rho2Term_;
+            bool normal_;
+        };
+    }
+
     Real unsafeSabrLogNormalVolatility(
                               Rate strike,
                               Rate forward,
@@ -38,37 +109,8 @@ namespace QuantLib {
                               Real beta,
                               Real nu,
                               Real rho) {
-        const Real oneMinusBeta = 1.0-beta;
-        const Real A = std::pow(forward*strike, oneMinusBeta);
-        const Real sqrtA= std::sqrt(A);
-        Real logM;
-        if (!close(forward, strike))
-            logM = std::log(forward/strike);
-        else {
-            const Real epsilon = (forward-strike)/strike;
-            logM = epsilon - .5 * epsilon * epsilon ;
-        }
-        const Real z = (nu/alpha)*sqrtA*logM;
-        const Real B = 1.0-2.0*rho*z+z*z;
-        const Real C = oneMinusBeta*oneMinusBeta*logM*logM;
-        const Real tmp = (std::sqrt(B)+z-rho)/(1.0-rho);
-        const Real xx = std::log(tmp);
-        const Real D = sqrtA*(1.0+C/24.0+C*C/1920.0);
-        const Real d = 1.0 + expiryTime *
-            (oneMinusBeta*oneMinusBeta*alpha*alpha/(24.0*A)
-                                + 0.25*rho*beta*nu*alpha/sqrtA
-                                    +(2.0-3.0*rho*rho)*(nu*nu/24.0));
-
-        Real multiplier;
-        // computations become precise enough if the square of z worth
-        // slightly more than the precision machine (hence the m)
-        static const Real m = 10;
-        if (std::fabs(z*z)>QL_EPSILON * m)
-            multiplier = z/xx;
-        else {
-            multiplier = 1.0 - 0.5*rho*z - (3.0*rho*rho-2.0)*z*z/12.0;
-        }
-        return (alpha/D)*multiplier*d;
+        return SabrVolatilityKernel(forward, expiryTime, alpha, beta, nu, rho,
+                                    false)(strike);
     }
 
     Real unsafeShiftedSabrVolatility(Rate strike,
@@ -89,42 +131,140 @@ namespace QuantLib {
 
     Real unsafeSabrNormalVolatility(
         Rate strike, Rate forward, Time expiryTime, Real alpha, Real beta, Real nu, Real rho) {
-        const Real oneMinusBeta = 1.0 - beta;
-        const Real minusBeta = -1.0 * beta;
-        const Real A = std::pow(forward * strike, oneMinusBeta);
-        const Real sqrtA = std::sqrt(A);
-        Real logM;
-        if (!close(forward, strike))
-            logM = std::log(forward / strike);
-        else {
-            const Real epsilon = (forward - strike) / strike;
-            logM = epsilon - .5 * epsilon * epsilon;
-        }
-        const Real z = (nu / alpha) * sqrtA * logM;
-        const Real B = 1.0 - 2.0 * rho * z + z * z;
-        const Real C = oneMinusBeta * oneMinusBeta * logM * logM;
-        const Real D = logM * logM;
-        const Real tmp = (std::sqrt(B) + z - rho) / (1.0 - rho);
-        const Real xx = std::log(tmp);
-        const Real E_1 = (1.0 + D / 24.0 + D * D / 1920.0);
-        const Real E_2 = (1.0 + C / 24.0 + C * C / 1920.0);
-        const Real E = E_1 / E_2;
-        const Real d = 1.0 + expiryTime * (minusBeta * (2 - beta) * alpha * alpha / (24.0 * A) +
-                                0.25 * rho * beta * nu * alpha / sqrtA +
-                                (2.0 - 3.0 * rho * rho) * (nu * nu / 24.0));
-
-        Real multiplier;
-        // computations become precise enough if the square of z worth
-        // slightly more than the precision machine (hence the m)
-        static const Real m = 10;
-        if (std::fabs(z * z) > QL_EPSILON * m)
-            multiplier = z / xx;
-        else {
-            multiplier = 1.0 - 0.5 * rho * z - (3.0 * rho * rho - 2.0) * z * z / 12.0;
+        return SabrVolatilityKernel(forward, expiryTime, alpha, beta, nu, rho,
+                                    true)(strike);
+    }
+
+    void unsafeShiftedSabrVolatilities(const Rate* strikes,
+                                       Volatility* volatilities,
+                                       Size n,
+                                       Rate forward,
+                                       Time expiryTime,
+                                       Real alpha,
+                                       Real beta,
+                                       Real nu,
+                                       Real rho,
+                                       Real shift,
+                                       VolatilityType volatilityType) {
+        const SabrVolatilityKernel kernel(forward + shift, expiryTime,
+                                          alpha, beta, nu, rho,
+                                          volatilityType == VolatilityType::Normal);
+        for (Size i = 0; i < n; ++i)
+            volatilities[i] = kernel(strikes[i] + shift);
+    }
+
+    namespace {
+        // derivatives of the expansions above with respect to alpha,
+        // beta, nu and rho, using the same notation.  Both share z, the
+        // multiplier and most of the time correction d; the remaining
+        // prefactor is alpha/(sqrt(A)*E_2) in the lognormal and
+        // alpha*(F*K)^(beta/2)*E_1/E_2 in the normal case.
+        Array unsafeSabrVolatilityGradient(Rate strike,
+                                           Rate forward,
+                                           Time expiryTime,
+                                           Real alpha,
+                                           Real beta,
+                                           Real nu,
+                                           Real rho,
+                                           bool normal) {
+            const Real oneMinusBeta = 1.0 - beta;
+            const Real logFK = log(forward * strike);
+            const Real A = pow(forward * strike, oneMinusBeta);
+            const Real sqrtA = sqrt(A);
+            Real logM;
+            if (!close(forward, strike))
+                logM = log(forward / strike);
+            else {
+                const Real epsilon = (forward - strike) / strike;
+                logM = epsilon - .5 * epsilon * epsilon;
+            }
+            const Real z = (nu / alpha) * sqrtA * logM;
+            const Real sqrtB = sqrt(1.0 - 2.0 * rho * z + z * z);
+            const Real C = oneMinusBeta * oneMinusBeta * logM * logM;
+            const Real E_2 = 1.0 + C / 24.0 + C * C / 1920.0;
+            const Real dE_2dBeta =
+                -(1.0 / 24.0 + C / 960.0) * 2.0 * oneMinusBeta * logM * logM;
+
+            Real multiplier, dMultiplierdZ, dMultiplierdRho;
+            static const Real m = 10;
+            if (fabs(z * z) > QL_EPSILON * m) {
+                const Real xx = log((sqrtB + z - rho) / (1.0 - rho));
+                const Real dxxdRho =
+                    (-z / sqrtB - 1.0) / (sqrtB + z - rho) + 1.0 / (1.0 - rho);
+                multiplier = z / xx;
+                dMultiplierdZ = 1.0 / xx - z / (xx * xx * sqrtB);
+                dMultiplierdRho = -z / (xx * xx) * dxxdRho;
+            } else {
+                multiplier = 1.0 - 0.5 * rho * z - (3.0 * rho * rho - 2.0) * z * z / 12.0;
+                dMultiplierdZ = -0.5 * rho - (3.0 * rho * rho - 2.0) * z / 6.0;
+                dMultiplierdRho = -0.5 * z - 0.5 * rho * z * z;
+            }
+            const Real dMultiplier[] = {
+                -dMultiplierdZ * z / alpha,
+                -0.5 * dMultiplierdZ * z * logFK,
+                dMultiplierdZ * sqrtA * logM / alpha,
+                dMultiplierdRho
+            };
+
+            // d = 1 + T*(a + b + c), only a depends on the volatility type
+            Real a, dadBeta;
+            if (normal) {
+                a = -beta * (2.0 - beta) * alpha * alpha / (24.0 * A);
+                dadBeta = -alpha * alpha / (24.0 * A) *
+                          (2.0 - 2.0 * beta + beta * (2.0 - beta) * logFK);
+            } else {
+                a = oneMinusBeta * oneMinusBeta * alpha * alpha / (24.0 * A);
+                dadBeta = alpha * alpha / (24.0 * A) *
+                          (oneMinusBeta * oneMinusBeta * logFK - 2.0 * oneMinusBeta);
+            }
+            const Real b = 0.25 * rho * beta * nu * alpha / sqrtA;
+            const Real c = (2.0 - 3.0 * rho * rho) * (nu * nu / 24.0);
+            const Real d = 1.0 + expiryTime * (a + b + c);
+            const Real dd[] = {
+                expiryTime * (2.0 * a / alpha + 0.25 * rho * beta * nu / sqrtA),
+                expiryTime * (dadBeta
+                              + 0.25 * rho * nu * alpha * (1.0 + 0.5 * beta * logFK) / sqrtA),
+                expiryTime * (0.25 * rho * beta * alpha / sqrtA
+                              + (2.0 - 3.0 * rho * rho) * nu / 12.0),
+                expiryTime * (0.25 * beta * nu * alpha / sqrtA - 0.25 * rho * nu * nu)
+            };
+
+            Real prefactor;
+            if (normal) {
+                const Real D = logM * logM;
+                const Real E_1 = 1.0 + D / 24.0 + D * D / 1920.0;
+                prefactor = alpha * pow(forward * strike, beta / 2.0) * E_1 / E_2;
+            } else {
+                prefactor = alpha / (sqrtA * E_2);
+            }
+            const Real dPrefactor[] = {
+                prefactor / alpha,
+                prefactor * (0.5 * logFK - dE_2dBeta / E_2),
+                0.0,
+                0.0
+            };
+
+            Array gradient(4);
+            for (Size i = 0; i < 4; ++i)
+                gradient[i] = dPrefactor[i] * multiplier * d
+                              + prefactor * dMultiplier[i] * d
+                              + prefactor * multiplier * dd[i];
+            return gradient;
         }
-        const Real F = alpha * std::pow(forward * strike, beta / 2.0);
+    }
 
-       return F * E * multiplier * d;
+    Array unsafeShiftedSabrVolatilityGradient(Rate strike,
+                                              Rate forward,
+                                              Time expiryTime,
+                                              Real alpha,
+                                              Real beta,
+                                              Real nu,
+                                              Real rho,
+                                              Real shift,
+                                              VolatilityType volatilityType) {
+        return unsafeSabrVolatilityGradient(strike + shift, forward + shift, expiryTime,
+                                            alpha, beta, nu, rho,
+                                            volatilityType == VolatilityType::Normal);
     }
 
      Real unsafeSabrVolatility(Rate strike,
@@ -200,31 +340,31 @@ namespace QuantLib {
             Real F, alpha, beta, nu, rho, t;
 
             Real y(Real k) const {
-                return -1.0/(1.0-beta)*(std::pow(F,1-beta)-std::pow(k,1-beta));
+                return -1.0/(1.0-beta)*(pow(F,1-beta)-pow(k,1-beta));
             }
 
             Real Dint(Real k) const {
-                return 1/nu*std::log( ( std::sqrt(1+2*rho*nu/alpha*y(k)
+                return 1/nu*log( ( sqrt(1+2*rho*nu/alpha*y(k)
                     + squared(nu/alpha*y(k)) )
                     - rho - nu/alpha*y(k) ) / (1-rho) );
             }
 
             Real D(Real k) const {
-                return std::sqrt(alpha*alpha+2*alpha*rho*nu*y(k)
-                    + squared(nu*y(k)))*std::pow(k,beta);
+                return sqrt(alpha*alpha+2*alpha*rho*nu*y(k)
+                    + squared(nu*y(k)))*pow(k,beta);
             }
 
             Real omega0(Real k) const {
-                return std::log(F/k)/Dint(k);
+                return log(F/k)/Dint(k);
             }
 
             Real operator()(Real k) const {
                 const Real m = F/k;
                 if (m > 1.0025 || m < 0.9975) {
                     return omega0(k)*(1+0.25*rho*nu*alpha*
-                       (std::pow(k,beta)-std::pow(F,beta))/(k-F)*t)
-                       -omega0(k)/squared(Dint(k))*(std::log(
-                           omega0(k)) + 0.5*std::log((F*k/(D(F)*D(k))) ))*t;
+                       (pow(k,beta)-pow(F,beta))/(k-F)*t)
+                       -omega0(k)/squared(Dint(k))*(log(
+                           omega0(k)) + 0.5*log((F*k/(D(F)*D(k))) ))*t;
                 }
                 else {
                     return taylorExpansion(k);
@@ -236,14 +376,14 @@ namespace QuantLib {
                 const Real alpha2 = alpha*alpha;
                 const Real rho2 = rho*rho;
                 return
-                    (alpha*std::pow(F,-3 + beta)*(alpha2*squared(-1 + beta)*std::pow(F,2*beta)*t + 6*alpha*beta*nu*std::pow(F,1 + beta)*rho*t +
+                    (alpha*pow(F,-3 + beta)*(alpha2*squared(-1 + beta)*pow(F,2*beta)*t + 6*alpha*beta*nu*pow(F,1 + beta)*rho*t +
                         F2*(24 + nu*nu*(2 - 3*rho2)*t)))/24.0 +
-                     (3*alpha2*alpha*std::pow(-1 + beta,3)*std::pow(F,3*beta)*t +
-                        3*alpha2*(-1 + beta)*(-1 + 5*beta)*nu*std::pow(F,1 + 2*beta)*rho*t + nu*F2*F*rho*(24 + nu*nu*(-4 + 3*rho2)*t) +
-                        alpha*std::pow(F,2 + beta)*(24*(-1 + beta) + nu*nu*(2*(-1 + beta) + 3*(1 + beta)*rho2)*t))/(48.*F2*F2) * (k-F) +
-                    (std::pow(F,-5 - beta)*(alpha2*alpha2*std::pow(-1 + beta,3)*(-209 + 119*beta)*std::pow(F,4*beta)*t + 30*alpha2*alpha*(-1 + beta)*(9 + beta*(-37 + 18*beta))*nu*std::pow(F,1 + 3*beta)*rho*t -
-                        30*alpha*nu*std::pow(F,3 + beta)*rho*(24 + nu*nu*(-4*(1 + beta) + 3*(1 + 2*beta)*rho2)*t) +
-                        10*alpha2*std::pow(F,2 + 2*beta)*(24*(-4 + beta)*(-1 + beta) + nu*nu*(2*(-1 + beta)*(-7 + 4*beta) + 3*(-4 + beta*(-7 + 5*beta))*rho2)*t) +
+                     (3*alpha2*alpha*pow(-1 + beta,3)*pow(F,3*beta)*t +
+                        3*alpha2*(-1 + beta)*(-1 + 5*beta)*nu*pow(F,1 + 2*beta)*rho*t + nu*F2*F*rho*(24 + nu*nu*(-4 + 3*rho2)*t) +
+                        alpha*pow(F,2 + beta)*(24*(-1 + beta) + nu*nu*(2*(-1 + beta) + 3*(1 + beta)*rho2)*t))/(48.*F2*F2) * (k-F) +
+                    (pow(F,-5 - beta)*(alpha2*alpha2*pow(-1 + beta,3)*(-209 + 119*beta)*pow(F,4*beta)*t + 30*alpha2*alpha*(-1 + beta)*(9 + beta*(-37 + 18*beta))*nu*pow(F,1 + 3*beta)*rho*t -
+                        30*alpha*nu*pow(F,3 + beta)*rho*(24 + nu*nu*(-4*(1 + beta) + 3*(1 + 2*beta)*rho2)*t) +
+                        10*alpha2*pow(F,2 + 2*beta)*(24*(-4 + beta)*(-1 + beta) + nu*nu*(2*(-1 + beta)*(-7 + 4*beta) + 3*(-4 + beta*(-7 + 5*beta))*rho2)*t) +
                         nu*nu*F2*F2*(480 - 720*rho2 + nu*nu*(-64 + 75*rho2*(4 - 3*rho2))*t)))/(2880*alpha) * (k-F)*(k-F);
             }
         };
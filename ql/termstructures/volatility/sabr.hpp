@@ -28,6 +28,7 @@
 #ifndef quantlib_sabr_hpp
 #define quantlib_sabr_hpp
 
+#include <math/array.hpp>
 #include <types.hpp>
 #include <termstructures/volatility/volatilitytype.hpp>
 
@@ -51,6 +52,38 @@ namespace QuantLib {
                               Real shift,
                               VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
 
+    //! unsafeShiftedSabrVolatility on a whole strike grid
+    /*! The strike-independent terms of the expansion are computed
+        once for the whole grid.  The strikes and volatilities
+        arrays may coincide.
+    */
+    void unsafeShiftedSabrVolatilities(const Rate* strikes,
+                              Volatility* volatilities,
+                              Size n,
+                              Rate forward,
+                              Time expiryTime,
+                              Real alpha,
+                              Real beta,
+                              Real nu,
+                              Real rho,
+                              Real shift,
+                              VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
+
+    //! derivatives of unsafeShiftedSabrVolatility
+    /*! Returns the partial derivatives of the volatility with respect
+        to alpha, beta, nu and rho, in this order.
+    */
+    Array unsafeShiftedSabrVolatilityGradient(
+                              Rate strike,
+                              Rate forward,
+                              Time expiryTime,
+                              Real alpha,
+                              Real beta,
+                              Real nu,
+                              Real rho,
+                              Real shift,
+                              VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
+
     /* Normal SABR implemented according to
        https://www2.deloitte.com/content/dam/Deloitte/global/Documents/Financial-Services/be-aers-fsi-sabr-sensitivities.pdf
     */
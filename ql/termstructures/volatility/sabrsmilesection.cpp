@@ -74,4 +74,28 @@ namespace QuantLib {
         return unsafeShiftedSabrVolatility(strike, forward_, exerciseTime(),
                                            alpha_, beta_, nu_, rho_, shift_, volatilityType());
      }
+
+     void SabrSmileSection::volatilities(const Rate* strikes,
+                                         Volatility* volatilities,
+                                         Size n) const {
+        Real minStrike = 0.00001 - shift();
+        for (Size i = 0; i < n; ++i)
+            volatilities[i] = std::max(minStrike, strikes[i]);
+        unsafeShiftedSabrVolatilities(volatilities, volatilities, n, forward_,
+                                      exerciseTime(), alpha_, beta_, nu_, rho_,
+                                      shift_, volatilityType());
+     }
+
+     void SabrSmileSection::optionPrices(const Rate* strikes,
+                                         Real* prices,
+                                         Size n,
+                                         Option::Type type,
+                                         Real discount) const {
+        std::vector<Volatility> vols(n);
+        volatilities(strikes, vols.data(), n);
+        Time t = exerciseTime();
+        for (Size i = 0; i < n; ++i)
+            prices[i] = optionPriceFromStdDev(
+                strikes[i], sqrt(vols[i] * vols[i] * t), type, discount);
+     }
 }
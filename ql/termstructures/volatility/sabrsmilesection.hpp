@@ -53,6 +53,14 @@ namespace QuantLib {
         Real beta() const { return beta_; }
         Real nu() const { return nu_; }
         Real rho() const { return rho_; }
+        void volatilities(const Rate* strikes,
+                          Volatility* volatilities,
+                          Size n) const override;
+        void optionPrices(const Rate* strikes,
+                          Real* prices,
+                          Size n,
+                          Option::Type type = Option::Call,
+                          Real discount = 1.0) const override;
       protected:
         Real varianceImpl(Rate strike) const override;
         Volatility volatilityImpl(Rate strike) const override;
@@ -72,6 +72,18 @@ namespace QuantLib {
     Real SmileSection::optionPrice(Rate strike,
                                    Option::Type type,
                                    Real discount) const {
+        // the variance is not needed at -shift, see optionPriceFromStdDev
+        bool atMinusShift = volatilityType() == ShiftedLognormal &&
+                            fabs(strike+shift()) < QL_EPSILON;
+        return optionPriceFromStdDev(strike,
+                                     atMinusShift ? 0.0 : Real(sqrt(variance(strike))),
+                                     type, discount);
+    }
+
+    Real SmileSection::optionPriceFromStdDev(Rate strike,
+                                             Real stdDev,
+                                             Option::Type type,
+                                             Real discount) const {
         Real atm = atmLevel();
         QL_REQUIRE(atm != Null<Real>(),
                    "smile section must provide atm level to compute option price");
@@ -79,10 +91,26 @@ namespace QuantLib {
         // for strike at -shift, return option price even if outside
         // minstrike, maxstrike interval
         if (volatilityType() == ShiftedLognormal)
-            return blackFormula(type,strike,atm, std::fabs(strike+shift()) < QL_EPSILON ?
-                            0.2 : Real(sqrt(variance(strike))),discount,shift());
+            return blackFormula(type,strike,atm, fabs(strike+shift()) < QL_EPSILON ?
+                            0.2 : stdDev,discount,shift());
         else
-            return bachelierBlackFormula(type,strike,atm,sqrt(variance(strike)),discount);
+            return bachelierBlackFormula(type,strike,atm,stdDev,discount);
+    }
+
+    void SmileSection::volatilities(const Rate* strikes,
+                                    Volatility* volatilities,
+                                    Size n) const {
+        for (Size i=0; i<n; ++i)
+            volatilities[i] = volatilityImpl(strikes[i]);
+    }
+
+    void SmileSection::optionPrices(const Rate* strikes,
+                                    Real* prices,
+                                    Size n,
+                                    Option::Type type,
+                                    Real discount) const {
+        for (Size i=0; i<n; ++i)
+            prices[i] = optionPrice(strikes[i], type, discount);
     }
 
     Real SmileSection::digitalOptionPrice(Rate strike,
@@ -130,11 +158,11 @@ namespace QuantLib {
             try {
                 return blackFormulaImpliedStdDev(type, strike, atm, premium,
                                                  1.0, shift) /
-                       std::sqrt(exerciseTime());
+                       sqrt(exerciseTime());
             } catch(...) {
                 return blackFormulaImpliedStdDevChambers(
                     type, strike, atm, premium, premiumAtm, 1.0, shift) /
-                       std::sqrt(exerciseTime());
+                       sqrt(exerciseTime());
             }
         } else {
                 return bachelierBlackFormulaImpliedVol(type, strike, atm,
@@ -68,6 +68,19 @@ namespace QuantLib {
         virtual Real optionPrice(Rate strike,
                                  Option::Type type = Option::Call,
                                  Real discount=1.0) const;
+        //! volatilities on a whole strike grid
+        /*! Derived classes can override this method to compute
+            the strike-independent terms of their smile only once.
+        */
+        virtual void volatilities(const Rate* strikes,
+                                  Volatility* volatilities,
+                                  Size n) const;
+        //! option prices on a whole strike grid
+        virtual void optionPrices(const Rate* strikes,
+                                  Real* prices,
+                                  Size n,
+                                  Option::Type type = Option::Call,
+                                  Real discount=1.0) const;
         virtual Real digitalOptionPrice(Rate strike,
                                         Option::Type type = Option::Call,
                                         Real discount=1.0,
@@ -82,6 +95,12 @@ namespace QuantLib {
         virtual void initializeExerciseTime() const;
         virtual Real varianceImpl(Rate strike) const;
         virtual Volatility volatilityImpl(Rate strike) const = 0;
+        /*! option price for a given standard deviation, as used
+            by optionPrice() and optionPrices() */
+        Real optionPriceFromStdDev(Rate strike,
+                                   Real stdDev,
+                                   Option::Type type,
+                                   Real discount) const;
       private:
         bool isFloating_;
         mutable Date referenceDate_;
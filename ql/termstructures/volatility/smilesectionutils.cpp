@@ -113,14 +113,14 @@ namespace QuantLib {
         }
 
         // only known for shifted lognormal vols, otherwise we include
-        // the lower strike in the loop below
+        // the lower strike in the prices below
         if(section.volatilityType() == ShiftedLognormal)
             c_.push_back(f_ + shift);
 
-        for (Size i = (section.volatilityType() == Normal ? 0 : 1);
-             i < k_.size(); i++) {
-            c_.push_back(section.optionPrice(k_[i], Option::Call, 1.0));
-        }
+        Size firstPriced = section.volatilityType() == Normal ? 0 : 1;
+        c_.resize(k_.size());
+        section.optionPrices(k_.data() + firstPriced, c_.data() + firstPriced,
+                             k_.size() - firstPriced, Option::Call, 1.0);
 
         Size centralIndex =
             std::upper_bound(m_.begin(), m_.end(),
@@ -73,11 +73,11 @@ namespace QuantLib {
         EndCriteria::Type endCriteria() { return endCriteria_; };
 
         static Real betaTransformInverse(Real beta) {
-            return std::sqrt(-std::log(beta));
+            return sqrt(-log(beta));
         }
         static Real betaTransformDirect(Real y) {
             return std::max(
-                std::min(std::fabs(y) < 10.0 ? Real(std::exp(-(y * y))) : 0.0,
+                std::min(fabs(y) < 10.0 ? Real(exp(-(y * y))) : 0.0,
                          0.999999),
                 0.000001);
         }
@@ -85,7 +85,7 @@ namespace QuantLib {
             return reversion * reversion;
         }
         static Real reversionTransformDirect(Real y) {
-            return std::sqrt(y);
+            return sqrt(y);
         }
 
       private:
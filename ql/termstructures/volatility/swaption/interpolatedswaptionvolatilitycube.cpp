@@ -91,7 +91,7 @@ namespace QuantLib {
                                                 swapTenor,
                                                 atmForward);
         Time optionTime = timeFromReference(optionDate);
-        Real exerciseTimeSqrt = std::sqrt(optionTime);
+        Real exerciseTimeSqrt = sqrt(optionTime);
         std::vector<Real> strikes, stdDevs;
         strikes.reserve(nStrikes_);
         stdDevs.reserve(nStrikes_);
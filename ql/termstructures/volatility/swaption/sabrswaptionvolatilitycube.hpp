@@ -38,6 +38,7 @@
 #include <quote.hpp>
 #include <termstructures/volatility/sabrsmilesection.hpp>
 #include <termstructures/volatility/swaption/swaptionvolcube.hpp>
+#include <exception>
 #include <utility>
 
 
@@ -58,6 +59,16 @@ namespace QuantLib {
     /*! This class implements the XABR Swaption Volatility Cube
         which is a generic for different SABR, ZABR and 
         different smile models that can be used to instantiate concrete cubes.
+
+        The smiles of the different nodes are calibrated independently
+        and, when OpenMP is enabled and no optimization method is given,
+        in parallel.  If \p warmStart is true, each recalibration starts
+        from the parameters of the previous one instead of the given
+        guesses; updating the guess quotes reverts to the latter.
+        If \p useAnalyticJacobian is true and no optimization method is
+        given, each node is calibrated by its own Levenberg-Marquardt
+        instance using the analytic Jacobian of the smile model, so that
+        the nodes can still be calibrated in parallel.
     */
     template<class Model>
     class XabrSwaptionVolatilityCube : public SwaptionVolatilityCube {
@@ -133,7 +144,9 @@ namespace QuantLib {
             bool useMaxError = false,
             Size maxGuesses = 50,
             bool backwardFlat = false,
-            Real cutoffStrike = 0.0001);
+            Real cutoffStrike = 0.0001,
+            bool warmStart = false,
+            bool useAnalyticJacobian = false);
         //! \name LazyObject interface
         //@{
         void performCalculations() const override;
@@ -171,7 +184,8 @@ namespace QuantLib {
                                     Time optionTime,
                                     Time swapLength,
                                     const Cube& sabrParametersCube) const;
-        Cube sabrCalibration(const Cube &marketVolCube) const;
+        Cube sabrCalibration(const Cube& marketVolCube,
+                             const Cube* previousParameters = nullptr) const;
         void fillVolatilityCube() const;
         void createSparseSmiles() const;
         std::vector<Real> spreadVolInterpolation(const Date& atmOptionDate,
@@ -196,6 +210,9 @@ namespace QuantLib {
         const Size maxGuesses_;
         const bool backwardFlat_;
         const Real cutoffStrike_;
+        const bool warmStart_;
+        const bool useAnalyticJacobian_;
+        mutable bool hasCalibratedParameters_ = false;
         VolatilityType volatilityType_;
 
         class PrivateObserver : public Observer {
@@ -239,7 +256,9 @@ namespace QuantLib {
         const bool useMaxError,
         const Size maxGuesses,
         const bool backwardFlat,
-        const Real cutoffStrike)
+        const Real cutoffStrike,
+        const bool warmStart,
+        const bool useAnalyticJacobian)
     : SwaptionVolatilityCube(atmVolStructure,
                              optionTenors,
                              swapTenors,
@@ -252,7 +271,8 @@ namespace QuantLib {
       isParameterFixed_(std::move(isParameterFixed)), isAtmCalibrated_(isAtmCalibrated),
       endCriteria_(std::move(endCriteria)), optMethod_(std::move(optMethod)),
       useMaxError_(useMaxError), maxGuesses_(maxGuesses), backwardFlat_(backwardFlat),
-      cutoffStrike_(cutoffStrike), volatilityType_(atmVolStructure->volatilityType()) {
+      cutoffStrike_(cutoffStrike), warmStart_(warmStart),
+      useAnalyticJacobian_(useAnalyticJacobian), volatilityType_(atmVolStructure->volatilityType()) {
 
         if (maxErrorTolerance != Null<Rate>()) {
             maxErrorTolerance_ = maxErrorTolerance;
@@ -294,6 +314,8 @@ namespace QuantLib {
                 }
         parametersGuess_.updateInterpolators();
 
+        // new guesses supersede the parameters of the last calibration
+        hasCalibratedParameters_ = false;
     }
 
     template<class Model> void XabrSwaptionVolatilityCube<Model>::performCalculations() const {
@@ -318,7 +340,11 @@ namespace QuantLib {
         }
         marketVolCube_.updateInterpolators();
 
-        sparseParameters_ = sabrCalibration(marketVolCube_);
+        const bool warmStart = warmStart_ && hasCalibratedParameters_;
+        hasCalibratedParameters_ = false;
+
+        sparseParameters_ = sabrCalibration(
+            marketVolCube_, warmStart ? &sparseParameters_ : nullptr);
         //parametersGuess_ = sparseParameters_;
         sparseParameters_.updateInterpolators();
         //parametersGuess_.updateInterpolators();
@@ -326,9 +352,11 @@ namespace QuantLib {
 
         if(isAtmCalibrated_){
             fillVolatilityCube();
-            denseParameters_ = sabrCalibration(volCubeAtmCalibrated_);
+            denseParameters_ = sabrCalibration(
+                volCubeAtmCalibrated_, warmStart ? &denseParameters_ : nullptr);
             denseParameters_.updateInterpolators();
         }
+        hasCalibratedParameters_ = true;
     }
 
     template<class Model> void XabrSwaptionVolatilityCube<Model>::updateAfterRecalibration() {
@@ -343,7 +371,9 @@ namespace QuantLib {
 
     template <class Model>
     typename XabrSwaptionVolatilityCube<Model>::Cube
-    XabrSwaptionVolatilityCube<Model>::sabrCalibration(const Cube &marketVolCube) const {
+    XabrSwaptionVolatilityCube<Model>::sabrCalibration(
+                                    const Cube& marketVolCube,
+                                    const Cube* previousParameters) const {
 
         const std::vector<Time>& optionTimes = marketVolCube.optionTimes();
         const std::vector<Time>& swapLengths = marketVolCube.swapLengths();
@@ -360,31 +390,61 @@ namespace QuantLib {
 
         const std::vector<Matrix>& tmpMarketVolCube = marketVolCube.points();
 
-        std::vector<Real> strikes(strikeSpreads_.size());
-        std::vector<Real> volatilities(strikeSpreads_.size());
+        // the previous parameters can only seed nodes on the same grid
+        const bool warmStart = previousParameters != nullptr
+            && previousParameters->points().size() == 8
+            && previousParameters->points()[0].rows() == optionTimes.size()
+            && previousParameters->points()[0].columns() == swapLengths.size();
+
+        // market data and guesses are collected on the calling thread,
+        // so that lazily calculated term structures are not triggered
+        // concurrently by the calibrations below
+        const Size nSwapLengths = swapLengths.size();
+        const Size nNodes = optionTimes.size()*nSwapLengths;
+        std::vector<std::vector<Real> > strikes(nNodes), volatilities(nNodes);
+        std::vector<std::vector<Real> > guesses(nNodes);
+        std::vector<Real> shifts(nNodes);
 
         for (Size j=0; j<optionTimes.size(); j++) {
             for (Size k=0; k<swapLengths.size(); k++) {
+                const Size n = j*nSwapLengths + k;
                 Rate atmForward = atmStrike(optionDates[j], swapTenors[k]);
-                Real shiftTmp = atmVol_->shift(optionTimes[j], swapLengths[k]);
-                strikes.clear();
-                volatilities.clear();
+                shifts[n] = atmVol_->shift(optionTimes[j], swapLengths[k]);
+                forwards[j][k] = atmForward;
                 for (Size i=0; i<nStrikes_; i++){
                     Real strike = atmForward+strikeSpreads_[i];
-                    if(strike + shiftTmp >=cutoffStrike_) {
-                        strikes.push_back(strike);
-                        volatilities.push_back(tmpMarketVolCube[i][j][k]);
+                    if(strike + shifts[n] >=cutoffStrike_) {
+                        strikes[n].push_back(strike);
+                        volatilities[n].push_back(tmpMarketVolCube[i][j][k]);
                     }
                 }
 
-                const std::vector<Real>& guess =
-                    parametersGuess_(optionTimes[j], swapLengths[k]);
+                guesses[n] = parametersGuess_(optionTimes[j], swapLengths[k]);
+                if (warmStart) {
+                    for (Size p=0; p<4; ++p)
+                        if (!isParameterFixed_[p])
+                            guesses[n][p] = previousParameters->points()[p][j][k];
+                }
+            }
+        }
+
+        // nodes are calibrated independently; each one writes its own
+        // results, so that these do not depend on the thread scheduling.
+        // A user-supplied optimization method keeps per-call state and
+        // can't be shared among threads.
+        std::vector<std::exception_ptr> failures(nNodes);
+
+        #pragma omp parallel for schedule(dynamic) if(!optMethod_)
+        for (long n=0; n < (long)nNodes; ++n) {
+            const Size j = n / nSwapLengths, k = n % nSwapLengths;
+            try {
+                const std::vector<Real>& guess = guesses[n];
 
                 const ext::shared_ptr<typename Model::Interpolation> sabrInterpolation =
                     ext::shared_ptr<typename Model::Interpolation>(new
-                                          (typename Model::Interpolation)(strikes.begin(), strikes.end(),
-                                          volatilities.begin(),
-                                          optionTimes[j], atmForward,
+                                          (typename Model::Interpolation)(strikes[n].begin(), strikes[n].end(),
+                                          volatilities[n].begin(),
+                                          optionTimes[j], forwards[j][k],
                                           guess[0], guess[1],
                                           guess[2], guess[3],
                                           isParameterFixed_[0],
@@ -397,8 +457,9 @@ namespace QuantLib {
                                           errorAccept_,
                                           useMaxError_,
                                           maxGuesses_,
-                                          shiftTmp,
-                                          volatilityType_));
+                                          shifts[n],
+                                          volatilityType_,
+                                          useAnalyticJacobian_));
                 sabrInterpolation->update();
 
                 Real rmsError = sabrInterpolation->rmsError();
@@ -407,7 +468,6 @@ namespace QuantLib {
                 betas      [j][k] = sabrInterpolation->beta();
                 nus        [j][k] = sabrInterpolation->nu();
                 rhos       [j][k] = sabrInterpolation->rho();
-                forwards   [j][k] = atmForward;
                 errors     [j][k] = rmsError;
                 maxErrors  [j][k] = maxError;
                 endCriteria[j][k] = sabrInterpolation->endCriteria();
@@ -439,8 +499,17 @@ namespace QuantLib {
                               << "   beta = " << betas[j][k] << "\n"
                               << "   nu = " << nus[j][k] << "\n"
                               << "   rho = " << rhos[j][k] << "\n");
+            } catch (...) {
+                failures[n] = std::current_exception();
             }
         }
+
+        // report the first failing node, as a sequential loop would
+        for (const auto& failure : failures) {
+            if (failure)
+                std::rethrow_exception(failure);
+        }
+
         Cube sabrParametersCube(optionDates, swapTenors,
                                 optionTimes, swapLengths, 8,
                                 true, backwardFlat_);
@@ -510,7 +579,9 @@ namespace QuantLib {
                                       errorAccept_,
                                       useMaxError_,
                                       maxGuesses_,
-                                      shiftTmp));
+                                      shiftTmp,
+                                      volatilityType_,
+                                      useAnalyticJacobian_));
 
             sabrInterpolation->update();
             Real interpolationError = sabrInterpolation->rmsError();
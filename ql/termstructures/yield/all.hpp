@@ -10,6 +10,7 @@
 #include <termstructures/yield/forwardcurve.hpp>
 #include <termstructures/yield/forwardspreadedtermstructure.hpp>
 #include <termstructures/yield/forwardstructure.hpp>
+#include <termstructures/yield/frozendiscountcurve.hpp>
 #include <termstructures/yield/impliedtermstructure.hpp>
 #include <termstructures/yield/interpolatedsimplezerocurve.hpp>
 #include <termstructures/yield/nonlinearfittingmethods.hpp>
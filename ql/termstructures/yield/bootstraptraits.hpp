@@ -73,8 +73,8 @@ namespace QuantLib {
                 return 1.0/(1.0+detail::avgRate*c->times()[1]);
 
             // flat rate extrapolation
-            Real r = -std::log(c->data()[i-1])/c->times()[i-1];
-            return std::exp(-r * c->times()[i]);
+            Real r = -log(c->data()[i-1])/c->times()[i-1];
+            return exp(-r * c->times()[i]);
         }
 
         // possible constraints based on previous values
@@ -89,7 +89,7 @@ namespace QuantLib {
                                           c->data().end()))/2.0;
             }
             Time dt = c->times()[i] - c->times()[i-1];
-            return c->data()[i-1] * std::exp(- detail::maxRate * dt);
+            return c->data()[i-1] * exp(- detail::maxRate * dt);
         }
         template <class C>
         static Real maxValueAfter(Size i,
@@ -98,19 +98,30 @@ namespace QuantLib {
                                   Size) // firstAliveHelper
         {
             Time dt = c->times()[i] - c->times()[i-1];
-            return c->data()[i-1] * std::exp(detail::maxRate * dt);
+            return c->data()[i-1] * exp(detail::maxRate * dt);
         }
 
         // transformation to add constraints to an unconstrained optimization
         template <class C>
         static Real transformDirect(Real x, Size i, const C* c)
         {
-            return std::exp(x);
+            return exp(x);
         }
         template <class C>
         static Real transformInverse(Real x, Size i, const C* c)
         {
-            return std::log(x);
+            return log(x);
+        }
+        template <class C>
+        static Real transformDirectDerivative(Real x, Size /*i*/, const C* /*c*/)
+        {
+            return exp(x);
+        }
+
+        // derivative of the discount at t with respect to the curve
+        // value at t (used when the value is interpolated)
+        static Real discountDerivative(Time, Real) {
+            return 1.0;
         }
 
         // root-finding update
@@ -203,6 +214,17 @@ namespace QuantLib {
         {
             return x;
         }
+        template <class C>
+        static Real transformDirectDerivative(Real /*x*/, Size /*i*/, const C* /*c*/)
+        {
+            return 1.0;
+        }
+
+        // derivative of the discount at t with respect to the curve
+        // value at t (used when the value is interpolated)
+        static Real discountDerivative(Time t, Real zero) {
+            return -t * exp(-zero * t);
+        }
 
         // root-finding update
         static void updateGuess(std::vector<Real>& data,
@@ -384,12 +406,24 @@ namespace QuantLib {
         template <class C>
         static Real transformDirect(Real x, Size i, const C* c)
         {
-            return std::exp(x) + (-1.0 / c->times()[i] + 1E-8);
+            return exp(x) + (-1.0 / c->times()[i] + 1E-8);
         }
         template <class C>
         static Real transformInverse(Real x, Size i, const C* c)
         {
-            return std::log(x - (-1.0 / c->times()[i] + 1E-8));
+            return log(x - (-1.0 / c->times()[i] + 1E-8));
+        }
+        template <class C>
+        static Real transformDirectDerivative(Real x, Size /*i*/, const C* /*c*/)
+        {
+            return exp(x);
+        }
+
+        // derivative of the discount at t with respect to the curve
+        // value at t (used when the value is interpolated)
+        static Real discountDerivative(Time t, Real zero) {
+            Real d = 1.0 + zero * t;
+            return -t / (d * d);
         }
 
         // root-finding update
@@ -31,6 +31,7 @@
 #include <termstructures/interpolatedcurve.hpp>
 #include <math/interpolations/loginterpolation.hpp>
 #include <math/comparison.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib {
@@ -65,6 +66,8 @@ namespace QuantLib {
         //@{
         Date maxDate() const override;
         //@}
+        using YieldTermStructure::discounts;
+        using InterpolatedCurve<Interpolator>::enableLocateIndex;
         //! \name other inspectors
         //@{
         const std::vector<Time>& times() const;
@@ -95,6 +98,7 @@ namespace QuantLib {
         //! \name YieldTermStructure implementation
         //@{
         DiscountFactor discountImpl(Time) const override;
+        void discountsImpl(const Time* t, DiscountFactor* d, Size n) const override;
         //@}
         mutable std::vector<Date> dates_;
       private:
@@ -165,7 +169,18 @@ namespace QuantLib {
         Time tMax = this->times_.back();
         DiscountFactor dMax = this->data_.back();
         Rate instFwdMax = - this->interpolation_.derivative(tMax) / dMax;
-        return dMax * std::exp(- instFwdMax * (t-tMax));
+        return dMax * exp(- instFwdMax * (t-tMax));
+    }
+
+    template <class T>
+    void InterpolatedDiscountCurve<T>::discountsImpl(const Time* t,
+                                                     DiscountFactor* d,
+                                                     Size n) const {
+        // the times up to the last node are interpolated in one pass
+        Size m = std::upper_bound(t, t+n, this->times_.back()) - t;
+        this->interpolation_(t, d, m, true);
+        for (Size i=m; i<n; ++i)
+            d[i] = InterpolatedDiscountCurve<T>::discountImpl(t[i]);
     }
 
     template <class T>
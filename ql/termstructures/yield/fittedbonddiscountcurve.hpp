@@ -358,12 +358,12 @@ namespace QuantLib {
     inline DiscountFactor FittedBondDiscountCurve::FittingMethod::discount(const Array& x, Time t) const {
         if (t < minCutoffTime_) {
             // flat fwd extrapolation before min cutoff time
-            return std::exp(std::log(discountFunction(x, minCutoffTime_)) / minCutoffTime_ * t);
+            return exp(log(discountFunction(x, minCutoffTime_)) / minCutoffTime_ * t);
         } else if (t > maxCutoffTime_) {
             // flat fwd extrapolation after max cutoff time
             return discountFunction(x, maxCutoffTime_) *
-                   std::exp((std::log(discountFunction(x, maxCutoffTime_ + 1E-4)) -
-                             std::log(discountFunction(x, maxCutoffTime_))) *
+                   exp((log(discountFunction(x, maxCutoffTime_ + 1E-4)) -
+                             log(discountFunction(x, maxCutoffTime_))) *
                             1E4 * (t - maxCutoffTime_));
         } else {
             return discountFunction(x, t);
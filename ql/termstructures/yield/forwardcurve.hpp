@@ -64,6 +64,7 @@ namespace QuantLib {
         //@{
         Date maxDate() const override;
         //@}
+        using InterpolatedCurve<Interpolator>::enableLocateIndex;
         //! \name other inspectors
         //@{
         const std::vector<Time>& times() const;
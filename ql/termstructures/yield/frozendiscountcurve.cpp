@@ -0,0 +1,56 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+
+#include <termstructures/yield/frozendiscountcurve.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace QuantLib {
+
+    FrozenDiscountCurve::FrozenDiscountCurve(const Handle<YieldTermStructure>& curve,
+                                             const Date& maxDate)
+    : YieldTermStructure(curve->referenceDate(), curve->calendar(), curve->dayCounter()) {
+        Date reference = referenceDate();
+        QL_REQUIRE(maxDate > reference,
+                   "max date (" << maxDate << ") must be later than the "
+                   "reference date (" << reference << ")");
+        firstSerialNumber_ = reference.serialNumber();
+        Size n = static_cast<Size>(maxDate - reference) + 1;
+        discounts_.resize(n);
+        times_.resize(n);
+        for (Size i=0; i<n; ++i) {
+            Date d = reference + Integer(i);
+            discounts_[i] = curve->discount(d);
+            times_[i] = timeFromReference(d);
+        }
+    }
+
+    DiscountFactor FrozenDiscountCurve::discountImpl(Time t) const {
+        Size i = std::upper_bound(times_.begin(), times_.end()-1, t) - times_.begin();
+        i = std::max<Size>(i, 1) - 1;
+        i = std::min(i, times_.size()-2);
+        Time dt = times_[i+1] - times_[i];
+        if (dt == 0.0)
+            return discounts_[i];
+        // log-linear, i.e., flat forward between days; the
+        // formulation below is exact on the sampled days
+        return discounts_[i] *
+            pow(discounts_[i+1]/discounts_[i], (t-times_[i])/dt);
+    }
+
+}
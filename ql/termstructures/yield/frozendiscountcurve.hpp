@@ -0,0 +1,96 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+
+/*! \file frozendiscountcurve.hpp
+    \brief Daily discount factors sampled from a yield term structure
+*/
+
+#ifndef quantlib_frozen_discount_curve_hpp
+#define quantlib_frozen_discount_curve_hpp
+
+#include <termstructures/yieldtermstructure.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! Frozen snapshot of a yield term structure on a daily grid
+    /*! The discount factors of the given curve are sampled once on
+        each calendar day from its reference date to the given
+        maximum date and stored in a flat table.  Given the serial
+        number of a date, discountOnSerial() returns the stored value
+        with a single array lookup, bypassing the time conversion, the
+        range checks and the virtual dispatch of the original curve;
+        the result is exactly the one of the original curve on each
+        day.
+
+        When used as a YieldTermStructure, the snapshot interpolates
+        log-linearly between consecutive days.
+
+        \note The snapshot doesn't observe the original curve, nor the
+              evaluation date; it must be rebuilt when they change.
+
+        \ingroup yieldtermstructures
+    */
+    class FrozenDiscountCurve : public YieldTermStructure {
+      public:
+        FrozenDiscountCurve(const Handle<YieldTermStructure>& curve,
+                            const Date& maxDate);
+        //! \name YieldTermStructure interface
+        //@{
+        Date maxDate() const override;
+        //@}
+        //! \name Daily discount factors
+        //@{
+        /*! \pre the date must lie between the reference date and
+                 the maximum date of the snapshot.
+        */
+        DiscountFactor discountOnSerial(Date::serial_type serialNumber) const;
+        const std::vector<DiscountFactor>& discounts() const;
+        //@}
+      protected:
+        DiscountFactor discountImpl(Time) const override;
+      private:
+        Date::serial_type firstSerialNumber_;
+        std::vector<DiscountFactor> discounts_;
+        std::vector<Time> times_;
+    };
+
+
+    // inline definitions
+
+    inline Date FrozenDiscountCurve::maxDate() const {
+        return referenceDate() + Integer(discounts_.size() - 1);
+    }
+
+    inline DiscountFactor
+    FrozenDiscountCurve::discountOnSerial(Date::serial_type serialNumber) const {
+        Size i = static_cast<Size>(serialNumber - firstSerialNumber_);
+        QL_REQUIRE(i < discounts_.size(),
+                   "date (" << Date(serialNumber) << ") outside the snapshot range ["
+                   << referenceDate() << ", " << maxDate() << "]");
+        return discounts_[i];
+    }
+
+    inline const std::vector<DiscountFactor>&
+    FrozenDiscountCurve::discounts() const {
+        return discounts_;
+    }
+
+}
+
+#endif
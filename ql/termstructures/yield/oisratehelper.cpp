@@ -21,6 +21,7 @@
 #include <instruments/makeois.hpp>
 #include <instruments/simplifynotificationgraph.hpp>
 #include <cashflows/couponpricer.hpp>
+#include <cashflows/overnightindexedcoupon.hpp>
 #include <pricingengines/swap/discountingswapengine.hpp>
 #include <termstructures/yield/oisratehelper.hpp>
 #include <utilities/null_deleter.hpp>
@@ -201,6 +202,52 @@ namespace QuantLib {
         return swap_->fairRate();
     }
 
+    bool OISRateHelper::impliedQuoteDerivatives(
+                                   std::vector<Time>& times,
+                                   std::vector<Real>& derivatives) const {
+        QL_REQUIRE(termStructure_ != nullptr, "term structure not set");
+        // only the default compounding pricer with the telescopic
+        // formula over the whole coupon is supported
+        if (pricer_ || averagingMethod_ != RateAveraging::Compound)
+            return false;
+        swap_->deepUpdate();
+        const YieldTermStructure* ts = termStructure_;
+        auto couponDerivatives = [ts](const CashFlow& cf,
+                                      std::vector<Date>& dates,
+                                      std::vector<Real>& couponDerivatives) {
+            const auto* coupon = dynamic_cast<const OvernightIndexedCoupon*>(&cf);
+            if (coupon == nullptr || !coupon->canApplyTelescopicFormula() ||
+                coupon->lockoutDays() > 0 || coupon->applyObservationShift())
+                return false;
+            dates.clear();
+            couponDerivatives.clear();
+            // skip the known fixings
+            const Date today = Settings::instance().evaluationDate();
+            const auto& fixingDates = coupon->fixingDates();
+            const auto& valueDates = coupon->valueDates();
+            const Size n = fixingDates.size();
+            Size i = 0;
+            while (i < n && (fixingDates[i] < today ||
+                             (fixingDates[i] == today &&
+                              coupon->index()->hasHistoricalFixing(fixingDates[i]))))
+                ++i;
+            if (i == n)
+                return true;
+            // the amount is N T (g (C P(v_i)/P(v_n) - 1)/T + s),
+            // where C compounds the known fixings
+            const Real T = coupon->accrualPeriod(), g = coupon->gearing();
+            const Real compoundFactor = 1.0 + (coupon->rate() - coupon->spread()) * T / g;
+            const Real k = coupon->nominal() * g * compoundFactor;
+            dates = { valueDates[i], valueDates[n] };
+            couponDerivatives = { k / ts->discount(valueDates[i]),
+                                  -k / ts->discount(valueDates[n]) };
+            return true;
+        };
+        return detail::fairRateDerivatives(termStructure_, **discountRelinkableHandle_,
+                                           swap_->fixedLeg(), swap_->overnightLeg(), 0.0,
+                                           couponDerivatives, times, derivatives);
+    }
+
     void OISRateHelper::accept(AcyclicVisitor& v) {
         auto* v1 = dynamic_cast<Visitor<OISRateHelper>*>(&v);
         if (v1 != nullptr)
@@ -86,6 +86,8 @@ namespace QuantLib {
         //! \name RateHelper interface
         //@{
         Real impliedQuote() const override;
+        bool impliedQuoteDerivatives(std::vector<Time>& times,
+                                     std::vector<Real>& derivatives) const override;
         void setTermStructure(YieldTermStructure*) override;
         //@}
         //! \name inspectors
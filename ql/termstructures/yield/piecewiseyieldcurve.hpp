@@ -176,6 +176,7 @@ namespace QuantLib {
         //@}
         // methods
         DiscountFactor discountImpl(Time) const override;
+        void discountsImpl(const Time* t, DiscountFactor* d, Size n) const override;
         // data members
         std::vector<ext::shared_ptr<typename Traits::helper> > instruments_;
         Real accuracy_;
@@ -246,10 +247,21 @@ namespace QuantLib {
         return base_curve::discountImpl(t);
     }
 
+    template <class C, class I, template <class> class B>
+    inline void PiecewiseYieldCurve<C,I,B>::discountsImpl(const Time* t,
+                                                          DiscountFactor* d,
+                                                          Size n) const {
+        calculate();
+        base_curve::discountsImpl(t, d, n);
+    }
+
     template <class C, class I, template <class> class B>
     inline void PiecewiseYieldCurve<C,I,B>::performCalculations() const {
         // just delegate to the bootstrapper
         bootstrap_.calculate();
+        // the bootstrapper might have rebuilt the interpolation
+        if (this->locateIndex_)
+            this->interpolation_.enableLocateIndex();
     }
 
 }
@@ -64,6 +64,43 @@ namespace QuantLib {
                                            earliestDate, maturityDate);
         }
 
+        // derivatives of (P(d1)/P(d2) - 1)/t with respect to P(d1) and P(d2)
+        void ForwardRateDerivatives(const YieldTermStructure* ts,
+                                    const Date& d1,
+                                    const Date& d2,
+                                    Time t,
+                                    std::vector<Time>& times,
+                                    std::vector<Real>& derivatives) {
+            DiscountFactor p1 = ts->discount(d1), p2 = ts->discount(d2);
+            times = { ts->timeFromReference(d1), ts->timeFromReference(d2) };
+            derivatives = { 1.0/(p2*t), -p1/(p2*p2*t) };
+        }
+
+        // same as above, for the forecast of an index fixing; known
+        // fixings (see InterestRateIndex::fixing) don't depend on the
+        // curve and have null derivatives
+        bool FixingDerivatives(const YieldTermStructure* ts,
+                               const IborIndex& index,
+                               const Date& fixingDate,
+                               bool forecastTodaysFixing,
+                               std::vector<Time>& times,
+                               std::vector<Real>& derivatives) {
+            Date today = Settings::instance().evaluationDate();
+            if (fixingDate < today ||
+                (fixingDate == today && !forecastTodaysFixing &&
+                 (Settings::instance().enforcesTodaysHistoricFixings() ||
+                  index.hasHistoricalFixing(fixingDate)))) {
+                times.clear();
+                derivatives.clear();
+                return true;
+            }
+            Date d1 = index.valueDate(fixingDate);
+            Date d2 = index.maturityDate(d1);
+            Time t = index.dayCounter().yearFraction(d1, d2);
+            ForwardRateDerivatives(ts, d1, d2, t, times, derivatives);
+            return true;
+        }
+
     } // namespace
 
     FuturesRateHelper::FuturesRateHelper(const Handle<Quote>& price,
@@ -247,6 +284,14 @@ namespace QuantLib {
         return iborIndex_->fixing(fixingDate_, true);
     }
 
+    bool DepositRateHelper::impliedQuoteDerivatives(
+                                   std::vector<Time>& times,
+                                   std::vector<Real>& derivatives) const {
+        QL_REQUIRE(termStructure_ != nullptr, "term structure not set");
+        return FixingDerivatives(termStructure_, *iborIndex_, fixingDate_, true,
+                                 times, derivatives);
+    }
+
     void DepositRateHelper::setTermStructure(YieldTermStructure* t) {
         // do not set the relinkable handle as an observer -
         // force recalculation when needed---the index is not lazy
@@ -432,6 +477,18 @@ namespace QuantLib {
                    spanningTime_;
     }
 
+    bool FraRateHelper::impliedQuoteDerivatives(
+                                   std::vector<Time>& times,
+                                   std::vector<Real>& derivatives) const {
+        QL_REQUIRE(termStructure_ != nullptr, "term structure not set");
+        if (useIndexedCoupon_)
+            return FixingDerivatives(termStructure_, *iborIndex_, fixingDate_, true,
+                                     times, derivatives);
+        ForwardRateDerivatives(termStructure_, earliestDate_, maturityDate_,
+                               spanningTime_, times, derivatives);
+        return true;
+    }
+
     void FraRateHelper::setTermStructure(YieldTermStructure* t) {
         // do not set the relinkable handle as an observer -
         // force recalculation when needed---the index is not lazy
@@ -718,6 +775,36 @@ namespace QuantLib {
         return result;
     }
 
+    bool SwapRateHelper::impliedQuoteDerivatives(
+                                   std::vector<Time>& times,
+                                   std::vector<Real>& derivatives) const {
+        QL_REQUIRE(termStructure_ != nullptr, "term structure not set");
+        swap_->deepUpdate();
+        const YieldTermStructure* ts = termStructure_;
+        auto couponDerivatives = [ts](const CashFlow& cf,
+                                      std::vector<Date>& dates,
+                                      std::vector<Real>& couponDerivatives) {
+            const auto* coupon = dynamic_cast<const IborCoupon*>(&cf);
+            if (coupon == nullptr || coupon->isInArrears())
+                return false;
+            dates.clear();
+            couponDerivatives.clear();
+            if (coupon->hasFixed())
+                return true;
+            // the amount is N T (g (P(d1)/P(d2) - 1)/t + s)
+            Date d1 = coupon->fixingValueDate(), d2 = coupon->fixingEndDate();
+            DiscountFactor p1 = ts->discount(d1), p2 = ts->discount(d2);
+            Real k = coupon->nominal() * coupon->accrualPeriod() *
+                     coupon->gearing() / coupon->spanningTime();
+            dates = { d1, d2 };
+            couponDerivatives = { k/p2, -k*p1/(p2*p2) };
+            return true;
+        };
+        return detail::fairRateDerivatives(termStructure_, **discountRelinkableHandle_,
+                                           swap_->fixedLeg(), swap_->floatingLeg(), spread(),
+                                           couponDerivatives, times, derivatives);
+    }
+
     void SwapRateHelper::accept(AcyclicVisitor& v) {
         auto* v1 = dynamic_cast<Visitor<SwapRateHelper>*>(&v);
         if (v1 != nullptr)
@@ -726,6 +813,80 @@ namespace QuantLib {
             RateHelper::accept(v);
     }
 
+    namespace detail {
+
+        bool fairRateDerivatives(
+            const YieldTermStructure* ts,
+            const YieldTermStructure& discountCurve,
+            const Leg& fixedLeg,
+            const Leg& floatingLeg,
+            Spread spread,
+            const std::function<bool(const CashFlow&,
+                                     std::vector<Date>&,
+                                     std::vector<Real>&)>& couponDerivatives,
+            std::vector<Time>& times,
+            std::vector<Real>& derivatives) {
+            // cash flows are discounted to the reference date of the
+            // discount curve; the ratio doesn't depend on the NPV date
+            const Date referenceDate = discountCurve.referenceDate();
+            const bool discounting = (&discountCurve == ts);
+
+            std::vector<Date> paymentDates, dates;
+            std::vector<Real> fixedTerms, floatingTerms, amountDerivatives;
+            std::vector<Date> forecastDates;
+            std::vector<Real> forecastTerms;
+            Real annuity = 0.0, floating = 0.0;
+            for (const auto& cf : fixedLeg) {
+                if (cf->hasOccurred(referenceDate))
+                    continue;
+                auto coupon = ext::dynamic_pointer_cast<Coupon>(cf);
+                if (coupon == nullptr)
+                    return false;
+                Real term = coupon->nominal() * coupon->accrualPeriod();
+                annuity += term * discountCurve.discount(cf->date());
+                paymentDates.push_back(cf->date());
+                fixedTerms.push_back(term);
+            }
+            for (const auto& cf : floatingLeg) {
+                if (cf->hasOccurred(referenceDate))
+                    continue;
+                auto coupon = ext::dynamic_pointer_cast<Coupon>(cf);
+                if (coupon == nullptr || !couponDerivatives(*cf, dates, amountDerivatives))
+                    return false;
+                DiscountFactor discount = discountCurve.discount(cf->date());
+                Real term = cf->amount() + spread * coupon->nominal() * coupon->accrualPeriod();
+                floating += term * discount;
+                paymentDates.push_back(cf->date());
+                floatingTerms.push_back(term);
+                for (Size k = 0; k < dates.size(); ++k) {
+                    forecastDates.push_back(dates[k]);
+                    forecastTerms.push_back(amountDerivatives[k] * discount);
+                }
+            }
+            QL_REQUIRE(annuity != 0.0, "null fixed-leg annuity");
+            const Real rate = floating / annuity;
+
+            times.clear();
+            derivatives.clear();
+            if (discounting) {
+                for (Size i = 0; i < fixedTerms.size(); ++i) {
+                    times.push_back(ts->timeFromReference(paymentDates[i]));
+                    derivatives.push_back(-rate * fixedTerms[i] / annuity);
+                }
+                for (Size j = 0; j < floatingTerms.size(); ++j) {
+                    times.push_back(ts->timeFromReference(paymentDates[fixedTerms.size() + j]));
+                    derivatives.push_back(floatingTerms[j] / annuity);
+                }
+            }
+            for (Size k = 0; k < forecastDates.size(); ++k) {
+                times.push_back(ts->timeFromReference(forecastDates[k]));
+                derivatives.push_back(forecastTerms[k] / annuity);
+            }
+            return true;
+        }
+
+    }
+
     BMASwapRateHelper::BMASwapRateHelper(const Handle<Quote>& liborFraction,
                                          const Period& tenor,
                                          Natural settlementDays,
@@ -37,6 +37,7 @@
 #include <time/calendar.hpp>
 #include <time/daycounter.hpp>
 #include <optional.hpp>
+#include <functional>
 
 namespace QuantLib {
 
@@ -132,6 +133,8 @@ namespace QuantLib {
         //! \name RateHelper interface
         //@{
         Real impliedQuote() const override;
+        bool impliedQuoteDerivatives(std::vector<Time>& times,
+                                     std::vector<Real>& derivatives) const override;
         void setTermStructure(YieldTermStructure*) override;
         //@}
         //! \name Visitability
@@ -234,6 +237,8 @@ namespace QuantLib {
         //! \name RateHelper interface
         //@{
         Real impliedQuote() const override;
+        bool impliedQuoteDerivatives(std::vector<Time>& times,
+                                     std::vector<Real>& derivatives) const override;
         void setTermStructure(YieldTermStructure*) override;
         //@}
         //! \name Visitability
@@ -333,6 +338,8 @@ namespace QuantLib {
         //! \name RateHelper interface
         //@{
         Real impliedQuote() const override;
+        bool impliedQuoteDerivatives(std::vector<Time>& times,
+                                     std::vector<Real>& derivatives) const override;
         void setTermStructure(YieldTermStructure*) override;
         //@}
         //! \name SwapRateHelper inspectors
@@ -496,6 +503,34 @@ namespace QuantLib {
       Calendar jointCalendar_;
     };
 
+    namespace detail {
+
+        //! derivatives of the fair rate of a fixed vs floating swap
+        /*! The fair rate is \f$ (F + sB)/A \f$, where \f$ F \f$ is the
+            value of the floating coupons, \f$ A \f$ and \f$ B \f$ are
+            the annuities of the fixed and floating legs, and \f$ s \f$
+            is a spread over the floating leg.  Its derivatives are
+            taken with respect to the discount factors of \p ts: the
+            ones at the payment dates are included if \p ts is also the
+            discount curve, and \p couponDerivatives must store the
+            derivatives of each floating amount with respect to the
+            discount factors of \p ts at the given dates (or return
+            false if they're not available.)
+        */
+        bool fairRateDerivatives(
+            const YieldTermStructure* ts,
+            const YieldTermStructure& discountCurve,
+            const Leg& fixedLeg,
+            const Leg& floatingLeg,
+            Spread spread,
+            const std::function<bool(const CashFlow&,
+                                     std::vector<Date>&,
+                                     std::vector<Real>&)>& couponDerivatives,
+            std::vector<Time>& times,
+            std::vector<Real>& derivatives);
+
+    }
+
     // inline
 
     inline Spread SwapRateHelper::spread() const {
@@ -165,7 +165,7 @@ namespace QuantLib {
            with a being the growth factor (alpha). */
         if (deltaT > 0.0) {
             InterestRate baseRate = originalCurve_->zeroRate(cutOffTime, Continuous, NoFrequency);
-            Real beta = (1.0 - std::exp(-alpha_ * deltaT)) / (alpha_ * deltaT);
+            Real beta = (1.0 - exp(-alpha_ * deltaT)) / (alpha_ * deltaT);
             Rate extrapolatedForward = ufr_->value() + (llfr_->value() - ufr_->value()) * beta;
             return (cutOffTime * baseRate + deltaT * extrapolatedForward) / t;
         }
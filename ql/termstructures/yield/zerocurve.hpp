@@ -32,6 +32,7 @@
 #include <interestrate.hpp>
 #include <math/comparison.hpp>
 #include <utilities/dataformatters.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib {
@@ -72,6 +73,7 @@ namespace QuantLib {
         //@{
         Date maxDate() const override;
         //@}
+        using InterpolatedCurve<Interpolator>::enableLocateIndex;
         //! \name other inspectors
         //@{
         const std::vector<Time>& times() const;
@@ -103,6 +105,10 @@ namespace QuantLib {
         //@{
         Rate zeroYieldImpl(Time t) const override;
         //@}
+        //! \name YieldTermStructure implementation
+        //@{
+        void discountsImpl(const Time* t, DiscountFactor* d, Size n) const override;
+        //@}
         mutable std::vector<Date> dates_;
       private:
         void initialize(const Compounding& compounding, const Frequency& frequency);
@@ -169,6 +175,19 @@ namespace QuantLib {
         return (zMax * tMax + instFwdMax * (t-tMax)) / t;
     }
 
+    template <class T>
+    void InterpolatedZeroCurve<T>::discountsImpl(const Time* t,
+                                                 DiscountFactor* d,
+                                                 Size n) const {
+        // the zero rates up to the last node are interpolated in one pass
+        Size m = std::upper_bound(t, t+n, this->times_.back()) - t;
+        this->interpolation_(t, d, m, true);
+        for (Size i=m; i<n; ++i)
+            d[i] = InterpolatedZeroCurve<T>::zeroYieldImpl(t[i]);
+        for (Size i=0; i<n; ++i)
+            d[i] = (t[i] == 0.0) ? 1.0 : DiscountFactor(exp(-d[i]*t[i]));
+    }
+
     template <class T>
     InterpolatedZeroCurve<T>::InterpolatedZeroCurve(
                                     const DayCounter& dayCounter,
@@ -21,6 +21,7 @@
 
 #include <termstructures/yieldtermstructure.hpp>
 #include <utilities/dataformatters.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib {
@@ -95,6 +96,31 @@ namespace QuantLib {
         return jumpEffect * discountImpl(t);
     }
 
+    void YieldTermStructure::discounts(const Time* t,
+                                       DiscountFactor* d,
+                                       Size n,
+                                       bool extrapolate) const {
+        if (n == 0)
+            return;
+        QL_REQUIRE(std::is_sorted(t, t+n), "unsorted times");
+        checkRange(t[0], extrapolate);
+        checkRange(t[n-1], extrapolate);
+
+        if (!jumps_.empty()) {
+            for (Size i=0; i<n; ++i)
+                d[i] = discount(t[i], extrapolate);
+            return;
+        }
+        discountsImpl(t, d, n);
+    }
+
+    void YieldTermStructure::discountsImpl(const Time* t,
+                                           DiscountFactor* d,
+                                           Size n) const {
+        for (Size i=0; i<n; ++i)
+            d[i] = discountImpl(t[i]);
+    }
+
     InterestRate YieldTermStructure::zeroRate(const Date& d,
                                               const DayCounter& dayCounter,
                                               Compounding comp,
@@ -134,7 +160,7 @@ namespace QuantLib {
                                                  bool extrapolate) const {
         if (d1==d2) {
             checkRange(d1, extrapolate);
-            Time t1 = std::max(timeFromReference(d1) - dt/2.0, 0.0);
+            Time t1 = std::max(timeFromReference(d1) - dt/2.0, Time(0.0));
             Time t2 = t1 + dt;
             Real compound =
                 discount(t1, true)/discount(t2, true);
@@ -159,7 +185,7 @@ namespace QuantLib {
         Real compound;
         if (t2==t1) {
             checkRange(t1, extrapolate);
-            t1 = std::max(t1 - dt/2.0, 0.0);
+            t1 = std::max(t1 - dt/2.0, Time(0.0));
             t2 = t1 + dt;
             compound = discount(t1, true)/discount(t2, true);
         } else {
@@ -75,6 +75,14 @@ namespace QuantLib {
         */
         DiscountFactor discount(Time t,
                                 bool extrapolate = false) const;
+        /*! Discount factors at the \p n times in \p t, which must be
+            sorted in increasing order, written to \p d.  Derived
+            curves can calculate them in a single pass.
+        */
+        void discounts(const Time* t,
+                       DiscountFactor* d,
+                       Size n,
+                       bool extrapolate = false) const;
         //@}
 
         /*! \name Zero-yield rates
@@ -165,6 +173,8 @@ namespace QuantLib {
         //@{
         //! discount factor calculation
         virtual DiscountFactor discountImpl(Time) const = 0;
+        //! discount factors at sorted times; by default, calls discountImpl
+        virtual void discountsImpl(const Time* t, DiscountFactor* d, Size n) const;
         //@}
       private:
         // methods
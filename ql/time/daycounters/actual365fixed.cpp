@@ -50,7 +50,7 @@ namespace QuantLib {
 
         Time dcs = daysBetween(d1,d2);
         Time dcc = daysBetween(refPeriodStart,refPeriodEnd);
-        auto months = Integer(std::lround(12 * dcc / 365));
+        auto months = Integer(lround(12 * dcc / 365));
         QL_REQUIRE(months != 0,
                    "invalid reference period for Act/365 Canadian; "
                    "must be longer than a month");
@@ -31,8 +31,8 @@ namespace QuantLib {
         Integer findCouponsPerYear(const T& impl,
                                    Date refStart, Date refEnd) {
             // This will only work for day counts longer than 15 days.
-            auto months = (Integer)std::lround(12 * Real(impl.dayCount(refStart, refEnd)) / 365.0);
-            return (Integer)std::lround(12.0 / Real(months));
+            auto months = (Integer)lround(12 * Real(impl.dayCount(refStart, refEnd)) / 365.0);
+            return (Integer)lround(12.0 / Real(months));
         }
 
         /* An ISMA day counter either needs a schedule or to have
@@ -205,7 +205,7 @@ namespace QuantLib {
                    << ", reference period end: " << refPeriodEnd);
 
         // estimate roughly the length in months of a period
-        auto months = (Integer)std::lround(12 * Real(refPeriodEnd - refPeriodStart) / 365);
+        auto months = (Integer)lround(12 * Real(refPeriodEnd - refPeriodStart) / 365);
 
         // for short periods...
         if (months == 0) {
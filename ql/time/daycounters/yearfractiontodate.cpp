@@ -38,7 +38,7 @@ namespace QuantLib {
         if (close_enough(guessTime, t))
             return guessDate;
 
-        const auto searchDirection = boost::numeric_cast<Integer>(copysign(1.0, t - guessTime));
+        const auto searchDirection = boost::numeric_cast<Integer>(std::copysign(1.0, static_cast<double>(t - guessTime)));
 
         t += searchDirection*100*QL_EPSILON;
 
@@ -53,9 +53,9 @@ namespace QuantLib {
 
         guessTime = dayCounter.yearFraction(referenceDate, guessDate);
         if (close_enough(guessTime, t)
-                || std::abs(dayCounter.yearFraction(referenceDate,
+                || abs(dayCounter.yearFraction(referenceDate,
                     guessDate + Period(searchDirection, Days)) - t) >
-                    std::abs(guessTime - t))
+                    abs(guessTime - t))
             return guessDate;
         else
             return guessDate + Period(searchDirection, Days);
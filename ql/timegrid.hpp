@@ -126,7 +126,7 @@ namespace QuantLib {
                 Time periodEnd = *t;
                 if (periodEnd != 0.0) {
                     // the nearest integer, at least 1
-                    Size nSteps = std::max(Size(std::lround((periodEnd - periodBegin)/dtMax)), Size(1));
+                    Size nSteps = std::max(Size(lround((periodEnd - periodBegin)/dtMax)), Size(1));
                     Time dt = (periodEnd - periodBegin)/nSteps;
                     for (Size n=1; n<=nSteps; ++n)
                         times_.push_back(periodBegin + n*dt);
@@ -26,7 +26,9 @@
 #define quantlib_types_hpp
 
 #include <qldefines.hpp>
+#include <cmath>
 #include <cstddef>
+#include <cstdlib>
 
 namespace QuantLib {
 
@@ -81,6 +83,50 @@ namespace QuantLib {
     /*! \ingroup types */
     typedef Real Probability;
 
+    /* The standard mathematical functions are called unqualified
+       throughout the library, so that argument-dependent lookup can
+       find the corresponding overloads when Real is a user-defined type
+       (see ql/math/adjointreal.hpp.)
+    */
+    using std::exp;
+    using std::log;
+    using std::log10;
+    using std::expm1;
+    using std::log1p;
+    using std::sqrt;
+    using std::cbrt;
+    using std::pow;
+    using std::fabs;
+    using std::abs;
+    using std::sin;
+    using std::cos;
+    using std::tan;
+    using std::asin;
+    using std::acos;
+    using std::atan;
+    using std::atan2;
+    using std::sinh;
+    using std::cosh;
+    using std::tanh;
+    using std::erf;
+    using std::erfc;
+    using std::hypot;
+    using std::fmod;
+    using std::ldexp;
+    using std::frexp;
+    using std::modf;
+    using std::fmax;
+    using std::fmin;
+    using std::floor;
+    using std::ceil;
+    using std::round;
+    using std::trunc;
+    using std::lround;
+    using std::isnan;
+    using std::isinf;
+    using std::isfinite;
+    using std::signbit;
+
 }
 
 
@@ -32,14 +32,25 @@
 
 namespace QuantLib {
 
+    namespace detail {
+
+        // floating-point types, including user-defined ones such
+        // as the number types used for algorithmic differentiation
+        template <typename T>
+        constexpr bool is_real_v =
+            std::is_floating_point_v<T> ||
+            (std::numeric_limits<T>::is_specialized && !std::numeric_limits<T>::is_integer);
+
+    }
+
     #ifdef QL_NULL_AS_FUNCTIONS
 
     //! template function providing a null value for a given type.
     template <typename T>
     T Null() {
-        if constexpr (std::is_floating_point_v<T>) {
+        if constexpr (detail::is_real_v<T>) {
             // a specific, unlikely value that should fit into any Real
-            return (std::numeric_limits<float>::max)();
+            return T((std::numeric_limits<float>::max)());
         } else if constexpr (std::is_integral_v<T>) {
             // this should fit into any Integer
             return (std::numeric_limits<int>::max)();
@@ -60,9 +71,9 @@ namespace QuantLib {
       public:
         Null() = default;
         operator T() const {
-            if constexpr (std::is_floating_point_v<T>) {
+            if constexpr (detail::is_real_v<T>) {
                 // a specific, unlikely value that should fit into any Real
-                return (std::numeric_limits<float>::max)();
+                return T((std::numeric_limits<float>::max)());
             } else if constexpr (std::is_integral_v<T>) {
                 // this should fit into any Integer
                 return (std::numeric_limits<int>::max)();
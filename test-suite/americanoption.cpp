@@ -30,6 +30,13 @@
 #include <math/integrals/integral.hpp>
 #include <math/randomnumbers/rngtraits.hpp>
 #include <math/statistics/incrementalstatistics.hpp>
+#include <methods/finitedifferences/meshers/fdmblackscholesmesher.hpp>
+#include <methods/finitedifferences/meshers/fdmmeshercomposite.hpp>
+#include <methods/finitedifferences/meshers/uniform1dmesher.hpp>
+#include <methods/finitedifferences/operators/fdmblackscholesop.hpp>
+#include <methods/finitedifferences/solvers/fdm2dimsolver.hpp>
+#include <methods/finitedifferences/stepconditions/fdmstepconditioncomposite.hpp>
+#include <methods/finitedifferences/utilities/fdminnervaluecalculator.hpp>
 #include <pricingengines/vanilla/analyticeuropeanengine.hpp>
 #include <pricingengines/vanilla/baroneadesiwhaleyengine.hpp>
 #include <pricingengines/vanilla/bjerksundstenslandengine.hpp>
@@ -43,6 +50,7 @@
 #include <time/daycounters/actual360.hpp>
 #include <time/daycounters/thirty360.hpp>
 #include <utilities/dataformatters.hpp>
+#include <algorithm>
 #include <map>
 
 using namespace QuantLib;
@@ -1009,6 +1017,347 @@ BOOST_AUTO_TEST_CASE(testCallPutParity) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testFdEngineOperatorReuse) {
+    BOOST_TEST_MESSAGE(
+        "Testing reuse of the finite-difference operators across repricings...");
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(8, April, 2022);
+    Settings::instance().evaluationDate() = today;
+
+    const auto spot = ext::make_shared<SimpleQuote>(100.0);
+    const auto process = ext::make_shared<BlackScholesMertonProcess>(
+        Handle<Quote>(spot),
+        Handle<YieldTermStructure>(flatRate(0.02, dc)),
+        Handle<YieldTermStructure>(flatRate(0.05, dc)),
+        Handle<BlackVolTermStructure>(flatVol(0.3, dc)));
+
+    const Date maturityDate = today + Period(1, Years);
+    const auto american =
+        ext::make_shared<AmericanExercise>(today, maturityDate);
+    const auto european = ext::make_shared<EuropeanExercise>(maturityDate);
+
+    const auto sharedEngine =
+        ext::make_shared<FdBlackScholesVanillaEngine>(process, 100, 200);
+
+    std::vector<ext::shared_ptr<VanillaOption>> options = {
+        ext::make_shared<VanillaOption>(
+            ext::make_shared<PlainVanillaPayoff>(Option::Put, 100.0), american),
+        ext::make_shared<VanillaOption>(
+            ext::make_shared<PlainVanillaPayoff>(Option::Call, 100.0), american),
+        ext::make_shared<VanillaOption>(
+            ext::make_shared<CashOrNothingPayoff>(Option::Call, 100.0, 10.0),
+            european),
+        ext::make_shared<VanillaOption>(
+            ext::make_shared<PlainVanillaPayoff>(Option::Put, 110.0), american)
+    };
+    for (const auto& option: options)
+        option->setPricingEngine(sharedEngine);
+
+    const Real tol = 1e-12;
+    for (Real s: {100.0, 105.0}) {
+        spot->setValue(s);
+
+        for (const auto& option: options) {
+            const auto payoff =
+                ext::dynamic_pointer_cast<StrikedTypePayoff>(option->payoff());
+            VanillaOption fresh(payoff, option->exercise());
+            fresh.setPricingEngine(
+                ext::make_shared<FdBlackScholesVanillaEngine>(process, 100, 200));
+
+            const Real diff = std::fabs(option->NPV() - fresh.NPV());
+            if (diff > tol || std::fabs(option->delta() - fresh.delta()) > tol)
+                BOOST_FAIL("reused operators do not reproduce the fresh engine"
+                           << "\n    spot      : " << s
+                           << "\n    strike    : " << payoff->strike()
+                           << "\n    reused NPV: " << option->NPV()
+                           << "\n    fresh NPV : " << fresh.NPV()
+                           << "\n    difference: " << diff);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testFdTangentVega) {
+    BOOST_TEST_MESSAGE(
+        "Testing tangent-linear vega of the finite-difference engine...");
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(8, April, 2022);
+    Settings::instance().evaluationDate() = today;
+
+    const auto spot = ext::make_shared<SimpleQuote>(100.0);
+    const auto vol = ext::make_shared<SimpleQuote>(0.25);
+    const auto process = ext::make_shared<BlackScholesMertonProcess>(
+        Handle<Quote>(spot),
+        Handle<YieldTermStructure>(flatRate(0.03, dc)),
+        Handle<YieldTermStructure>(flatRate(0.06, dc)),
+        Handle<BlackVolTermStructure>(flatVol(vol, dc)));
+
+    const Date maturityDate = today + Period(1, Years);
+
+    const auto fdEngine = ext::shared_ptr<PricingEngine>(
+        MakeFdBlackScholesVanillaEngine(process)
+        .withTGrid(200)
+        .withXGrid(400)
+        .withDampingSteps(2)
+        .withVega());
+
+    // European option against the analytic vega
+    VanillaOption european(
+        ext::make_shared<PlainVanillaPayoff>(Option::Call, 105.0),
+        ext::make_shared<EuropeanExercise>(maturityDate));
+
+    european.setPricingEngine(
+        ext::make_shared<AnalyticEuropeanEngine>(process));
+    const Real analyticVega = european.vega();
+
+    european.setPricingEngine(fdEngine);
+    const Real fdVega = european.vega();
+
+    if (std::fabs(fdVega - analyticVega) > 1e-3*analyticVega)
+        BOOST_FAIL("failed to reproduce the analytic European vega"
+                   << "\n    tangent vega : " << fdVega
+                   << "\n    analytic vega: " << analyticVega);
+
+    // American option against bump and revalue on the same grid
+    VanillaOption american(
+        ext::make_shared<PlainVanillaPayoff>(Option::Put, 105.0),
+        ext::make_shared<AmericanExercise>(today, maturityDate));
+
+    american.setPricingEngine(fdEngine);
+    const Real tangentVega = american.vega();
+
+    const Real h = 1e-4;
+    vol->setValue(0.25 + h);
+    const Real up = american.NPV();
+    vol->setValue(0.25 - h);
+    const Real down = american.NPV();
+    vol->setValue(0.25);
+
+    const Real bumpedVega = (up - down)/(2*h);
+
+    if (std::fabs(tangentVega - bumpedVega) > 1e-3*bumpedVega)
+        BOOST_FAIL("failed to reproduce the bumped American vega"
+                   << "\n    tangent vega: " << tangentVega
+                   << "\n    bumped vega : " << bumpedVega);
+
+    // no vega unless requested
+    american.setPricingEngine(
+        ext::make_shared<FdBlackScholesVanillaEngine>(process, 200, 400));
+    BOOST_CHECK_THROW(american.vega(), Error);
+}
+
+BOOST_AUTO_TEST_CASE(testFdTangentVegaWithCashDividends) {
+    BOOST_TEST_MESSAGE(
+        "Testing tangent-linear vega of the finite-difference engine "
+        "with cash dividends...");
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(8, April, 2022);
+    Settings::instance().evaluationDate() = today;
+
+    const auto spot = ext::make_shared<SimpleQuote>(100.0);
+    const auto vol = ext::make_shared<SimpleQuote>(0.25);
+    const auto process = ext::make_shared<BlackScholesMertonProcess>(
+        Handle<Quote>(spot),
+        Handle<YieldTermStructure>(flatRate(0.03, dc)),
+        Handle<YieldTermStructure>(flatRate(0.0, dc)),
+        Handle<BlackVolTermStructure>(flatVol(vol, dc)));
+
+    const Date maturityDate = today + Period(1, Years);
+    const std::vector<Date> dividendDates = {
+        today + Period(3, Months), today + Period(9, Months) };
+    const std::vector<Real> dividendAmounts = { 2.0, 2.5 };
+
+    VanillaOption american(
+        ext::make_shared<PlainVanillaPayoff>(Option::Put, 105.0),
+        ext::make_shared<AmericanExercise>(today, maturityDate));
+    VanillaOption european(
+        ext::make_shared<PlainVanillaPayoff>(Option::Call, 95.0),
+        ext::make_shared<EuropeanExercise>(maturityDate));
+
+    // the tangent follows the damping steps and the scheme of the rollback
+    const std::pair<FdmSchemeDesc, Size> schemes[] = {
+        { FdmSchemeDesc::Douglas(), 2 },
+        { FdmSchemeDesc(FdmSchemeDesc::DouglasType, 0.7, 0.0), 0 },
+        { FdmSchemeDesc::ImplicitEuler(), 0 }
+    };
+
+    for (const auto& scheme : schemes) {
+        const auto fdEngine = ext::shared_ptr<PricingEngine>(
+            MakeFdBlackScholesVanillaEngine(process)
+            .withTGrid(200)
+            .withXGrid(400)
+            .withDampingSteps(scheme.second)
+            .withFdmSchemeDesc(scheme.first)
+            .withCashDividends(dividendDates, dividendAmounts)
+            .withVega());
+
+        for (auto* option : { &american, &european }) {
+            option->setPricingEngine(fdEngine);
+            const Real tangentVega = option->vega();
+
+            const Real h = 1e-4;
+            vol->setValue(0.25 + h);
+            const Real up = option->NPV();
+            vol->setValue(0.25 - h);
+            const Real down = option->NPV();
+            vol->setValue(0.25);
+
+            const Real bumpedVega = (up - down)/(2*h);
+
+            if (std::fabs(tangentVega - bumpedVega) > 1e-3*bumpedVega)
+                BOOST_ERROR("failed to reproduce the bumped vega "
+                            "with cash dividends"
+                            << "\n    scheme type:   " << scheme.first.type
+                            << "\n    theta:         " << scheme.first.theta
+                            << "\n    damping steps: " << scheme.second
+                            << "\n    payoff:        " << option->payoff()
+                            << "\n    tangent vega:  " << tangentVega
+                            << "\n    bumped vega:   " << bumpedVega);
+        }
+    }
+
+    // no vega with adaptive time stepping, but the price is still there
+    american.setPricingEngine(
+        MakeFdBlackScholesVanillaEngine(process)
+        .withTGrid(50)
+        .withXGrid(200)
+        .withFdmSchemeDesc(FdmSchemeDesc::Douglas().withAdaptiveTimeStepping(1e-4))
+        .withCashDividends(dividendDates, dividendAmounts)
+        .withVega());
+    BOOST_CHECK_NO_THROW(american.NPV());
+    BOOST_CHECK_THROW(american.vega(), Error);
+}
+
+BOOST_AUTO_TEST_CASE(testFdm2DimSolverTangent) {
+    BOOST_TEST_MESSAGE(
+        "Testing tangent-linear sensitivity of the two-dimensional solver...");
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(8, April, 2022);
+    Settings::instance().evaluationDate() = today;
+
+    const Real strike = 105.0;
+    const auto process = ext::make_shared<BlackScholesMertonProcess>(
+        Handle<Quote>(ext::make_shared<SimpleQuote>(100.0)),
+        Handle<YieldTermStructure>(flatRate(0.03, dc)),
+        Handle<YieldTermStructure>(flatRate(0.06, dc)),
+        Handle<BlackVolTermStructure>(flatVol(0.25, dc)));
+
+    const Date maturityDate = today + Period(1, Years);
+    const Time maturity = dc.yearFraction(today, maturityDate);
+    const ext::shared_ptr<Exercise> exercise =
+        ext::make_shared<EuropeanExercise>(maturityDate);
+    const ext::shared_ptr<StrikedTypePayoff> payoff =
+        ext::make_shared<PlainVanillaPayoff>(Option::Call, strike);
+
+    // the Black-Scholes operator acts along the first direction only,
+    // the second one is a spectator
+    const ext::shared_ptr<FdmMesher> mesher =
+        ext::make_shared<FdmMesherComposite>(
+            ext::make_shared<FdmBlackScholesMesher>(200, process, maturity, strike),
+            ext::make_shared<Uniform1dMesher>(0.0, 1.0, 5));
+    const auto op = ext::make_shared<FdmBlackScholesOp>(mesher, process, strike);
+    const auto calculator = ext::make_shared<FdmLogInnerValue>(payoff, mesher, 0);
+
+    const FdmSolverDesc solverDesc = {
+        mesher, FdmBoundaryConditionSet(),
+        FdmStepConditionComposite::vanillaComposite(
+            DividendSchedule(), exercise, mesher, calculator, today, dc),
+        calculator, maturity, 100, 0 };
+
+    const Fdm2DimSolver solver(
+        solverDesc, FdmSchemeDesc::Douglas(), op,
+        [op](const Array& u, Time t1, Time t2) { return op->apply_vega(u, t1, t2); });
+
+    VanillaOption option(payoff, exercise);
+    option.setPricingEngine(ext::make_shared<AnalyticEuropeanEngine>(process));
+    const Real analyticVega = option.vega();
+
+    for (Real y : { 0.0, 0.5, 1.0 }) {
+        const Real tangentVega = solver.tangentAt(std::log(100.0), y);
+        if (std::fabs(tangentVega - analyticVega) > 5e-3*analyticVega)
+            BOOST_ERROR("failed to reproduce the analytic vega "
+                        "with the two-dimensional solver"
+                        << "\n    y:             " << y
+                        << "\n    tangent vega:  " << tangentVega
+                        << "\n    analytic vega: " << analyticVega);
+    }
+
+    // no tangent without a source
+    const Fdm2DimSolver noTangent(solverDesc, FdmSchemeDesc::Douglas(), op);
+    BOOST_CHECK(noTangent.tangentAt(std::log(100.0), 0.5) == Null<Real>());
+}
+
+BOOST_AUTO_TEST_CASE(testFdEngineStrikeLadder) {
+    BOOST_TEST_MESSAGE(
+        "Testing finite-difference pricing of a strike ladder in one rollback...");
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(8, April, 2022);
+    Settings::instance().evaluationDate() = today;
+
+    const auto process = ext::make_shared<BlackScholesMertonProcess>(
+        Handle<Quote>(ext::make_shared<SimpleQuote>(100.0)),
+        Handle<YieldTermStructure>(flatRate(0.02, dc)),
+        Handle<YieldTermStructure>(flatRate(0.05, dc)),
+        Handle<BlackVolTermStructure>(flatVol(0.3, dc)));
+
+    const Date maturityDate = today + Period(1, Years);
+    const std::vector<ext::shared_ptr<Exercise> > exercises = {
+        ext::make_shared<AmericanExercise>(today, maturityDate),
+        ext::make_shared<EuropeanExercise>(maturityDate) };
+
+    const std::vector<Real> strikes = {
+        80.0, 85.0, 90.0, 95.0, 100.0, 105.0, 110.0, 115.0, 120.0 };
+
+    const FdBlackScholesVanillaEngine engine(process, 200, 400);
+
+    // the ladder shares the mesher concentrated around the middle
+    // strike, hence it differs from single pricings by the
+    // discretization error only
+    const Real tol = 5e-3;
+    for (const auto& exercise: exercises) {
+        for (Option::Type type: { Option::Put, Option::Call }) {
+            const std::vector<Real> ladder =
+                engine.strikeLadder(type, strikes, exercise);
+
+            // the order of the strikes must not matter
+            const std::vector<Real> shuffled = {
+                80.0, 120.0, 85.0, 115.0, 90.0, 110.0, 95.0, 105.0, 100.0 };
+            const std::vector<Real> shuffledLadder =
+                engine.strikeLadder(type, shuffled, exercise);
+            for (Size i=0; i < shuffled.size(); ++i) {
+                const Size j = std::find(strikes.begin(), strikes.end(), shuffled[i])
+                    - strikes.begin();
+                if (std::fabs(shuffledLadder[i] - ladder[j]) > 1e-10)
+                    BOOST_FAIL("strike ladder depends on the order of the strikes"
+                               << "\n    strike    : " << shuffled[i]
+                               << "\n    sorted    : " << ladder[j]
+                               << "\n    shuffled  : " << shuffledLadder[i]);
+            }
+
+            for (Size i=0; i < strikes.size(); ++i) {
+                VanillaOption option(
+                    ext::make_shared<PlainVanillaPayoff>(type, strikes[i]), exercise);
+                option.setPricingEngine(
+                    ext::make_shared<FdBlackScholesVanillaEngine>(process, 200, 400));
+
+                const Real diff = std::fabs(ladder[i] - option.NPV());
+                if (diff > tol)
+                    BOOST_FAIL("strike ladder does not reproduce single pricing"
+                               << "\n    exercise  : " << exercise->type()
+                               << "\n    type      : " << type
+                               << "\n    strike    : " << strikes[i]
+                               << "\n    ladder    : " << ladder[i]
+                               << "\n    single    : " << option.NPV()
+                               << "\n    difference: " << diff);
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testQdPlusBoundaryValues) {
     BOOST_TEST_MESSAGE("Testing QD+ boundary approximation...");
 
@@ -23,8 +23,21 @@
 
 #include "toplevelfixture.hpp"
 #include "utilities.hpp"
+#include <indexes/ibor/euribor.hpp>
+#include <instruments/makevanillaswap.hpp>
+#include <math/adjointreal.hpp>
+#include <math/interpolations/loginterpolation.hpp>
 #include <pricingengines/blackformula.hpp>
+#include <pricingengines/swap/discountingswapengine.hpp>
+#include <quotes/simplequote.hpp>
+#include <termstructures/yield/piecewiseyieldcurve.hpp>
+#include <termstructures/yield/ratehelpers.hpp>
+#include <time/calendars/target.hpp>
+#include <time/daycounters/actual360.hpp>
+#include <time/daycounters/thirty360.hpp>
+#include <algorithm>
 #include <cmath>
+#include <type_traits>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -40,7 +53,7 @@ BOOST_AUTO_TEST_CASE(testBachelierImpliedVol) {
     Real forward = 1.0;
     Real bpvol = 0.01;
     Real tte = 10.0;
-    Real stdDev = bpvol * std::sqrt(tte);
+    Real stdDev = bpvol * sqrt(tte);
     Option::Type optionType = Option::Call;
     Real discount = 0.95;
 
@@ -48,21 +61,21 @@ BOOST_AUTO_TEST_CASE(testBachelierImpliedVol) {
     for (Real i : d) {
 
 
-        Real strike = forward - i * bpvol * std::sqrt(tte);
+        Real strike = forward - i * bpvol * sqrt(tte);
 
         Real callPrem = bachelierBlackFormula(optionType, strike, forward, stdDev, discount);
 
         Real impliedBpVol = bachelierBlackFormulaImpliedVolChoi(optionType, strike, forward, tte,
                                                                 callPrem, discount);
 
-        if (std::fabs(bpvol - impliedBpVol) > 1.0e-12) {
+        if (fabs(bpvol - impliedBpVol) > 1.0e-12) {
             BOOST_ERROR("Failed, expected " << bpvol << " realised " << impliedBpVol);
         }
 
         Real impliedBpVolExact =
             bachelierBlackFormulaImpliedVol(optionType, strike, forward, tte, callPrem, discount);
 
-        if (std::fabs(bpvol - impliedBpVolExact) > 1.0e-15) {
+        if (fabs(bpvol - impliedBpVolExact) > 1.0e-15) {
             BOOST_ERROR("Failed, expected " << bpvol << " realised " << impliedBpVolExact);
         }
     }
@@ -124,12 +137,12 @@ BOOST_AUTO_TEST_CASE(testRadoicicStefanicaImpliedVol) {
 
     const Time T = 1.7;
     const Rate r = 0.1;
-    const DiscountFactor df = std::exp(-r*T);
+    const DiscountFactor df = exp(-r*T);
 
     const Real forward = 100;
 
     const Volatility vol = 0.3;
-    const Real stdDev = vol * std::sqrt(T);
+    const Real stdDev = vol * sqrt(T);
 
     const Option::Type types[] = { Option::Call, Option::Put };
     const Real strikes[] = {
@@ -145,9 +158,9 @@ BOOST_AUTO_TEST_CASE(testRadoicicStefanicaImpliedVol) {
             const Real marketValue = blackFormula(payoff, forward, stdDev, df);
 
             const Real estVol = blackFormulaImpliedStdDevApproximationRS(
-                payoff, forward, marketValue, df) / std::sqrt(T);
+                payoff, forward, marketValue, df) / sqrt(T);
 
-            const Real error = std::fabs(estVol - vol);
+            const Real error = fabs(estVol - vol);
             if (error > tol) {
                 BOOST_ERROR("Failed to verify Radoicic-Stefanica"
                     "approximation for "
@@ -177,13 +190,13 @@ BOOST_AUTO_TEST_CASE(testRadoicicStefanicaLowerBound) {
     const Real k = 1.2;
 
     for (Real s=0.17; s < 2.9; s+=0.01) {
-        const Real strike = std::exp(k)*forward;
+        const Real strike = exp(k)*forward;
         const Real c = blackFormula(Option::Call, strike, forward, s);
         const Real estimate = blackFormulaImpliedStdDevApproximationRS(
             Option::Call, strike, forward, c);
 
         const Real error = s - estimate;
-        if (std::isnan(estimate) || std::fabs(error) > 0.05) {
+        if (isnan(estimate) || fabs(error) > 0.05) {
             BOOST_ERROR("Failed to lower bound Radoicic-Stefanica"
                 "approximation for "
                 << "\n forward     :" << forward
@@ -222,7 +235,7 @@ BOOST_AUTO_TEST_CASE(testImpliedVolAdaptiveSuccessiveOverRelaxation) {
     const DiscountFactor df = rTS->discount(exerciseDate);
 
     const Volatility vol = 0.20;
-    const Real stdDev = vol * std::sqrt(exerciseTime);
+    const Real stdDev = vol * sqrt(exerciseTime);
 
     const Real s0     = 100;
     const Real forward= s0 * qTS->discount(exerciseDate)/df;
@@ -246,7 +259,7 @@ BOOST_AUTO_TEST_CASE(testImpliedVolAdaptiveSuccessiveOverRelaxation) {
                     payoff, forward, marketValue, df, displacement,
                     Null<Real>(), 1.0, tol, 100);
 
-                const Real error = std::fabs(impliedStdDev - stdDev);
+                const Real error = fabs(impliedStdDev - stdDev);
                 if (error > 10*tol) {
                     BOOST_ERROR("Failed to calculated implied volatility"
                                 " with adaptive successive over-relaxation"
@@ -270,7 +283,7 @@ void assertBlackFormulaForwardDerivative(
 {
     Real forward = 1.0;
     Real tte = 10.0;
-    Real stdDev = bpvol * std::sqrt(tte);
+    Real stdDev = bpvol * sqrt(tte);
     Real discount = 0.95;
     Real displacement = 0.01;
     Real bump = 0.0001;
@@ -362,7 +375,7 @@ void assertBachelierBlackFormulaForwardDerivative(
 {
     Real forward = 1.0;
     Real tte = 10.0;
-    Real stdDev = bpvol * std::sqrt(tte);
+    Real stdDev = bpvol * sqrt(tte);
     Real discount = 0.95;
     Real bump = 0.0001;
     Real epsilon = 1.e-10;
@@ -442,6 +455,430 @@ BOOST_AUTO_TEST_CASE(testBachelierBlackFormulaForwardDerivativeWithZeroVolatilit
     assertBachelierBlackFormulaForwardDerivative(Option::Put, strikes, vol);
 }
 
+BOOST_AUTO_TEST_CASE(testBatchBlackFormula) {
+
+    BOOST_TEST_MESSAGE("Testing batch Black formula against single options...");
+
+    std::vector<Option::Type> types;
+    std::vector<Real> strikes, forwards, stdDevs, discounts;
+
+    const Option::Type optionTypes[] = { Option::Call, Option::Put };
+    const Real strikeValues[] = { 0.0, 50.0, 90.0, 100.0, 110.0, 250.0 };
+    const Real stdDevValues[] = { 0.0, 1e-4, 0.1, 0.3, 1.0, 5.0 };
+    const Real displacements[] = { 0.0, 20.0 };
+
+    // more than one block, so that the block boundaries are crossed
+    for (Size i=0; i<3; ++i) {
+        for (auto type : optionTypes) {
+            for (auto strike : strikeValues) {
+                for (auto stdDev : stdDevValues) {
+                    for (Real forward = 60.0; forward < 160.0; forward += 20.0) {
+                        types.push_back(type);
+                        strikes.push_back(strike);
+                        forwards.push_back(forward + 1.0*i);
+                        stdDevs.push_back(stdDev);
+                        discounts.push_back(0.95 - 0.05*i);
+                    }
+                }
+            }
+        }
+    }
+
+    const Size n = types.size();
+    const Real tolerance = 1e-12;
+    std::vector<Real> values(n), deltas(n), vegas(n);
+
+    for (auto displacement : displacements) {
+        blackFormula(n, &types[0], &strikes[0], &forwards[0], &stdDevs[0],
+                     &discounts[0], &values[0], &deltas[0], &vegas[0],
+                     displacement);
+
+        for (Size i=0; i<n; ++i) {
+            const Real expected[] = {
+                blackFormula(types[i], strikes[i], forwards[i], stdDevs[i],
+                             discounts[i], displacement),
+                blackFormulaForwardDerivative(types[i], strikes[i], forwards[i],
+                                              stdDevs[i], discounts[i],
+                                              displacement),
+                blackFormulaStdDevDerivative(strikes[i], forwards[i],
+                                             stdDevs[i], discounts[i],
+                                             displacement) };
+            const Real calculated[] = { values[i], deltas[i], vegas[i] };
+            const char* names[] = { "value", "forward derivative",
+                                    "stdDev derivative" };
+            for (Size j=0; j<3; ++j) {
+                if (fabs(calculated[j] - expected[j])
+                    > tolerance * std::max(Real(1.0), fabs(expected[j]))) {
+                    BOOST_ERROR("failed to reproduce " << names[j]
+                                << " of single option:"
+                                << "\n    type:         " << types[i]
+                                << "\n    strike:       " << strikes[i]
+                                << "\n    forward:      " << forwards[i]
+                                << "\n    stdDev:       " << stdDevs[i]
+                                << "\n    displacement: " << displacement
+                                << std::setprecision(16)
+                                << "\n    calculated:   " << calculated[j]
+                                << "\n    expected:     " << expected[j]);
+                }
+            }
+        }
+    }
+
+    // the greeks are optional
+    std::vector<Real> valuesOnly(n);
+    blackFormula(n, &types[0], &strikes[0], &forwards[0], &stdDevs[0],
+                 &discounts[0], &valuesOnly[0]);
+    blackFormula(n, &types[0], &strikes[0], &forwards[0], &stdDevs[0],
+                 &discounts[0], &values[0], &deltas[0], &vegas[0]);
+    for (Size i=0; i<n; ++i) {
+        if (valuesOnly[i] != values[i])
+            BOOST_ERROR("values depend on the greeks being calculated");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testBatchImpliedStdDev) {
+
+    BOOST_TEST_MESSAGE("Testing batch Black implied standard deviation...");
+
+    std::vector<Option::Type> types;
+    std::vector<Real> strikes, forwards, stdDevs, discounts;
+
+    const Option::Type optionTypes[] = { Option::Call, Option::Put };
+    const Real strikeValues[] = { 50.0, 80.0, 95.0, 100.0, 105.0, 125.0, 200.0 };
+    const Real stdDevValues[] = { 0.05, 0.1, 0.3, 0.7, 1.5 };
+    const Real displacements[] = { 0.0, 20.0 };
+
+    for (Size i=0; i<3; ++i) {
+        for (auto type : optionTypes) {
+            for (auto strike : strikeValues) {
+                for (auto stdDev : stdDevValues) {
+                    for (Real forward = 80.0; forward < 130.0; forward += 10.0) {
+                        types.push_back(type);
+                        strikes.push_back(strike);
+                        forwards.push_back(forward + 1.0*i);
+                        stdDevs.push_back(stdDev);
+                        discounts.push_back(0.95 - 0.05*i);
+                    }
+                }
+            }
+        }
+    }
+
+    const Size n = types.size();
+    std::vector<Real> prices(n), implied(n);
+
+    for (auto displacement : displacements) {
+        blackFormula(n, &types[0], &strikes[0], &forwards[0], &stdDevs[0],
+                     &discounts[0], &prices[0], nullptr, nullptr,
+                     displacement);
+
+        Size failures =
+            blackFormulaImpliedStdDev(n, &types[0], &strikes[0], &forwards[0],
+                                      &prices[0], &discounts[0], &implied[0],
+                                      displacement, 1.0e-10);
+
+        for (Size i=0; i<n; ++i) {
+            // the out-of-the-money price carries the information;
+            // skip the quotes for which it's lost in round-off
+            const Real timeValue = std::min(prices[i],
+                prices[i] - Integer(types[i])*(forwards[i]-strikes[i])*discounts[i]);
+            if (timeValue < 1.0e-8) {
+                if (implied[i] == Null<Real>())
+                    --failures;
+                continue;
+            }
+            if (implied[i] == Null<Real>() ||
+                fabs(implied[i] - stdDevs[i]) > 1.0e-8) {
+                BOOST_ERROR("failed to recover standard deviation:"
+                            << "\n    type:         " << types[i]
+                            << "\n    strike:       " << strikes[i]
+                            << "\n    forward:      " << forwards[i]
+                            << "\n    displacement: " << displacement
+                            << "\n    price:        " << prices[i]
+                            << std::setprecision(16)
+                            << "\n    stdDev:       " << stdDevs[i]
+                            << "\n    implied:      " << implied[i]);
+            }
+        }
+        if (failures != 0)
+            BOOST_ERROR(failures << " unexpected failures reported");
+    }
+
+    // invalid quotes are flagged without affecting the others
+    const Option::Type badTypes[] = {
+        Option::Call, Option::Call, Option::Put, Option::Put, Option::Call };
+    const Real badStrikes[] = { 100.0, 100.0, 100.0, -10.0, 90.0 };
+    const Real badForwards[] = { 100.0, 100.0, 100.0, 100.0, 100.0 };
+    const Real badPrices[] = {
+        -1.0, 101.0, 0.0, 1.0,
+        blackFormula(Option::Call, 90.0, 100.0, 0.2, 0.9) };
+    const Real badDiscounts[] = { 1.0, 1.0, 1.0, 1.0, 0.9 };
+    Real results[5];
+
+    Size failures =
+        blackFormulaImpliedStdDev(5, badTypes, badStrikes, badForwards,
+                                  badPrices, badDiscounts, results);
+    if (failures != 3)
+        BOOST_ERROR("3 failures expected, " << failures << " reported");
+    for (Size i=0; i<2; ++i) {
+        if (results[i] != Null<Real>())
+            BOOST_ERROR("null result expected for quote #" << i
+                        << ", got " << results[i]);
+    }
+    if (results[2] != 0.0)
+        BOOST_ERROR("zero stdDev expected for null at-the-money price, got "
+                    << results[2]);
+    if (results[3] != Null<Real>())
+        BOOST_ERROR("null result expected for negative strike, got "
+                    << results[3]);
+    if (fabs(results[4] - 0.2) > 1.0e-6)
+        BOOST_ERROR("failed to recover standard deviation of valid quote:"
+                    << "\n    expected:   " << 0.2
+                    << "\n    calculated: " << results[4]);
+}
+
+BOOST_AUTO_TEST_CASE(testAdjointBlackFormulaDerivatives) {
+
+    BOOST_TEST_MESSAGE("Testing Black formula derivatives by adjoint "
+                       "differentiation...");
+
+    const Real strike = 105.0;
+    const Real tolerance = 1.0e-12;
+
+    // boost::unit_test::log would make the unqualified name ambiguous
+    using std::log;
+
+    AdjointTape& tape = AdjointTape::instance();
+    tape.clear();
+
+    AdjointReal forward = 100.0, stdDev = 0.25, discount = 0.95;
+    tape.registerInput(forward);
+    tape.registerInput(stdDev);
+    tape.registerInput(discount);
+
+    AdjointReal d1 = log(forward / strike) / stdDev + 0.5 * stdDev;
+    AdjointReal d2 = d1 - stdDev;
+    AdjointReal nd1 = 0.5 * erfc(-d1 / M_SQRT2);
+    AdjointReal nd2 = 0.5 * erfc(-d2 / M_SQRT2);
+    AdjointReal price = discount * (forward * nd1 - strike * nd2);
+
+    Real expected = blackFormula(Option::Call, strike, forward.value(),
+                                 stdDev.value(), discount.value());
+    if (fabs(price.value() - expected) > tolerance)
+        BOOST_ERROR("failed to reproduce Black price:"
+                    << "\n    expected:   " << expected
+                    << "\n    calculated: " << price.value());
+
+    tape.computeAdjoints(price);
+
+    Real expectedDelta =
+        blackFormulaForwardDerivative(Option::Call, strike, forward.value(),
+                                      stdDev.value(), discount.value());
+    Real expectedVega =
+        blackFormulaStdDevDerivative(strike, forward.value(),
+                                     stdDev.value(), discount.value());
+    Real expectedRho = expected / discount.value();
+
+    if (fabs(tape.adjoint(forward) - expectedDelta) > tolerance)
+        BOOST_ERROR("failed to reproduce forward derivative:"
+                    << "\n    expected:   " << expectedDelta
+                    << "\n    calculated: " << tape.adjoint(forward));
+    if (fabs(tape.adjoint(stdDev) - expectedVega) > tolerance)
+        BOOST_ERROR("failed to reproduce standard-deviation derivative:"
+                    << "\n    expected:   " << expectedVega
+                    << "\n    calculated: " << tape.adjoint(stdDev));
+    if (fabs(tape.adjoint(discount) - expectedRho) > tolerance)
+        BOOST_ERROR("failed to reproduce discount derivative:"
+                    << "\n    expected:   " << expectedRho
+                    << "\n    calculated: " << tape.adjoint(discount));
+
+    tape.clear();
+}
+
+BOOST_AUTO_TEST_CASE(testAdjointBootstrapSensitivities) {
+
+    BOOST_TEST_MESSAGE("Testing adjoint sensitivities of a hand-rolled "
+                       "discount-factor bootstrap...");
+
+    // deposits at 3 and 6 months, annual par swaps from 1 to 5 years
+    const std::vector<Time> depositTimes = { 0.25, 0.5 };
+    const std::vector<Real> rates = { 0.0310, 0.0305,
+                                      0.0300, 0.0290, 0.0282, 0.0278, 0.0275 };
+    const Real fixedRate = 0.029;
+
+    // the same code is run with Real, for bump-and-reprice, and with
+    // AdjointReal; the math functions are called unqualified so that
+    // the AdjointReal overloads are found by argument-dependent lookup
+    auto npv = [&](const auto& quotes) {
+        using T = std::decay_t<decltype(quotes[0])>;
+        using std::log;
+        std::vector<Time> times = { 0.0 };
+        std::vector<T> discounts = { T(1.0) };
+        for (Size i=0; i < depositTimes.size(); ++i) {
+            times.push_back(depositTimes[i]);
+            discounts.push_back(1.0 / (1.0 + quotes[i] * depositTimes[i]));
+        }
+        T annuity = 0.0;
+        for (Size i=depositTimes.size(); i < quotes.size(); ++i) {
+            const Time t = Real(i - depositTimes.size() + 1);
+            const T d = (1.0 - quotes[i] * annuity) / (1.0 + quotes[i]);
+            annuity += d;
+            times.push_back(t);
+            discounts.push_back(d);
+        }
+        // log-linear interpolation of the bootstrapped discounts
+        auto discount = [&](Time t) {
+            Size j = std::upper_bound(times.begin(), times.end(), t)
+                   - times.begin();
+            j = std::min<Size>(std::max<Size>(j, 1), times.size() - 1);
+            const Real w = (t - times[j-1]) / (times[j] - times[j-1]);
+            return T(exp((1.0 - w) * log(discounts[j-1])
+                         + w * log(discounts[j])));
+        };
+        // payer swap starting in 9 months, with annual fixed payments
+        T value = discount(0.75) - discount(3.75);
+        for (Size i=1; i <= 3; ++i)
+            value -= fixedRate * discount(0.75 + i);
+        return value;
+    };
+
+    AdjointTape& tape = AdjointTape::instance();
+    tape.clear();
+
+    std::vector<AdjointReal> inputs(rates.begin(), rates.end());
+    for (auto& x : inputs)
+        tape.registerInput(x);
+    const AdjointReal value = npv(inputs);
+
+    const Real expectedValue = npv(rates);
+    if (fabs(value.value() - expectedValue) > 1.0e-15)
+        BOOST_ERROR("failed to reproduce swap value:"
+                    << "\n    expected:   " << expectedValue
+                    << "\n    calculated: " << value.value());
+
+    tape.computeAdjoints(value);
+
+    const Real bump = 1.0e-6;
+    const Real tolerance = 1.0e-8;
+    for (Size i=0; i < rates.size(); ++i) {
+        std::vector<Real> bumped = rates;
+        bumped[i] = rates[i] + bump;
+        const Real up = npv(bumped);
+        bumped[i] = rates[i] - bump;
+        const Real down = npv(bumped);
+
+        const Real expected = (up - down) / (2.0*bump);
+        const Real calculated = tape.adjoint(inputs[i]);
+        if (fabs(calculated - expected) > tolerance)
+            BOOST_ERROR("failed to reproduce bump-and-reprice "
+                        "sensitivity to quote #" << i << ":"
+                        << "\n    bumped:   " << expected
+                        << "\n    adjoint:  " << calculated);
+    }
+
+    tape.clear();
+}
+
+#ifdef QL_USE_ADJOINT_REAL
+
+BOOST_AUTO_TEST_CASE(testAdjointCurveSensitivities) {
+
+    BOOST_TEST_MESSAGE("Testing adjoint sensitivities to the quotes "
+                       "of a bootstrapped curve...");
+
+    const Calendar calendar = TARGET();
+    const Date today = calendar.adjust(Date(16, October, 2024));
+    Settings::instance().evaluationDate() = today;
+    const Date settlement = calendar.advance(today, 2, Days);
+
+    const std::vector<Period> depositTenors = { 3*Months, 6*Months };
+    const std::vector<Period> swapTenors = { 2*Years, 3*Years, 5*Years,
+                                             7*Years, 10*Years };
+    const std::vector<Real> rates = { 0.0310, 0.0305,
+                                      0.0290, 0.0282, 0.0275, 0.0278, 0.0285 };
+
+    AdjointTape& tape = AdjointTape::instance();
+    tape.clear();
+
+    // the quotes are the inputs of the tape; everything else, from the
+    // bootstrap to the pricing, is recorded when calculated below
+    std::vector<AdjointReal> inputs(rates.begin(), rates.end());
+    std::vector<ext::shared_ptr<SimpleQuote> > quotes;
+    for (auto& x : inputs) {
+        tape.registerInput(x);
+        quotes.push_back(ext::make_shared<SimpleQuote>(x));
+    }
+
+    RelinkableHandle<YieldTermStructure> curveHandle;
+    const auto index = ext::make_shared<Euribor6M>(curveHandle);
+
+    std::vector<ext::shared_ptr<RateHelper> > helpers;
+    for (Size i=0; i < depositTenors.size(); ++i)
+        helpers.push_back(ext::make_shared<DepositRateHelper>(
+            Handle<Quote>(quotes[i]), depositTenors[i], 2, calendar,
+            ModifiedFollowing, true, Actual360()));
+    for (Size i=0; i < swapTenors.size(); ++i)
+        helpers.push_back(ext::make_shared<SwapRateHelper>(
+            Handle<Quote>(quotes[depositTenors.size()+i]), swapTenors[i],
+            calendar, Annual, Unadjusted, Thirty360(Thirty360::BondBasis),
+            ext::make_shared<Euribor6M>()));
+
+    curveHandle.linkTo(ext::make_shared<PiecewiseYieldCurve<Discount, LogLinear> >(
+        settlement, helpers, Actual360()));
+
+    const ext::shared_ptr<VanillaSwap> swap =
+        MakeVanillaSwap(6*Years, index, 0.028)
+        .withNominal(10000.0)
+        .withPricingEngine(ext::make_shared<DiscountingSwapEngine>(curveHandle));
+
+    // a payer swaption on the same swap, priced with the Black formula
+    const Real stdDev = 0.2 * sqrt(1.0);
+    auto prices = [&]() {
+        const Real annuity = fabs(swap->fixedLegBPS()) / 1.0e-4;
+        return std::make_pair(swap->NPV(),
+                              blackFormula(Option::Call, 0.028, swap->fairRate(),
+                                           stdDev, annuity));
+    };
+
+    const std::pair<Real, Real> values = prices();
+
+    std::vector<Real> swapDeltas(quotes.size()), swaptionDeltas(quotes.size());
+    tape.computeAdjoints(values.first);
+    for (Size i=0; i < inputs.size(); ++i)
+        swapDeltas[i] = tape.adjoint(inputs[i]);
+    tape.computeAdjoints(values.second);
+    for (Size i=0; i < inputs.size(); ++i)
+        swaptionDeltas[i] = tape.adjoint(inputs[i]);
+
+    const Real bump = 1.0e-6;
+    const Real tolerance = 1.0e-4;
+    for (Size i=0; i < quotes.size(); ++i) {
+        quotes[i]->setValue(rates[i] + bump);
+        const std::pair<Real, Real> up = prices();
+        quotes[i]->setValue(rates[i] - bump);
+        const std::pair<Real, Real> down = prices();
+        quotes[i]->setValue(rates[i]);
+
+        const Real expected[] = { (up.first - down.first) / (2.0*bump),
+                                  (up.second - down.second) / (2.0*bump) };
+        const Real calculated[] = { swapDeltas[i], swaptionDeltas[i] };
+        const char* names[] = { "swap", "swaption" };
+
+        for (Size k=0; k < 2; ++k) {
+            if (fabs(calculated[k] - expected[k])
+                > tolerance * std::max<Real>(1.0, fabs(expected[k])))
+                BOOST_ERROR("failed to reproduce bump-and-reprice " << names[k]
+                            << " sensitivity to quote #" << i << ":"
+                            << "\n    bumped:   " << expected[k]
+                            << "\n    adjoint:  " << calculated[k]);
+        }
+    }
+
+    tape.clear();
+}
+
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -30,6 +30,7 @@
 #include <cashflows/conundrumpricer.hpp>
 #include <cashflows/cashflowvectors.hpp>
 #include <cashflows/lineartsrpricer.hpp>
+#include <math/integrals/gaussianquadratures.hpp>
 #include <quotes/simplequote.hpp>
 #include <termstructures/volatility/swaption/swaptionvolmatrix.hpp>
 #include <termstructures/volatility/swaption/interpolatedswaptionvolatilitycube.hpp>
@@ -459,6 +460,79 @@ BOOST_AUTO_TEST_CASE(testParity) {
     }
 }
 
+namespace {
+
+    // integrates the same Gauss-Legendre rule one point at a time
+    class PointwiseGaussLegendreIntegrator : public Integrator {
+      public:
+        explicit PointwiseGaussLegendreIntegrator(Size n)
+        : Integrator(Null<Real>(), n), integration_(n) {}
+      private:
+        Real integrate(const std::function<Real(Real)>& f, Real a, Real b) const override {
+            const Real c1 = 0.5*(b-a), c2 = 0.5*(a+b);
+            return c1*integration_([&](Real x) { return f(c1*x+c2); });
+        }
+        GaussLegendreIntegration integration_;
+    };
+
+}
+
+BOOST_AUTO_TEST_CASE(testLinearTsrPricerOnFixedNodes) {
+
+    BOOST_TEST_MESSAGE("Testing linear TSR pricer with fixed integration nodes...");
+
+    CommonVars vars;
+
+    ext::shared_ptr<SwapIndex> swapIndex(new
+        EuriborSwapIsdaFixA(10*Years, vars.termStructure));
+    Date startDate = vars.termStructure->referenceDate() + 5*Years;
+    Date paymentDate = startDate + 1*Years;
+    CmsCoupon coupon(paymentDate, 1.0, startDate, paymentDate,
+                     swapIndex->fixingDays(), swapIndex,
+                     1.0, 0.0, startDate, paymentDate,
+                     vars.iborIndex->dayCounter());
+
+    Handle<Quote> meanReversion(ext::make_shared<SimpleQuote>(0.01));
+    const Size nodes = 64;
+    auto batch = ext::make_shared<LinearTsrPricer>(
+        vars.SabrVolCube1, meanReversion, Handle<YieldTermStructure>(),
+        LinearTsrPricer::Settings(), ext::make_shared<GaussLegendreIntegrator>(nodes));
+    auto pointwise = ext::make_shared<LinearTsrPricer>(
+        vars.SabrVolCube1, meanReversion, Handle<YieldTermStructure>(),
+        LinearTsrPricer::Settings(),
+        ext::make_shared<PointwiseGaussLegendreIntegrator>(nodes));
+    auto adaptive = ext::make_shared<LinearTsrPricer>(
+        vars.SabrVolCube1, meanReversion);
+
+    const auto prices = [&](const ext::shared_ptr<CmsCouponPricer>& pricer) {
+        coupon.setPricer(pricer);
+        pricer->initialize(coupon);
+        return std::vector<Real>{ pricer->swapletRate(),
+                                  pricer->capletRate(0.03),
+                                  pricer->floorletRate(0.03),
+                                  pricer->capletRate(0.06),
+                                  pricer->floorletRate(0.01) };
+    };
+    const std::vector<Real> batchPrices = prices(batch);
+    const std::vector<Real> pointwisePrices = prices(pointwise);
+    const std::vector<Real> adaptivePrices = prices(adaptive);
+
+    for (Size i=0; i<batchPrices.size(); ++i) {
+        if (std::fabs(batchPrices[i] - pointwisePrices[i]) > 1.0e-14)
+            BOOST_ERROR("\nbatch and pointwise integration differ:"
+                        "\n  price #" << i <<
+                        std::setprecision(16) <<
+                        "\n  batch:     " << batchPrices[i] <<
+                        "\n  pointwise: " << pointwisePrices[i]);
+        if (std::fabs(batchPrices[i] - adaptivePrices[i]) > 1.0e-6)
+            BOOST_ERROR("\nfixed-node and adaptive integration differ:"
+                        "\n  price #" << i <<
+                        std::setprecision(16) <<
+                        "\n  fixed nodes: " << batchPrices[i] <<
+                        "\n  adaptive:    " << adaptivePrices[i]);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
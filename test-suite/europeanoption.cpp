@@ -1292,6 +1292,82 @@ BOOST_AUTO_TEST_CASE(testQmcEngines) {
     testEngineConsistency(engine,steps,samples,relativeTol);
 }
 
+BOOST_AUTO_TEST_CASE(testMcEnginesWithMultipleStreams) {
+
+    BOOST_TEST_MESSAGE("Testing Monte Carlo European engines "
+                       "with multiple random streams...");
+
+    DayCounter dc = Actual360();
+    Date today = Date::todaysDate();
+
+    ext::shared_ptr<SimpleQuote> spot(new SimpleQuote(100.0));
+    ext::shared_ptr<YieldTermStructure> qTS = flatRate(today, 0.02, dc);
+    ext::shared_ptr<YieldTermStructure> rTS = flatRate(today, 0.05, dc);
+    ext::shared_ptr<BlackVolTermStructure> volTS = flatVol(today, 0.25, dc);
+    ext::shared_ptr<BlackScholesMertonProcess> process(
+        new BlackScholesMertonProcess(Handle<Quote>(spot),
+                                      Handle<YieldTermStructure>(qTS),
+                                      Handle<YieldTermStructure>(rTS),
+                                      Handle<BlackVolTermStructure>(volTS)));
+
+    ext::shared_ptr<StrikedTypePayoff> payoff(
+        new PlainVanillaPayoff(Option::Call, 105.0));
+    ext::shared_ptr<Exercise> exercise(
+        new EuropeanExercise(today + Period(1, Years)));
+    EuropeanOption option(payoff, exercise);
+
+    option.setPricingEngine(
+        ext::make_shared<AnalyticEuropeanEngine>(process));
+    const Real expected = option.NPV();
+
+    // low-discrepancy streams are skipped ahead, so that splitting
+    // the sequence must not change the result
+    option.setPricingEngine(MakeMCEuropeanEngine<LowDiscrepancy>(process)
+                            .withSteps(4)
+                            .withSamples(4095)
+                            .withSeed(42));
+    const Real qmcSingle = option.NPV();
+    option.setPricingEngine(MakeMCEuropeanEngine<LowDiscrepancy>(process)
+                            .withSteps(4)
+                            .withSamples(4095)
+                            .withSeed(42)
+                            .withStreams(7));
+    const Real qmcMulti = option.NPV();
+
+    if (std::fabs(qmcSingle - qmcMulti) > 1.0e-10)
+        BOOST_ERROR("skipped low-discrepancy streams do not reproduce "
+                    "the single-stream result:"
+                    << "\n    single stream: " << qmcSingle
+                    << "\n    7 streams:     " << qmcMulti);
+
+    // pseudo-random streams are reseeded; results must be
+    // reproducible and consistent with the analytic value
+    Real pseudoMulti[2];
+    Real errorEstimate = 0.0;
+    for (Real& npv : pseudoMulti) {
+        option.setPricingEngine(MakeMCEuropeanEngine<PseudoRandom>(process)
+                                .withSteps(1)
+                                .withAntitheticVariate()
+                                .withAbsoluteTolerance(0.02)
+                                .withSeed(42)
+                                .withStreams(8));
+        npv = option.NPV();
+        errorEstimate = option.errorEstimate();
+    }
+
+    if (pseudoMulti[0] != pseudoMulti[1])
+        BOOST_ERROR("pseudo-random streams are not reproducible:"
+                    << "\n    first run:  " << pseudoMulti[0]
+                    << "\n    second run: " << pseudoMulti[1]);
+
+    if (std::fabs(pseudoMulti[0] - expected) > 4.0*errorEstimate)
+        BOOST_ERROR("failed to reproduce analytic value with "
+                    "multiple pseudo-random streams:"
+                    << "\n    calculated:     " << pseudoMulti[0]
+                    << "\n    expected:       " << expected
+                    << "\n    error estimate: " << errorEstimate);
+}
+
 BOOST_AUTO_TEST_CASE(testLocalVolatility) {
     BOOST_TEST_MESSAGE("Testing finite-differences with local volatility...");
 
@@ -27,7 +27,9 @@
 #include <math/interpolations/bilinearinterpolation.hpp>
 #include <math/interpolations/cubicinterpolation.hpp>
 #include <math/matrixutilities/bicgstab.hpp>
+#include <math/matrixutilities/csrmatrix.hpp>
 #include <math/matrixutilities/gmres.hpp>
+#include <math/matrixutilities/ilu0preconditioner.hpp>
 #include <math/matrixutilities/sparseilupreconditioner.hpp>
 #include <math/randomnumbers/rngtraits.hpp>
 #include <methods/finitedifferences/finitedifferencemodel.hpp>
@@ -50,11 +52,13 @@
 #include <methods/finitedifferences/schemes/craigsneydscheme.hpp>
 #include <methods/finitedifferences/schemes/douglasscheme.hpp>
 #include <methods/finitedifferences/schemes/hundsdorferscheme.hpp>
+#include <methods/finitedifferences/schemes/impliciteulerscheme.hpp>
 #include <methods/finitedifferences/solvers/fdm3dimsolver.hpp>
 #include <methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
 #include <methods/finitedifferences/solvers/fdmhestonsolver.hpp>
 #include <methods/finitedifferences/solvers/fdmndimsolver.hpp>
 #include <methods/finitedifferences/stepconditions/fdmamericanstepcondition.hpp>
+#include <methods/finitedifferences/stepconditions/fdmbermudanstepcondition.hpp>
 #include <methods/finitedifferences/stepconditions/fdmstepconditioncomposite.hpp>
 #include <methods/finitedifferences/utilities/fdmdividendhandler.hpp>
 #include <methods/finitedifferences/utilities/fdminnervaluecalculator.hpp>
@@ -833,6 +837,133 @@ BOOST_AUTO_TEST_CASE(testTripleBandMapSolve) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testOutputBufferOperatorApplication) {
+
+    BOOST_TEST_MESSAGE("Testing output-buffer versions of FDM operators "
+                       "and schemes...");
+
+    const std::vector<Size> dim = {40, 20};
+    ext::shared_ptr<FdmMesher> mesher = ext::make_shared<UniformGridMesher>(
+        ext::make_shared<FdmLinearOpLayout>(dim),
+        std::vector<std::pair<Real, Real> >({{3.8, 4.9}, {0.0, 1.0}}));
+
+    Handle<Quote> s0(ext::make_shared<SimpleQuote>(100.0));
+    Handle<YieldTermStructure> rTS(flatRate(0.05, Actual365Fixed()));
+    Handle<YieldTermStructure> qTS(flatRate(0.02, Actual365Fixed()));
+
+    const ext::shared_ptr<FdmLinearOpComposite> op =
+        ext::make_shared<FdmHestonOp>(
+            mesher, ext::make_shared<HestonProcess>(
+                rTS, qTS, s0, 0.04, 2.5, 0.04, 0.66, -0.8));
+    op->setTime(0.4, 0.5);
+
+    Array u(mesher->layout()->size());
+    for (const auto& iter : *mesher->layout())
+        u[iter.index()] = std::exp(mesher->location(iter, 0))
+            * (1.0 + mesher->location(iter, 1));
+
+    const Real tol = 1e-12;
+    const auto check = [&](const Array& expected, const Array& calculated,
+                           const std::string& name) {
+        QL_REQUIRE(expected.size() == calculated.size(),
+                   "inconsistent sizes for " << name);
+        for (Size i=0; i < expected.size(); ++i) {
+            if (std::fabs(expected[i] - calculated[i])
+                > tol*std::max(1.0, std::fabs(expected[i]))) {
+                BOOST_FAIL("failed to reproduce " << name << " at index " << i
+                           << "\n    expected:   " << expected[i]
+                           << "\n    calculated: " << calculated[i]);
+            }
+        }
+    };
+
+    Array out;
+    op->apply_to(u, out);
+    check(op->apply(u), out, "apply");
+
+    op->apply_mixed_to(u, out);
+    check(op->apply_mixed(u), out, "apply_mixed");
+
+    const Real s = -0.01;
+    for (Size direction=0; direction < op->size(); ++direction) {
+        op->apply_direction_to(direction, u, out);
+        check(op->apply_direction(direction, u), out, "apply_direction");
+
+        op->solve_splitting_to(direction, u, s, out);
+        check(op->solve_splitting(direction, u, s), out, "solve_splitting");
+
+        Array inPlace = u;
+        op->solve_splitting_to(direction, inPlace, s, inPlace);
+        check(op->solve_splitting(direction, u, s), inPlace,
+              "in-place solve_splitting");
+    }
+
+    // a Douglas step must match the one written with the allocating interface
+    const Real theta = 0.5, dt = 0.1, t = 0.5;
+    Array y = u + dt*op->apply(u);
+    for (Size i=0; i < op->size(); ++i) {
+        Array rhs = y - theta*dt*op->apply_direction(i, u);
+        y = op->solve_splitting(i, rhs, -theta*dt);
+    }
+
+    DouglasScheme douglas(theta, op);
+    douglas.setStep(dt);
+    Array a = u;
+    douglas.step(a, t);
+    check(y, a, "Douglas step");
+
+    // and the scheme can be reused without changing its results
+    a = u;
+    douglas.step(a, t);
+    check(y, a, "repeated Douglas step");
+}
+
+BOOST_AUTO_TEST_CASE(testTripleBandMapSolveOnGrids) {
+
+    BOOST_TEST_MESSAGE("Testing triple-band map solution on "
+                       "1-D, 2-D and 3-D grids...");
+
+    const std::vector<std::vector<Size> > dims = {
+        {40000}, {200, 200}, {40, 30, 35} };
+
+    for (const auto& dim : dims) {
+        const std::vector<std::pair<Real, Real> > boundaries(
+            dim.size(), std::make_pair(0.0, 1.0));
+        ext::shared_ptr<FdmMesher> mesher =
+            ext::make_shared<UniformGridMesher>(
+                ext::make_shared<FdmLinearOpLayout>(dim), boundaries);
+        const Size n = mesher->layout()->size();
+
+        Array r(n);
+        for (Size i=0; i < n; ++i)
+            r[i] = std::sin(0.1*i)+std::cos(0.35*i);
+
+        const Real a = -0.001, b = 1.0;
+        for (Size direction=0; direction < dim.size(); ++direction) {
+            TripleBandLinearOp op(SecondDerivativeOp(direction, mesher));
+            op.axpyb(Array(1, 0.3), FirstDerivativeOp(direction, mesher),
+                     op, Array());
+
+            // (a*op + b) x = r must hold on every line of the grid;
+            // the solve is repeated as in the time steps of a scheme
+            Array x(n), tmp(n);
+            for (Size k=0; k < 20; ++k)
+                op.solve_splitting_to(r, a, b, x, tmp);
+
+            const Array calculated = a*op.apply(x) + b*x;
+            for (Size i=0; i < n; ++i) {
+                if (std::fabs(calculated[i] - r[i]) > 1e-9) {
+                    BOOST_FAIL("solve and apply are not consistent "
+                               << "on a " << dim.size() << "-D grid "
+                               << "in direction " << direction
+                               << "\n expected      : " << r[i]
+                               << "\n calculated    : " << calculated[i]);
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testFdmHestonBarrier) {
 
     BOOST_TEST_MESSAGE("Testing FDM with barrier option in Heston model...");
@@ -1289,6 +1420,99 @@ BOOST_AUTO_TEST_CASE(testGMRES) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testCSRMatrixKrylovSolvers) {
+    BOOST_TEST_MESSAGE("Testing Krylov solvers on CSR matrices "
+                       "with ILU(0) preconditioning...");
+
+    const Size n=41, m=21;
+    const boost::numeric::ublas::compressed_matrix<Real> a
+        = createTestMatrix(n, m, 1.0);
+    const CSRMatrix csr(a);
+
+    Array b(n*m);
+    MersenneTwisterUniformRng rng(1234);
+    for (Real& i : b) {
+        i = rng.next().value;
+    }
+
+    const Array expected = axpy(a, b);
+    const Array calculated = csr.apply(b);
+    for (Size i=0; i < b.size(); ++i) {
+        if (std::fabs(expected[i] - calculated[i]) > 1e-14) {
+            BOOST_FAIL("failed to reproduce sparse matrix product"
+                       "\n    expected:   " << expected[i] <<
+                       "\n    calculated: " << calculated[i]);
+        }
+        for (Size j : {Size(0), i, (i+m+1) % (n*m)}) {
+            if (csr(i, j) != Real(a(i, j))) {
+                BOOST_FAIL("failed to reproduce sparse matrix element "
+                           "(" << i << ", " << j << ")");
+            }
+        }
+    }
+
+    const ILU0Preconditioner ilu(csr);
+    const std::function<Array(const Array&)> matmult
+        = [&](const Array& _x) { return csr.apply(_x); };
+    const std::function<Array(const Array&)> precond
+        = [&](const Array& _x) { return ilu.apply(_x); };
+
+    const Real tol = 1e-10;
+    const Array x = BiCGstab(matmult, n*m, tol, precond).solve(b).x;
+    const Array y = GMRES(matmult, n*m, tol, precond).solve(b, b).x;
+
+    for (const Array& sol : {x, y}) {
+        const Real error = std::sqrt(DotProduct(b-csr.apply(sol),
+                                     b-csr.apply(sol))/DotProduct(b,b));
+        if (error > tol) {
+            BOOST_FAIL("Error calculating the inverse of a CSR matrix" <<
+                       "\n tolerance:  " << tol <<
+                       "\n error:      " << error);
+        }
+    }
+
+    // implicit Euler steps based on the assembled operator matrix
+    const std::vector<Size> dim = {40, 20};
+    ext::shared_ptr<FdmMesher> mesher = ext::make_shared<UniformGridMesher>(
+        ext::make_shared<FdmLinearOpLayout>(dim),
+        std::vector<std::pair<Real, Real> >({{3.8, 4.9}, {0.0, 1.0}}));
+
+    Handle<Quote> s0(ext::make_shared<SimpleQuote>(100.0));
+    Handle<YieldTermStructure> rTS(flatRate(0.05, Actual365Fixed()));
+    Handle<YieldTermStructure> qTS(flatRate(0.02, Actual365Fixed()));
+
+    const ext::shared_ptr<FdmLinearOpComposite> op =
+        ext::make_shared<FdmHestonOp>(
+            mesher, ext::make_shared<HestonProcess>(
+                rTS, qTS, s0, 0.04, 2.5, 0.04, 0.66, -0.8));
+
+    Array u(mesher->layout()->size());
+    for (const auto& iter : *mesher->layout())
+        u[iter.index()] = std::max(
+            0.0, std::exp(mesher->location(iter, 0)) - 100.0);
+
+    ImplicitEulerScheme reference(op, ImplicitEulerScheme::bc_set(), 1e-12);
+    ImplicitEulerScheme sparse(op, ImplicitEulerScheme::bc_set(), 1e-12,
+                               ImplicitEulerScheme::SparseBiCGstab);
+    reference.setStep(0.05);
+    sparse.setStep(0.05);
+
+    Array v = u;
+    for (Size i=0; i < 4; ++i) {
+        reference.step(u, 1.0 - i*0.05);
+        sparse.step(v, 1.0 - i*0.05);
+    }
+
+    for (Size i=0; i < u.size(); ++i) {
+        if (std::fabs(u[i] - v[i]) > 1e-8*std::max(1.0, std::fabs(u[i]))) {
+            BOOST_FAIL("failed to reproduce implicit Euler step with the "
+                       "CSR matrix based solver at index " << i <<
+                       "\n    expected:   " << u[i] <<
+                       "\n    calculated: " << v[i]);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testCrankNicolsonWithDamping) {
 
     BOOST_TEST_MESSAGE("Testing Crank-Nicolson with initial implicit damping steps "
@@ -1377,6 +1601,326 @@ BOOST_AUTO_TEST_CASE(testCrankNicolsonWithDamping) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testBatchedBackwardRollback) {
+
+    BOOST_TEST_MESSAGE("Testing batched rollback of a strike ladder...");
+
+    DayCounter dc = Actual365Fixed();
+    Date today = Date(22, October, 2024);
+    Settings::instance().evaluationDate() = today;
+
+    ext::shared_ptr<BlackScholesMertonProcess> process =
+        ext::make_shared<BlackScholesMertonProcess>(
+            Handle<Quote>(ext::make_shared<SimpleQuote>(100.0)),
+            Handle<YieldTermStructure>(flatRate(today, 0.01, dc)),
+            Handle<YieldTermStructure>(flatRate(today, 0.04, dc)),
+            Handle<BlackVolTermStructure>(flatVol(today, 0.25, dc)));
+
+    const Time maturity = 1.0;
+    const ext::shared_ptr<FdmMesher> mesher =
+        ext::make_shared<FdmMesherComposite>(
+            ext::make_shared<FdmBlackScholesMesher>(
+                200, process, maturity, 100.0));
+    const ext::shared_ptr<FdmBlackScholesOp> op =
+        ext::make_shared<FdmBlackScholesOp>(mesher, process, 100.0);
+    const FdmBoundaryConditionSet bcSet = {
+        ext::make_shared<FdmDirichletBoundary>(
+            mesher, 0.0, 0, FdmDirichletBoundary::Upper) };
+
+    std::vector<Array> payoffs;
+    std::vector<ext::shared_ptr<FdmStepConditionComposite> > conditions;
+    for (Real strike = 80.0; strike <= 120.0; strike += 5.0) {
+        const ext::shared_ptr<FdmInnerValueCalculator> calculator =
+            ext::make_shared<FdmLogInnerValue>(
+                ext::make_shared<PlainVanillaPayoff>(Option::Put, strike),
+                mesher, 0);
+
+        Array payoff(mesher->layout()->size());
+        for (const auto& iter : *mesher->layout())
+            payoff[iter.index()] = calculator->avgInnerValue(iter, maturity);
+        payoffs.push_back(payoff);
+
+        conditions.push_back(ext::make_shared<FdmStepConditionComposite>(
+            std::list<std::vector<Time> >(),
+            FdmStepConditionComposite::Conditions(
+                1, ext::make_shared<FdmAmericanStepCondition>(
+                    mesher, calculator))));
+    }
+
+    const std::vector<FdmSchemeDesc> schemes = {
+        FdmSchemeDesc::Douglas(), FdmSchemeDesc::CraigSneyd(),
+        FdmSchemeDesc::ImplicitEuler() };
+
+    for (const auto& scheme : schemes) {
+        FdmBackwardSolver solver(
+            op, bcSet, ext::shared_ptr<FdmStepConditionComposite>(), scheme);
+
+        std::vector<Array> batch = payoffs;
+        solver.rollback(batch, maturity, 0.0, 50, 2, conditions);
+
+        for (Size j=0; j < payoffs.size(); ++j) {
+            Array expected = payoffs[j];
+            FdmBackwardSolver(op, bcSet, conditions[j], scheme)
+                .rollback(expected, maturity, 0.0, 50, 2);
+
+            for (Size i=0; i < expected.size(); ++i) {
+                if (std::fabs(expected[i] - batch[j][i]) > 1e-10) {
+                    BOOST_FAIL("batched rollback doesn't reproduce "
+                               "single rollback"
+                               << "\n    scheme:     " << scheme.type
+                               << "\n    payoff:     " << j
+                               << "\n    index:      " << i
+                               << "\n    expected:   " << expected[i]
+                               << "\n    calculated: " << batch[j][i]);
+                }
+            }
+        }
+    }
+}
+
+// counts the eliminations of the wrapped operator, i.e., the calls
+// of its tridiagonal solvers, and the time-dependent setups
+class FdmCountingOp : public FdmLinearOpComposite {
+  public:
+    explicit FdmCountingOp(ext::shared_ptr<FdmLinearOpComposite> op)
+    : op_(std::move(op)) {}
+
+    Size size() const override { return op_->size(); }
+    void setTime(Time t1, Time t2) override {
+        ++setups;
+        op_->setTime(t1, t2);
+    }
+
+    Array apply(const Array& r) const override { return op_->apply(r); }
+    Array apply_mixed(const Array& r) const override { return op_->apply_mixed(r); }
+    Array apply_direction(Size direction, const Array& r) const override {
+        return op_->apply_direction(direction, r);
+    }
+    Array solve_splitting(Size direction, const Array& r, Real s) const override {
+        ++eliminations;
+        return op_->solve_splitting(direction, r, s);
+    }
+    Array preconditioner(const Array& r, Real s) const override {
+        ++eliminations;
+        return op_->preconditioner(r, s);
+    }
+
+    void apply_to(const Array& r, Array& out) const override { op_->apply_to(r, out); }
+    void apply_mixed_to(const Array& r, Array& out) const override {
+        op_->apply_mixed_to(r, out);
+    }
+    void apply_direction_to(Size direction, const Array& r, Array& out) const override {
+        op_->apply_direction_to(direction, r, out);
+    }
+    void solve_splitting_to(Size direction, const Array& r, Real s, Array& out) const override {
+        ++eliminations;
+        op_->solve_splitting_to(direction, r, s, out);
+    }
+    void solve_splitting_columns_to(Size direction, const Array& r, Real s,
+                                    Array& out, Size n) const override {
+        ++eliminations;
+        op_->solve_splitting_columns_to(direction, r, s, out, n);
+    }
+
+    std::vector<SparseMatrix> toMatrixDecomp() const override {
+        return op_->toMatrixDecomp();
+    }
+
+    mutable Size eliminations = 0;
+    Size setups = 0;
+
+  private:
+    const ext::shared_ptr<FdmLinearOpComposite> op_;
+};
+
+BOOST_AUTO_TEST_CASE(testBatchedRollbackSharesElimination) {
+
+    BOOST_TEST_MESSAGE("Testing that a batched rollback eliminates "
+                       "the operator once per step...");
+
+    DayCounter dc = Actual365Fixed();
+    Date today = Date(22, October, 2024);
+    Settings::instance().evaluationDate() = today;
+
+    ext::shared_ptr<BlackScholesMertonProcess> process =
+        ext::make_shared<BlackScholesMertonProcess>(
+            Handle<Quote>(ext::make_shared<SimpleQuote>(100.0)),
+            Handle<YieldTermStructure>(flatRate(today, 0.01, dc)),
+            Handle<YieldTermStructure>(flatRate(today, 0.04, dc)),
+            Handle<BlackVolTermStructure>(flatVol(today, 0.25, dc)));
+
+    const Time maturity = 1.0;
+    const Size steps = 50;
+    const ext::shared_ptr<FdmMesher> mesher =
+        ext::make_shared<FdmMesherComposite>(
+            ext::make_shared<FdmBlackScholesMesher>(
+                200, process, maturity, 100.0));
+    const ext::shared_ptr<FdmBlackScholesOp> op =
+        ext::make_shared<FdmBlackScholesOp>(mesher, process, 100.0);
+    const ext::shared_ptr<FdmStepConditionComposite> noCondition =
+        ext::make_shared<FdmStepConditionComposite>(
+            std::list<std::vector<Time> >(),
+            FdmStepConditionComposite::Conditions());
+
+    std::vector<Array> payoffs;
+    for (Real strike = 70.0; strike <= 130.0; strike += 5.0) {
+        FdmLogInnerValue calculator(
+            ext::make_shared<PlainVanillaPayoff>(Option::Call, strike), mesher, 0);
+
+        Array payoff(mesher->layout()->size());
+        for (const auto& iter : *mesher->layout())
+            payoff[iter.index()] = calculator.avgInnerValue(iter, maturity);
+        payoffs.push_back(payoff);
+    }
+
+    const ext::shared_ptr<FdmCountingOp> batchOp =
+        ext::make_shared<FdmCountingOp>(op);
+    std::vector<Array> batch = payoffs;
+    FdmBackwardSolver(batchOp, FdmBoundaryConditionSet(), noCondition,
+                      FdmSchemeDesc::Douglas())
+        .rollback(batch, maturity, 0.0, steps, 0);
+
+    const ext::shared_ptr<FdmCountingOp> singleOp =
+        ext::make_shared<FdmCountingOp>(op);
+    for (Size j=0; j < payoffs.size(); ++j) {
+        Array expected = payoffs[j];
+        FdmBackwardSolver(singleOp, FdmBoundaryConditionSet(), noCondition,
+                          FdmSchemeDesc::Douglas())
+            .rollback(expected, maturity, 0.0, steps, 0);
+
+        for (Size i=0; i < expected.size(); ++i) {
+            if (std::fabs(expected[i] - batch[j][i]) > 1e-10)
+                BOOST_FAIL("batched rollback doesn't reproduce single rollback"
+                           << "\n    payoff:     " << j
+                           << "\n    index:      " << i
+                           << "\n    expected:   " << expected[i]
+                           << "\n    calculated: " << batch[j][i]);
+        }
+    }
+
+    // one setup and one elimination per step for the whole ladder,
+    // instead of one per step and payoff
+    if (batchOp->setups != steps || batchOp->eliminations != steps)
+        BOOST_FAIL("unexpected work in batched rollback"
+                   << "\n    steps:        " << steps
+                   << "\n    setups:       " << batchOp->setups
+                   << "\n    eliminations: " << batchOp->eliminations);
+    if (singleOp->setups != payoffs.size()*steps
+        || singleOp->eliminations != payoffs.size()*steps)
+        BOOST_FAIL("unexpected work in single rollbacks"
+                   << "\n    expected:     " << payoffs.size()*steps
+                   << "\n    setups:       " << singleOp->setups
+                   << "\n    eliminations: " << singleOp->eliminations);
+
+    // the multi-column solve reproduces the column-by-column solve
+    // while eliminating only once
+    const Size n = mesher->layout()->size(), nColumns = payoffs.size();
+    Array r(n*nColumns);
+    for (Size j=0; j < nColumns; ++j)
+        std::copy(payoffs[j].begin(), payoffs[j].end(), r.begin() + j*n);
+
+    TripleBandLinearOp mapT(SecondDerivativeOp(0, mesher));
+    mapT.axpyb(Array(1, -0.1), FirstDerivativeOp(0, mesher), mapT, Array(1, -0.01));
+
+    Array columns(n*nColumns), single(n*nColumns), x(n), y(n), tmp;
+    mapT.solve_splitting_columns_to(r, -0.02, 1.0, columns, tmp);
+    for (Size j=0; j < nColumns; ++j) {
+        std::copy(r.begin() + j*n, r.begin() + (j+1)*n, x.begin());
+        mapT.solve_splitting_to(x, -0.02, 1.0, y, tmp);
+        std::copy(y.begin(), y.end(), single.begin() + j*n);
+    }
+
+    for (Size i=0; i < columns.size(); ++i) {
+        if (std::fabs(columns[i] - single[i]) > 1e-12)
+            BOOST_FAIL("multi-column solve doesn't reproduce single solves"
+                       << "\n    index:      " << i
+                       << "\n    expected:   " << single[i]
+                       << "\n    calculated: " << columns[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testAdaptiveTimeStepping) {
+
+    BOOST_TEST_MESSAGE("Testing adaptive time stepping of the "
+                       "backward solver...");
+
+    DayCounter dc = Actual365Fixed();
+    Date today = Date(22, October, 2024);
+    Settings::instance().evaluationDate() = today;
+
+    ext::shared_ptr<BlackScholesMertonProcess> process =
+        ext::make_shared<BlackScholesMertonProcess>(
+            Handle<Quote>(ext::make_shared<SimpleQuote>(100.0)),
+            Handle<YieldTermStructure>(flatRate(today, 0.01, dc)),
+            Handle<YieldTermStructure>(flatRate(today, 0.04, dc)),
+            Handle<BlackVolTermStructure>(flatVol(today, 0.25, dc)));
+
+    const Date maturityDate = today + Period(1, Years);
+    const Time maturity = dc.yearFraction(today, maturityDate);
+
+    const ext::shared_ptr<FdmMesher> mesher =
+        ext::make_shared<FdmMesherComposite>(
+            ext::make_shared<FdmBlackScholesMesher>(
+                200, process, maturity, 100.0));
+    const ext::shared_ptr<FdmBlackScholesOp> op =
+        ext::make_shared<FdmBlackScholesOp>(mesher, process, 100.0);
+
+    const ext::shared_ptr<FdmInnerValueCalculator> calculator =
+        ext::make_shared<FdmLogInnerValue>(
+            ext::make_shared<PlainVanillaPayoff>(Option::Put, 100.0),
+            mesher, 0);
+
+    Array payoff(mesher->layout()->size());
+    for (const auto& iter : *mesher->layout())
+        payoff[iter.index()] = calculator->avgInnerValue(iter, maturity);
+
+    // Bermudan exercise, the exercise times must be hit exactly
+    const std::vector<Date> exerciseDates = {
+        today + Period(3, Months), today + Period(6, Months),
+        today + Period(9, Months) };
+    const ext::shared_ptr<FdmBermudanStepCondition> bermudan =
+        ext::make_shared<FdmBermudanStepCondition>(
+            exerciseDates, today, dc, mesher, calculator);
+    const ext::shared_ptr<FdmStepConditionComposite> condition =
+        ext::make_shared<FdmStepConditionComposite>(
+            std::list<std::vector<Time> >(1, bermudan->exerciseTimes()),
+            FdmStepConditionComposite::Conditions(1, bermudan));
+
+    const auto maxDiff = [&](const Array& a, const Array& b) {
+        Real diff = 0.0;
+        for (Size i=0; i < a.size(); ++i)
+            diff = std::max(diff, std::fabs(a[i] - b[i]));
+        return diff;
+    };
+
+    const FdmSchemeDesc scheme = FdmSchemeDesc::Douglas();
+
+    Array reference = payoff;
+    FdmBackwardSolver(op, FdmBoundaryConditionSet(), condition, scheme)
+        .rollback(reference, maturity, 0.0, 2000, 2);
+
+    Array coarse = payoff;
+    FdmBackwardSolver(op, FdmBoundaryConditionSet(), condition, scheme)
+        .rollback(coarse, maturity, 0.0, 10, 2);
+
+    Array adaptive = payoff;
+    FdmBackwardSolver(op, FdmBoundaryConditionSet(), condition,
+                      scheme.withAdaptiveTimeStepping(1e-5))
+        .rollback(adaptive, maturity, 0.0, 10, 2);
+
+    const Real coarseError = maxDiff(coarse, reference);
+    const Real adaptiveError = maxDiff(adaptive, reference);
+
+    const Real tol = 1e-3;
+    if (adaptiveError > tol || adaptiveError > 0.1*coarseError) {
+        BOOST_FAIL("adaptive time stepping failed to reach "
+                   "the target accuracy"
+                   << "\n    fixed-step error:    " << coarseError
+                   << "\n    adaptive error:      " << adaptiveError
+                   << "\n    tolerance:           " << tol);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testSpareMatrixReference) {
     BOOST_TEST_MESSAGE("Testing SparseMatrixReference type...");
 
@@ -44,6 +44,7 @@
 #include <pricingengines/vanilla/exponentialfittinghestonengine.hpp>
 #include <pricingengines/vanilla/fdblackscholesvanillaengine.hpp>
 #include <pricingengines/vanilla/fdhestonvanillaengine.hpp>
+#include <pricingengines/vanilla/fdrichardsonvanillaengine.hpp>
 #include <pricingengines/vanilla/hestonexpansionengine.hpp>
 #include <pricingengines/vanilla/mceuropeanhestonengine.hpp>
 #include <processes/hestonprocess.hpp>
@@ -686,6 +687,56 @@ BOOST_AUTO_TEST_CASE(testFdVanillaVsCached) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testFdVanillaRichardsonExtrapolation) {
+    BOOST_TEST_MESSAGE(
+        "Testing Richardson extrapolation of the FD vanilla Heston engine...");
+
+    Date settlementDate(27, December, 2004);
+    Settings::instance().evaluationDate() = settlementDate;
+
+    DayCounter dayCounter = ActualActual(ActualActual::ISDA);
+    Date exerciseDate(28, March, 2005);
+
+    Handle<YieldTermStructure> riskFreeTS(flatRate(0.7, dayCounter));
+    Handle<YieldTermStructure> dividendTS(flatRate(0.4, dayCounter));
+
+    Handle<Quote> s0(ext::make_shared<SimpleQuote>(1.05));
+
+    const auto model = ext::make_shared<HestonModel>(
+        ext::make_shared<HestonProcess>(
+            riskFreeTS, dividendTS, s0, 0.3, 1.16, 0.2, 0.8, 0.8));
+
+    VanillaOption option(
+        ext::make_shared<PlainVanillaPayoff>(Option::Put, 1.05),
+        ext::make_shared<EuropeanExercise>(exerciseDate));
+
+    option.setPricingEngine(ext::make_shared<AnalyticHestonEngine>(model));
+    const Real expected = option.NPV();
+
+    const auto fdEngine = [&model](Real scale) {
+        return ext::make_shared<FdHestonVanillaEngine>(
+            model, Size(20*scale), Size(50*scale), Size(25*scale));
+    };
+
+    // a single solve on a grid refined four times in every direction
+    option.setPricingEngine(fdEngine(4.0));
+    const Real fineGridError = std::fabs(option.NPV() - expected);
+
+    option.setPricingEngine(
+        ext::make_shared<FdRichardsonVanillaEngine>(fdEngine));
+    const Real calculated = option.NPV();
+    const Real error = std::fabs(calculated - expected);
+
+    if (error > 0.5*fineGridError) {
+        BOOST_FAIL("Richardson extrapolation of coarse grids does not "
+                   "beat the fine grid solution"
+                   << "\n    calculated:      " << calculated
+                   << "\n    expected:        " << expected
+                   << "\n    error:           " << std::scientific << error
+                   << "\n    fine grid error: " << fineGridError);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testFdVanillaWithDividendsVsCached) {
     BOOST_TEST_MESSAGE("Testing FD vanilla Heston engine for discrete dividends...");
 
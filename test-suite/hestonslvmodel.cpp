@@ -2501,6 +2501,50 @@ BOOST_AUTO_TEST_CASE(testDiffusionAndDriftSlvProcess) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testLeverageFunctionSliceUpdate) {
+    BOOST_TEST_MESSAGE("Testing in-place update of a single leverage "
+                       "function time slice...");
+
+    const DayCounter dc = Actual365Fixed();
+    const Date todaysDate(1, Jun, 2021);
+
+    const std::vector<Time> times = {0.25, 0.5, 0.75, 1.0};
+    std::vector<ext::shared_ptr<std::vector<Real> > > strikes;
+    ext::shared_ptr<Matrix> m = ext::make_shared<Matrix>(21, times.size());
+    for (Size j=0; j < times.size(); ++j) {
+        strikes.push_back(ext::make_shared<std::vector<Real> >(21));
+        for (Size i=0; i < 21; ++i) {
+            (*strikes[j])[i] = 50.0 + 5.0*i;
+            (*m)[i][j] = 0.2 + 0.01*j;
+        }
+    }
+
+    FixedLocalVolSurface updated(todaysDate, times, strikes, m, dc);
+
+    // modify the third slice in place, as the SLV calibration does
+    for (Size i=0; i < 21; ++i) {
+        (*strikes[2])[i] = 40.0 + 6.0*i;
+        (*m)[i][2] = 0.3 - 0.005*i;
+    }
+    updated.updateInterpolation(2);
+
+    const FixedLocalVolSurface expected(todaysDate, times, strikes, m, dc);
+
+    for (Time t : {0.4, 0.75, 0.9}) {
+        for (Real strike=35.0; strike < 200.0; strike+=7.5) {
+            const Volatility calculated = updated.localVol(t, strike, true);
+            const Volatility reference = expected.localVol(t, strike, true);
+            if (std::fabs(calculated - reference) > 1e-14) {
+                BOOST_FAIL("failed to update leverage function slice"
+                           << "\n time:       " << t
+                           << "\n strike:     " << strike
+                           << "\n calculated: " << calculated
+                           << "\n expected:   " << reference);
+            }
+        }
+    }
+}
+
 //BOOST_AUTO_TEST_CASE(testBarrierPricingMixedModelsMonteCarloVsFdmPricing) {
 //    BOOST_TEST_MESSAGE(
 //        "Testing European and Barrier Pricing for Monte-Carlo and FDM "
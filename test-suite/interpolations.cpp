@@ -39,12 +39,14 @@
 #include <math/interpolations/kernelinterpolation2d.hpp>
 #include <math/interpolations/lagrangeinterpolation.hpp>
 #include <math/interpolations/linearinterpolation.hpp>
+#include <math/interpolations/loginterpolation.hpp>
 #include <math/interpolations/multicubicspline.hpp>
 #include <math/interpolations/sabrinterpolation.hpp>
 #include <math/kernelfunctions.hpp>
 #include <math/optimization/levenbergmarquardt.hpp>
 #include <math/randomnumbers/sobolrsg.hpp>
 #include <math/richardsonextrapolation.hpp>
+#include <termstructures/volatility/sabrsmilesection.hpp>
 #include <utilities/dataformatters.hpp>
 #include <utilities/null.hpp>
 #include <cmath>
@@ -1979,6 +1981,209 @@ BOOST_AUTO_TEST_CASE(testSabrSingleCases) {
 
 }
 
+class CountingLevenbergMarquardt : public LevenbergMarquardt {
+  public:
+    using LevenbergMarquardt::LevenbergMarquardt;
+    EndCriteria::Type minimize(Problem& P, const EndCriteria& endCriteria) override {
+        const EndCriteria::Type result = LevenbergMarquardt::minimize(P, endCriteria);
+        evaluations += P.functionEvaluation();
+        return result;
+    }
+    Integer evaluations = 0;
+};
+
+BOOST_AUTO_TEST_CASE(testSabrAnalyticJacobian) {
+
+    BOOST_TEST_MESSAGE("Testing analytic Jacobian of Sabr calibration...");
+
+    const Real forward = 0.04, tte = 2.0, shift = 0.01;
+    const Real h = 1e-6, tolerance = 1e-6;
+
+    const std::vector<Real> strikes = { 0.02, 0.03, 0.035, 0.04, 0.045, 0.05, 0.06, 0.07 };
+    const VolatilityType types[] = { VolatilityType::ShiftedLognormal,
+                                     VolatilityType::Normal };
+
+    for (auto type : types) {
+        const Real params[] = { type == VolatilityType::Normal ? 0.01 : 0.03,
+                                0.6, 0.4, -0.3 };
+        for (Real strike : strikes) {
+            const Array gradient = unsafeShiftedSabrVolatilityGradient(
+                strike, forward, tte, params[0], params[1], params[2], params[3],
+                shift, type);
+            for (Size i = 0; i < 4; ++i) {
+                Real up[4], down[4];
+                std::copy(params, params + 4, up);
+                std::copy(params, params + 4, down);
+                up[i] += h;
+                down[i] -= h;
+                const Real expected =
+                    (unsafeShiftedSabrVolatility(strike, forward, tte, up[0], up[1],
+                                                 up[2], up[3], shift, type)
+                     - unsafeShiftedSabrVolatility(strike, forward, tte, down[0],
+                                                   down[1], down[2], down[3], shift, type))
+                    / (2.0 * h);
+                if (std::fabs(gradient[i] - expected) > tolerance)
+                    BOOST_ERROR("failed to reproduce Sabr volatility derivative"
+                                << "\n    volatility type: " << type
+                                << "\n    strike:          " << strike
+                                << "\n    parameter:       " << i
+                                << "\n    analytic:        " << gradient[i]
+                                << "\n    numerical:       " << expected);
+            }
+        }
+    }
+
+    const std::vector<bool> fixed(4, false);
+    const std::vector<Real> noParams(4, 0.0);
+    const Real xs[][4] = { { 0.3, 0.8, 0.6, 0.2 }, { -2.0, 0.1, 1.5, -2.4 },
+                           { 6.0, -1.2, -7.0, 1.0 } };
+    for (const auto& xi : xs) {
+        Array x(xi, xi + 4);
+        const Array dy = QuantLib::detail::SABRSpecs().directDerivatives(
+            x, fixed, noParams, forward);
+        for (Size i = 0; i < 4; ++i) {
+            Array up(x), down(x);
+            up[i] += h;
+            down[i] -= h;
+            const Real expected =
+                (QuantLib::detail::SABRSpecs().direct(up, fixed, noParams, forward)[i]
+                 - QuantLib::detail::SABRSpecs().direct(down, fixed, noParams, forward)[i])
+                / (2.0 * h);
+            if (std::fabs(dy[i] - expected) > tolerance)
+                BOOST_ERROR("failed to reproduce Sabr transformation derivative"
+                            << "\n    x:         " << x
+                            << "\n    parameter: " << i
+                            << "\n    analytic:  " << dy[i]
+                            << "\n    numerical: " << expected);
+        }
+    }
+
+    // the calibration with the analytic Jacobian must find the same
+    // parameters as the one with finite-difference derivatives
+    std::vector<Real> vols(strikes.size());
+    for (Size i = 0; i < strikes.size(); ++i)
+        vols[i] = unsafeShiftedSabrVolatility(strikes[i], forward, tte,
+                                              0.03, 0.6, 0.4, -0.3, 0.0)
+            + (i % 2 != 0U ? 0.0005 : -0.0005);
+
+    const auto analyticMethod =
+        ext::make_shared<CountingLevenbergMarquardt>(1e-8, 1e-8, 1e-8, true);
+    SABRInterpolation analytic(strikes.begin(), strikes.end(), vols.begin(), tte,
+                               forward, 0.05, 0.5, 0.4, 0.0,
+                               false, false, false, false, false,
+                               ext::shared_ptr<EndCriteria>(), analyticMethod);
+    analytic.update();
+    const auto numericalMethod =
+        ext::make_shared<CountingLevenbergMarquardt>(1e-8, 1e-8, 1e-8);
+    SABRInterpolation numerical(strikes.begin(), strikes.end(), vols.begin(), tte,
+                                forward, 0.05, 0.5, 0.4, 0.0,
+                                false, false, false, false, false,
+                                ext::shared_ptr<EndCriteria>(), numericalMethod);
+    numerical.update();
+
+    // without finite differences, the fit needs much fewer evaluations
+    BOOST_TEST_MESSAGE("    function evaluations: analytic "
+                       << analyticMethod->evaluations << ", numerical "
+                       << numericalMethod->evaluations);
+    if (analyticMethod->evaluations * 3 > numericalMethod->evaluations)
+        BOOST_ERROR("analytic Jacobian doesn't reduce the function evaluations"
+                    << "\n    analytic:  " << analyticMethod->evaluations
+                    << "\n    numerical: " << numericalMethod->evaluations);
+
+    // the interpolation can build the analytic optimizer by itself
+    SABRInterpolation flagged(strikes.begin(), strikes.end(), vols.begin(), tte,
+                              forward, 0.05, 0.5, 0.4, 0.0,
+                              false, false, false, false, false,
+                              ext::shared_ptr<EndCriteria>(),
+                              ext::shared_ptr<OptimizationMethod>(),
+                              0.0020, false, 50, 0.0,
+                              VolatilityType::ShiftedLognormal, true);
+    flagged.update();
+    if (flagged.alpha() != analytic.alpha() || flagged.beta() != analytic.beta()
+        || flagged.nu() != analytic.nu() || flagged.rho() != analytic.rho())
+        BOOST_ERROR("Sabr calibration with useAnalyticJacobian differs "
+                    "from the one with an analytic optimizer"
+                    << "\n    flag:      alpha " << flagged.alpha()
+                    << ", beta " << flagged.beta() << ", nu " << flagged.nu()
+                    << ", rho " << flagged.rho()
+                    << "\n    optimizer: alpha " << analytic.alpha()
+                    << ", beta " << analytic.beta() << ", nu " << analytic.nu()
+                    << ", rho " << analytic.rho());
+
+    const Real paramTolerance = 1e-5;
+    if (std::fabs(analytic.alpha() - numerical.alpha()) > paramTolerance
+        || std::fabs(analytic.beta() - numerical.beta()) > paramTolerance
+        || std::fabs(analytic.nu() - numerical.nu()) > paramTolerance
+        || std::fabs(analytic.rho() - numerical.rho()) > paramTolerance)
+        BOOST_ERROR("Sabr calibrations with analytic and numerical Jacobian differ"
+                    << "\n    analytic:  alpha " << analytic.alpha()
+                    << ", beta " << analytic.beta() << ", nu " << analytic.nu()
+                    << ", rho " << analytic.rho()
+                    << "\n    numerical: alpha " << numerical.alpha()
+                    << ", beta " << numerical.beta() << ", nu " << numerical.nu()
+                    << ", rho " << numerical.rho());
+}
+
+BOOST_AUTO_TEST_CASE(testSabrSmileSectionOnStrikeGrid) {
+
+    BOOST_TEST_MESSAGE("Testing SABR smile section on a whole strike grid...");
+
+    const Time t = 2.5;
+    const Real forward = 0.012;
+    const std::vector<Real> params = {0.025, 0.5, 0.4, -0.3};
+    const Real shift = 0.02;
+    const Size n = 101;
+
+    std::vector<Real> strikes(n);
+    for (Size i = 0; i < n; ++i)
+        strikes[i] = -0.019999 + 0.0005 * i; // partly below the sabr strike floor
+
+    const Real tolerance = 1.0e-14;
+
+    for (auto volType : {ShiftedLognormal, Normal}) {
+        const Real alpha = volType == Normal ? Real(0.006) : params[0];
+        SabrSmileSection section(t, forward, {alpha, params[1], params[2], params[3]},
+                                 shift, volType);
+
+        std::vector<Real> vols(n), prices(n), puts(n);
+        section.volatilities(strikes.data(), vols.data(), n);
+        section.optionPrices(strikes.data(), prices.data(), n);
+        section.optionPrices(strikes.data(), puts.data(), n, Option::Put, 0.9);
+
+        for (Size i = 0; i < n; ++i) {
+            Real expected = section.volatility(strikes[i]);
+            if (std::fabs(vols[i] - expected) > tolerance * expected)
+                BOOST_ERROR("batch volatility differs from scalar one:"
+                            << "\n    strike:   " << strikes[i]
+                            << "\n    batch:    " << vols[i]
+                            << "\n    scalar:   " << expected);
+            expected = section.optionPrice(strikes[i]);
+            if (std::fabs(prices[i] - expected) > tolerance * std::max(expected, 1.0e-4))
+                BOOST_ERROR("batch call price differs from scalar one:"
+                            << "\n    strike:   " << strikes[i]
+                            << "\n    batch:    " << prices[i]
+                            << "\n    scalar:   " << expected);
+            expected = section.optionPrice(strikes[i], Option::Put, 0.9);
+            if (std::fabs(puts[i] - expected) > tolerance * std::max(expected, 1.0e-4))
+                BOOST_ERROR("batch put price differs from scalar one:"
+                            << "\n    strike:   " << strikes[i]
+                            << "\n    batch:    " << puts[i]
+                            << "\n    scalar:   " << expected);
+        }
+
+        // in place evaluation
+        std::vector<Real> inPlace = strikes;
+        section.volatilities(inPlace.data(), inPlace.data(), n);
+        for (Size i = 0; i < n; ++i) {
+            if (inPlace[i] != vols[i])
+                BOOST_ERROR("in place batch volatility differs:"
+                            << "\n    strike:   " << strikes[i]
+                            << "\n    in place: " << inPlace[i]
+                            << "\n    batch:    " << vols[i]);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testTransformations) {
 
     BOOST_TEST_MESSAGE("Testing Sabr and no-arbitrage Sabr transformation functions...");
@@ -2343,6 +2548,78 @@ BOOST_AUTO_TEST_CASE(testBSplines) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testLocateIndexAndSortedBatch) {
+
+    BOOST_TEST_MESSAGE("Testing interpolation locate index and sorted batch evaluation...");
+
+    // a typical curve grid, far from uniform
+    std::vector<Real> x = {0.02, 0.08, 0.25, 0.5, 0.75, 1.0, 1.5, 2.0, 3.0,
+                           4.0, 5.0, 7.0, 10.0, 12.0, 15.0, 20.0, 25.0, 30.0};
+    std::vector<Real> y(x.size());
+    for (Size i=0; i<x.size(); ++i)
+        y[i] = std::exp(-0.03*x[i] - 0.001*x[i]*x[i]);
+
+    std::vector<Real> xs;
+    for (Real t=-1.0; t<=35.0; t+=0.0123)
+        xs.push_back(t);
+    xs.insert(xs.end(), x.begin(), x.end());
+    std::sort(xs.begin(), xs.end());
+    const Size n = xs.size();
+
+    std::vector<std::pair<std::string, Interpolation> > interpolations = {
+        {"linear", LinearInterpolation(x.begin(), x.end(), y.begin())},
+        {"log-linear", LogLinearInterpolation(x.begin(), x.end(), y.begin())},
+        {"cubic", CubicInterpolation(x.begin(), x.end(), y.begin(),
+                                     CubicInterpolation::Spline, false,
+                                     CubicInterpolation::SecondDerivative, 0.0,
+                                     CubicInterpolation::SecondDerivative, 0.0)}};
+
+    for (auto& named : interpolations) {
+        Interpolation& f = named.second;
+        f.update();
+
+        std::vector<Real> expected(n), batch(n), indexed(n), indexedBatch(n);
+        for (Size j=0; j<n; ++j)
+            expected[j] = f(xs[j], true);
+        f(xs.data(), batch.data(), n, true);
+
+        f.enableLocateIndex();
+        for (Size j=0; j<n; ++j)
+            indexed[j] = f(xs[j], true);
+        f(xs.data(), indexedBatch.data(), n, true);
+
+        for (Size j=0; j<n; ++j) {
+            if (batch[j] != expected[j] || indexed[j] != expected[j]
+                || indexedBatch[j] != expected[j])
+                BOOST_ERROR(named.first << " interpolation:"
+                            << "\n    x:               " << xs[j]
+                            << "\n    value:           " << expected[j]
+                            << "\n    batch:           " << batch[j]
+                            << "\n    with index:      " << indexed[j]
+                            << "\n    batch and index: " << indexedBatch[j]);
+        }
+
+        BOOST_CHECK_EXCEPTION(f(xs.data(), batch.data(), n), Error,
+                              ExpectedErrorMessage("extrapolation"));
+        f.enableLocateIndex(false);
+    }
+
+    // the index follows changes to the x values
+    Interpolation f = LinearInterpolation(x.begin(), x.end(), y.begin());
+    f.enableLocateIndex();
+    for (Real& xi : x)
+        xi *= 0.5;
+    f.update();
+    Interpolation g = LinearInterpolation(x.begin(), x.end(), y.begin());
+    for (Real t : xs) {
+        if (f(t, true) != g(t, true))
+            BOOST_ERROR("index not updated with the x values:"
+                        << "\n    x:          " << t
+                        << "\n    with index: " << f(t, true)
+                        << "\n    expected:   " << g(t, true));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testBackwardFlatOnSinglePoint) {
     BOOST_TEST_MESSAGE("Testing piecewise constant interpolation on a "
                        "single point...");
@@ -263,6 +263,61 @@ BOOST_AUTO_TEST_CASE(testMultiThreadingGlobalSettings) {
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(testConcurrentNotifications) {
+    BOOST_TEST_MESSAGE("Testing concurrent notifications and "
+                       "registrations from multiple threads...");
+
+    const Size nrObservers = 50;
+    const Size nrNotifications = 2000;
+
+    for (Size nrThreads = 1; nrThreads <= 64; nrThreads *= 4) {
+        const ext::shared_ptr<SimpleQuote> quote(new SimpleQuote(0.0));
+
+        std::vector<ext::shared_ptr<MTUpdateCounter> > observers;
+        for (Size i=0; i < nrObservers; ++i) {
+            observers.push_back(ext::make_shared<MTUpdateCounter>());
+            observers.back()->registerWith(quote);
+        }
+
+        // each thread also registers and unregisters a transient
+        // observer, which forces the observer list to be rebuilt
+        auto worker = [&]() {
+            const ext::shared_ptr<MTUpdateCounter> transient(
+                                                       new MTUpdateCounter);
+            for (Size j=0; j < nrNotifications; ++j) {
+                if (j % 100 == 0)
+                    transient->registerWith(quote);
+                else if (j % 100 == 50)
+                    transient->unregisterWith(quote);
+                quote->notifyObservers();
+            }
+        };
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (Size t=0; t < nrThreads; ++t)
+            threads.emplace_back(worker);
+        for (auto& thread : threads)
+            thread.join();
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        BOOST_TEST_MESSAGE("    " << nrThreads << " thread(s): "
+                           << nrThreads*nrNotifications/elapsed.count()
+                           << " notifications/s");
+
+        for (const auto& observer : observers) {
+            if (observer->counter() != int(nrThreads*nrNotifications)) {
+                BOOST_FAIL("notifications lost with " << nrThreads
+                           << " thread(s): "
+                           << "\n    expected:   "
+                           << nrThreads*nrNotifications
+                           << "\n    calculated: " << observer->counter());
+            }
+        }
+    }
+}
 #endif
 
 BOOST_AUTO_TEST_CASE(testDeepUpdate) {
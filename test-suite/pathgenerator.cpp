@@ -19,9 +19,12 @@
 
 #include "toplevelfixture.hpp"
 #include "utilities.hpp"
+#include <methods/montecarlo/batchpathgenerator.hpp>
 #include <methods/montecarlo/mctraits.hpp>
 #include <processes/blackscholesprocess.hpp>
 #include <processes/geometricbrownianprocess.hpp>
+#include <processes/hestonprocess.hpp>
+#include <processes/hullwhiteprocess.hpp>
 #include <processes/ornsteinuhlenbeckprocess.hpp>
 #include <processes/squarerootprocess.hpp>
 #include <processes/stochasticprocessarray.hpp>
@@ -140,6 +143,75 @@ void testMultiple(const ext::shared_ptr<StochasticProcess>& process,
     }
 }
 
+void testBatch(const ext::shared_ptr<StochasticProcess>& process,
+               const std::string& tag, bool brownianBridge) {
+    typedef PseudoRandom::rsg_type rsg_type;
+
+    BigNatural seed = 42;
+    Time length = 5;
+    Size timeSteps = 10, batchSize = 7;
+    TimeGrid grid(length, timeSteps);
+    Size assets = process->size(), factors = process->factors();
+    rsg_type rsg =
+        PseudoRandom::make_sequence_generator(factors*timeSteps, seed);
+
+    BatchPathGenerator<rsg_type> generator(process, grid, rsg,
+                                           brownianBridge, batchSize);
+    MultiPathGenerator<rsg_type> multiGenerator(process, grid, rsg,
+                                                brownianBridge);
+    ext::shared_ptr<PathGenerator<rsg_type> > singleGenerator;
+    if (factors == 1)
+        singleGenerator = ext::make_shared<PathGenerator<rsg_type> >(
+            ext::dynamic_pointer_cast<StochasticProcess1D>(process),
+            grid, rsg, brownianBridge);
+
+    Real tolerance = 1.0e-12;
+    for (Size k=0; k<2; ++k) {
+        const PathBatch& batch = generator.next();
+        std::vector<MultiPath> expected, expectedAntithetic;
+        for (Size p=0; p<batchSize; ++p) {
+            if (singleGenerator != nullptr) {
+                expected.emplace_back(std::vector<Path>(
+                                    1, singleGenerator->next().value));
+                expectedAntithetic.emplace_back(std::vector<Path>(
+                                    1, singleGenerator->antithetic().value));
+            } else {
+                expected.push_back(multiGenerator.next().value);
+                expectedAntithetic.push_back(
+                                    multiGenerator.antithetic().value);
+            }
+        }
+        for (Size antithetic=0; antithetic<2; ++antithetic) {
+            if (antithetic != 0U)
+                generator.antithetic();
+            const std::vector<MultiPath>& paths =
+                antithetic != 0U ? expectedAntithetic : expected;
+            for (Size p=0; p<batchSize; ++p) {
+                for (Size j=0; j<assets; ++j) {
+                    for (Size i=0; i<batch.length(); ++i) {
+                        Real calculated = batch.values(i, j)[p];
+                        Real reference = paths[p][j][i];
+                        if (std::fabs(calculated-reference) >
+                            tolerance*std::max(1.0, std::fabs(reference)))
+                            BOOST_FAIL("using " << tag << " process "
+                                       << (brownianBridge ?
+                                           "with Brownian bridge" : "")
+                                       << (antithetic != 0U ?
+                                           " (antithetic)" : "") << ":\n"
+                                       << std::setprecision(13)
+                                       << "    path:       " << p << "\n"
+                                       << "    asset:      " << j << "\n"
+                                       << "    step:       " << i << "\n"
+                                       << "    calculated: " << calculated
+                                       << "\n"
+                                       << "    expected:   " << reference);
+                    }
+                }
+            }
+        }
+    }
+}
+
 
 BOOST_AUTO_TEST_CASE(testPathGenerator) {
 
@@ -284,6 +356,42 @@ BOOST_AUTO_TEST_CASE(testMultiPathGenerator) {
     testMultiple(process, "square-root", result4, result4a);
 }
 
+BOOST_AUTO_TEST_CASE(testBatchPathGenerator) {
+
+    BOOST_TEST_MESSAGE("Testing batch path generation against single paths...");
+
+    Settings::instance().evaluationDate() = Date(26,April,2005);
+
+    Handle<Quote> x0(ext::shared_ptr<Quote>(new SimpleQuote(100.0)));
+    Handle<YieldTermStructure> r(flatRate(0.05, Actual360()));
+    Handle<YieldTermStructure> q(flatRate(0.02, Actual360()));
+    Handle<BlackVolTermStructure> sigma(flatVol(0.20, Actual360()));
+
+    ext::shared_ptr<StochasticProcess> bsm(
+                                 new BlackScholesMertonProcess(x0,q,r,sigma));
+    testBatch(bsm, "Black-Scholes", false);
+    testBatch(bsm, "Black-Scholes", true);
+
+    testBatch(ext::make_shared<HullWhiteProcess>(r, 0.1, 0.01),
+              "Hull-White", false);
+
+    testBatch(ext::make_shared<OrnsteinUhlenbeckProcess>(0.1, 0.20),
+              "Ornstein-Uhlenbeck", false);
+
+    HestonProcess::Discretization schemes[] = {
+        HestonProcess::PartialTruncation,
+        HestonProcess::FullTruncation,
+        HestonProcess::Reflection,
+        HestonProcess::QuadraticExponential,
+        HestonProcess::QuadraticExponentialMartingale,
+        HestonProcess::BroadieKayaExactSchemeLaguerre };
+    for (auto& scheme : schemes) {
+        testBatch(ext::make_shared<HestonProcess>(r, q, x0, 0.04, 1.5,
+                                                  0.04, 0.5, -0.7, scheme),
+                  "Heston", false);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
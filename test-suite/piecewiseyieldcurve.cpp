@@ -40,10 +40,12 @@
 #include <quotes/simplequote.hpp>
 #include <termstructures/globalbootstrap.hpp>
 #include <termstructures/yield/bondhelpers.hpp>
+#include <termstructures/yield/discountcurve.hpp>
 #include <termstructures/yield/flatforward.hpp>
 #include <termstructures/yield/oisratehelper.hpp>
 #include <termstructures/yield/piecewiseyieldcurve.hpp>
 #include <termstructures/yield/ratehelpers.hpp>
+#include <termstructures/yield/zerocurve.hpp>
 #include <time/asx.hpp>
 #include <time/calendars/canada.hpp>
 #include <time/calendars/japan.hpp>
@@ -1368,6 +1370,333 @@ BOOST_AUTO_TEST_CASE(testGlobalBootstrap, *precondition(usingAtParCoupons())) {
     }
 }
 
+// quote counting how many times it's read; the global bootstrap
+// reads it once for each evaluation of the error terms
+class CountingQuote : public SimpleQuote {
+  public:
+    using SimpleQuote::SimpleQuote;
+    Real value() const override {
+        ++calls;
+        return SimpleQuote::value();
+    }
+    mutable Size calls = 0;
+};
+
+BOOST_AUTO_TEST_CASE(testGlobalBootstrapWithHelperDerivatives) {
+
+    BOOST_TEST_MESSAGE("Testing global bootstrap with analytic helper derivatives...");
+
+    Date today(26, Sep, 2019);
+    Settings::instance().evaluationDate() = today;
+
+    ext::shared_ptr<IborIndex> index = ext::make_shared<Euribor>(6 * Months);
+    ext::shared_ptr<OvernightIndex> overnightIndex = ext::make_shared<Estr>();
+
+    // today's fixings are stored, so that the ones of the
+    // overnight coupons starting today don't depend on the curve
+    overnightIndex->addFixing(today, 0.0045);
+
+    std::vector<Real> rates;
+    for (Size i = 1; i <= 3; ++i)
+        rates.push_back(0.010 + 0.0005 * i);
+    for (Size i = 1; i <= 12; ++i)
+        rates.push_back(0.012 + 0.0003 * i);
+    for (Size i = 2; i <= 10; ++i)
+        rates.push_back(0.015 + 0.0008 * i);
+    for (Size i = 1; i <= 10; ++i)
+        rates.push_back(0.008 + 0.0007 * i);
+
+    // each curve needs its own helpers, and its own quotes to count
+    // the evaluations of the error terms
+    auto makeHelpers = [&](std::vector<ext::shared_ptr<CountingQuote> >& quotes,
+                           std::vector<ext::shared_ptr<RateHelper> >& iborHelpers,
+                           std::vector<ext::shared_ptr<RateHelper> >& oisHelpers) {
+        for (Real r : rates)
+            quotes.push_back(ext::make_shared<CountingQuote>(r));
+        Size q = 0;
+        for (Size i = 1; i <= 3; ++i)
+            iborHelpers.push_back(ext::make_shared<DepositRateHelper>(
+                Handle<Quote>(quotes[q++]), i * Months, 2, TARGET(), ModifiedFollowing, true,
+                Actual360()));
+        for (Size i = 1; i <= 12; ++i)
+            // odd start months use the indexed coupon, even ones don't
+            iborHelpers.push_back(ext::make_shared<FraRateHelper>(
+                Handle<Quote>(quotes[q++]), i, index, Pillar::LastRelevantDate, Date(),
+                i % 2 == 1));
+        for (Size i = 2; i <= 10; ++i)
+            iborHelpers.push_back(ext::make_shared<SwapRateHelper>(
+                Handle<Quote>(quotes[q++]), i * Years, TARGET(), Annual, ModifiedFollowing,
+                Thirty360(Thirty360::BondBasis), index));
+        for (Size i = 1; i <= 10; ++i)
+            oisHelpers.push_back(ext::make_shared<OISRateHelper>(
+                0, i * Years, Handle<Quote>(quotes[q++]), overnightIndex));
+    };
+
+    std::vector<ext::shared_ptr<CountingQuote> > quotes, fdQuotes, jumpQuotes;
+    std::vector<ext::shared_ptr<RateHelper> > helpers, oisHelpers, fdHelpers, fdOisHelpers,
+        jumpHelpers, jumpOisHelpers;
+    makeHelpers(quotes, helpers, oisHelpers);
+    makeHelpers(fdQuotes, fdHelpers, fdOisHelpers);
+    makeHelpers(jumpQuotes, jumpHelpers, jumpOisHelpers);
+
+    // check the derivatives against the implied quotes on a flat curve
+    Real rate = 0.02, h = 1.0e-6;
+    FlatForward flat(today, rate, Actual365Fixed());
+    FlatForward flatUp(today, rate + h, Actual365Fixed());
+    FlatForward flatDown(today, rate - h, Actual365Fixed());
+    std::vector<ext::shared_ptr<RateHelper> > allHelpers = helpers;
+    allHelpers.insert(allHelpers.end(), oisHelpers.begin(), oisHelpers.end());
+    for (auto& helper : allHelpers) {
+        std::vector<Time> times;
+        std::vector<Real> derivatives;
+        helper->setTermStructure(&flat);
+        BOOST_REQUIRE(helper->impliedQuoteDerivatives(times, derivatives));
+        BOOST_REQUIRE(times.size() == derivatives.size());
+        Real calculated = 0.0;
+        for (Size k = 0; k < times.size(); ++k)
+            calculated -= derivatives[k] * times[k] * flat.discount(times[k]);
+        helper->setTermStructure(&flatUp);
+        Real up = helper->impliedQuote();
+        helper->setTermStructure(&flatDown);
+        Real down = helper->impliedQuote();
+        Real expected = (up - down) / (2.0 * h);
+        if (std::fabs(calculated - expected) > 1.0e-6)
+            BOOST_ERROR("wrong derivatives for helper with pillar " << helper->pillarDate()
+                        << "\n    calculated rate sensitivity: " << calculated
+                        << "\n    expected rate sensitivity:   " << expected);
+    }
+
+    // the analytic Jacobian is available for log-linear discounts and
+    // linear zero rates; it is not for log-cubic discounts, for which
+    // the error terms are evaluated once per pillar for each Jacobian
+    typedef PiecewiseYieldCurve<Discount, LogLinear, GlobalBootstrap> DiscountCurve;
+    typedef PiecewiseYieldCurve<ZeroYield, Linear, GlobalBootstrap> ZeroCurve;
+    typedef PiecewiseYieldCurve<Discount, MonotonicLogCubic, GlobalBootstrap> CubicCurve;
+    ext::shared_ptr<YieldTermStructure> curve = ext::make_shared<DiscountCurve>(
+        today, helpers, Actual365Fixed(), LogLinear(), DiscountCurve::bootstrap_type(1.0e-12));
+    ext::shared_ptr<YieldTermStructure> oisCurve = ext::make_shared<ZeroCurve>(
+        today, oisHelpers, Actual365Fixed(), Linear(), ZeroCurve::bootstrap_type(1.0e-12));
+    ext::shared_ptr<YieldTermStructure> fdCurve = ext::make_shared<CubicCurve>(
+        today, fdHelpers, Actual365Fixed(), MonotonicLogCubic(),
+        CubicCurve::bootstrap_type(1.0e-12));
+    // the same curves with a neutral jump, which disables the
+    // analytic Jacobian and gives the reference numerical cost
+    const std::vector<Handle<Quote> > jumps = {
+        Handle<Quote>(ext::make_shared<SimpleQuote>(1.0)) };
+    const std::vector<Date> jumpDates = { today + 6 * Months };
+    ext::shared_ptr<YieldTermStructure> jumpCurve = ext::make_shared<DiscountCurve>(
+        today, jumpHelpers, Actual365Fixed(), jumps, jumpDates, LogLinear(),
+        DiscountCurve::bootstrap_type(1.0e-12));
+    ext::shared_ptr<YieldTermStructure> jumpOisCurve = ext::make_shared<ZeroCurve>(
+        today, jumpOisHelpers, Actual365Fixed(), jumps, jumpDates, Linear(),
+        ZeroCurve::bootstrap_type(1.0e-12));
+
+    // small moves are handled by reusing the last Jacobian, large ones
+    // by running the optimizer again; the helpers must be repriced anyway
+    const Real moves[] = { 0.0, 1.0e-6, 1.0e-5, 0.005 };
+    for (auto move : moves) {
+        for (auto& q : quotes) {
+            q->setValue(q->value() + move);
+            q->calls = 0;
+        }
+        for (auto& q : fdQuotes) {
+            q->setValue(q->value() + move);
+            q->calls = 0;
+        }
+        for (auto& q : jumpQuotes) {
+            q->setValue(q->value() + move);
+            q->calls = 0;
+        }
+        curve->discount(1.0);
+        oisCurve->discount(1.0);
+        fdCurve->discount(1.0);
+        jumpCurve->discount(1.0);
+        jumpOisCurve->discount(1.0);
+
+        // the pillars are not bumped on the analytic path; on the
+        // numerical one, each Jacobian takes an evaluation per pillar.
+        // When the numerical path computed a Jacobian, the analytic one
+        // must be several times cheaper; when it reused the last one,
+        // both just reprice the helpers and must cost the same.
+        Size evaluations = quotes.front()->calls,
+             oisEvaluations = quotes.back()->calls,
+             fdEvaluations = fdQuotes.front()->calls,
+             jumpEvaluations = jumpQuotes.front()->calls,
+             jumpOisEvaluations = jumpQuotes.back()->calls;
+        auto tooMany = [](Size analytic, Size numerical, Size pillars) {
+            return numerical >= pillars ? analytic * 3 >= numerical
+                                        : analytic > numerical;
+        };
+        if (tooMany(evaluations, jumpEvaluations, helpers.size())
+            || tooMany(oisEvaluations, jumpOisEvaluations, oisHelpers.size()))
+            BOOST_ERROR("analytic Jacobian not used after a " << move << " move"
+                        << "\n    error evaluations:     " << evaluations
+                        << " (numerical: " << jumpEvaluations << ")"
+                        << "\n    OIS error evaluations: " << oisEvaluations
+                        << " (numerical: " << jumpOisEvaluations << ")");
+        if (move == 0.0 && fdEvaluations < fdHelpers.size())
+            BOOST_ERROR("numerical Jacobian not used for log-cubic discounts"
+                        << "\n    error evaluations: " << fdEvaluations);
+        if (move == 0.0 && (jumpEvaluations < jumpHelpers.size()
+                            || jumpOisEvaluations < jumpOisHelpers.size()))
+            BOOST_ERROR("numerical Jacobian not used for curves with jumps"
+                        << "\n    error evaluations:     " << jumpEvaluations
+                        << "\n    OIS error evaluations: " << jumpOisEvaluations);
+
+        allHelpers = helpers;
+        allHelpers.insert(allHelpers.end(), oisHelpers.begin(), oisHelpers.end());
+        allHelpers.insert(allHelpers.end(), fdHelpers.begin(), fdHelpers.end());
+        allHelpers.insert(allHelpers.end(), jumpHelpers.begin(), jumpHelpers.end());
+        allHelpers.insert(allHelpers.end(), jumpOisHelpers.begin(), jumpOisHelpers.end());
+        for (auto& helper : allHelpers) {
+            if (std::fabs(helper->quoteError()) > 1.0e-10)
+                BOOST_ERROR("failed to reprice helper with pillar " << helper->pillarDate()
+                            << " after a " << move << " move"
+                            << std::setprecision(12)
+                            << "\n    quote:   " << helper->quote()->value()
+                            << "\n    implied: " << helper->impliedQuote());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testIncrementalBootstrap) {
+
+    BOOST_TEST_MESSAGE("Testing incremental iterative bootstrap...");
+
+    Date today(26, Sep, 2019);
+    Settings::instance().evaluationDate() = today;
+
+    ext::shared_ptr<IborIndex> index = ext::make_shared<Euribor>(6 * Months);
+
+    std::vector<ext::shared_ptr<SimpleQuote> > quotes;
+    for (Size i = 0; i < 20; ++i)
+        quotes.push_back(ext::make_shared<SimpleQuote>(0.01 + 0.0004 * i));
+
+    // the two curves need separate helpers
+    std::vector<ext::shared_ptr<RateHelper> > helpers[2];
+    for (auto& h : helpers) {
+        h.push_back(ext::make_shared<DepositRateHelper>(Handle<Quote>(quotes[0]), index));
+        for (Size i = 1; i < 6; ++i)
+            h.push_back(ext::make_shared<FraRateHelper>(Handle<Quote>(quotes[i]), i, index));
+        for (Size i = 6; i < quotes.size(); ++i)
+            h.push_back(ext::make_shared<SwapRateHelper>(
+                Handle<Quote>(quotes[i]), (i - 4) * Years, TARGET(), Annual, ModifiedFollowing,
+                Thirty360(Thirty360::BondBasis), index));
+    }
+
+    typedef PiecewiseYieldCurve<Discount, LogLinear> Curve;
+    Curve full(2, TARGET(), helpers[0], Actual365Fixed());
+    Curve incremental(2, TARGET(), helpers[1], Actual365Fixed(), LogLinear(),
+                      Curve::bootstrap_type(Null<Real>(), Null<Real>(), Null<Real>(), 1, 2.0,
+                                            2.0, false, 10, MAX_FUNCTION_EVALUATIONS, true));
+
+    auto check = [&](const std::string& what) {
+        const std::vector<Date>& dates = full.dates();
+        BOOST_REQUIRE(dates == incremental.dates());
+        for (const auto& d : dates) {
+            if (std::fabs(full.discount(d) - incremental.discount(d)) > 1.0e-10)
+                BOOST_ERROR("incremental bootstrap failed " << what
+                            << std::setprecision(12)
+                            << "\n    date:          " << d
+                            << "\n    full:          " << full.discount(d)
+                            << "\n    incremental:   " << incremental.discount(d));
+        }
+        for (const auto& h : helpers[1]) {
+            if (std::fabs(h->quoteError()) > 1.0e-9)
+                BOOST_ERROR("incremental bootstrap failed to reprice helper " << what
+                            << "\n    pillar: " << h->pillarDate()
+                            << "\n    error:  " << h->quoteError());
+        }
+    };
+
+    check("on first calculation");
+
+    // single ticks at the short end, in the middle and at the long end
+    Size ticked[] = { 0, 9, 19, 3 };
+    for (auto i : ticked) {
+        quotes[i]->setValue(quotes[i]->value() + 0.0001);
+        check("after tick of quote #" + std::to_string(i));
+    }
+
+    // several ticks between calculations
+    quotes[15]->setValue(quotes[15]->value() - 0.0002);
+    quotes[7]->setValue(quotes[7]->value() - 0.0002);
+    check("after multiple ticks");
+
+    // all helpers are notified of a change in the evaluation date
+    Settings::instance().evaluationDate() = today + 1;
+    check("after change of evaluation date");
+}
+
+BOOST_AUTO_TEST_CASE(testIncrementalBootstrapWithMovingEvaluationDate) {
+
+    BOOST_TEST_MESSAGE("Testing incremental iterative bootstrap when the evaluation date moves...");
+
+    Date today(26, Sep, 2019);
+    Settings::instance().evaluationDate() = today;
+
+    ext::shared_ptr<IborIndex> index = ext::make_shared<Euribor>(6 * Months);
+
+    std::vector<ext::shared_ptr<SimpleQuote> > quotes;
+    for (Size i = 0; i < 9; ++i)
+        quotes.push_back(ext::make_shared<SimpleQuote>(0.01 + 0.0004 * i));
+
+    // the futures helper has fixed dates and, unlike the swap helpers,
+    // is not notified when the evaluation date moves
+    auto futuresPrice = ext::make_shared<SimpleQuote>(99.0);
+    std::vector<ext::shared_ptr<RateHelper> > helpers[2];
+    for (auto& h : helpers) {
+        h.push_back(ext::make_shared<FuturesRateHelper>(
+            Handle<Quote>(futuresPrice), Date(18, Dec, 2019), Date(18, Mar, 2020),
+            Actual360()));
+        for (Size i = 0; i < quotes.size(); ++i)
+            h.push_back(ext::make_shared<SwapRateHelper>(
+                Handle<Quote>(quotes[i]), (i + 2) * Years, TARGET(), Annual, ModifiedFollowing,
+                Thirty360(Thirty360::BondBasis), index));
+    }
+
+    typedef PiecewiseYieldCurve<Discount, LogLinear> Curve;
+    Curve full(2, TARGET(), helpers[0], Actual365Fixed());
+    Curve incremental(2, TARGET(), helpers[1], Actual365Fixed(), LogLinear(),
+                      Curve::bootstrap_type(Null<Real>(), Null<Real>(), Null<Real>(), 1, 2.0,
+                                            2.0, false, 10, MAX_FUNCTION_EVALUATIONS, true));
+
+    auto check = [&](const std::string& what) {
+        const std::vector<Date>& dates = full.dates();
+        BOOST_REQUIRE(dates == incremental.dates());
+        for (const auto& d : dates) {
+            if (std::fabs(full.discount(d) - incremental.discount(d)) > 1.0e-10)
+                BOOST_ERROR("incremental bootstrap failed " << what
+                            << std::setprecision(12)
+                            << "\n    date:          " << d
+                            << "\n    full:          " << full.discount(d)
+                            << "\n    incremental:   " << incremental.discount(d));
+        }
+        for (const auto& h : helpers[1]) {
+            if (std::fabs(h->quoteError()) > 1.0e-9)
+                BOOST_ERROR("incremental bootstrap failed to reprice helper " << what
+                            << "\n    pillar: " << h->pillarDate()
+                            << "\n    error:  " << h->quoteError());
+        }
+    };
+
+    check("on first calculation");
+
+    quotes[5]->setValue(quotes[5]->value() + 0.0001);
+    check("after tick");
+
+    // the reference date, and thus the times of all pillars, moves
+    Settings::instance().evaluationDate() = today + 1;
+    check("after change of evaluation date");
+
+    quotes[7]->setValue(quotes[7]->value() + 0.0001);
+    Settings::instance().evaluationDate() = today + 2;
+    check("after tick and change of evaluation date");
+
+    quotes[3]->setValue(quotes[3]->value() - 0.0001);
+    check("after tick following change of evaluation date");
+}
+
 /* This test attempts to build an ARS collateralised in USD curve as of 25 Sep 2019. Using the default 
    IterativeBootstrap with no retries, the yield curve building fails. Allowing retries, it expands the min and max 
    bounds and passes.
@@ -1626,6 +1955,70 @@ BOOST_AUTO_TEST_CASE(testDatedSwapHelpers) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testBatchDiscountsWithLocateIndex) {
+    BOOST_TEST_MESSAGE("Testing batch discounts on curves with a locate index...");
+
+    CommonVars vars;
+
+    // sorted times, from the reference date to past the last pillar
+    std::vector<Time> times;
+    for (Size i=0; i<=2000; ++i)
+        times.push_back(0.02 * i);
+    std::vector<DiscountFactor> discounts(times.size());
+
+    auto check = [&](const YieldTermStructure& curve,
+                     const YieldTermStructure& reference,
+                     const std::string& name) {
+        curve.discounts(times.data(), discounts.data(), times.size());
+        for (Size i=0; i<times.size(); ++i) {
+            DiscountFactor expected = reference.discount(times[i]);
+            if (std::fabs(discounts[i] - expected) > 1.0e-14)
+                BOOST_ERROR("batch discount mismatch for " << name
+                            << std::setprecision(15)
+                            << "\n    time:       " << times[i]
+                            << "\n    calculated: " << discounts[i]
+                            << "\n    expected:   " << expected);
+        }
+    };
+
+    auto discountCurve = ext::make_shared<PiecewiseYieldCurve<Discount, LogLinear> >(
+        vars.settlement, vars.instruments, Actual360());
+    auto zeroCurve = ext::make_shared<PiecewiseYieldCurve<ZeroYield, Linear> >(
+        vars.settlement, vars.instruments, Actual360());
+    // enabled before the first bootstrap, it must survive the
+    // rebuilds of the interpolation
+    discountCurve->enableLocateIndex();
+    zeroCurve->enableLocateIndex();
+    discountCurve->enableExtrapolation();
+    zeroCurve->enableExtrapolation();
+
+    for (Real move : { 0.0, 0.001 }) {
+        for (auto& q : vars.rates)
+            q->setValue(q->value() + move);
+
+        // the same nodes, interpolated without the index
+        DiscountCurve discountReference(discountCurve->dates(), discountCurve->data(),
+                                        Actual360());
+        ZeroCurve zeroReference(zeroCurve->dates(), zeroCurve->data(), Actual360());
+        discountReference.enableExtrapolation();
+        zeroReference.enableExtrapolation();
+
+        check(*discountCurve, discountReference, "log-linear discount bootstrap");
+        check(*zeroCurve, zeroReference, "linear zero bootstrap");
+
+        DiscountCurve indexedDiscounts(discountCurve->dates(), discountCurve->data(),
+                                       Actual360());
+        ZeroCurve indexedZeros(zeroCurve->dates(), zeroCurve->data(), Actual360());
+        indexedDiscounts.enableLocateIndex();
+        indexedZeros.enableLocateIndex();
+        indexedDiscounts.enableExtrapolation();
+        indexedZeros.enableExtrapolation();
+
+        check(indexedDiscounts, discountReference, "log-linear discount curve");
+        check(indexedZeros, zeroReference, "linear zero curve");
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -26,7 +26,13 @@
  test cases. This benchmarks supports multiprocessing, e.g.
 
  Single process benchmark for testing:
- ./quantlib-benchmark --size=1 --nProc=1 
+ ./quantlib-benchmark --size=1
+
+ Single process benchmark, writing the results to a JSON file:
+ ./quantlib-benchmark --json=results.json
+
+ When the benchmark is compiled with QL_ENABLE_PARALLEL_UNIT_TEST_RUNNER,
+ worker processes are available:
 
  Benchmark with 16 processes and the default size:
  ./quantlib-benchmark --nProc=16
@@ -34,6 +40,9 @@
  Benchmark with one worker process per hardware thread and the default size:
  ./quantlib-benchmark 
 
+ Benchmark with 16 processes, writing the results to a JSON file:
+ ./quantlib-benchmark --nProc=16 --json=results.json
+
  This benchmark is derived from quantlibtestsuite.cpp. Please see the
  copyrights therein.
 */
@@ -55,8 +64,12 @@
 #include <boost/test/unit_test_suite.hpp>
 #include <boost/test/framework.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <utility>
 #include <vector>
 #include <string>
@@ -129,6 +142,13 @@ namespace {
             // Total runtime across multiple runs is manually accumulated into the class
             double& getTotalRuntime()       { return totalRuntime_; }
             const double& getTotalRuntime() const { return totalRuntime_; }
+            // The runtimes of the individual runs, used for the latency percentiles
+            std::vector<double>& getRuntimes()             { return runtimes_; }
+            const std::vector<double>& getRuntimes() const { return runtimes_; }
+            void addRuntime(double time) {
+                totalRuntime_ += time;
+                runtimes_.push_back(time);
+            }
             void setTestUnit(const boost::unit_test::test_unit * unit) { test_ = unit; }
 
 
@@ -180,6 +200,7 @@ namespace {
             const boost::unit_test::test_unit * test_ = nullptr;
             double cost_; 
             double totalRuntime_ = 0;
+            std::vector<double> runtimes_;
             std::function<void(void)> testBody_;
     };
 
@@ -345,6 +366,16 @@ namespace {
         }
 
 
+        // Nearest-rank percentile (0 < p <= 100) of a set of runtimes
+        static double percentile(std::vector<double> times, double p)
+        {
+            if (times.empty())
+                return 0.0;
+            std::sort(times.begin(), times.end());
+            auto rank = static_cast<size_t>(std::ceil(p / 100.0 * times.size()));
+            return times[std::max<size_t>(rank, 1) - 1];
+        }
+
         static void printResults(
                 unsigned nSize,                         // the size of the benchmark
                 double masterLifetime,                  // lifetime of the master process
@@ -387,7 +418,7 @@ namespace {
             std::cout << std::string(84,'-') << std::endl;
 
             if(verbose >= 2) {            
-                std::cout << "                       Total Runtime spent in each test " << std::endl;
+                std::cout << "          Total Runtime spent in each test, and p50/p99 latency of each run " << std::endl;
                 std::cout << std::string(84,'-') << std::endl;
 
                 // Compute max test name length
@@ -397,7 +428,9 @@ namespace {
                 for (const auto& b: bm) {
                     std::cout << b.getName()
                         << std::string(len+2 - b.getName().length(),' ')
-                        << ": " << b.getTotalRuntime()  << "s" << std::endl;
+                        << ": " << b.getTotalRuntime()  << "s"
+                        << "  (p50 " << percentile(b.getRuntimes(), 50.0) << "s"
+                        << ", p99 " << percentile(b.getRuntimes(), 99.0) << "s)" << std::endl;
                 }
                 std::cout << std::string(84,'-') << std::endl;
             }
@@ -405,6 +438,61 @@ namespace {
         }
 
 
+        // Escape quotes, backslashes and control characters for a JSON string
+        static std::string jsonEscaped(const std::string &s)
+        {
+            std::ostringstream out;
+            for (const char c : s) {
+                if (c == '"' || c == '\\')
+                    out << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                        << static_cast<int>(c) << std::dec << std::setfill(' ');
+                else
+                    out << c;
+            }
+            return out.str();
+        }
+
+
+        // Write the results in JSON format for automated processing
+        static void writeJson(
+                const std::string &fileName,
+                unsigned nSize,
+                double masterLifetime,
+                const std::vector<double> &workerLifetimes)
+        {
+            std::ofstream out(fileName);
+            if (!out) {
+                std::cerr << "Error: unable to open '" << fileName << "' for writing" << std::endl;
+                return;
+            }
+            out << std::setprecision(9);
+            out << "{\n"
+                << "  \"version\": \"" QL_VERSION "\",\n"
+                << "  \"size\": " << nSize << ",\n"
+                << "  \"workers\": " << workerLifetimes.size() << ",\n"
+                << "  \"throughput\": " << (double(nSize) * bm.size()) / masterLifetime << ",\n"
+                << "  \"runtime\": " << masterLifetime << ",\n"
+                << "  \"workerLifetimes\": [";
+            for (size_t i=0; i<workerLifetimes.size(); ++i)
+                out << (i == 0 ? "" : ", ") << workerLifetimes[i];
+            out << "],\n"
+                << "  \"benchmarks\": [\n";
+            for (size_t i=0; i<bm.size(); ++i) {
+                const Benchmark& b = bm[i];
+                out << "    {\"name\": \"" << jsonEscaped(b.getName()) << "\""
+                    << ", \"runs\": " << b.getRuntimes().size()
+                    << ", \"total\": " << b.getTotalRuntime()
+                    << ", \"p50\": " << percentile(b.getRuntimes(), 50.0)
+                    << ", \"p99\": " << percentile(b.getRuntimes(), 99.0)
+                    << "}" << (i+1 < bm.size() ? "," : "") << "\n";
+            }
+            out << "  ]\n"
+                << "}\n";
+        }
+
+
 #ifdef QL_ENABLE_PARALLEL_UNIT_TEST_RUNNER
         // The entry point for the std::thread's that will be the workers
         static int worker(const char * exe, const std::vector<std::string>& args) {        
@@ -489,6 +577,7 @@ QL_BENCHMARK_DECLARE(BatesModelTests, testAnalyticAndMcVsJumpDiffusion, 5, 1.0);
 QL_BENCHMARK_DECLARE(HestonModelTests, testDAXCalibration, 1, 0.5);
 QL_BENCHMARK_DECLARE(HestonModelTests, testFdBarrierVsCached, 1, 3.0);
 QL_BENCHMARK_DECLARE(HestonModelTests, testFdAmerican, 1, 1.0);
+QL_BENCHMARK_DECLARE(HestonModelTests, testFdVanillaRichardsonExtrapolation, 5, 1.0);
 QL_BENCHMARK_DECLARE(HestonModelTests, testLocalVolFromHestonModel, 10, 1.0);
 QL_BENCHMARK_DECLARE(FdHestonTests, testFdmHestonAmerican, 10, 1.0);
 QL_BENCHMARK_DECLARE(FdHestonTests, testAmericanCallPutParity, 15, 1.5);
@@ -536,6 +625,7 @@ QL_BENCHMARK_DECLARE(CmsSpreadTests, testCouponPricing, 1, 1.0);
 QL_BENCHMARK_DECLARE(CmsTests, testCmsSwap, 20, 2.0);
 QL_BENCHMARK_DECLARE(CmsTests, testParity, 30, 2.0);
 QL_BENCHMARK_DECLARE(InterestRateTests, testConversions, 10000, 0.1);
+QL_BENCHMARK_DECLARE(SwapTests, testPortfolioNpvWithBatchedDiscounts, 20, 1.0);
 
 // Credit Derivatives
 QL_BENCHMARK_DECLARE(NthToDefaultTests, testGauss, 2, 14.0);
@@ -552,6 +642,9 @@ QL_BENCHMARK_DECLARE(SwingOptionTests, testFdBSSwingOption, 20, 1.0);
 QL_BENCHMARK_DECLARE(VppTests, testVPPPricing, 1, 5.0);
 QL_BENCHMARK_DECLARE(VppTests, testKlugeExtOUSpreadOption, 1, 1.0);
 
+// Finite-difference methods
+QL_BENCHMARK_DECLARE(FdmLinearOpTests, testTripleBandMapSolveOnGrids, 10, 1.0);
+
 // Math
 QL_BENCHMARK_DECLARE(RiskStatisticsTests, testResults, 4, 0.5);
 QL_BENCHMARK_DECLARE(LowDiscrepancyTests, testMersenneTwisterDiscrepancy, 2, 0.5);
@@ -594,6 +687,9 @@ int main(int argc, char* argv[] )  // NOLINT(bugprone-exception-escape)
     // A threadId is useful for debugging, but has no other purpose
     unsigned threadId = 0;
 
+    // Optional file for the results in JSON format
+    std::string jsonFile;
+
 
 
 
@@ -613,6 +709,10 @@ int main(int argc, char* argv[] )  // NOLINT(bugprone-exception-escape)
                 exit(1);
             }
         }
+        else if (tok[0] == "--json") {
+            QL_REQUIRE(tok.size() == 2 && !tok[1].empty(), "Must provide a file name for the JSON output");
+            jsonFile = tok[1];
+        }
         else if (tok[0] == "--threadId") {
             QL_REQUIRE(tok.size() == 2, "Must provide a threadId");
             try {
@@ -671,6 +771,9 @@ int main(int argc, char* argv[] )  // NOLINT(bugprone-exception-escape)
                 << "\n"
                 << "--verbose=<0|1|2|3>\t controls verbosity of output, default value is verbose=" << BenchmarkSupport::verbose << "\n"
                 << "\n"
+                << "--json=<file>      \t writes the results, including the p50/p99 latency\n"
+                << "                   \t of each test, to the given file in JSON format\n"
+                << "\n"
                 << "-?, --help         \t display this help and exit"
                 << std::endl;
             return 0;
@@ -727,7 +830,7 @@ int main(int argc, char* argv[] )  // NOLINT(bugprone-exception-escape)
             for (unsigned i=0; i < nSize; ++i) {
                 for(unsigned int j=0; j<bm.size(); j++) {
                     double time = bm[j].runBenchmark();
-                    bm[j].getTotalRuntime() += time;
+                    bm[j].addRuntime(time);
                     LOG_MESSAGE("MASTER  :  completed benchmarkId=" << j << ", time=" << time);              
                 }
             }
@@ -735,6 +838,8 @@ int main(int argc, char* argv[] )  // NOLINT(bugprone-exception-escape)
             double masterLifetime = std::chrono::duration_cast<std::chrono::microseconds>(stopTime - startTime).count() * 1e-6;
             workerLifetimes.push_back(masterLifetime);        
             BenchmarkSupport::printResults(nSize, masterLifetime, workerLifetimes);
+            if (!jsonFile.empty())
+                BenchmarkSupport::writeJson(jsonFile, nSize, masterLifetime, workerLifetimes);
         }
         else {
 
@@ -835,7 +940,7 @@ int main(int argc, char* argv[] )  // NOLINT(bugprone-exception-escape)
                         // A benchmark test has failed - should be impossible here
                         BenchmarkSupport::terminateBenchmark();
                     }               
-                    bm[r.bmId].getTotalRuntime() += r.time;                             
+                    bm[r.bmId].addRuntime(r.time);                             
                 }
 
 
@@ -861,6 +966,8 @@ int main(int argc, char* argv[] )  // NOLINT(bugprone-exception-escape)
                 auto stopTime = std::chrono::steady_clock::now();            
                 double masterLifetime = std::chrono::duration_cast<std::chrono::microseconds>(stopTime - startTime).count() * 1e-6;
                 BenchmarkSupport::printResults(nSize, masterLifetime, workerLifetimes);
+                if (!jsonFile.empty())
+                    BenchmarkSupport::writeJson(jsonFile, nSize, masterLifetime, workerLifetimes);
 
 
             }
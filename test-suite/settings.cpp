@@ -19,7 +19,12 @@
 
 #include "toplevelfixture.hpp"
 #include "utilities.hpp"
+#include <indexes/ibor/euribor.hpp>
+#include <pricingcontext.hpp>
 #include <settings.hpp>
+#ifdef QL_ENABLE_SESSIONS
+#include <thread>
+#endif
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -61,6 +66,85 @@ BOOST_AUTO_TEST_CASE(testNotificationsOnDateChange) {
         BOOST_ERROR("missing notification");
 }
 
+BOOST_AUTO_TEST_CASE(testPricingContext) {
+    BOOST_TEST_MESSAGE("Testing installation of pricing contexts...");
+
+    Date today(11, February, 2021);
+    Date fixingDate(10, February, 2021);
+    Settings::instance().evaluationDate() = today;
+    Settings::instance().includeReferenceDateEvents() = false;
+
+    Euribor6M index;
+    index.addFixing(fixingDate, 0.01);
+
+    Flag flag;
+    flag.registerWith(Settings::instance().evaluationDate());
+
+    PricingContext context;
+    if (context.evaluationDate() != today)
+        BOOST_ERROR("evaluation date not captured");
+    if (context.fixings(index.name())[fixingDate] != 0.01)
+        BOOST_ERROR("fixings not captured");
+
+    // the captured fixings are shared, but not modified, by later fixings
+    index.addFixing(fixingDate - 1, 0.03);
+    if (context.fixings(index.name())[fixingDate - 1] != Null<Real>())
+        BOOST_ERROR("captured fixings modified by the index manager");
+    index.clearFixings();
+    index.addFixing(fixingDate, 0.01);
+
+    context.evaluationDate() = today + 1;
+    context.includeReferenceDateEvents() = true;
+    context.fixings(index.name())[fixingDate] = 0.02;
+
+    {
+        ScopedPricingContext scope(context);
+
+        if (!flag.isUp())
+            BOOST_ERROR("missing notification");
+        if (Settings::instance().evaluationDate() != today + 1)
+            BOOST_ERROR("evaluation date not installed");
+        if (!Settings::instance().includeReferenceDateEvents())
+            BOOST_ERROR("flags not installed");
+        if (index.fixing(fixingDate) != 0.02)
+            BOOST_ERROR("fixings not installed");
+    }
+
+    if (Settings::instance().evaluationDate() != today)
+        BOOST_ERROR("evaluation date not restored");
+    if (Settings::instance().includeReferenceDateEvents())
+        BOOST_ERROR("flags not restored");
+    if (index.fixing(fixingDate) != 0.01)
+        BOOST_ERROR("fixings not restored");
+
+#ifdef QL_ENABLE_SESSIONS
+    // with sessions, contexts can be installed on worker threads
+    // without affecting each other
+    const Size nrThreads = 8;
+    std::vector<int> failures(nrThreads, 0);
+    std::vector<std::thread> threads;
+    for (Size i=0; i<nrThreads; ++i) {
+        PricingContext scenario(context);
+        scenario.evaluationDate() = today + Integer(i);
+        scenario.fixings(index.name())[fixingDate] = 0.01*Real(i);
+        threads.emplace_back([scenario, i, &failures, today, fixingDate]() {
+            ScopedPricingContext scope(scenario);
+            for (Size k=0; k<1000; ++k) {
+                if (Settings::instance().evaluationDate() != today + Integer(i)
+                    || Euribor6M().fixing(fixingDate) != 0.01*Real(i))
+                    ++failures[i];
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (Size i=0; i<nrThreads; ++i) {
+        if (failures[i] != 0)
+            BOOST_ERROR("context of thread " << i << " was modified");
+    }
+#endif
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
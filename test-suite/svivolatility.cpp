@@ -65,6 +65,31 @@ BOOST_AUTO_TEST_CASE(testSviSmileSection) {
     QL_CHECK_CLOSE(date_section->variance(strike), a + b * sigma, 1E-10);
 }
 
+BOOST_AUTO_TEST_CASE(testSviSmileSectionOnStrikeGrid) {
+
+    BOOST_TEST_MESSAGE("Testing SviSmileSection on a whole strike grid...");
+
+    Time tte = 0.75;
+    Real forward = 123.45;
+    std::vector<Real> sviParameters = {0.01, 0.229, 0.337, 0.439, 0.193};
+    SviSmileSection section(tte, forward, sviParameters);
+
+    std::vector<Real> strikes;
+    for (Real k = 0.0; k <= 300.0; k += 2.5)
+        strikes.push_back(k);
+    Size n = strikes.size();
+
+    std::vector<Real> vols(n), prices(n);
+    section.volatilities(strikes.data(), vols.data(), n);
+    section.optionPrices(strikes.data(), prices.data(), n, Option::Put, 0.95);
+
+    for (Size i = 0; i < n; ++i) {
+        QL_CHECK_CLOSE(vols[i], section.volatility(strikes[i]), 1E-12);
+        BOOST_CHECK_SMALL(prices[i] - section.optionPrice(strikes[i], Option::Put, 0.95),
+                          1E-12);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -21,6 +21,7 @@
 #include "utilities.hpp"
 #include <instruments/vanillaswap.hpp>
 #include <pricingengines/swap/discountingswapengine.hpp>
+#include <termstructures/yield/discountcurve.hpp>
 #include <termstructures/yield/flatforward.hpp>
 #include <time/calendars/nullcalendar.hpp>
 #include <time/daycounters/thirty360.hpp>
@@ -370,6 +371,60 @@ BOOST_AUTO_TEST_CASE(testNotifications) {
         BOOST_FAIL("swap was not notified of curve change");
 }
 
+BOOST_AUTO_TEST_CASE(testPortfolioNpvWithBatchedDiscounts) {
+
+    BOOST_TEST_MESSAGE("Testing vanilla-swap portfolio valuation "
+                       "with batched discount factors...");
+
+    CommonVars vars;
+
+    std::vector<Date> dates = { vars.settlement };
+    std::vector<DiscountFactor> discounts = { 1.0 };
+    Time t = 0.0;
+    for (Size i=1; i<=25; ++i) {
+        const Period step = (i <= 5) ? Period(3*i, Months) : Period(2*i-8, Years);
+        dates.push_back(vars.settlement + step);
+        const Time ti = Actual365Fixed().yearFraction(vars.settlement, dates.back());
+        const Rate forward = 0.02 + 0.001*i;
+        discounts.push_back(discounts.back() * std::exp(-forward*(ti-t)));
+        t = ti;
+    }
+    const auto curve = ext::make_shared<InterpolatedDiscountCurve<LogLinear> >(
+        dates, discounts, Actual365Fixed());
+    curve->enableLocateIndex();
+    vars.termStructure.linkTo(curve);
+
+    // about 10000 cash flows, on swaps of all lengths up to 30 years
+    std::vector<ext::shared_ptr<VanillaSwap> > portfolio;
+    Size cashflows = 0;
+    for (Integer length = 1; cashflows < 10000; length = length % 30 + 1) {
+        const Rate fixedRate = 0.02 + 0.0001*portfolio.size();
+        portfolio.push_back(vars.makeSwap(length, fixedRate, 0.0));
+        cashflows += portfolio.back()->fixedLeg().size()
+                   + portfolio.back()->floatingLeg().size();
+    }
+
+    Real npv = 0.0, expected = 0.0;
+    for (const auto& swap : portfolio) {
+        npv += swap->NPV();
+
+        Real fixedNPV = 0.0, floatingNPV = 0.0;
+        for (const auto& cf : swap->fixedLeg())
+            fixedNPV += cf->amount() * curve->discount(cf->date());
+        for (const auto& cf : swap->floatingLeg())
+            floatingNPV += cf->amount() * curve->discount(cf->date());
+        expected += floatingNPV - fixedNPV;
+    }
+
+    if (std::fabs(npv - expected) > 1.0e-8)
+        BOOST_ERROR("failed to reproduce pointwise-discounted portfolio value:\n"
+                    << std::fixed << std::setprecision(12)
+                    << "    swaps:      " << portfolio.size() << "\n"
+                    << "    cash flows: " << cashflows << "\n"
+                    << "    calculated: " << npv << "\n"
+                    << "    expected:   " << expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
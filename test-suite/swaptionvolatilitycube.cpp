@@ -23,6 +23,7 @@
 #include "swaptionvolstructuresutilities.hpp"
 #include "utilities.hpp"
 #include <indexes/swap/euriborswap.hpp>
+#include <math/optimization/levenbergmarquardt.hpp>
 #include <quotes/simplequote.hpp>
 #include <termstructures/volatility/swaption/interpolatedswaptionvolatilitycube.hpp>
 #include <termstructures/volatility/swaption/sabrswaptionvolatilitycube.hpp>
@@ -252,6 +253,175 @@ BOOST_AUTO_TEST_CASE(testSabrVols) {
     vars.makeVolSpreadsTest(volCube, tolerance);
 }
 
+BOOST_AUTO_TEST_CASE(testSabrWarmStartRecalibration) {
+
+    BOOST_TEST_MESSAGE("Testing warm-started recalibration of sabr swaption volatility cube...");
+
+    CommonVars vars;
+
+    std::vector<std::vector<Handle<Quote> > >
+        parametersGuess(vars.cube.tenors.options.size()*vars.cube.tenors.swaps.size());
+    for (Size i=0; i<vars.cube.tenors.options.size()*vars.cube.tenors.swaps.size(); i++) {
+        parametersGuess[i] = std::vector<Handle<Quote> >(4);
+        parametersGuess[i][0] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.2)));
+        parametersGuess[i][1] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.5)));
+        parametersGuess[i][2] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.4)));
+        parametersGuess[i][3] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.0)));
+    }
+    std::vector<bool> isParameterFixed(4, false);
+
+    const auto makeCube = [&](bool warmStart) {
+        return ext::make_shared<SabrSwaptionVolatilityCube>(
+            vars.atmVolMatrix, vars.cube.tenors.options, vars.cube.tenors.swaps,
+            vars.cube.strikeSpreads, vars.cube.volSpreadsHandle, vars.swapIndexBase,
+            vars.shortSwapIndexBase, vars.vegaWeighedSmileFit, parametersGuess,
+            isParameterFixed, true, ext::shared_ptr<EndCriteria>(), Null<Real>(),
+            ext::shared_ptr<OptimizationMethod>(), Null<Real>(), false, 50, false,
+            0.0001, warmStart);
+    };
+    const ext::shared_ptr<SabrSwaptionVolatilityCube> coldCube = makeCube(false);
+    const ext::shared_ptr<SabrSwaptionVolatilityCube> warmCube = makeCube(true);
+
+    const Matrix coldParameters = coldCube->sparseSabrParameters();
+    const Matrix warmParameters = warmCube->sparseSabrParameters();
+    for (Size i=0; i<coldParameters.rows(); ++i)
+        for (Size j=0; j<coldParameters.columns(); ++j)
+            if (coldParameters[i][j] != warmParameters[i][j])
+                BOOST_FAIL("\nfirst calibration of warm-started cube differs:"
+                           "\n  row = " << i << "\n  column = " << j <<
+                           "\n  cold = " << coldParameters[i][j] <<
+                           "\n  warm = " << warmParameters[i][j]);
+
+    // move the smile; the warm-started cube recalibrates from its
+    // previous parameters and must fit the market as well as a cold start
+    for (auto& spreads : vars.cube.volSpreadsHandle) {
+        for (auto& spread : spreads) {
+            const ext::shared_ptr<SimpleQuote> q =
+                ext::dynamic_pointer_cast<SimpleQuote>(*spread);
+            q->setValue(q->value()*1.05);
+        }
+    }
+    vars.cube.volSpreads *= 1.05;
+
+    vars.makeVolSpreadsTest(*warmCube, 12.0e-4);
+
+    const Real tolerance = 5.0e-4;
+    for (auto& option : vars.cube.tenors.options) {
+        for (auto& swap : vars.cube.tenors.swaps) {
+            const Rate atmStrike = coldCube->atmStrike(option, swap);
+            for (Real strikeSpread : vars.cube.strikeSpreads) {
+                const Rate strike = atmStrike + strikeSpread;
+                const Volatility coldVol =
+                    coldCube->volatility(option, swap, strike, true);
+                const Volatility warmVol =
+                    warmCube->volatility(option, swap, strike, true);
+                if (std::fabs(coldVol - warmVol) > tolerance)
+                    BOOST_ERROR("\nwarm-started recalibration differs:"
+                                "\n  option tenor = " << option <<
+                                "\n    swap tenor = " << swap <<
+                                "\n        strike = " << io::rate(strike) <<
+                                "\n      cold vol = " << io::volatility(coldVol) <<
+                                "\n      warm vol = " << io::volatility(warmVol) <<
+                                "\n     tolerance = " << tolerance);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testSabrCalibrationWithAnalyticJacobian) {
+
+    BOOST_TEST_MESSAGE("Testing sabr swaption volatility cube calibrated "
+                       "with analytic Jacobian...");
+
+    CommonVars vars;
+
+    std::vector<std::vector<Handle<Quote> > >
+        parametersGuess(vars.cube.tenors.options.size()*vars.cube.tenors.swaps.size());
+    for (Size i=0; i<vars.cube.tenors.options.size()*vars.cube.tenors.swaps.size(); i++) {
+        parametersGuess[i] = std::vector<Handle<Quote> >(4);
+        parametersGuess[i][0] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.2)));
+        parametersGuess[i][1] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.5)));
+        parametersGuess[i][2] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.4)));
+        parametersGuess[i][3] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.0)));
+    }
+    std::vector<bool> isParameterFixed(4, false);
+
+    const auto makeCube = [&](const ext::shared_ptr<EndCriteria>& endCriteria,
+                              const ext::shared_ptr<OptimizationMethod>& optMethod,
+                              bool useAnalyticJacobian = false) {
+        return ext::make_shared<SabrSwaptionVolatilityCube>(
+            vars.atmVolMatrix, vars.cube.tenors.options, vars.cube.tenors.swaps,
+            vars.cube.strikeSpreads, vars.cube.volSpreadsHandle, vars.swapIndexBase,
+            vars.shortSwapIndexBase, vars.vegaWeighedSmileFit, parametersGuess,
+            isParameterFixed, true, endCriteria, Null<Real>(), optMethod,
+            Null<Real>(), false, 50, false, 0.0001, false, useAnalyticJacobian);
+    };
+    // the default calibration is the finite-difference one...
+    const ext::shared_ptr<SabrSwaptionVolatilityCube> defaultCube =
+        makeCube(ext::shared_ptr<EndCriteria>(), ext::shared_ptr<OptimizationMethod>());
+    const ext::shared_ptr<SabrSwaptionVolatilityCube> numericalCube =
+        makeCube(ext::make_shared<EndCriteria>(60000, 100, 1e-8, 1e-8, 1e-8),
+                 ext::make_shared<LevenbergMarquardt>(1e-8, 1e-8, 1e-8));
+    // ...and the analytic Jacobian is opt-in, either through the
+    // optimizer or through a flag leaving each node its own optimizer
+    const ext::shared_ptr<SabrSwaptionVolatilityCube> analyticCube =
+        makeCube(ext::make_shared<EndCriteria>(1000, 100, 1e-8, 1e-8, 1e-8),
+                 ext::make_shared<LevenbergMarquardt>(1e-8, 1e-8, 1e-8, true));
+    const ext::shared_ptr<SabrSwaptionVolatilityCube> flaggedCube =
+        makeCube(ext::make_shared<EndCriteria>(1000, 100, 1e-8, 1e-8, 1e-8),
+                 ext::shared_ptr<OptimizationMethod>(), true);
+
+    const Matrix analyticParameters = analyticCube->sparseSabrParameters();
+    const Matrix flaggedParameters = flaggedCube->sparseSabrParameters();
+    for (Size i=0; i<analyticParameters.rows(); ++i)
+        for (Size j=0; j<analyticParameters.columns(); ++j)
+            if (analyticParameters[i][j] != flaggedParameters[i][j])
+                BOOST_FAIL("\nflagged analytic calibration differs:"
+                           "\n  row = " << i << "\n  column = " << j <<
+                           "\n  optimizer = " << analyticParameters[i][j] <<
+                           "\n  flag = " << flaggedParameters[i][j]);
+
+    const Matrix defaultParameters = defaultCube->sparseSabrParameters();
+    const Matrix numericalParameters = numericalCube->sparseSabrParameters();
+    for (Size i=0; i<defaultParameters.rows(); ++i)
+        for (Size j=0; j<defaultParameters.columns(); ++j)
+            if (defaultParameters[i][j] != numericalParameters[i][j])
+                BOOST_FAIL("\ndefault calibration changed:"
+                           "\n  row = " << i << "\n  column = " << j <<
+                           "\n  default = " << defaultParameters[i][j] <<
+                           "\n  finite differences = " << numericalParameters[i][j]);
+
+    const Real tolerance = 1.0e-5;
+    for (auto& option : vars.cube.tenors.options) {
+        for (auto& swap : vars.cube.tenors.swaps) {
+            const Rate atmStrike = numericalCube->atmStrike(option, swap);
+            for (Real strikeSpread : vars.cube.strikeSpreads) {
+                const Rate strike = atmStrike + strikeSpread;
+                const Volatility numericalVol =
+                    numericalCube->volatility(option, swap, strike, true);
+                const Volatility analyticVol =
+                    analyticCube->volatility(option, swap, strike, true);
+                if (std::fabs(numericalVol - analyticVol) > tolerance)
+                    BOOST_ERROR("\ncalibration with analytic Jacobian differs:"
+                                "\n  option tenor = " << option <<
+                                "\n    swap tenor = " << swap <<
+                                "\n        strike = " << io::rate(strike) <<
+                                "\n numerical vol = " << io::volatility(numericalVol) <<
+                                "\n  analytic vol = " << io::volatility(analyticVol) <<
+                                "\n     tolerance = " << tolerance);
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testSpreadedCube) {
 
     BOOST_TEST_MESSAGE("Testing spreaded swaption volatility cube...");
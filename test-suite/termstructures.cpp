@@ -25,6 +25,7 @@
 #include <termstructures/yield/piecewiseyieldcurve.hpp>
 #include <termstructures/yield/impliedtermstructure.hpp>
 #include <termstructures/yield/forwardspreadedtermstructure.hpp>
+#include <termstructures/yield/frozendiscountcurve.hpp>
 #include <termstructures/yield/zerospreadedtermstructure.hpp>
 #include <time/calendars/target.hpp>
 #include <time/calendars/nullcalendar.hpp>
@@ -415,6 +416,62 @@ BOOST_AUTO_TEST_CASE(testNullTimeToReference) {
                     << "    expected:   " << expected);
 }
 
+BOOST_AUTO_TEST_CASE(testFrozenDiscountCurve) {
+
+    BOOST_TEST_MESSAGE("Testing frozen daily snapshot of a term structure...");
+
+    CommonVars vars;
+
+    Handle<YieldTermStructure> curve(vars.termStructure);
+    Date reference = curve->referenceDate();
+    Date maxDate = reference + 25*Years;
+    FrozenDiscountCurve frozen(curve, maxDate);
+
+    BOOST_CHECK_EQUAL(frozen.referenceDate(), reference);
+    BOOST_CHECK_EQUAL(frozen.maxDate(), maxDate);
+    BOOST_CHECK_EQUAL(frozen.discounts().size(), Size(maxDate - reference + 1));
+
+    Real tolerance = 1.0e-12;
+    for (Date d = reference; d <= maxDate; ++d) {
+        DiscountFactor expected = curve->discount(d);
+        DiscountFactor calculated = frozen.discountOnSerial(d.serialNumber());
+        if (calculated != expected)
+            BOOST_ERROR("unable to reproduce discount factor on " << d
+                        << std::setprecision(16)
+                        << "\n    calculated: " << calculated
+                        << "\n    expected:   " << expected);
+        calculated = frozen.discount(d);
+        if (std::fabs(calculated - expected) > tolerance)
+            BOOST_ERROR("unable to reproduce discount factor on " << d
+                        << " through the term structure interface"
+                        << std::setprecision(16)
+                        << "\n    calculated: " << calculated
+                        << "\n    expected:   " << expected);
+    }
+
+    // between days, the forward rate is flat
+    Date d = reference + 1000;
+    Time t1 = frozen.timeFromReference(d), t2 = frozen.timeFromReference(d+1);
+    if (std::fabs(frozen.discount(t1) - frozen.discountOnSerial(d.serialNumber())) > tolerance)
+        BOOST_ERROR("unable to reproduce discount factor on " << d
+                    << " from its time"
+                    << std::setprecision(16)
+                    << "\n    calculated: " << frozen.discount(t1)
+                    << "\n    expected:   " << frozen.discountOnSerial(d.serialNumber()));
+    Rate expectedForward = frozen.forwardRate(d, d+1, curve->dayCounter(),
+                                              Continuous, NoFrequency).rate();
+    Rate calculatedForward = frozen.forwardRate(t1 + 0.25*(t2-t1), t1 + 0.75*(t2-t1),
+                                                Continuous, NoFrequency).rate();
+    if (std::fabs(calculatedForward - expectedForward) > 1.0e-10)
+        BOOST_ERROR("forward rate between days not flat:"
+                    << std::setprecision(12)
+                    << "\n    calculated: " << calculatedForward
+                    << "\n    expected:   " << expectedForward);
+
+    BOOST_CHECK_THROW(frozen.discountOnSerial((maxDate+1).serialNumber()), Error);
+    BOOST_CHECK_THROW(frozen.discountOnSerial((reference-1).serialNumber()), Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
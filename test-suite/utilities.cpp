@@ -116,9 +116,9 @@ namespace QuantLib {
 
     Real relativeError(Real x1, Real x2, Real reference) {
         if (reference != 0.0)
-            return std::fabs(x1-x2)/reference;
+            return fabs(x1-x2)/reference;
         else
             // fall back to absolute error
-            return std::fabs(x1-x2);
+            return fabs(x1-x2);
     }
 }
@@ -132,12 +132,12 @@ namespace QuantLib {
         // numeric integral of f^2
         Real I = h * (std::accumulate(f2.begin(),f2.end(),Real(0.0))
                       - 0.5*f2.front() - 0.5*f2.back());
-        return std::sqrt(I);
+        return sqrt(I);
     }
 
 
     inline Integer timeToDays(Time t, Integer daysPerYear = 360) {
-        return Integer(std::lround(t * daysPerYear));
+        return Integer(lround(t * daysPerYear));
     }
 
 